@@ -30,7 +30,8 @@ project (_AMD_SAMPLE_NAME)
     links { "$(VULKAN_SDK)/lib/vulkan-1.lib" }
     includedirs { "$(VULKAN_SDK)/include" }
 
-    defines { "_CRT_SECURE_NO_WARNINGS" }
+    -- The sample calls the C interface of the library directly (--library)
+    defines { "_CRT_SECURE_NO_WARNINGS", "VKMBCNT_STATIC" }
 
     filter "configurations:Debug"
         defines { "WIN32", "_DEBUG", "DEBUG", "_WINDOWS" }
@@ -42,3 +43,43 @@ project (_AMD_SAMPLE_NAME)
         flags { "LinkTimeOptimization", "Symbols", "FatalWarnings", "Unicode" }
         targetsuffix ("_Release" .. _AMD_VS_SUFFIX)
         optimize "On"
+
+-- The compaction engine with the C interface from VkMbcnt.h, for processes
+-- which keep one context around for many calls
+project (_AMD_SAMPLE_NAME .. "Lib")
+    kind "SharedLib"
+    language "C++"
+    location "../build"
+    filename (_AMD_SAMPLE_NAME .. "Lib" .. _AMD_VS_SUFFIX)
+    targetdir "../bin"
+    objdir "../build/Desktop%{_AMD_VS_SUFFIX}/%{cfg.platform}/Lib/%{cfg.buildcfg}"
+    warnings "Extra"
+    floatingpoint "Fast"
+
+    windowstarget (_AMD_WIN_SDK_VERSION)
+
+    files {
+        "../src/GpuCompaction.*",
+        "../src/PackedFormats.*",
+        "../src/Shaders.h",
+        "../src/Trace.*",
+        "../src/Utility.*",
+        "../src/VkMbcnt.*",
+        "../src/VulkanContext.*",
+        "../src/VulkanUtility.*"
+    }
+    links { "$(VULKAN_SDK)/lib/vulkan-1.lib" }
+    includedirs { "$(VULKAN_SDK)/include" }
+
+    defines { "_CRT_SECURE_NO_WARNINGS", "VKMBCNT_EXPORTS" }
+
+    filter "configurations:Debug"
+        defines { "WIN32", "_DEBUG", "DEBUG", "_WINDOWS", "_USRDLL" }
+        flags { "Symbols", "FatalWarnings", "Unicode" }
+        targetsuffix ("_Debug" .. _AMD_VS_SUFFIX)
+
+    filter "configurations:Release"
+        defines { "WIN32", "NDEBUG", "PROFILE", "_WINDOWS", "_USRDLL" }
+        flags { "LinkTimeOptimization", "Symbols", "FatalWarnings", "Unicode" }
+        targetsuffix ("_Release" .. _AMD_VS_SUFFIX)
+        optimize "On"
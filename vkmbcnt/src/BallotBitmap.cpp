@@ -0,0 +1,139 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "BallotBitmap.h"
+
+#include <algorithm>
+#include <cassert>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace AMD
+{
+///////////////////////////////////////////////////////////////////////////////
+std::uint32_t PopCount64(const std::uint64_t value)
+{
+#ifdef _MSC_VER
+    return static_cast<std::uint32_t> (__popcnt64(value));
+#else
+    return static_cast<std::uint32_t> (__builtin_popcountll(value));
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint32_t FindLowestBit64(const std::uint64_t value)
+{
+    assert(value != 0);
+
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return static_cast<std::uint32_t> (index);
+#else
+    return static_cast<std::uint32_t> (__builtin_ctzll(value));
+#endif
+}
+
+const std::size_t BallotBitmap::WaveSize;
+
+///////////////////////////////////////////////////////////////////////////////
+BallotBitmap::BallotBitmap(const std::uint64_t* masks,
+    const std::uint32_t* waveCounts, const std::size_t elementCount)
+    : elementCount_(elementCount)
+{
+    const std::size_t waveCount = (elementCount + WaveSize - 1) / WaveSize;
+
+    masks_.assign(masks, masks + waveCount);
+
+    // The kernel never sets bits past the end of the input, but be safe
+    // with bitmaps coming from elsewhere
+    if (elementCount % WaveSize)
+    {
+        masks_.back() &= (std::uint64_t(1) << (elementCount % WaveSize)) - 1;
+        waveCounts = nullptr;
+    }
+
+    prefix_.resize(waveCount + 1);
+    prefix_[0] = 0;
+
+    for (std::size_t wave = 0; wave < waveCount; ++wave)
+    {
+        const std::size_t count = waveCounts ? waveCounts[wave] : PopCount64(masks_[wave]);
+        prefix_[wave + 1] = prefix_[wave] + count;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t BallotBitmap::Rank(const std::size_t index) const
+{
+    assert(index <= elementCount_);
+
+    // There is no mask past the last wave if it is full
+    if (index == elementCount_)
+    {
+        return GetCount();
+    }
+
+    const std::size_t wave = index / WaveSize;
+    const std::size_t lane = index % WaveSize;
+
+    // Same as mbcnt: count the set bits below our lane
+    const std::uint64_t lowerLanes = (std::uint64_t(1) << lane) - 1;
+
+    return prefix_[wave] + PopCount64(masks_[wave] & lowerLanes);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t BallotBitmap::Select(const std::size_t n) const
+{
+    assert(n < GetCount());
+
+    // First wave whose prefix is larger than n, the one before contains
+    // the element we're looking for
+    const auto it = std::upper_bound(prefix_.begin(), prefix_.end(), n);
+    const std::size_t wave = static_cast<std::size_t> (it - prefix_.begin()) - 1;
+
+    std::uint64_t mask = masks_[wave];
+    for (std::size_t i = prefix_[wave]; i < n; ++i)
+    {
+        mask &= mask - 1;
+    }
+
+    return wave * WaveSize + FindLowestBit64(mask);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<float> BallotBitmap::Gather(const float* input) const
+{
+    std::vector<float> result;
+    result.reserve(GetCount());
+
+    ForEach([&](std::size_t index) {
+        result.push_back(input[index]);
+    });
+
+    return result;
+}
+}   // namespace AMD
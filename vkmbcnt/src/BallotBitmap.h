@@ -0,0 +1,120 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef AMD_VULKAN_SAMPLE_BALLOT_BITMAP_H_
+#define AMD_VULKAN_SAMPLE_BALLOT_BITMAP_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace AMD
+{
+///////////////////////////////////////////////////////////////////////////////
+std::uint32_t PopCount64(const std::uint64_t value);
+
+// Index of the lowest set bit. value must not be 0
+std::uint32_t FindLowestBit64(const std::uint64_t value);
+
+///////////////////////////////////////////////////////////////////////////////
+// Selection result stored as one ballot mask per wave of 64 elements
+// instead of the surviving values, as written by bitmap.comp. Bit i of mask
+// w is set if element w * 64 + i passed the predicate.
+//
+// Next to the masks we keep the exclusive prefix sum of the per-wave
+// counts, which makes Rank O(1) and Select O(log(waves)).
+class BallotBitmap
+{
+public:
+    static const std::size_t WaveSize = 64;
+
+    BallotBitmap() = default;
+
+    // waveCounts holds the number of set bits of every mask, as written by
+    // the kernel. If it is null the counts are computed from the masks
+    BallotBitmap(const std::uint64_t* masks, const std::uint32_t* waveCounts,
+        const std::size_t elementCount);
+
+    std::size_t GetElementCount() const
+    {
+        return elementCount_;
+    }
+
+    // Number of elements which passed
+    std::size_t GetCount() const
+    {
+        return prefix_.empty() ? 0 : prefix_.back();
+    }
+
+    const std::vector<std::uint64_t>& GetMasks() const
+    {
+        return masks_;
+    }
+
+    bool Test(const std::size_t index) const
+    {
+        return ((masks_[index / WaveSize] >> (index % WaveSize)) & 1) != 0;
+    }
+
+    // Number of elements before index which passed. This is the slot
+    // element index would have in the compacted output. index may be the
+    // element count, which gives GetCount ()
+    std::size_t Rank(const std::size_t index) const;
+
+    // Index of the n-th element (counting from 0) which passed, which is
+    // the inverse of Rank. n must be smaller than GetCount ()
+    std::size_t Select(const std::size_t n) const;
+
+    // Calls function (index) for every element which passed, in order
+    template <typename F>
+    void ForEach(F function) const
+    {
+        for (std::size_t wave = 0; wave < masks_.size(); ++wave)
+        {
+            std::uint64_t mask = masks_[wave];
+
+            while (mask)
+            {
+                function(wave * WaveSize + FindLowestBit64(mask));
+
+                // Clear the lowest set bit
+                mask &= mask - 1;
+            }
+        }
+    }
+
+    // Gathers the elements which passed from input, which is what the
+    // compaction kernel would have written
+    std::vector<float> Gather(const float* input) const;
+
+private:
+    std::vector<std::uint64_t> masks_;
+
+    // masks_.size () + 1 entries, prefix_ [w] is the number of set bits in
+    // the masks before w
+    std::vector<std::size_t> prefix_;
+    std::size_t elementCount_ = 0;
+};
+}   // namespace AMD
+
+#endif
@@ -0,0 +1,2403 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Benchmarks.h"
+
+#include "Bfs.h"
+#include "ColumnFilter.h"
+#include "ComputeGraph.h"
+#include "Culling.h"
+#include "GpuCompaction.h"
+#include "HostCompaction.h"
+#include "PackedFormats.h"
+#include "PredicateCompiler.h"
+#include "SparseMatrix.h"
+#include "SparseExtraction.h"
+#include "TextIndex.h"
+#include "TopK.h"
+#include "VkMbcnt.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+#ifdef max
+#undef max
+#endif
+
+#ifdef min
+#undef min
+#endif
+
+namespace AMD
+{
+namespace
+{
+///////////////////////////////////////////////////////////////////////////////
+// Runs function a few times and returns the fastest run, in seconds
+template <typename F>
+double MeasureBest(const int runs, F function)
+{
+    double best = 1e30;
+
+    for (int i = 0; i < runs; ++i)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        function();
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        best = std::min(best, std::chrono::duration<double>(end - start).count());
+    }
+
+    return best;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Positive and negative values in random order, so about half survive and
+// the branch predictor can't help
+void FillRandom(float* data, const std::size_t count)
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        data[i] = distribution(generator);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Checks the GPU result against the host one. Out of place, the GPU writes
+// waves in the order they finish, so only the sorted values have to match.
+// In place keeps the order
+bool VerifyGpuCompaction(GpuCompactor& compactor, const std::size_t elementCount)
+{
+    std::vector<float> input(elementCount);
+    FillRandom(input.data(), elementCount);
+
+    std::vector<float> expected;
+    std::copy_if(input.begin(), input.end(), std::back_inserter(expected),
+        [](float f) { return f > 0; });
+
+    std::vector<float> output(elementCount);
+    const std::size_t written = compactor.Compact(input.data(), elementCount,
+        output.data());
+    output.resize(written);
+
+    const std::size_t writtenInPlace = compactor.Compact(input.data(),
+        elementCount, input.data());
+    input.resize(writtenInPlace);
+
+    if (input != expected)
+    {
+        return false;
+    }
+
+    std::sort(expected.begin(), expected.end());
+    std::sort(output.begin(), output.end());
+
+    return output == expected;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Random elements of format in [-1, 1) after decoding. Tiny values are
+// avoided, the device may flush fp16 denormals to zero
+std::vector<uint8_t> CreatePackedInput(const InputFormat format,
+    const std::size_t count, const float scale)
+{
+    std::vector<uint8_t> result(count * GetElementSize(format));
+
+    std::vector<float> values(count);
+    FillRandom(values.data(), count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        float value = values[i];
+        if (std::abs(value) < 1e-3f)
+        {
+            value = 0.5f;
+        }
+
+        switch (format)
+        {
+        case InputFormat::Float16:
+            reinterpret_cast<uint16_t*> (result.data())[i] = FloatToHalf(value);
+            break;
+        case InputFormat::BFloat16:
+            reinterpret_cast<uint16_t*> (result.data())[i] = FloatToBFloat16(value);
+            break;
+        case InputFormat::Int8:
+            reinterpret_cast<int8_t*> (result.data())[i] =
+                static_cast<int8_t> (value / scale);
+            break;
+        case InputFormat::Int16:
+            reinterpret_cast<int16_t*> (result.data())[i] =
+                static_cast<int16_t> (value / scale);
+            break;
+        default:
+            reinterpret_cast<float*> (result.data())[i] = value;
+            break;
+        }
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Undirected R-MAT graph with the Graph500 parameters: 2^scale vertices and
+// edgeFactor * 2^scale edges, stored in both directions. Every edge picks
+// one quadrant of the adjacency matrix per bit, which gives a few vertices
+// with huge degrees and many with small ones. Self loops and duplicate
+// edges are dropped
+CsrGraph CreateRmatGraph(const int scale, const int edgeFactor)
+{
+    const uint32_t vertexCount = 1u << scale;
+    const std::size_t edgeCount = static_cast<std::size_t> (edgeFactor) * vertexCount;
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+
+    std::vector<uint64_t> edges;
+    edges.reserve(2 * edgeCount);
+
+    for (std::size_t i = 0; i < edgeCount; ++i)
+    {
+        uint32_t from = 0, to = 0;
+
+        for (int bit = 0; bit < scale; ++bit)
+        {
+            const float r = distribution(generator);
+            const uint32_t row = (r >= 0.57f + 0.19f) ? 1 : 0;
+            const uint32_t column = ((r >= 0.57f && r < 0.57f + 0.19f) || r >= 0.95f) ? 1 : 0;
+
+            from |= row << bit;
+            to |= column << bit;
+        }
+
+        if (from != to)
+        {
+            edges.push_back(static_cast<uint64_t> (from) << 32 | to);
+            edges.push_back(static_cast<uint64_t> (to) << 32 | from);
+        }
+    }
+
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+    CsrGraph result;
+    result.rowOffsets.assign(vertexCount + 1, 0);
+    result.columns.resize(edges.size());
+
+    for (std::size_t i = 0; i < edges.size(); ++i)
+    {
+        ++result.rowOffsets[(edges[i] >> 32) + 1];
+        result.columns[i] = static_cast<uint32_t> (edges[i]);
+    }
+
+    for (uint32_t v = 0; v < vertexCount; ++v)
+    {
+        result.rowOffsets[v + 1] += result.rowOffsets[v];
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// CSV rows of about byteCount bytes in total: ids, names, quoted comments
+// with delimiters, escaped quotes and line breaks inside, and prices
+std::string CreateCsvText(const std::size_t byteCount)
+{
+    static const char* const words[] = {
+        "alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf", "hotel"
+    };
+
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> wordDistribution(0, 7);
+    std::uniform_int_distribution<int> shapeDistribution(0, 3);
+
+    std::string result;
+    result.reserve(byteCount + 256);
+
+    for (std::size_t row = 0; result.size() < byteCount; ++row)
+    {
+        result += std::to_string(row);
+        result += ',';
+        result += words[wordDistribution(generator)];
+        result += ",\"";
+
+        for (int word = 0; word < 6; ++word)
+        {
+            result += words[wordDistribution(generator)];
+
+            switch (shapeDistribution(generator))
+            {
+            case 0:
+                result += ", ";
+                break;
+            case 1:
+                result += " \"\"quoted\"\" ";
+                break;
+            case 2:
+                result += "\n";
+                break;
+            default:
+                result += ' ';
+                break;
+            }
+        }
+
+        result += "\",";
+        result += std::to_string(row % 1000);
+        result += ".99\n";
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// One byte at a time, the way a hand written tokenizer finds the
+// structural characters. Same interface as IndexTextOnHost
+std::size_t IndexTextScalar(const char* text, const std::size_t size,
+    const TextDialect& dialect, uint64_t* offsets,
+    const std::size_t outputCapacity)
+{
+    std::size_t count = 0;
+    bool inQuote = false;
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        const char c = text[i];
+        bool structural = false;
+
+        if (c == dialect.quote)
+        {
+            inQuote = !inQuote;
+            structural = true;
+        }
+        else if (!inQuote && (c == dialect.delimiter || c == dialect.newline))
+        {
+            structural = true;
+        }
+
+        if (structural)
+        {
+            if (count < outputCapacity)
+            {
+                offsets[count] = i;
+            }
+
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Like a pruned weight matrix: about 10% of the elements in [-1, 1), the
+// rest exactly 0. The padding between rows is set to a large value, so
+// reading it shows up in the result
+void FillPrunedMatrix(float* matrix, const std::size_t rowCount,
+    const std::size_t columnCount, const std::size_t rowPitch)
+{
+    // A plain LCG, mt19937 takes too long for a few hundred million values
+    uint64_t state = 42;
+
+    for (std::size_t row = 0; row < rowCount; ++row)
+    {
+        float* rowData = matrix + row * rowPitch;
+
+        for (std::size_t column = 0; column < columnCount; ++column)
+        {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            const uint32_t bits = static_cast<uint32_t> (state >> 32);
+
+            rowData[column] = ((bits & 0xFF) < 26)
+                ? (bits >> 8) * (2.0f / 16777216.0f) - 1.0f : 0.0f;
+        }
+
+        std::fill(rowData + columnCount, rowData + rowPitch, 1000.0f);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool IsSameCsr(const CsrMatrix& a, const CsrMatrix& b)
+{
+    return a.columnCount == b.columnCount && a.rowOffsets == b.rowOffsets
+        && a.columns == b.columns && a.values == b.values;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Converts csr back and compares it with matrix, in which the elements
+// with a magnitude up to threshold must have become 0
+bool CheckCsrRoundTrip(const CsrMatrix& csr, const float* matrix,
+    const std::size_t rowPitch, const float threshold)
+{
+    const std::size_t rowCount = csr.GetRowCount();
+    const std::size_t columnCount = csr.columnCount;
+
+    std::vector<float> roundTrip(rowCount * columnCount);
+    CsrToDense(csr, roundTrip.data(), columnCount);
+
+    for (std::size_t row = 0; row < rowCount; ++row)
+    {
+        for (std::size_t column = 0; column < columnCount; ++column)
+        {
+            const float value = matrix[row * rowPitch + column];
+            const float expected = (std::abs(value) > threshold) ? value : 0.0f;
+
+            if (roundTrip[row * columnCount + column] != expected)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+}   // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+int RunHostCompactionBenchmark(const std::size_t elementCount,
+    int maxThreadCount)
+{
+    if (maxThreadCount <= 0)
+    {
+        maxThreadCount = std::max(1, static_cast<int> (std::thread::hardware_concurrency()));
+    }
+
+    std::vector<int> threadCounts;
+    for (int i = 1; i < maxThreadCount; i *= 2)
+    {
+        threadCounts.push_back(i);
+    }
+    threadCounts.push_back(maxThreadCount);
+
+    std::vector<float> input(elementCount);
+    FillRandom(input.data(), elementCount);
+
+    std::vector<float> expected;
+    expected.reserve(elementCount);
+    const double copyIfTime = MeasureBest(3, [&]() {
+        expected.clear();
+        std::copy_if(input.begin(), input.end(), std::back_inserter(expected),
+            [](float f) { return f > 0; });
+    });
+
+    // Unordered compaction writes the chunks in the order they finish, so
+    // only the sorted values have to match
+    std::vector<float> sortedExpected(expected);
+    std::sort(sortedExpected.begin(), sortedExpected.end());
+
+    // Read the input once and write the survivors
+    const double bytes = static_cast<double> (elementCount + expected.size()) * sizeof(float);
+
+    std::cout << "Host compaction of " << elementCount << " floats, "
+        << expected.size() << " survive\n";
+    std::cout << "std::copy_if: " << std::fixed << std::setprecision(2)
+        << bytes / copyIfTime / 1e9 << " GB/s\n\n";
+    std::cout << "threads   ordered GB/s  speedup   unordered GB/s  speedup\n";
+
+    double orderedBase = 0, unorderedBase = 0;
+
+    for (const auto threadCount : threadCounts)
+    {
+        HostCompactor compactor(threadCount);
+        auto output = compactor.AllocateBuffer(elementCount);
+        std::size_t written = 0;
+
+        const double orderedTime = MeasureBest(5, [&]() {
+            written = compactor.Compact(input.data(), elementCount,
+                output.get(), CompactionOrder::Ordered);
+        });
+
+        if (written != expected.size()
+            || !std::equal(expected.begin(), expected.end(), output.get()))
+        {
+            std::cerr << "Ordered host compaction produced a wrong result\n";
+            return 1;
+        }
+
+        const double unorderedTime = MeasureBest(5, [&]() {
+            written = compactor.Compact(input.data(), elementCount,
+                output.get(), CompactionOrder::Unordered);
+        });
+
+        std::sort(output.get(), output.get() + written);
+
+        if (written != expected.size()
+            || !std::equal(sortedExpected.begin(), sortedExpected.end(), output.get()))
+        {
+            std::cerr << "Unordered host compaction produced a wrong result\n";
+            return 1;
+        }
+
+        if (threadCount == 1)
+        {
+            orderedBase = orderedTime;
+            unorderedBase = unorderedTime;
+        }
+
+        std::cout << std::setw(7) << threadCount
+            << std::setw(18) << bytes / orderedTime / 1e9
+            << std::setw(9) << orderedBase / orderedTime << "x"
+            << std::setw(17) << bytes / unorderedTime / 1e9
+            << std::setw(9) << unorderedBase / unorderedTime << "x\n";
+    }
+
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int RunDispatchBenchmark(const std::size_t elementCount)
+{
+    auto context = VulkanContext::Get();
+    VkDevice device = context->GetDevice();
+
+    GpuCompactor compactor(context);
+
+    if (!VerifyGpuCompaction(compactor, elementCount))
+    {
+        std::cerr << "GPU compaction produced a wrong result\n";
+        return 1;
+    }
+
+    const auto& memoryTypes = context->GetCapabilities().memoryTypes;
+    Buffer buffers[3];
+    buffers[0] = CreateBuffer(device, memoryTypes, elementCount * sizeof(float),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    buffers[1] = CreateBuffer(device, memoryTypes, elementCount * sizeof(float),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    buffers[2] = CreateBuffer(device, memoryTypes, sizeof(uint32_t),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    VkCommandPoolCreateInfo commandPoolCreateInfo = {};
+    commandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    commandPoolCreateInfo.queueFamilyIndex = context->GetQueueFamilyIndex();
+    commandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+
+    VkCommandPool commandPool;
+    vkCreateCommandPool(device, &commandPoolCreateInfo, nullptr, &commandPool);
+
+    VkCommandBufferAllocateInfo commandBufferAllocateInfo = {};
+    commandBufferAllocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    commandBufferAllocateInfo.commandBufferCount = 1;
+    commandBufferAllocateInfo.commandPool = commandPool;
+    commandBufferAllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+
+    VkCommandBuffer commandBuffer;
+    vkAllocateCommandBuffers(device, &commandBufferAllocateInfo, &commandBuffer);
+
+    CompactionParameters parameters;
+    parameters.elementCount = static_cast<uint32_t> (elementCount);
+    parameters.threshold = 0;
+
+    // Only host time is measured: a batch is recorded, including whatever
+    // cleanup the binding needs afterwards, but never submitted
+    const int BatchSize = GpuCompactor::MaxDescriptorSets;
+
+    auto measure = [&](const std::function<void()>& recordOne,
+        const std::function<void()>& cleanup) {
+        return MeasureBest(5, [&]() {
+            VkCommandBufferBeginInfo commandBufferBeginInfo = {};
+            commandBufferBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+            commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            vkBeginCommandBuffer(commandBuffer, &commandBufferBeginInfo);
+
+            for (int i = 0; i < BatchSize; ++i)
+            {
+                recordOne();
+            }
+
+            vkEndCommandBuffer(commandBuffer);
+            cleanup();
+        }) / BatchSize * 1e9;
+    };
+
+    std::cout << "Host cost of recording one compaction dispatch of "
+        << elementCount << " elements\n\n";
+    std::cout << "binding                         ns/dispatch\n";
+    std::cout << std::fixed << std::setprecision(0);
+
+    // What Run () does: a new pool and set for every dispatch
+    std::vector<VkDescriptorPool> pools;
+    pools.reserve(BatchSize);
+
+    const double perDispatchPoolTime = measure([&]() {
+        VkDescriptorPool pool;
+        VkDescriptorSet descriptorSet = CreateStorageBufferDescriptorSet(device,
+            compactor.GetDescriptorSetLayout(), buffers, 3, &pool);
+        pools.push_back(pool);
+
+        compactor.Record(commandBuffer, buffers, descriptorSet, parameters);
+    }, [&]() {
+        for (auto pool : pools)
+        {
+            vkDestroyDescriptorPool(device, pool, nullptr);
+        }
+        pools.clear();
+    });
+
+    std::cout << std::left << std::setw(32) << "pool per dispatch (Run)"
+        << std::right << std::setw(11) << perDispatchPoolTime << "\n";
+
+    const struct
+    {
+        BindingMode mode;
+        const char* name;
+    } modes[] = {
+        { BindingMode::DescriptorSet, "descriptor set" },
+        { BindingMode::UpdateTemplate, "update template" },
+        { BindingMode::PushDescriptor, "push descriptor" }
+    };
+
+    for (const auto& mode : modes)
+    {
+        std::cout << std::left << std::setw(32) << mode.name << std::right;
+
+        if (!compactor.IsSupported(mode.mode))
+        {
+            std::cout << std::setw(11) << "n/a" << "\n";
+            continue;
+        }
+
+        const double time = measure([&]() {
+            compactor.Record(commandBuffer, buffers, parameters, mode.mode);
+        }, [&]() {
+            compactor.ResetDescriptors();
+        });
+
+        std::cout << std::setw(11) << time
+            << "  (" << std::setprecision(1) << perDispatchPoolTime / time
+            << "x)\n" << std::setprecision(0);
+    }
+
+    vkDestroyCommandPool(device, commandPool, nullptr);
+
+    for (const auto& buffer : buffers)
+    {
+        DestroyBuffer(device, buffer);
+    }
+
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int RunFormatBenchmark(const std::size_t elementCount)
+{
+    GpuCompactor compactor;
+
+    std::cout << "GPU compaction of " << elementCount
+        << " elements with packed input, output packed / widened to float\n\n";
+    std::cout << "format  upload MB  packed ms  widened ms  speedup vs fp32\n";
+    std::cout << std::fixed;
+
+    double float32Time = 0;
+
+    for (int i = 0; i < InputFormatCount; ++i)
+    {
+        const auto format = static_cast<InputFormat> (i);
+        const float scale = (format == InputFormat::Int8) ? 1.0f / 127
+            : (format == InputFormat::Int16) ? 1.0f / 32767 : 1.0f;
+
+        const auto input = CreatePackedInput(format, elementCount, scale);
+
+        std::vector<float> expected;
+        for (std::size_t j = 0; j < elementCount; ++j)
+        {
+            const float value = DecodeElement(input.data(), j, format, scale);
+            if (value > 0)
+            {
+                expected.push_back(value);
+            }
+        }
+        std::sort(expected.begin(), expected.end());
+
+        std::vector<uint8_t> packed(input.size());
+        std::vector<float> widened(elementCount);
+        std::size_t packedCount = 0, widenedCount = 0;
+
+        const double packedTime = MeasureBest(3, [&]() {
+            packedCount = compactor.CompactPacked(input.data(), elementCount,
+                format, packed.data(), false, 0, scale);
+        });
+
+        const double widenedTime = MeasureBest(3, [&]() {
+            widenedCount = compactor.CompactPacked(input.data(), elementCount,
+                format, widened.data(), true, 0, scale);
+        });
+
+        // Waves are written in the order they finish, compare sorted values
+        std::vector<float> packedValues(packedCount);
+        for (std::size_t j = 0; j < packedCount; ++j)
+        {
+            packedValues[j] = DecodeElement(packed.data(), j, format, scale);
+        }
+        std::sort(packedValues.begin(), packedValues.end());
+
+        widened.resize(widenedCount);
+        std::sort(widened.begin(), widened.end());
+
+        if (packedValues != expected || widened != expected)
+        {
+            std::cerr << "GPU compaction of " << GetInputFormatName(format)
+                << " input produced a wrong result\n";
+            return 1;
+        }
+
+        if (format == InputFormat::Float32)
+        {
+            float32Time = packedTime;
+        }
+
+        std::cout << std::left << std::setw(6) << GetInputFormatName(format)
+            << std::right << std::setprecision(1)
+            << std::setw(11) << input.size() / 1e6
+            << std::setprecision(2)
+            << std::setw(11) << packedTime * 1e3
+            << std::setw(12) << widenedTime * 1e3
+            << std::setw(16) << float32Time / packedTime << "x\n";
+    }
+
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int RunTopKBenchmark(const std::size_t elementCount, const std::size_t k)
+{
+    if (elementCount == 0 || k == 0)
+    {
+        std::cerr << "Top-K needs at least one element and k > 0\n";
+        return 1;
+    }
+
+    // Quantized so there are plenty of ties to break
+    std::vector<float> input(elementCount);
+    FillRandom(input.data(), elementCount);
+    for (auto& value : input)
+    {
+        value = std::floor(value * 4096) / 4096;
+    }
+
+    TopKSelector selector;
+
+    std::vector<float> values(k);
+    std::vector<uint32_t> indices(k);
+    std::size_t selected = 0;
+
+    const double gpuTime = MeasureBest(3, [&]() {
+        selected = selector.Select(input.data(), elementCount, k,
+            values.data(), indices.data());
+    });
+
+    // Reference: largest values first, lower index first among equal values
+    std::vector<uint32_t> expected(elementCount);
+    for (std::size_t i = 0; i < elementCount; ++i)
+    {
+        expected[i] = static_cast<uint32_t> (i);
+    }
+
+    const std::size_t expectedCount = std::min(k, elementCount);
+    const double partialSortTime = MeasureBest(3, [&]() {
+        std::nth_element(expected.begin(), expected.begin() + expectedCount - 1,
+            expected.end(), [&](uint32_t a, uint32_t b) {
+                return input[a] > input[b] || (input[a] == input[b] && a < b);
+            });
+    });
+
+    std::vector<float> sorted;
+    const double sortTime = MeasureBest(3, [&]() {
+        sorted = input;
+        std::sort(sorted.begin(), sorted.end());
+    });
+
+    expected.resize(expectedCount);
+    std::sort(expected.begin(), expected.end());
+    indices.resize(selected);
+    std::sort(indices.begin(), indices.end());
+
+    if (indices != expected)
+    {
+        std::cerr << "GPU top-K selected the wrong elements\n";
+        return 1;
+    }
+
+    std::cout << "Top " << k << " of " << elementCount << " floats, "
+        << selector.GetLastPassCount() << " histogram passes\n";
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "GPU radix select:  " << gpuTime * 1e3 << " ms\n";
+    std::cout << "std::nth_element:  " << partialSortTime * 1e3 << " ms\n";
+    std::cout << "std::sort:         " << sortTime * 1e3 << " ms\n";
+
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int RunFilterBenchmark(const std::string& expression, const std::size_t rowCount)
+{
+    const std::vector<std::string> columnNames = { "a", "b", "c" };
+
+    Predicate predicate;
+    std::string error;
+    if (!Predicate::Parse(expression, columnNames, &predicate, &error))
+    {
+        std::cerr << "Invalid filter: " << error << "\n";
+        return 1;
+    }
+
+    if (rowCount == 0)
+    {
+        std::cerr << "Filtering needs at least one row\n";
+        return 1;
+    }
+
+    std::vector<float> a(rowCount), b(rowCount), c(rowCount);
+    {
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<float> aDistribution(0.0f, 8.0f);
+        std::uniform_int_distribution<int> bDistribution(0, 9);
+        std::uniform_real_distribution<float> cDistribution(-1.0f, 1.0f);
+
+        for (std::size_t i = 0; i < rowCount; ++i)
+        {
+            a[i] = aDistribution(generator);
+            b[i] = static_cast<float> (bDistribution(generator));
+            c[i] = cDistribution(generator);
+        }
+    }
+
+    const float* const columns[] = { a.data(), b.data(), c.data() };
+
+    ColumnFilter filter;
+    if (!filter.IsSupported(predicate))
+    {
+        std::cerr << "Too many columns for this device\n";
+        return 1;
+    }
+
+    const double compileTime = MeasureBest(1, [&]() {
+        filter.Prepare(predicate);
+    });
+
+    std::vector<uint32_t> output(rowCount);
+    std::size_t matched = 0;
+
+    const double gpuTime = MeasureBest(3, [&]() {
+        matched = filter.Filter(predicate, columns, rowCount, output.data());
+    });
+
+    std::vector<uint32_t> expected;
+    const double hostTime = MeasureBest(3, [&]() {
+        expected.clear();
+        for (std::size_t i = 0; i < rowCount; ++i)
+        {
+            if (predicate.Evaluate(columns, i))
+            {
+                expected.push_back(static_cast<uint32_t> (i));
+            }
+        }
+    });
+
+    output.resize(matched);
+    std::sort(output.begin(), output.end());
+
+    if (output != expected)
+    {
+        std::cerr << "GPU filter matched the wrong rows\n";
+        return 1;
+    }
+
+    std::cout << predicate.GetCanonicalForm() << ": " << matched << " of "
+        << rowCount << " rows, " << filter.GetCachedPipelineCount()
+        << " cached pipeline(s)\n";
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Compile:           " << compileTime * 1e3 << " ms\n";
+    std::cout << "GPU filter:        " << gpuTime * 1e3 << " ms\n";
+    std::cout << "Host interpreter:  " << hostTime * 1e3 << " ms\n";
+
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int RunGraphBenchmark(const std::size_t elementCount, const int stageCount)
+{
+    if (elementCount == 0 || stageCount <= 0)
+    {
+        std::cerr << "The graph needs at least one element and one stage\n";
+        return 1;
+    }
+
+    auto context = VulkanContext::Get();
+    VkDevice device = context->GetDevice();
+    const auto& memoryTypes = context->GetCapabilities().memoryTypes;
+
+    GpuCompactor compactor(context);
+    const BindingMode mode = compactor.GetBestBindingMode();
+
+    const int ChainCount = 2;
+    const VkDeviceSize dataSize = elementCount * sizeof(float);
+
+    // Two independent chains, each input split into two halves of one
+    // random sequence
+    std::vector<float> input(ChainCount * elementCount);
+    FillRandom(input.data(), input.size());
+
+    Buffer inputs[ChainCount], outputs[ChainCount], counters[ChainCount];
+    for (int chain = 0; chain < ChainCount; ++chain)
+    {
+        inputs[chain] = CreateBuffer(device, memoryTypes, dataSize,
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+        outputs[chain] = CreateBuffer(device, memoryTypes, dataSize,
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+        counters[chain] = CreateBuffer(device, memoryTypes, sizeof(uint32_t),
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+        void* mapping = MapBuffer(device, inputs[chain]);
+        std::memcpy(mapping, input.data() + chain * elementCount, dataSize);
+        UnmapBuffer(device, inputs[chain]);
+    }
+
+    // Every stage keeps the elements above a higher threshold. The kernel
+    // reads all elementCount elements of the previous stage, so the data
+    // is cleared to -inf first, which no threshold lets through
+    const uint32_t NegativeInfinity = 0xFF800000;
+    const float thresholdStep = 0.8f / stageCount;
+
+    ComputeGraph graph(context);
+    std::vector<ComputeGraph::RecordFunction> passes;
+
+    auto addPass = [&](const char* name,
+        const std::vector<ComputeGraph::BufferUse>& uses,
+        ComputeGraph::RecordFunction record) {
+        graph.AddPass(name, uses, record);
+        passes.push_back(record);
+    };
+
+    for (int chain = 0; chain < ChainCount; ++chain)
+    {
+        ComputeGraph::BufferHandle previous = graph.ImportBuffer(inputs[chain]);
+
+        for (int stage = 0; stage < stageCount; ++stage)
+        {
+            const bool last = stage + 1 == stageCount;
+            const ComputeGraph::BufferHandle data = last
+                ? graph.ImportBuffer(outputs[chain]) : graph.CreateTransientBuffer(dataSize);
+            const ComputeGraph::BufferHandle counter = last
+                ? graph.ImportBuffer(counters[chain]) : graph.CreateTransientBuffer(sizeof(uint32_t));
+
+            addPass("Clear", {
+                { data, BufferAccess::TransferWrite },
+                { counter, BufferAccess::TransferWrite }
+            }, [=](VkCommandBuffer commandBuffer, const ComputeGraph& compiled) {
+                vkCmdFillBuffer(commandBuffer, compiled.GetBuffer(data).buffer,
+                    0, VK_WHOLE_SIZE, NegativeInfinity);
+                vkCmdFillBuffer(commandBuffer, compiled.GetBuffer(counter).buffer,
+                    0, VK_WHOLE_SIZE, 0);
+            });
+
+            CompactionParameters parameters;
+            parameters.elementCount = static_cast<uint32_t> (elementCount);
+            parameters.threshold = stage * thresholdStep;
+
+            addPass("Compact", {
+                { previous, BufferAccess::ShaderRead },
+                { data, BufferAccess::ShaderWrite },
+                { counter, BufferAccess::ShaderWrite }
+            }, [=, &compactor](VkCommandBuffer commandBuffer, const ComputeGraph& compiled) {
+                const Buffer buffers[3] = {
+                    compiled.GetBuffer(previous), compiled.GetBuffer(data),
+                    compiled.GetBuffer(counter)
+                };
+                compactor.Record(commandBuffer, buffers, parameters, mode, false);
+            });
+
+            previous = data;
+        }
+    }
+
+    graph.Compile();
+
+    VkCommandPoolCreateInfo commandPoolCreateInfo = {};
+    commandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    commandPoolCreateInfo.queueFamilyIndex = context->GetQueueFamilyIndex();
+
+    VkCommandPool commandPool;
+    vkCreateCommandPool(device, &commandPoolCreateInfo, nullptr, &commandPool);
+
+    VkCommandBufferAllocateInfo commandBufferAllocateInfo = {};
+    commandBufferAllocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    commandBufferAllocateInfo.commandBufferCount = 2;
+    commandBufferAllocateInfo.commandPool = commandPool;
+    commandBufferAllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+
+    VkCommandBuffer commandBuffers[2];
+    vkAllocateCommandBuffers(device, &commandBufferAllocateInfo, commandBuffers);
+
+    VkMemoryBarrier fullBarrier = {};
+    fullBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    fullBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+    fullBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT
+        | VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_HOST_READ_BIT;
+    const VkPipelineStageFlags allStages = VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT
+        | VK_PIPELINE_STAGE_TRANSFER_BIT;
+
+    // The graph, and the same passes in program order with a full barrier
+    // between every two of them, as if each was recorded on its own. Both
+    // use the graph's buffers, the full barriers make the aliasing safe
+    for (int i = 0; i < 2; ++i)
+    {
+        VkCommandBufferBeginInfo commandBufferBeginInfo = {};
+        commandBufferBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        vkBeginCommandBuffer(commandBuffers[i], &commandBufferBeginInfo);
+
+        if (i == 0)
+        {
+            graph.Record(commandBuffers[i]);
+        }
+        else
+        {
+            for (std::size_t pass = 0; pass < passes.size(); ++pass)
+            {
+                if (pass > 0)
+                {
+                    vkCmdPipelineBarrier(commandBuffers[i], allStages, allStages, 0,
+                        1, &fullBarrier, 0, nullptr, 0, nullptr);
+                }
+
+                passes[pass](commandBuffers[i], graph);
+            }
+        }
+
+        vkCmdPipelineBarrier(commandBuffers[i], allStages, VK_PIPELINE_STAGE_HOST_BIT, 0,
+            1, &fullBarrier, 0, nullptr, 0, nullptr);
+        vkEndCommandBuffer(commandBuffers[i]);
+    }
+
+    VkFenceCreateInfo fenceCreateInfo = {};
+    fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+    VkFence fence;
+    vkCreateFence(device, &fenceCreateInfo, nullptr, &fence);
+
+    auto run = [&](VkCommandBuffer commandBuffer) {
+        VkSubmitInfo submitInfo = {};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &commandBuffer;
+
+        context->Submit(submitInfo, fence);
+        vkWaitForFences(device, 1, &fence, VK_TRUE, UINT64_MAX);
+        vkResetFences(device, 1, &fence);
+    };
+
+    // Out of place, the order of the survivors depends on the GPU
+    auto verify = [&]() {
+        const float lastThreshold = (stageCount - 1) * thresholdStep;
+
+        for (int chain = 0; chain < ChainCount; ++chain)
+        {
+            std::vector<float> expected;
+            std::copy_if(input.begin() + chain * elementCount,
+                input.begin() + (chain + 1) * elementCount,
+                std::back_inserter(expected),
+                [=](float f) { return f > lastThreshold; });
+            std::sort(expected.begin(), expected.end());
+
+            const std::size_t count = *static_cast<const uint32_t*> (
+                MapBuffer(device, counters[chain]));
+            vkUnmapMemory(device, counters[chain].memory);
+
+            if (count != expected.size())
+            {
+                return false;
+            }
+
+            const float* mapping = static_cast<const float*> (MapBuffer(device, outputs[chain]));
+            std::vector<float> output(mapping, mapping + count);
+            vkUnmapMemory(device, outputs[chain].memory);
+
+            std::sort(output.begin(), output.end());
+            if (output != expected)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    };
+
+    const double graphTime = MeasureBest(5, [&]() { run(commandBuffers[0]); });
+    const bool graphCorrect = verify();
+    const double serialTime = MeasureBest(5, [&]() { run(commandBuffers[1]); });
+    const bool serialCorrect = verify();
+
+    vkDestroyFence(device, fence, nullptr);
+    vkDestroyCommandPool(device, commandPool, nullptr);
+    compactor.ResetDescriptors();
+
+    for (int chain = 0; chain < ChainCount; ++chain)
+    {
+        DestroyBuffer(device, inputs[chain]);
+        DestroyBuffer(device, outputs[chain]);
+        DestroyBuffer(device, counters[chain]);
+    }
+
+    if (!graphCorrect || !serialCorrect)
+    {
+        std::cerr << "The compute graph produced a wrong result\n";
+        return 1;
+    }
+
+    const int serialBarrierCount = static_cast<int> (passes.size()) - 1;
+
+    std::cout << ChainCount << " chains of " << stageCount << " compactions of "
+        << elementCount << " elements\n\n";
+    std::cout << "                  passes  levels  barriers  transient MiB   ms\n";
+    std::cout << std::fixed;
+    std::cout << std::left << std::setw(18) << "compute graph" << std::right
+        << std::setw(6) << graph.GetPassCount()
+        << std::setw(8) << graph.GetLevelCount()
+        << std::setw(10) << graph.GetBarrierCount()
+        << std::setw(15) << std::setprecision(1) << graph.GetTransientMemorySize() / 1048576.0
+        << std::setw(7) << std::setprecision(2) << graphTime * 1e3 << "\n";
+    std::cout << std::left << std::setw(18) << "barrier per pass" << std::right
+        << std::setw(6) << passes.size()
+        << std::setw(8) << passes.size()
+        << std::setw(10) << serialBarrierCount
+        << std::setw(15) << std::setprecision(1) << graph.GetUnaliasedTransientMemorySize() / 1048576.0
+        << std::setw(7) << std::setprecision(2) << serialTime * 1e3 << "\n";
+
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int RunOutputSizingBenchmark(const std::size_t elementCount, const float threshold)
+{
+    if (elementCount == 0)
+    {
+        std::cerr << "Compaction needs at least one element\n";
+        return 1;
+    }
+
+    std::vector<float> input(elementCount);
+    FillRandom(input.data(), elementCount);
+
+    std::vector<float> expected;
+    std::copy_if(input.begin(), input.end(), std::back_inserter(expected),
+        [=](float f) { return f > threshold; });
+    std::sort(expected.begin(), expected.end());
+
+    // The bounded run guesses half the real count, so it always overflows
+    // once and has to retry
+    const std::size_t guess = expected.size() / 2;
+
+    std::cout << "Compacting " << elementCount << " elements, "
+        << expected.size() << " above " << threshold << "\n\n";
+    std::cout << "sizing                 output MiB   submissions      ms\n";
+    std::cout << std::fixed;
+
+    const char* names[] = { "worst case", "count first", "bounded + retry" };
+
+    for (int policy = 0; policy < 3; ++policy)
+    {
+        // A fresh compactor each, it keeps its buffers between calls
+        GpuCompactor compactor;
+        std::vector<float> output(elementCount);
+        std::size_t written = 0;
+        int submissions = 0;
+
+        const double time = MeasureBest(3, [&]() {
+            if (policy == 0)
+            {
+                written = compactor.Compact(input.data(), elementCount,
+                    output.data(), threshold, OutputSizing::WorstCase);
+                submissions = 2;
+            }
+            else if (policy == 1)
+            {
+                written = compactor.Compact(input.data(), elementCount,
+                    output.data(), threshold, OutputSizing::CountFirst);
+                submissions = 3;
+            }
+            else
+            {
+                // The readback of what did fit is wasted, a real caller
+                // would keep it and only ask for the rest
+                written = compactor.CompactBounded(input.data(), elementCount,
+                    output.data(), guess, threshold);
+                submissions = 2;
+
+                if (written > guess)
+                {
+                    written = compactor.CompactBounded(input.data(), elementCount,
+                        output.data(), written, threshold);
+                    submissions += 2;
+                }
+            }
+        });
+
+        output.resize(written);
+        std::sort(output.begin(), output.end());
+
+        if (output != expected)
+        {
+            std::cerr << names[policy] << " produced a wrong result\n";
+            return 1;
+        }
+
+        std::cout << std::left << std::setw(22) << names[policy] << std::right
+            << std::setw(11) << std::setprecision(2)
+            << compactor.GetOutputBufferSize() / 1048576.0
+            << std::setw(14) << submissions
+            << std::setw(8) << time * 1e3 << "\n";
+    }
+
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int RunBfsBenchmark(const int scale, const int edgeFactor)
+{
+    if (scale <= 0 || scale > 30 || edgeFactor <= 0)
+    {
+        std::cerr << "BFS needs a scale in [1, 30] and an edge factor > 0\n";
+        return 1;
+    }
+
+    const CsrGraph graph = CreateRmatGraph(scale, edgeFactor);
+    const uint32_t vertexCount = graph.GetVertexCount();
+
+    BreadthFirstSearch search;
+    search.SetGraph(graph);
+
+    // Sources with at least one edge, R-MAT leaves many vertices isolated
+    std::vector<uint32_t> sources;
+    {
+        std::mt19937 generator(7);
+        std::uniform_int_distribution<uint32_t> distribution(0, vertexCount - 1);
+
+        for (int attempt = 0; attempt < 1000 && sources.size() < 8; ++attempt)
+        {
+            const uint32_t vertex = distribution(generator);
+            if (graph.rowOffsets[vertex + 1] > graph.rowOffsets[vertex])
+            {
+                sources.push_back(vertex);
+            }
+        }
+    }
+
+    if (sources.empty())
+    {
+        std::cerr << "The graph has no edges\n";
+        return 1;
+    }
+
+    std::vector<uint32_t> levels(vertexCount), expected(vertexCount);
+    std::vector<uint32_t> queue(vertexCount);
+    double gpuTime = 0, hostTime = 0;
+    std::size_t traversedEdges = 0;
+    uint32_t maxLevelCount = 0;
+    int submissions = 0;
+
+    for (const uint32_t source : sources)
+    {
+        uint32_t levelCount = 0;
+        gpuTime += MeasureBest(1, [&]() {
+            levelCount = search.Search(source, levels.data());
+        });
+        submissions += search.GetLastSubmissionCount();
+        maxLevelCount = std::max(maxLevelCount, levelCount);
+
+        // Reference: a plain queue based BFS
+        hostTime += MeasureBest(1, [&]() {
+            std::fill(expected.begin(), expected.end(), BreadthFirstSearch::Unreached);
+            expected[source] = 0;
+            queue[0] = source;
+
+            std::size_t head = 0, tail = 1;
+            while (head < tail)
+            {
+                const uint32_t vertex = queue[head++];
+
+                for (uint32_t e = graph.rowOffsets[vertex]; e < graph.rowOffsets[vertex + 1]; ++e)
+                {
+                    const uint32_t neighbour = graph.columns[e];
+                    if (expected[neighbour] == BreadthFirstSearch::Unreached)
+                    {
+                        expected[neighbour] = expected[vertex] + 1;
+                        queue[tail++] = neighbour;
+                    }
+                }
+            }
+        });
+
+        if (levels != expected)
+        {
+            std::cerr << "GPU BFS from " << source << " computed the wrong levels\n";
+            return 1;
+        }
+
+        // Every edge out of a reached vertex gets looked at once
+        for (uint32_t v = 0; v < vertexCount; ++v)
+        {
+            if (expected[v] != BreadthFirstSearch::Unreached)
+            {
+                traversedEdges += graph.rowOffsets[v + 1] - graph.rowOffsets[v];
+            }
+        }
+    }
+
+    std::cout << "R-MAT scale " << scale << ", " << vertexCount << " vertices, "
+        << graph.GetEdgeCount() << " directed edges\n";
+    std::cout << sources.size() << " searches, up to " << maxLevelCount << " levels, "
+        << submissions << " submissions\n";
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "GPU BFS:   " << traversedEdges / gpuTime * 1e-9 << " GTEPS ("
+        << std::setprecision(2) << gpuTime / sources.size() * 1e3 << " ms per search)\n";
+    std::cout << std::setprecision(3);
+    std::cout << "Host BFS:  " << traversedEdges / hostTime * 1e-9 << " GTEPS ("
+        << std::setprecision(2) << hostTime / sources.size() * 1e3 << " ms per search)\n";
+
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int RunCullingBenchmark(const std::size_t instanceCount)
+{
+    if (instanceCount == 0)
+    {
+        std::cerr << "Culling needs at least one instance\n";
+        return 1;
+    }
+
+    auto context = VulkanContext::Get();
+    VkDevice device = context->GetDevice();
+    const auto& memoryTypes = context->GetCapabilities().memoryTypes;
+
+    // Instances scattered around the camera, which looks down -z with a
+    // 60 degree vertical field of view
+    const int MeshCount = 4;
+    const MeshDraw meshes[MeshCount] = {
+        { 36, 0, 0, 0 }, { 960, 36, 24, 0 }, { 2880, 996, 506, 0 }, { 60, 3876, 1988, 0 }
+    };
+
+    std::vector<float> spheres(4 * instanceCount), boxes(8 * instanceCount);
+    std::vector<uint32_t> meshIndices(instanceCount);
+    {
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<float> position(-150.0f, 150.0f);
+        std::uniform_real_distribution<float> size(0.5f, 4.0f);
+        std::uniform_int_distribution<uint32_t> mesh(0, MeshCount - 1);
+
+        for (std::size_t i = 0; i < instanceCount; ++i)
+        {
+            const float center[3] = { position(generator), position(generator), position(generator) };
+            const float extents[3] = { size(generator), size(generator), size(generator) };
+
+            for (int j = 0; j < 3; ++j)
+            {
+                spheres[4 * i + j] = center[j];
+                boxes[8 * i + j] = center[j];
+                boxes[8 * i + 4 + j] = extents[j];
+            }
+
+            spheres[4 * i + 3] = std::sqrt(extents[0] * extents[0]
+                + extents[1] * extents[1] + extents[2] * extents[2]);
+            boxes[8 * i + 3] = 0;
+            boxes[8 * i + 7] = 0;
+            meshIndices[i] = mesh(generator);
+        }
+    }
+
+    const float f = 1.0f / std::tan(0.5f * 60.0f * 3.14159265f / 180.0f);
+    const float nearPlane = 0.1f, farPlane = 200.0f, aspect = 16.0f / 9.0f;
+    float projection[16] = {};
+    projection[0] = f / aspect;
+    projection[5] = -f;
+    projection[10] = farPlane / (nearPlane - farPlane);
+    projection[11] = -1;
+    projection[14] = nearPlane * farPlane / (nearPlane - farPlane);
+
+    const Frustum frustum = ExtractFrustum(projection);
+
+    CullingBuffers buffers;
+    buffers.bounds = CreateBuffer(device, memoryTypes, boxes.size() * sizeof(float),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    buffers.meshIndices = CreateBuffer(device, memoryTypes, instanceCount * sizeof(uint32_t),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    buffers.meshes = CreateBuffer(device, memoryTypes, sizeof(meshes),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    buffers.visibleInstances = CreateBuffer(device, memoryTypes, instanceCount * sizeof(uint32_t),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    buffers.drawCommands = CreateBuffer(device, memoryTypes,
+        instanceCount * sizeof(VkDrawIndexedIndirectCommand),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT);
+    buffers.drawCount = CreateBuffer(device, memoryTypes, sizeof(uint32_t),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT
+        | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    auto upload = [&](const Buffer& buffer, const void* data, const std::size_t size) {
+        std::memcpy(MapBuffer(device, buffer), data, size);
+        UnmapBuffer(device, buffer);
+    };
+
+    upload(buffers.meshIndices, meshIndices.data(), instanceCount * sizeof(uint32_t));
+    upload(buffers.meshes, meshes, sizeof(meshes));
+
+    InstanceCuller culler(context);
+    culler.SetBuffers(buffers);
+
+    VkCommandPoolCreateInfo commandPoolCreateInfo = {};
+    commandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    commandPoolCreateInfo.queueFamilyIndex = context->GetQueueFamilyIndex();
+    commandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+
+    VkCommandPool commandPool;
+    vkCreateCommandPool(device, &commandPoolCreateInfo, nullptr, &commandPool);
+
+    VkCommandBufferAllocateInfo commandBufferAllocateInfo = {};
+    commandBufferAllocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    commandBufferAllocateInfo.commandBufferCount = 1;
+    commandBufferAllocateInfo.commandPool = commandPool;
+    commandBufferAllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+
+    VkCommandBuffer commandBuffer;
+    vkAllocateCommandBuffers(device, &commandBufferAllocateInfo, &commandBuffer);
+
+    VkFenceCreateInfo fenceCreateInfo = {};
+    fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+    VkFence fence;
+    vkCreateFence(device, &fenceCreateInfo, nullptr, &fence);
+
+    std::cout << "Culling " << instanceCount << " instances\n\n";
+    std::cout << "bounds   visible   record us   GPU ms   host ms\n";
+    std::cout << std::fixed;
+
+    const BoundsType boundsTypes[] = { BoundsType::Sphere, BoundsType::Box };
+    bool correct = true;
+
+    for (const BoundsType boundsType : boundsTypes)
+    {
+        const bool box = (boundsType == BoundsType::Box);
+        if (box)
+        {
+            upload(buffers.bounds, boxes.data(), boxes.size() * sizeof(float));
+        }
+        else
+        {
+            upload(buffers.bounds, spheres.data(), spheres.size() * sizeof(float));
+        }
+
+        auto record = [&]() {
+            VkCommandBufferBeginInfo commandBufferBeginInfo = {};
+            commandBufferBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+            commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            vkBeginCommandBuffer(commandBuffer, &commandBufferBeginInfo);
+
+            culler.Record(commandBuffer, frustum, instanceCount, boundsType);
+
+            // Only for reading the results back here, a renderer would
+            // draw instead
+            VkMemoryBarrier memoryBarrier = {};
+            memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            memoryBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+            memoryBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+            vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                VK_PIPELINE_STAGE_HOST_BIT, 0,
+                1, &memoryBarrier, 0, nullptr, 0, nullptr);
+
+            vkEndCommandBuffer(commandBuffer);
+        };
+
+        const double recordTime = MeasureBest(5, record);
+
+        const double gpuTime = MeasureBest(5, [&]() {
+            record();
+
+            VkSubmitInfo submitInfo = {};
+            submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submitInfo.commandBufferCount = 1;
+            submitInfo.pCommandBuffers = &commandBuffer;
+
+            context->Submit(submitInfo, fence);
+            vkWaitForFences(device, 1, &fence, VK_TRUE, UINT64_MAX);
+            vkResetFences(device, 1, &fence);
+        });
+
+        // The host version builds the same draw list. The margins are for
+        // the verification: instances that close to a plane may go either
+        // way on the GPU
+        std::vector<VkDrawIndexedIndirectCommand> hostCommands(instanceCount);
+        std::vector<int8_t> certainty(instanceCount);
+        std::size_t hostCount = 0;
+
+        const double hostTime = MeasureBest(5, [&]() {
+            hostCount = 0;
+
+            for (std::size_t i = 0; i < instanceCount; ++i)
+            {
+                const float* center = box ? &boxes[8 * i] : &spheres[4 * i];
+                float minimum = 1e30f;
+
+                for (const auto& plane : frustum.planes)
+                {
+                    const float reach = box
+                        ? std::abs(plane[0]) * boxes[8 * i + 4] + std::abs(plane[1]) * boxes[8 * i + 5]
+                            + std::abs(plane[2]) * boxes[8 * i + 6]
+                        : spheres[4 * i + 3];
+                    const float distance = plane[0] * center[0] + plane[1] * center[1]
+                        + plane[2] * center[2] + plane[3] + reach;
+                    minimum = std::min(minimum, distance);
+                }
+
+                certainty[i] = (minimum > 1e-3f) ? 1 : ((minimum < -1e-3f) ? -1 : 0);
+
+                if (minimum >= 0)
+                {
+                    const MeshDraw& mesh = meshes[meshIndices[i]];
+                    VkDrawIndexedIndirectCommand& command = hostCommands[hostCount++];
+                    command.indexCount = mesh.indexCount;
+                    command.instanceCount = 1;
+                    command.firstIndex = mesh.firstIndex;
+                    command.vertexOffset = mesh.vertexOffset;
+                    command.firstInstance = static_cast<uint32_t> (i);
+                }
+            }
+        });
+
+        const std::size_t drawCount = *static_cast<const uint32_t*> (MapBuffer(device, buffers.drawCount));
+        vkUnmapMemory(device, buffers.drawCount.memory);
+
+        const uint32_t* visible = static_cast<const uint32_t*> (MapBuffer(device, buffers.visibleInstances));
+        std::vector<uint32_t> visibleInstances(visible, visible + drawCount);
+        vkUnmapMemory(device, buffers.visibleInstances.memory);
+
+        const auto* commands = static_cast<const VkDrawIndexedIndirectCommand*> (
+            MapBuffer(device, buffers.drawCommands));
+
+        std::vector<bool> seen(instanceCount, false);
+        for (std::size_t i = 0; i < drawCount; ++i)
+        {
+            const uint32_t instance = visibleInstances[i];
+            if (instance >= instanceCount)
+            {
+                correct = false;
+                break;
+            }
+
+            const MeshDraw& mesh = meshes[meshIndices[instance]];
+
+            correct = correct && !seen[instance] && certainty[instance] >= 0
+                && commands[i].firstInstance == instance
+                && commands[i].instanceCount == 1
+                && commands[i].indexCount == mesh.indexCount
+                && commands[i].firstIndex == mesh.firstIndex
+                && commands[i].vertexOffset == mesh.vertexOffset;
+            seen[instance] = true;
+        }
+        vkUnmapMemory(device, buffers.drawCommands.memory);
+
+        for (std::size_t i = 0; i < instanceCount; ++i)
+        {
+            correct = correct && (certainty[i] <= 0 || seen[i]);
+        }
+
+        if (!correct)
+        {
+            std::cerr << "GPU culling produced a wrong draw list\n";
+            break;
+        }
+
+        std::cout << std::left << std::setw(7) << (box ? "box" : "sphere") << std::right
+            << std::setw(10) << drawCount
+            << std::setw(12) << std::setprecision(1) << recordTime * 1e6
+            << std::setw(9) << std::setprecision(2) << gpuTime * 1e3
+            << std::setw(10) << hostTime * 1e3 << "\n";
+    }
+
+    vkDestroyFence(device, fence, nullptr);
+    vkDestroyCommandPool(device, commandPool, nullptr);
+
+    for (const auto buffer : { &buffers.bounds, &buffers.meshIndices, &buffers.meshes,
+        &buffers.visibleInstances, &buffers.drawCommands, &buffers.drawCount })
+    {
+        DestroyBuffer(device, *buffer);
+    }
+
+    return correct ? 0 : 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int RunExtractionBenchmark()
+{
+    auto context = VulkanContext::Get();
+    VkDevice device = context->GetDevice();
+    const auto& memoryTypes = context->GetCapabilities().memoryTypes;
+
+    const struct
+    {
+        uint32_t width;
+        uint32_t height;
+        const char* name;
+    } resolutions[] = {
+        { 3840, 2160, "4K" },
+        { 7680, 4320, "8K" }
+    };
+
+    const struct
+    {
+        TileShape shape;
+        const char* name;
+    } shapes[] = {
+        { TileShape::Row64, "64x1" },
+        { TileShape::Tile16x4, "16x4" },
+        { TileShape::Tile8x8, "8x8" }
+    };
+
+    SparseExtractor extractor(context);
+
+    VkCommandPoolCreateInfo commandPoolCreateInfo = {};
+    commandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    commandPoolCreateInfo.queueFamilyIndex = context->GetQueueFamilyIndex();
+    commandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+
+    VkCommandPool commandPool;
+    vkCreateCommandPool(device, &commandPoolCreateInfo, nullptr, &commandPool);
+
+    VkCommandBufferAllocateInfo commandBufferAllocateInfo = {};
+    commandBufferAllocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    commandBufferAllocateInfo.commandBufferCount = 1;
+    commandBufferAllocateInfo.commandPool = commandPool;
+    commandBufferAllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+
+    VkCommandBuffer commandBuffer;
+    vkAllocateCommandBuffers(device, &commandBufferAllocateInfo, &commandBuffer);
+
+    VkFenceCreateInfo fenceCreateInfo = {};
+    fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+    VkFence fence;
+    vkCreateFence(device, &fenceCreateInfo, nullptr, &fence);
+
+    std::cout << "Extracting the pixels > 0 of a float image, GPU time per extraction\n\n";
+    std::cout << "image   tiles   pixels kept     ms   Gpixels/s\n";
+    std::cout << std::fixed;
+
+    for (const auto& resolution : resolutions)
+    {
+        const uint32_t width = resolution.width;
+        const uint32_t height = resolution.height;
+
+        // Padded rows, as many image layouts have. Blobs of positive values
+        // on a negative background, about 10% of the pixels survive
+        const std::size_t rowPitch = width + 256;
+        std::vector<float> image(rowPitch * height, 1.0f);
+        {
+            std::vector<float> rowWave(width), columnWave(height);
+            for (uint32_t x = 0; x < width; ++x)
+            {
+                rowWave[x] = std::sin(x * 0.013f);
+            }
+            for (uint32_t y = 0; y < height; ++y)
+            {
+                columnWave[y] = std::sin(y * 0.011f);
+            }
+
+            for (uint32_t y = 0; y < height; ++y)
+            {
+                for (uint32_t x = 0; x < width; ++x)
+                {
+                    image[y * rowPitch + x] = rowWave[x] * columnWave[y] - 0.6f;
+                }
+            }
+        }
+
+        // Check a region in the middle against the host, coordinates
+        // include the region's origin
+        {
+            const uint32_t x0 = width / 4, y0 = height / 4;
+            const uint32_t regionWidth = width / 2, regionHeight = height / 2;
+
+            std::vector<PixelRecord> expected;
+            for (uint32_t y = y0; y < y0 + regionHeight; ++y)
+            {
+                for (uint32_t x = x0; x < x0 + regionWidth; ++x)
+                {
+                    const float value = image[y * rowPitch + x];
+                    if (value > 0)
+                    {
+                        const PixelRecord record = {
+                            static_cast<uint16_t> (x), static_cast<uint16_t> (y), value
+                        };
+                        expected.push_back(record);
+                    }
+                }
+            }
+
+            auto less = [](const PixelRecord& a, const PixelRecord& b) {
+                return a.y < b.y || (a.y == b.y && a.x < b.x);
+            };
+
+            for (const auto& shape : shapes)
+            {
+                std::vector<PixelRecord> output(expected.size());
+                const std::size_t count = extractor.Extract(image.data(), rowPitch,
+                    x0, y0, regionWidth, regionHeight, 0, shape.shape,
+                    output.data(), output.size());
+
+                std::sort(output.begin(), output.end(), less);
+
+                bool correct = (count == expected.size());
+                for (std::size_t i = 0; correct && i < count; ++i)
+                {
+                    correct = output[i].x == expected[i].x && output[i].y == expected[i].y
+                        && output[i].value == expected[i].value;
+                }
+
+                if (!correct)
+                {
+                    std::cerr << "2D extraction with " << shape.name
+                        << " tiles produced a wrong result\n";
+                    return 1;
+                }
+            }
+        }
+
+        // Timing: the image stays on the device, only the dispatches count
+        const std::size_t pixelCount = static_cast<std::size_t> (width) * height;
+        const std::size_t recordCapacity = pixelCount / 4;
+
+        Buffer buffers[3];
+        buffers[0] = CreateBuffer(device, memoryTypes, image.size() * sizeof(float),
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+        buffers[1] = CreateBuffer(device, memoryTypes, recordCapacity * sizeof(PixelRecord),
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+        buffers[2] = CreateBuffer(device, memoryTypes, sizeof(uint32_t),
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+        std::memcpy(MapBuffer(device, buffers[0]), image.data(), image.size() * sizeof(float));
+        UnmapBuffer(device, buffers[0]);
+
+        VkDescriptorPool descriptorPool;
+        VkDescriptorSet descriptorSet = CreateStorageBufferDescriptorSet(device,
+            extractor.GetDescriptorSetLayout(), buffers, 3, &descriptorPool);
+
+        ExtractionParameters parameters;
+        parameters.regionOrigin[0] = 0;
+        parameters.regionOrigin[1] = 0;
+        parameters.regionSize[0] = width;
+        parameters.regionSize[1] = height;
+        parameters.rowPitch = static_cast<uint32_t> (rowPitch);
+        parameters.threshold = 0;
+        parameters.outputCapacity = static_cast<uint32_t> (recordCapacity);
+
+        const int Repetitions = 10;
+
+        for (const auto& shape : shapes)
+        {
+            const double time = MeasureBest(3, [&]() {
+                VkCommandBufferBeginInfo commandBufferBeginInfo = {};
+                commandBufferBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+                commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+                vkBeginCommandBuffer(commandBuffer, &commandBufferBeginInfo);
+
+                for (int i = 0; i < Repetitions; ++i)
+                {
+                    extractor.Record(commandBuffer, buffers, descriptorSet,
+                        parameters, shape.shape);
+                }
+
+                VkMemoryBarrier memoryBarrier = {};
+                memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+                memoryBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+                memoryBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+                vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                    VK_PIPELINE_STAGE_HOST_BIT, 0,
+                    1, &memoryBarrier, 0, nullptr, 0, nullptr);
+                vkEndCommandBuffer(commandBuffer);
+
+                VkSubmitInfo submitInfo = {};
+                submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+                submitInfo.commandBufferCount = 1;
+                submitInfo.pCommandBuffers = &commandBuffer;
+
+                context->Submit(submitInfo, fence);
+                vkWaitForFences(device, 1, &fence, VK_TRUE, UINT64_MAX);
+                vkResetFences(device, 1, &fence);
+            }) / Repetitions;
+
+            const std::size_t count = *static_cast<const uint32_t*> (MapBuffer(device, buffers[2]));
+            vkUnmapMemory(device, buffers[2].memory);
+
+            std::cout << std::left << std::setw(8) << resolution.name
+                << std::setw(6) << shape.name << std::right
+                << std::setw(14) << count
+                << std::setw(7) << std::setprecision(2) << time * 1e3
+                << std::setw(12) << pixelCount / time * 1e-9 << "\n";
+        }
+
+        vkDestroyDescriptorPool(device, descriptorPool, nullptr);
+
+        for (const auto& buffer : buffers)
+        {
+            DestroyBuffer(device, buffer);
+        }
+    }
+
+    vkDestroyFence(device, fence, nullptr);
+    vkDestroyCommandPool(device, commandPool, nullptr);
+
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int RunLibraryBenchmark(const std::size_t callCount, const std::size_t elementCount)
+{
+    if (elementCount == 0)
+    {
+        std::cerr << "Compaction needs at least one element\n";
+        return 1;
+    }
+
+    // Goes through the C interface only, with a context of its own, like a
+    // service linking VkMBCNTLib would
+    VkmbcntContextCreateInfo createInfo = {};
+    createInfo.headless = 1;
+
+    VkmbcntContext context = nullptr;
+    if (vkmbcntCreateContext(&createInfo, &context) != VKMBCNT_SUCCESS)
+    {
+        std::cerr << "Could not create a library context\n";
+        return 1;
+    }
+
+    VkmbcntDeviceInfo deviceInfo = {};
+    vkmbcntGetDeviceInfo(context, &deviceInfo);
+
+    // Calls in flight at any time, each with its own input and output
+    const int SlotCount = 8;
+
+    struct Slot
+    {
+        std::vector<float> input;
+        std::vector<float> output;
+        std::vector<float> expected;
+        VkmbcntHostMemory importedInput = nullptr;
+        VkmbcntHostMemory importedOutput = nullptr;
+        VkmbcntJob job = nullptr;
+    };
+
+    std::vector<Slot> slots(SlotCount);
+
+    for (auto& slot : slots)
+    {
+        slot.input.resize(elementCount);
+        slot.output.resize(elementCount);
+        FillRandom(slot.input.data(), elementCount);
+
+        std::copy_if(slot.input.begin(), slot.input.end(),
+            std::back_inserter(slot.expected), [](float f) { return f > 0; });
+        std::sort(slot.expected.begin(), slot.expected.end());
+    }
+
+    std::cout << "Library API version " << vkmbcntGetApiVersion() << ", "
+        << callCount << " calls of " << elementCount << " elements, "
+        << SlotCount << " in flight\n";
+    std::cout << "Host memory import: "
+        << (deviceInfo.hostImportAlignment ? "supported" : "not supported, staging copies")
+        << "\n\n";
+    std::cout << "path                            calls/s   us/call\n";
+    std::cout << std::fixed;
+
+    bool failed = false;
+
+    // 0 imports the caller memory on every call. 1 and 2 import it once up
+    // front, 1 passes the same host pointers, 2 the imported buffers
+    const char* const pathNames[] = {
+        "host pointers", "host pointers, pre-imported", "pre-imported buffers"
+    };
+
+    for (int path = 0; path < 3; ++path)
+    {
+        if (path == 1)
+        {
+            bool imported = true;
+
+            for (auto& slot : slots)
+            {
+                imported = imported
+                    && vkmbcntImportHostMemory(context, slot.input.data(),
+                        elementCount * sizeof(float), &slot.importedInput) == VKMBCNT_SUCCESS
+                    && vkmbcntImportHostMemory(context, slot.output.data(),
+                        elementCount * sizeof(float), &slot.importedOutput) == VKMBCNT_SUCCESS;
+            }
+
+            if (!imported)
+            {
+                std::cout << "pre-imported                    (host memory import not available)\n";
+                break;
+            }
+        }
+
+        bool correct = true;
+
+        const auto start = std::chrono::high_resolution_clock::now();
+
+        for (std::size_t call = 0; call < callCount + SlotCount && correct; ++call)
+        {
+            Slot& slot = slots[call % SlotCount];
+
+            if (slot.job)
+            {
+                std::size_t count = 0;
+                correct = vkmbcntWaitJob(context, slot.job, UINT64_MAX, &count) == VKMBCNT_SUCCESS
+                    && count == slot.expected.size();
+
+                // The contents only for the first round, sorting is slower
+                // than the call itself
+                if (correct && call < 2 * SlotCount)
+                {
+                    std::vector<float> written(slot.output.begin(), slot.output.begin() + count);
+                    std::sort(written.begin(), written.end());
+                    correct = (written == slot.expected);
+                }
+
+                vkmbcntDestroyJob(context, slot.job);
+                slot.job = nullptr;
+            }
+
+            if (call >= callCount)
+            {
+                continue;
+            }
+
+            const VkmbcntResult result = (path < 2)
+                ? vkmbcntCompactHost(context, slot.input.data(), elementCount,
+                    slot.output.data(), elementCount, 0, &slot.job)
+                : vkmbcntCompactBuffers(context,
+                    vkmbcntGetHostMemoryBuffer(slot.importedInput),
+                    vkmbcntGetHostMemoryBuffer(slot.importedOutput),
+                    elementCount, elementCount, 0, &slot.job);
+
+            correct = (result == VKMBCNT_SUCCESS);
+        }
+
+        const auto end = std::chrono::high_resolution_clock::now();
+        const double time = std::chrono::duration<double>(end - start).count();
+
+        for (auto& slot : slots)
+        {
+            if (slot.job)
+            {
+                vkmbcntDestroyJob(context, slot.job);
+                slot.job = nullptr;
+            }
+        }
+
+        if (!correct)
+        {
+            std::cerr << "Library call produced a wrong result\n";
+            failed = true;
+            break;
+        }
+
+        std::cout << std::left << std::setw(29) << pathNames[path] << std::right
+            << std::setw(10) << std::setprecision(0) << callCount / time
+            << std::setw(10) << std::setprecision(2) << time / callCount * 1e6 << "\n";
+    }
+
+    for (auto& slot : slots)
+    {
+        vkmbcntReleaseHostMemory(context, slot.importedInput);
+        vkmbcntReleaseHostMemory(context, slot.importedOutput);
+    }
+
+    vkmbcntDestroyContext(context);
+
+    return failed ? 1 : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int RunTextIndexBenchmark(const std::size_t megabytes)
+{
+    auto context = VulkanContext::Get();
+    VkDevice device = context->GetDevice();
+    const auto& memoryTypes = context->GetCapabilities().memoryTypes;
+
+    const std::string text = CreateCsvText(megabytes << 20);
+    const TextDialect dialect;
+
+    std::vector<uint64_t> expected(text.size());
+    expected.resize(IndexTextScalar(text.data(), text.size(), dialect,
+        expected.data(), expected.size()));
+
+    StructuralIndexer indexer(context);
+
+    // Full text with both offset widths, with the host masks, and a prefix
+    // with chunks of a few tiles and half the output capacity, which must
+    // still count everything and write the first half
+    {
+        std::vector<uint64_t> offsets(expected.size());
+        bool correct = indexer.Index(text.data(), text.size(), dialect,
+            offsets.data(), offsets.size()) == expected.size()
+            && offsets == expected;
+
+        std::fill(offsets.begin(), offsets.end(), 0);
+        correct = correct && IndexTextOnHost(text.data(), text.size(), dialect,
+            offsets.data(), offsets.size()) == expected.size()
+            && offsets == expected;
+
+        if (text.size() <= 0xFFFFFFFFu)
+        {
+            std::vector<uint32_t> offsets32(expected.size());
+            correct = correct && indexer.Index(text.data(), text.size(), dialect,
+                offsets32.data(), offsets32.size()) == expected.size()
+                && std::equal(offsets32.begin(), offsets32.end(), expected.begin());
+        }
+
+        const std::size_t prefixSize = std::min<std::size_t>(text.size(), 4 << 20);
+        const std::size_t prefixCount = std::lower_bound(expected.begin(),
+            expected.end(), prefixSize) - expected.begin();
+        const std::size_t chunkSize = indexer.GetChunkSize();
+
+        indexer.SetChunkSize(3 * StructuralIndexer::TileSize);
+        std::fill(offsets.begin(), offsets.end(), 0);
+        correct = correct && indexer.Index(text.data(), prefixSize, dialect,
+            offsets.data(), prefixCount / 2) == prefixCount
+            && std::equal(offsets.begin(), offsets.begin() + prefixCount / 2,
+                expected.begin())
+            && offsets[prefixCount / 2] == 0;
+        indexer.SetChunkSize(chunkSize);
+
+        if (!correct)
+        {
+            std::cerr << "Structural indexing produced a wrong result\n";
+            return 1;
+        }
+    }
+
+    std::vector<uint64_t> offsets(expected.size());
+
+    const double scalarTime = MeasureBest(3, [&]() {
+        IndexTextScalar(text.data(), text.size(), dialect, offsets.data(),
+            offsets.size());
+    });
+    const double maskTime = MeasureBest(3, [&]() {
+        IndexTextOnHost(text.data(), text.size(), dialect, offsets.data(),
+            offsets.size());
+    });
+    const double gpuTime = MeasureBest(3, [&]() {
+        indexer.Index(text.data(), text.size(), dialect, offsets.data(),
+            offsets.size());
+    });
+
+    // GPU only: one chunk stays on the device and is indexed repeatedly
+    const std::size_t residentSize = std::min(text.size(), indexer.GetChunkSize());
+    const std::size_t residentCount = std::lower_bound(expected.begin(),
+        expected.end(), residentSize) - expected.begin();
+
+    Buffer buffers[4];
+    buffers[0] = CreateBuffer(device, memoryTypes, (residentSize + 3) & ~std::size_t(3),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    buffers[1] = CreateBuffer(device, memoryTypes,
+        StructuralIndexer::GetTileStateSize(residentSize),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, MemoryLocation::DeviceLocal);
+    buffers[2] = CreateBuffer(device, memoryTypes,
+        std::max<std::size_t>(residentCount, 1) * sizeof(uint64_t),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, MemoryLocation::DeviceLocal);
+    buffers[3] = CreateBuffer(device, memoryTypes, 2 * sizeof(uint32_t),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+
+    std::memcpy(MapBuffer(device, buffers[0]), text.data(), residentSize);
+    UnmapBuffer(device, buffers[0]);
+
+    VkDescriptorPool descriptorPool;
+    VkDescriptorSet descriptorSet = CreateStorageBufferDescriptorSet(device,
+        indexer.GetDescriptorSetLayout(), buffers, 4, &descriptorPool);
+
+    TextIndexParameters parameters;
+    parameters.byteCount = static_cast<uint32_t> (residentSize);
+    parameters.outputCapacity = static_cast<uint32_t> (residentCount);
+    parameters.dialect = dialect;
+
+    VkCommandPoolCreateInfo commandPoolCreateInfo = {};
+    commandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    commandPoolCreateInfo.queueFamilyIndex = context->GetQueueFamilyIndex();
+
+    VkCommandPool commandPool;
+    vkCreateCommandPool(device, &commandPoolCreateInfo, nullptr, &commandPool);
+
+    VkCommandBufferAllocateInfo commandBufferAllocateInfo = {};
+    commandBufferAllocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    commandBufferAllocateInfo.commandBufferCount = 1;
+    commandBufferAllocateInfo.commandPool = commandPool;
+    commandBufferAllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+
+    VkCommandBuffer commandBuffer;
+    vkAllocateCommandBuffers(device, &commandBufferAllocateInfo, &commandBuffer);
+
+    const int Repetitions = 10;
+
+    VkCommandBufferBeginInfo commandBufferBeginInfo = {};
+    commandBufferBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    vkBeginCommandBuffer(commandBuffer, &commandBufferBeginInfo);
+
+    for (int i = 0; i < Repetitions; ++i)
+    {
+        indexer.Record(commandBuffer, descriptorSet, parameters);
+    }
+
+    VkMemoryBarrier memoryBarrier = {};
+    memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    memoryBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    memoryBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_PIPELINE_STAGE_HOST_BIT, 0,
+        1, &memoryBarrier, 0, nullptr, 0, nullptr);
+    vkEndCommandBuffer(commandBuffer);
+
+    VkFenceCreateInfo fenceCreateInfo = {};
+    fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+    VkFence fence;
+    vkCreateFence(device, &fenceCreateInfo, nullptr, &fence);
+
+    const double residentTime = MeasureBest(3, [&]() {
+        VkSubmitInfo submitInfo = {};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &commandBuffer;
+
+        context->Submit(submitInfo, fence);
+        vkWaitForFences(device, 1, &fence, VK_TRUE, UINT64_MAX);
+        vkResetFences(device, 1, &fence);
+    }) / Repetitions;
+
+    const uint32_t residentResult = *static_cast<const uint32_t*> (MapBuffer(device, buffers[3]));
+    vkUnmapMemory(device, buffers[3].memory);
+
+    vkDestroyFence(device, fence, nullptr);
+    vkDestroyCommandPool(device, commandPool, nullptr);
+    vkDestroyDescriptorPool(device, descriptorPool, nullptr);
+
+    for (const auto& buffer : buffers)
+    {
+        DestroyBuffer(device, buffer);
+    }
+
+    if (residentResult != residentCount)
+    {
+        std::cerr << "Structural indexing on the device produced a wrong result\n";
+        return 1;
+    }
+
+    std::cout << "Structural characters of " << (text.size() >> 20) << " MiB of CSV: "
+        << expected.size() << "\n\n";
+    std::cout << "method                     GB/s\n";
+    std::cout << std::fixed << std::setprecision(2);
+
+    const struct
+    {
+        const char* name;
+        double bytesPerSecond;
+    } results[] = {
+        { "CPU, byte by byte", text.size() / scalarTime },
+        { "CPU, 64-bit masks", text.size() / maskTime },
+        { "GPU, with transfers", text.size() / gpuTime },
+        { "GPU, resident chunk", residentSize / residentTime }
+    };
+
+    for (const auto& result : results)
+    {
+        std::cout << std::left << std::setw(22) << result.name << std::right
+            << std::setw(9) << result.bytesPerSecond * 1e-9 << "\n";
+    }
+
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int RunCsrBenchmark(const std::size_t size)
+{
+    auto context = VulkanContext::Get();
+    VkDevice device = context->GetDevice();
+    const auto& memoryTypes = context->GetCapabilities().memoryTypes;
+
+    CsrConverter converter(context);
+
+    // 0 keeps all non-zero elements
+    const float thresholds[] = { 0.0f, 0.5f };
+
+    // Padded rows and chunks of a few rows against the host, both
+    // thresholds
+    {
+        const std::size_t rowCount = 1000, columnCount = 700, rowPitch = 768;
+        std::vector<float> matrix(rowCount * rowPitch);
+        FillPrunedMatrix(matrix.data(), rowCount, columnCount, rowPitch);
+
+        const std::size_t chunkRows = converter.GetChunkRows();
+        converter.SetChunkRows(7);
+
+        bool correct = true;
+
+        for (const float threshold : thresholds)
+        {
+            CsrMatrix expected, output;
+            DenseToCsr(matrix.data(), rowCount, columnCount, rowPitch, threshold, &expected);
+            converter.Convert(matrix.data(), rowCount, columnCount, rowPitch,
+                threshold, &output);
+
+            correct = correct && IsSameCsr(output, expected)
+                && CheckCsrRoundTrip(output, matrix.data(), rowPitch, threshold);
+        }
+
+        converter.SetChunkRows(chunkRows);
+
+        if (!correct)
+        {
+            std::cerr << "Dense to CSR conversion produced a wrong result\n";
+            return 1;
+        }
+    }
+
+    VkCommandPoolCreateInfo commandPoolCreateInfo = {};
+    commandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    commandPoolCreateInfo.queueFamilyIndex = context->GetQueueFamilyIndex();
+    commandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+
+    VkCommandPool commandPool;
+    vkCreateCommandPool(device, &commandPoolCreateInfo, nullptr, &commandPool);
+
+    VkCommandBufferAllocateInfo commandBufferAllocateInfo = {};
+    commandBufferAllocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    commandBufferAllocateInfo.commandBufferCount = 1;
+    commandBufferAllocateInfo.commandPool = commandPool;
+    commandBufferAllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+
+    VkCommandBuffer commandBuffer;
+    vkAllocateCommandBuffers(device, &commandBufferAllocateInfo, &commandBuffer);
+
+    VkFenceCreateInfo fenceCreateInfo = {};
+    fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+    VkFence fence;
+    vkCreateFence(device, &fenceCreateInfo, nullptr, &fence);
+
+    std::cout << "Dense to CSR, |value| > threshold, times in ms. Resident: GPU only, on\n"
+        "the rows which fit one chunk, GB/s of dense input\n\n";
+    std::cout << "matrix         threshold      kept      CPU      GPU  resident     GB/s\n";
+    std::cout << std::fixed;
+
+    const std::size_t sizes[] = { size, size * 3 / 2 };
+    bool failed = false;
+
+    for (const std::size_t n : sizes)
+    {
+        std::vector<float> matrix(n * n);
+        FillPrunedMatrix(matrix.data(), n, n, n);
+
+        for (const float threshold : thresholds)
+        {
+            CsrMatrix expected, output;
+
+            const double hostTime = MeasureBest(3, [&]() {
+                DenseToCsr(matrix.data(), n, n, n, threshold, &expected);
+            });
+            const double gpuTime = MeasureBest(3, [&]() {
+                converter.Convert(matrix.data(), n, n, n, threshold, &output);
+            });
+
+            if (!IsSameCsr(output, expected)
+                || !CheckCsrRoundTrip(output, matrix.data(), n, threshold))
+            {
+                std::cerr << "Dense to CSR conversion of a " << n << "x" << n
+                    << " matrix produced a wrong result\n";
+                failed = true;
+                break;
+            }
+
+            // As many rows as Convert puts into one chunk
+            const std::size_t residentRows = std::max<std::size_t>(1, std::min<std::size_t>(n,
+                std::min<std::size_t>(256 * 1024 * 1024,
+                    context->GetCapabilities().properties.limits.maxStorageBufferRange)
+                / (n * sizeof(float))));
+            const std::size_t residentCount = std::max<std::size_t>(
+                expected.rowOffsets[residentRows], 1);
+
+            Buffer buffers[4];
+            buffers[0] = CreateBuffer(device, memoryTypes, residentRows * n * sizeof(float),
+                VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+            buffers[1] = CreateBuffer(device, memoryTypes, (residentRows + 1) * sizeof(uint32_t),
+                VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, MemoryLocation::DeviceLocal);
+            buffers[2] = CreateBuffer(device, memoryTypes, residentCount * sizeof(uint32_t),
+                VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, MemoryLocation::DeviceLocal);
+            buffers[3] = CreateBuffer(device, memoryTypes, residentCount * sizeof(float),
+                VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, MemoryLocation::DeviceLocal);
+
+            std::memcpy(MapBuffer(device, buffers[0]), matrix.data(),
+                residentRows * n * sizeof(float));
+            UnmapBuffer(device, buffers[0]);
+
+            VkDescriptorPool descriptorPool;
+            VkDescriptorSet descriptorSet = CreateStorageBufferDescriptorSet(device,
+                converter.GetDescriptorSetLayout(), buffers, 4, &descriptorPool);
+
+            CsrParameters parameters;
+            parameters.rowCount = static_cast<uint32_t> (residentRows);
+            parameters.columnCount = static_cast<uint32_t> (n);
+            parameters.rowPitch = static_cast<uint32_t> (n);
+            parameters.threshold = threshold;
+
+            const int Repetitions = 10;
+
+            const double residentTime = MeasureBest(3, [&]() {
+                VkCommandBufferBeginInfo commandBufferBeginInfo = {};
+                commandBufferBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+                commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+                vkBeginCommandBuffer(commandBuffer, &commandBufferBeginInfo);
+
+                for (int i = 0; i < Repetitions; ++i)
+                {
+                    converter.RecordCount(commandBuffer, descriptorSet, parameters);
+                    converter.RecordFill(commandBuffer, descriptorSet, parameters);
+                }
+
+                vkEndCommandBuffer(commandBuffer);
+
+                VkSubmitInfo submitInfo = {};
+                submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+                submitInfo.commandBufferCount = 1;
+                submitInfo.pCommandBuffers = &commandBuffer;
+
+                context->Submit(submitInfo, fence);
+                vkWaitForFences(device, 1, &fence, VK_TRUE, UINT64_MAX);
+                vkResetFences(device, 1, &fence);
+            }) / Repetitions;
+
+            vkDestroyDescriptorPool(device, descriptorPool, nullptr);
+
+            for (const auto& buffer : buffers)
+            {
+                DestroyBuffer(device, buffer);
+            }
+
+            std::cout << std::left << std::setw(15)
+                << (std::to_string(n) + "x" + std::to_string(n)) << std::right
+                << std::setw(9) << std::setprecision(1) << threshold
+                << std::setw(10) << output.GetElementCount()
+                << std::setw(9) << std::setprecision(2) << hostTime * 1e3
+                << std::setw(9) << gpuTime * 1e3
+                << std::setw(10) << residentTime * 1e3
+                << std::setw(9) << residentRows * n * sizeof(float) / residentTime * 1e-9
+                << "\n";
+        }
+    }
+
+    vkDestroyFence(device, fence, nullptr);
+    vkDestroyCommandPool(device, commandPool, nullptr);
+
+    return failed ? 1 : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int RunContextBenchmark(const VulkanContext::Options& options, const int runCount)
+{
+    if (runCount < 2)
+    {
+        std::cerr << "The context benchmark needs at least 2 runs" << std::endl;
+        return 1;
+    }
+
+    const std::size_t ElementCount = 4096;
+
+    std::cout << "Run  Context (ms)  First compaction (ms)  Total (ms)\n";
+    std::cout << std::fixed << std::setprecision(2);
+
+    double coldTime = 0;
+    double warmTime = 0;
+
+    for (int run = 0; run < runCount; ++run)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+
+        auto context = std::make_shared<VulkanContext>(options);
+
+        const auto created = std::chrono::high_resolution_clock::now();
+
+        if (!context->IsValid())
+        {
+            std::cerr << "Failed to create a context" << std::endl;
+            return 1;
+        }
+
+        bool correct = false;
+
+        {
+            // Creates the pipelines, so this includes compiling the kernels
+            // unless the pipeline cache has them
+            GpuCompactor compactor(context);
+            correct = VerifyGpuCompaction(compactor, ElementCount);
+        }
+
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        if (!correct)
+        {
+            std::cerr << "Compaction in run " << run << " is wrong" << std::endl;
+            return 1;
+        }
+
+        const double contextTime = std::chrono::duration<double>(created - start).count();
+        const double totalTime = std::chrono::duration<double>(end - start).count();
+
+        std::cout << std::setw(3) << run
+            << std::setw(14) << contextTime * 1e3
+            << std::setw(23) << (totalTime - contextTime) * 1e3
+            << std::setw(12) << totalTime * 1e3 << "\n";
+
+        if (run == 0)
+        {
+            coldTime = totalTime;
+        }
+        else
+        {
+            warmTime += totalTime;
+        }
+    }
+
+    warmTime /= runCount - 1;
+
+    std::cout << "Cold start " << coldTime * 1e3 << " ms, warm start "
+        << warmTime * 1e3 << " ms on average" << std::endl;
+
+    return 0;
+}
+}   // namespace AMD
@@ -0,0 +1,143 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef AMD_VULKAN_SAMPLE_BENCHMARKS_H_
+#define AMD_VULKAN_SAMPLE_BENCHMARKS_H_
+
+#include "VulkanContext.h"
+
+#include <cstddef>
+#include <string>
+
+namespace AMD
+{
+// Prints throughput of the host compaction engine for 1, 2, 4, ... up to
+// maxThreadCount threads, for both orders. 0 uses all hardware threads.
+// Every run is compared with std::copy_if, the unordered ones after
+// sorting. Returns 1 as soon as one of them differs, 0 otherwise
+int RunHostCompactionBenchmark(const std::size_t elementCount,
+    int maxThreadCount);
+
+// Checks GpuCompactor against the host, then prints the host time needed
+// to record one dispatch with every binding mode, next to allocating a
+// descriptor pool and set per dispatch as Run () does. Needs the shared
+// VulkanContext. Returns 1 if the compacted values don't match
+// std::copy_if, 0 otherwise
+int RunDispatchBenchmark(const std::size_t elementCount);
+
+// Compacts elementCount random elements of every InputFormat on the GPU,
+// both packed and widened, and prints the upload size and the time of
+// every variant. Needs the shared VulkanContext. Returns 1 if a format
+// doesn't produce the host-decoded values that pass the threshold, in
+// order, 0 otherwise
+int RunFormatBenchmark(const std::size_t elementCount);
+
+// Selects the k largest of elementCount random values with TopKSelector
+// and prints the time of the selection, of std::nth_element and of
+// sorting everything. Needs the shared VulkanContext. Returns 1 if the
+// arguments are empty or the selected values aren't those of
+// std::nth_element, 0 otherwise
+int RunTopKBenchmark(const std::size_t elementCount, const std::size_t k);
+
+// Parses expression over the random columns a (uniform in [0, 8)), b
+// (integers 0 to 9) and c (uniform in [-1, 1)), filters rowCount rows with
+// ColumnFilter and prints the compile time, the time of a cached filter
+// and of the host interpreter. Needs the shared VulkanContext. Returns 1
+// if the expression doesn't parse, needs more columns than the device
+// binds or matches other rows than Predicate::Evaluate, 0 otherwise
+int RunFilterBenchmark(const std::string& expression, const std::size_t rowCount);
+
+// Builds a ComputeGraph of two independent chains of stageCount
+// compactions with rising thresholds, runs it and the same passes with a
+// full barrier between every two and prints the number of levels and
+// barriers, the transient memory with and without aliasing and the time
+// of both. Needs the shared VulkanContext. Returns 1 if there is no
+// element or stage, or if either run leaves other values at the end of a
+// chain than compacting on the host, 0 otherwise
+int RunGraphBenchmark(const std::size_t elementCount, const int stageCount);
+
+// Compacts elementCount random values in [-1, 1) above threshold with each
+// OutputSizing of GpuCompactor::Compact, and with CompactBounded given half
+// the needed capacity and retried after the overflow, and prints the
+// device output memory and the time of each. Needs the shared
+// VulkanContext. Returns 1 if there are no elements or a policy's output,
+// after the retry for the bounded one, differs from the host, 0 otherwise
+int RunOutputSizingBenchmark(const std::size_t elementCount, const float threshold);
+
+// Generates an undirected R-MAT graph with 2^scale vertices and
+// edgeFactor * 2^scale edges, runs BreadthFirstSearch from a few random
+// sources and prints the traversed edges per second of it and of a host
+// BFS. Needs the shared VulkanContext. Returns 1 if the parameters are
+// out of range or a level differs from the host BFS, 0 otherwise
+int RunBfsBenchmark(const int scale, const int edgeFactor);
+
+// Culls instanceCount random instances against a camera frustum with
+// InstanceCuller, as spheres and as boxes, and prints the host time to
+// record the culling, the time until the draw list is ready and the time
+// of host culling. Needs the shared VulkanContext. Returns 1 if there are
+// no instances, a draw command is malformed or duplicated, or an instance
+// clearly inside the frustum has none, 0 otherwise
+int RunCullingBenchmark(const std::size_t instanceCount);
+
+// Extracts the positive pixels of synthetic 4K and 8K float images with
+// padded rows into (x, y, value) records with SparseExtractor and prints
+// the GPU time of every tile shape. Needs the shared VulkanContext.
+// Returns 1 if a tile shape gets the records of a region in the middle
+// of an image wrong, 0 otherwise
+int RunExtractionBenchmark();
+
+// Compacts callCount inputs of elementCount floats through the C interface
+// of VkMBCNTLib (VkMbcnt.h), keeping several calls in flight, and prints
+// the calls per second. Runs with plain host pointers, with the same
+// pointers after importing them up front, and with the imported buffers.
+// Creates its own library context. Returns
+// 1 if there are no elements, no context can be created, a call fails or
+// the results of the first calls differ from the host, 0 otherwise
+int RunLibraryBenchmark(const std::size_t callCount, const std::size_t elementCount);
+
+// Finds the structural characters of megabytes MiB of synthetic CSV with
+// quoted fields with StructuralIndexer and prints the GB/s of a scalar
+// loop, IndexTextOnHost, the GPU including transfers and the GPU alone.
+// Needs the shared VulkanContext. Returns 1 if the offsets with 64 and
+// 32-bit widths, small chunks or a short output, or the count on the
+// device, differ from the scalar loop, 0 otherwise
+int RunTextIndexBenchmark(const std::size_t megabytes);
+
+// Converts pruned size x size and 1.5 size x 1.5 size matrices to CSR with
+// CsrConverter, keeping the non-zero elements and those with a magnitude
+// above 0.5, and prints the host time, the GPU time including transfers
+// and the GPU time alone. Needs the shared VulkanContext. Returns 1 if a
+// conversion differs from the host or doesn't convert back to the
+// thresholded matrix, 0 otherwise
+int RunCsrBenchmark(const std::size_t size);
+
+// Creates runCount VulkanContexts with options one after another and
+// compacts a few elements with each, and prints the time to create the
+// context and of the first compaction. The first run is the cold start,
+// it loads the driver; the average of the others is the warm start.
+// Doesn't use the shared VulkanContext. Returns 1 if runCount is less
+// than 2, a context can't be created or a compaction is wrong, 0 otherwise
+int RunContextBenchmark(const VulkanContext::Options& options, const int runCount);
+}   // namespace AMD
+
+#endif
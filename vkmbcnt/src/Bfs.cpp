@@ -0,0 +1,325 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Bfs.h"
+
+#include "Trace.h"
+
+#include "Shaders.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#ifdef max
+#undef max
+#endif
+
+namespace AMD
+{
+namespace
+{
+// Must match stateData in bfs-expand.comp and bfs-advance.comp. Starts
+// with the VkDispatchIndirectCommand for the next level
+struct State
+{
+    uint32_t dispatchSize[3];
+    uint32_t frontierCount;
+    uint32_t nextFrontierCount;
+    uint32_t levelCount;
+};
+
+// Must match the push constants of bfs-expand.comp
+struct ExpandParameters
+{
+    uint32_t level;
+};
+
+// Row offsets, columns, visited, levels, frontier, next frontier, state
+const int ExpandBufferCount = 7;
+
+///////////////////////////////////////////////////////////////////////////////
+void Upload(VkDevice device, const Buffer& buffer, const void* data,
+    const std::size_t size)
+{
+    void* mapping = MapBuffer(device, buffer);
+    std::memcpy(mapping, data, size);
+    UnmapBuffer(device, buffer);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void RecordBarrier(VkCommandBuffer commandBuffer,
+    const VkPipelineStageFlags srcStages, const VkAccessFlags srcAccess,
+    const VkPipelineStageFlags dstStages, const VkAccessFlags dstAccess)
+{
+    VkMemoryBarrier memoryBarrier = {};
+    memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    memoryBarrier.srcAccessMask = srcAccess;
+    memoryBarrier.dstAccessMask = dstAccess;
+    vkCmdPipelineBarrier(commandBuffer, srcStages, dstStages, 0,
+        1, &memoryBarrier, 0, nullptr, 0, nullptr);
+}
+}   // namespace
+
+const uint32_t BreadthFirstSearch::Unreached;
+const int BreadthFirstSearch::LevelsPerSubmission;
+
+///////////////////////////////////////////////////////////////////////////////
+BreadthFirstSearch::BreadthFirstSearch(std::shared_ptr<VulkanContext> context)
+    : context_(context)
+    , submitter_(*context, "BreadthFirstSearch")
+{
+    device_ = context_->GetDevice();
+
+    for (int i = 0; i < 2; ++i)
+    {
+        expandDescriptorPools_[i] = VK_NULL_HANDLE;
+        expandDescriptorSets_[i] = VK_NULL_HANDLE;
+    }
+
+    expandPipeline_ = CreateComputePipeline(device_, context_->GetPipelineCache(),
+        BfsExpandShader, sizeof(BfsExpandShader), ExpandBufferCount,
+        sizeof(ExpandParameters));
+    advancePipeline_ = CreateComputePipeline(device_, context_->GetPipelineCache(),
+        BfsAdvanceShader, sizeof(BfsAdvanceShader), 1);
+
+    stateBuffer_ = CreateBuffer(device_, context_->GetCapabilities().memoryTypes,
+        sizeof(State), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+        | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    advanceDescriptorSet_ = CreateStorageBufferDescriptorSet(device_,
+        advancePipeline_.descriptorSetLayout, &stateBuffer_, 1,
+        &advanceDescriptorPool_);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+BreadthFirstSearch::~BreadthFirstSearch()
+{
+    DestroyGraph();
+
+    vkDestroyDescriptorPool(device_, advanceDescriptorPool_, nullptr);
+    DestroyBuffer(device_, stateBuffer_);
+
+    DestroyComputePipeline(device_, advancePipeline_);
+    DestroyComputePipeline(device_, expandPipeline_);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void BreadthFirstSearch::SetGraph(const CsrGraph& graph)
+{
+    AMD_TRACE_SCOPE("BfsUpload");
+
+    // Offsets, and so edge indices, are 32 bits wide
+    assert(graph.GetEdgeCount() <= 0xFFFFFFFFu);
+
+    DestroyGraph();
+
+    vertexCount_ = graph.GetVertexCount();
+    if (vertexCount_ == 0)
+    {
+        return;
+    }
+
+    const auto& memoryTypes = context_->GetCapabilities().memoryTypes;
+    const VkDeviceSize vertexSize = vertexCount_ * sizeof(uint32_t);
+
+    rowOffsetBuffer_ = CreateBuffer(device_, memoryTypes,
+        graph.rowOffsets.size() * sizeof(uint32_t), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+
+    // A graph without edges still needs something to bind
+    columnBuffer_ = CreateBuffer(device_, memoryTypes,
+        std::max<std::size_t>(graph.columns.size(), 1) * sizeof(uint32_t),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+
+    visitedBuffer_ = CreateBuffer(device_, memoryTypes,
+        (vertexCount_ + 31) / 32 * sizeof(uint32_t),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    levelBuffer_ = CreateBuffer(device_, memoryTypes, vertexSize,
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    for (int i = 0; i < 2; ++i)
+    {
+        frontierBuffers_[i] = CreateBuffer(device_, memoryTypes, vertexSize,
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    }
+
+    Upload(device_, rowOffsetBuffer_, graph.rowOffsets.data(),
+        graph.rowOffsets.size() * sizeof(uint32_t));
+    Upload(device_, columnBuffer_, graph.columns.data(),
+        graph.columns.size() * sizeof(uint32_t));
+
+    // Even levels read frontier 0 and write frontier 1, odd levels the
+    // other way round
+    for (int i = 0; i < 2; ++i)
+    {
+        const Buffer buffers[ExpandBufferCount] = {
+            rowOffsetBuffer_, columnBuffer_, visitedBuffer_, levelBuffer_,
+            frontierBuffers_[i], frontierBuffers_[1 - i], stateBuffer_
+        };
+
+        expandDescriptorSets_[i] = CreateStorageBufferDescriptorSet(device_,
+            expandPipeline_.descriptorSetLayout, buffers, ExpandBufferCount,
+            &expandDescriptorPools_[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+uint32_t BreadthFirstSearch::Search(const uint32_t source, uint32_t* levels)
+{
+    AMD_TRACE_SCOPE("Bfs");
+
+    assert(source < vertexCount_);
+
+    lastSubmissionCount_ = 0;
+    uint32_t level = 0;
+    State state = {};
+
+    for (;;)
+    {
+        const VkCommandBuffer commandBuffer = submitter_.Begin();
+
+        if (level == 0)
+        {
+            RecordInitialize(commandBuffer, source);
+        }
+
+        for (int i = 0; i < LevelsPerSubmission; ++i)
+        {
+            RecordLevel(commandBuffer, level++);
+        }
+
+        submitter_.SubmitAndWait();
+        ++lastSubmissionCount_;
+
+        std::memcpy(&state, MapBuffer(device_, stateBuffer_), sizeof(state));
+        vkUnmapMemory(device_, stateBuffer_.memory);
+
+        if (state.frontierCount == 0)
+        {
+            break;
+        }
+    }
+
+    if (levels)
+    {
+        AMD_TRACE_SCOPE("Readback");
+
+        std::memcpy(levels, MapBuffer(device_, levelBuffer_),
+            vertexCount_ * sizeof(uint32_t));
+        vkUnmapMemory(device_, levelBuffer_.memory);
+    }
+
+    return state.levelCount;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void BreadthFirstSearch::RecordInitialize(VkCommandBuffer commandBuffer,
+    const uint32_t source)
+{
+    vkCmdFillBuffer(commandBuffer, levelBuffer_.buffer, 0, VK_WHOLE_SIZE, Unreached);
+    vkCmdFillBuffer(commandBuffer, visitedBuffer_.buffer, 0, VK_WHOLE_SIZE, 0);
+
+    RecordBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_ACCESS_TRANSFER_WRITE_BIT);
+
+    // The source is visited, on level 0 and the whole first frontier
+    const uint32_t sourceLevel = 0;
+    const uint32_t sourceBit = 1u << (source & 31);
+    vkCmdUpdateBuffer(commandBuffer, levelBuffer_.buffer,
+        source * sizeof(uint32_t), sizeof(uint32_t), &sourceLevel);
+    vkCmdUpdateBuffer(commandBuffer, visitedBuffer_.buffer,
+        (source / 32) * sizeof(uint32_t), sizeof(uint32_t), &sourceBit);
+    vkCmdUpdateBuffer(commandBuffer, frontierBuffers_[0].buffer,
+        0, sizeof(uint32_t), &source);
+
+    const State state = { { 1, 1, 1 }, 1, 0, 1 };
+    vkCmdUpdateBuffer(commandBuffer, stateBuffer_.buffer, 0, sizeof(state), &state);
+
+    RecordBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_ACCESS_TRANSFER_WRITE_BIT,
+        VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_SHADER_READ_BIT
+        | VK_ACCESS_SHADER_WRITE_BIT);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void BreadthFirstSearch::RecordLevel(VkCommandBuffer commandBuffer,
+    const uint32_t level)
+{
+    ExpandParameters parameters;
+    parameters.level = level;
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+        expandPipeline_.pipeline);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+        expandPipeline_.pipelineLayout, 0, 1, &expandDescriptorSets_[level & 1],
+        0, nullptr);
+    vkCmdPushConstants(commandBuffer, expandPipeline_.pipelineLayout,
+        VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(parameters), &parameters);
+    vkCmdDispatchIndirect(commandBuffer, stateBuffer_.buffer, 0);
+
+    RecordBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_ACCESS_SHADER_WRITE_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT);
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+        advancePipeline_.pipeline);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+        advancePipeline_.pipelineLayout, 0, 1, &advanceDescriptorSet_,
+        0, nullptr);
+    vkCmdDispatch(commandBuffer, 1, 1, 1);
+
+    // The next level reads the dispatch size as indirect arguments
+    RecordBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_ACCESS_SHADER_WRITE_BIT,
+        VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_SHADER_READ_BIT
+        | VK_ACCESS_SHADER_WRITE_BIT);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void BreadthFirstSearch::DestroyGraph()
+{
+    for (int i = 0; i < 2; ++i)
+    {
+        if (expandDescriptorPools_[i])
+        {
+            vkDestroyDescriptorPool(device_, expandDescriptorPools_[i], nullptr);
+            expandDescriptorPools_[i] = VK_NULL_HANDLE;
+        }
+    }
+
+    for (const auto buffer : { &rowOffsetBuffer_, &columnBuffer_, &visitedBuffer_,
+        &levelBuffer_, &frontierBuffers_[0], &frontierBuffers_[1] })
+    {
+        if (buffer->buffer)
+        {
+            DestroyBuffer(device_, *buffer);
+            *buffer = Buffer();
+        }
+    }
+
+    vertexCount_ = 0;
+}
+}   // namespace AMD
@@ -0,0 +1,129 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef AMD_VULKAN_SAMPLE_BFS_H_
+#define AMD_VULKAN_SAMPLE_BFS_H_
+
+#include "VulkanContext.h"
+#include "VulkanUtility.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace AMD
+{
+///////////////////////////////////////////////////////////////////////////////
+// Directed graph in compressed sparse row form: the neighbours of vertex v
+// are columns [rowOffsets [v] .. rowOffsets [v + 1])
+struct CsrGraph
+{
+    std::vector<uint32_t> rowOffsets;
+    std::vector<uint32_t> columns;
+
+    uint32_t GetVertexCount() const
+    {
+        return rowOffsets.empty() ? 0
+            : static_cast<uint32_t> (rowOffsets.size() - 1);
+    }
+
+    std::size_t GetEdgeCount() const
+    {
+        return columns.size();
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Level-synchronous breadth-first search on the GPU.
+//
+// The frontier is a list of vertices. For every level, bfs-expand.comp
+// walks the adjacency lists of the frontier, claims unvisited neighbours
+// in a visited bitmap with atomicOr and compacts the ones it claimed into
+// the next frontier with ballot/mbcnt. Lists of 64 edges or more are
+// walked by the whole wave, so a hub doesn't keep its wave busy while the
+// other lanes idle. bfs-advance.comp then swaps the frontiers and writes
+// the size of the next dispatch, which is issued with
+// vkCmdDispatchIndirect. LevelsPerSubmission levels are recorded into one
+// command buffer, levels past the end of the search dispatch nothing, and
+// the host only checks whether the frontier is empty between submissions.
+class BreadthFirstSearch
+{
+public:
+    BreadthFirstSearch(const BreadthFirstSearch&) = delete;
+    BreadthFirstSearch& operator= (const BreadthFirstSearch&) = delete;
+
+    explicit BreadthFirstSearch(std::shared_ptr<VulkanContext> context = VulkanContext::Get());
+    ~BreadthFirstSearch();
+
+    // Uploads graph, which is used by every Search until the next call
+    void SetGraph(const CsrGraph& graph);
+
+    // Searches from source. If levels isn't null, it receives the level of
+    // every vertex, Unreached for the ones source doesn't lead to. Returns
+    // the number of levels, the one of source included
+    uint32_t Search(const uint32_t source, uint32_t* levels);
+
+    // Submissions of the last Search
+    int GetLastSubmissionCount() const
+    {
+        return lastSubmissionCount_;
+    }
+
+    static const uint32_t Unreached = 0xFFFFFFFFu;
+    static const int LevelsPerSubmission = 8;
+
+private:
+    void DestroyGraph();
+    void RecordInitialize(VkCommandBuffer commandBuffer, const uint32_t source);
+    void RecordLevel(VkCommandBuffer commandBuffer, const uint32_t level);
+
+    std::shared_ptr<VulkanContext> context_;
+    VkDevice device_ = VK_NULL_HANDLE;
+
+    ComputePipeline expandPipeline_;
+    ComputePipeline advancePipeline_;
+
+    uint32_t vertexCount_ = 0;
+
+    Buffer rowOffsetBuffer_;
+    Buffer columnBuffer_;
+    Buffer visitedBuffer_;
+    Buffer levelBuffer_;
+    Buffer frontierBuffers_[2];
+
+    // Dispatch size and frontier counts, see State in Bfs.cpp
+    Buffer stateBuffer_;
+
+    // One expand set per frontier parity, recreated by SetGraph
+    VkDescriptorPool expandDescriptorPools_[2];
+    VkDescriptorSet expandDescriptorSets_[2];
+    VkDescriptorPool advanceDescriptorPool_ = VK_NULL_HANDLE;
+    VkDescriptorSet advanceDescriptorSet_ = VK_NULL_HANDLE;
+
+    CommandSubmitter submitter_;
+
+    int lastSubmissionCount_ = 0;
+};
+}   // namespace AMD
+
+#endif
@@ -0,0 +1,235 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "ColumnFilter.h"
+
+#include "Trace.h"
+
+#include <cassert>
+#include <cstring>
+
+namespace AMD
+{
+///////////////////////////////////////////////////////////////////////////////
+ColumnFilter::ColumnFilter(std::shared_ptr<VulkanContext> context)
+    : context_(context)
+    , submitter_(*context, "ColumnFilter")
+{
+    device_ = context_->GetDevice();
+
+    counterBuffer_ = CreateBuffer(device_, context_->GetCapabilities().memoryTypes,
+        sizeof(uint32_t),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ColumnFilter::~ColumnFilter()
+{
+    if (descriptorPool_)
+    {
+        vkDestroyDescriptorPool(device_, descriptorPool_, nullptr);
+    }
+
+    for (const auto& buffer : columnBuffers_)
+    {
+        DestroyBuffer(device_, buffer);
+    }
+
+    if (outputBuffer_.buffer)
+    {
+        DestroyBuffer(device_, outputBuffer_);
+    }
+
+    DestroyBuffer(device_, counterBuffer_);
+
+    for (const auto& bucket : pipelines_)
+    {
+        for (const auto& entry : bucket.second)
+        {
+            DestroyComputePipeline(device_, entry.pipeline);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool ColumnFilter::IsSupported(const Predicate& predicate) const
+{
+    return static_cast<uint32_t> (predicate.GetColumnCount() + 2) <=
+        context_->GetCapabilities().properties.limits.maxPerStageDescriptorStorageBuffers;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ColumnFilter::Prepare(const Predicate& predicate)
+{
+    GetPipeline(predicate);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const ComputePipeline& ColumnFilter::GetPipeline(const Predicate& predicate)
+{
+    auto& bucket = pipelines_[predicate.GetHash()];
+
+    for (const auto& entry : bucket)
+    {
+        if (entry.columnCount == predicate.GetColumnCount() &&
+            entry.canonicalForm == predicate.GetCanonicalForm())
+        {
+            return entry.pipeline;
+        }
+    }
+
+    AMD_TRACE_SCOPE("CompilePredicate");
+
+    const std::vector<uint32_t> code = predicate.CompileToSpirv();
+
+    CacheEntry entry;
+    entry.canonicalForm = predicate.GetCanonicalForm();
+    entry.columnCount = predicate.GetColumnCount();
+    entry.pipeline = CreateComputePipeline(device_, context_->GetPipelineCache(),
+        code.data(), code.size() * sizeof(uint32_t),
+        predicate.GetColumnCount() + 2, sizeof(uint32_t));
+
+    bucket.push_back(entry);
+    ++cachedPipelineCount_;
+
+    return bucket.back().pipeline;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t ColumnFilter::Filter(const Predicate& predicate,
+    const float* const* columns, const std::size_t rowCount, uint32_t* output)
+{
+    AMD_TRACE_SCOPE("ColumnFilter");
+
+    assert(IsSupported(predicate));
+    assert(rowCount <= 0xFFFFFFFFu);
+
+    // The shader clamps its loads to the last row, so there must be one
+    if (rowCount == 0)
+    {
+        return 0;
+    }
+
+    const ComputePipeline& pipeline = GetPipeline(predicate);
+    const int columnCount = predicate.GetColumnCount();
+
+    ReserveBuffers(columnCount, rowCount, pipeline.descriptorSetLayout);
+
+    {
+        AMD_TRACE_SCOPE("Upload");
+
+        for (int i = 0; i < columnCount; ++i)
+        {
+            void* mapping = MapBuffer(device_, columnBuffers_[i]);
+            std::memcpy(mapping, columns[i], rowCount * sizeof(float));
+            UnmapBuffer(device_, columnBuffers_[i]);
+        }
+    }
+
+    {
+        AMD_TRACE_SCOPE("Dispatch");
+
+        const VkCommandBuffer commandBuffer = submitter_.Begin();
+
+        vkCmdFillBuffer(commandBuffer, counterBuffer_.buffer, 0, VK_WHOLE_SIZE, 0);
+
+        VkMemoryBarrier memoryBarrier = {};
+        memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        memoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+            1, &memoryBarrier, 0, nullptr, 0, nullptr);
+
+        const uint32_t parameters = static_cast<uint32_t> (rowCount);
+
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+            pipeline.pipeline);
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+            pipeline.pipelineLayout, 0, 1, &descriptorSet_, 0, nullptr);
+        vkCmdPushConstants(commandBuffer, pipeline.pipelineLayout,
+            VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(parameters), &parameters);
+
+        // One row per lane, one wave per work group
+        DispatchFlat(commandBuffer, static_cast<uint32_t> ((rowCount + 63) / 64));
+        submitter_.SubmitAndWait();
+    }
+
+    std::size_t result = 0;
+
+    {
+        AMD_TRACE_SCOPE("Readback");
+
+        result = *static_cast<const uint32_t*> (MapBuffer(device_, counterBuffer_));
+        vkUnmapMemory(device_, counterBuffer_.memory);
+
+        std::memcpy(output, MapBuffer(device_, outputBuffer_), result * sizeof(uint32_t));
+        vkUnmapMemory(device_, outputBuffer_.memory);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ColumnFilter::ReserveBuffers(const int columnCount, const std::size_t rowCount,
+    VkDescriptorSetLayout descriptorSetLayout)
+{
+    const auto& memoryTypes = context_->GetCapabilities().memoryTypes;
+    bool recreated = (columnCount != descriptorSetColumnCount_);
+
+    if (static_cast<int> (columnBuffers_.size()) < columnCount)
+    {
+        columnBuffers_.resize(columnCount);
+    }
+
+    for (int i = 0; i < columnCount; ++i)
+    {
+        recreated |= ReserveBuffer(device_, memoryTypes, rowCount * sizeof(float),
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, &columnBuffers_[i]);
+    }
+
+    recreated |= ReserveBuffer(device_, memoryTypes, rowCount * sizeof(uint32_t),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, &outputBuffer_);
+
+    if (!recreated)
+    {
+        return;
+    }
+
+    // The set points at the old buffers, or has a different layout
+    if (descriptorPool_)
+    {
+        vkDestroyDescriptorPool(device_, descriptorPool_, nullptr);
+    }
+
+    std::vector<Buffer> buffers(columnBuffers_.begin(),
+        columnBuffers_.begin() + columnCount);
+    buffers.push_back(outputBuffer_);
+    buffers.push_back(counterBuffer_);
+
+    descriptorSet_ = CreateStorageBufferDescriptorSet(device_,
+        descriptorSetLayout, buffers.data(),
+        static_cast<int> (buffers.size()), &descriptorPool_);
+    descriptorSetColumnCount_ = columnCount;
+}
+}   // namespace AMD
@@ -0,0 +1,111 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef AMD_VULKAN_SAMPLE_COLUMN_FILTER_H_
+#define AMD_VULKAN_SAMPLE_COLUMN_FILTER_H_
+
+#include "PredicateCompiler.h"
+#include "VulkanContext.h"
+#include "VulkanUtility.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace AMD
+{
+///////////////////////////////////////////////////////////////////////////////
+// Runs Predicate filters over float columns on the GPU. Every distinct
+// predicate is compiled into its own pipeline once, on first use, and
+// cached by Predicate::GetHash, so a scan which keeps applying the same
+// filter only pays for the upload and the dispatch.
+class ColumnFilter
+{
+public:
+    ColumnFilter(const ColumnFilter&) = delete;
+    ColumnFilter& operator= (const ColumnFilter&) = delete;
+
+    explicit ColumnFilter(std::shared_ptr<VulkanContext> context = VulkanContext::Get());
+    ~ColumnFilter();
+
+    // The shader binds one storage buffer per column plus two, which must
+    // not exceed maxPerStageDescriptorStorageBuffers
+    bool IsSupported(const Predicate& predicate) const;
+
+    // Compiles the pipeline for predicate unless it is cached already.
+    // Filter does this on demand, call it up front to keep the compile out
+    // of the first Filter
+    void Prepare(const Predicate& predicate);
+
+    // columns holds predicate.GetColumnCount () pointers to rowCount floats.
+    // Writes the indices of the matching rows to output, which must have
+    // room for rowCount indices. Indices are ascending within a wave, but
+    // waves are written in the order they finish. Returns the number of
+    // indices written
+    std::size_t Filter(const Predicate& predicate, const float* const* columns,
+        const std::size_t rowCount, uint32_t* output);
+
+    std::size_t GetCachedPipelineCount() const
+    {
+        return cachedPipelineCount_;
+    }
+
+private:
+    struct CacheEntry
+    {
+        // Verified on every hit, so hash collisions only cost a compile
+        std::string canonicalForm;
+        int columnCount;
+        ComputePipeline pipeline;
+    };
+
+    const ComputePipeline& GetPipeline(const Predicate& predicate);
+
+    // Grows the buffers for columnCount columns of rowCount rows and points
+    // descriptorSet_ at them. The set is only recreated if a buffer was, or
+    // for a different column count. Pipelines with the same column count
+    // have identical set layouts, so any of them can use the set
+    void ReserveBuffers(const int columnCount, const std::size_t rowCount,
+        VkDescriptorSetLayout descriptorSetLayout);
+
+    std::shared_ptr<VulkanContext> context_;
+    VkDevice device_ = VK_NULL_HANDLE;
+
+    std::unordered_map<uint64_t, std::vector<CacheEntry>> pipelines_;
+    std::size_t cachedPipelineCount_ = 0;
+
+    std::vector<Buffer> columnBuffers_;
+    Buffer outputBuffer_;
+    Buffer counterBuffer_;
+
+    VkDescriptorPool descriptorPool_ = VK_NULL_HANDLE;
+    VkDescriptorSet descriptorSet_ = VK_NULL_HANDLE;
+    int descriptorSetColumnCount_ = 0;
+
+    CommandSubmitter submitter_;
+};
+}   // namespace AMD
+
+#endif
@@ -0,0 +1,502 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "ComputeGraph.h"
+
+#include "Trace.h"
+#include "Utility.h"
+
+#include <algorithm>
+#include <cassert>
+
+#ifdef max
+#undef max
+#endif
+
+#ifdef min
+#undef min
+#endif
+
+namespace AMD
+{
+namespace
+{
+///////////////////////////////////////////////////////////////////////////////
+bool IsWrite(const BufferAccess access)
+{
+    return access == BufferAccess::ShaderWrite || access == BufferAccess::TransferWrite;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+VkPipelineStageFlags GetStage(const BufferAccess access)
+{
+    switch (access)
+    {
+    case BufferAccess::TransferRead:
+    case BufferAccess::TransferWrite:
+        return VK_PIPELINE_STAGE_TRANSFER_BIT;
+    default:
+        return VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Everything the use may do to the buffer
+VkAccessFlags GetAccess(const BufferAccess access)
+{
+    switch (access)
+    {
+    case BufferAccess::ShaderRead:
+        return VK_ACCESS_SHADER_READ_BIT;
+    case BufferAccess::ShaderWrite:
+        return VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    case BufferAccess::TransferRead:
+        return VK_ACCESS_TRANSFER_READ_BIT;
+    default:
+        return VK_ACCESS_TRANSFER_WRITE_BIT;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Only the writes of the use, which are all a later access has to wait for
+VkAccessFlags GetWriteAccess(const BufferAccess access)
+{
+    switch (access)
+    {
+    case BufferAccess::ShaderWrite:
+        return VK_ACCESS_SHADER_WRITE_BIT;
+    case BufferAccess::TransferWrite:
+        return VK_ACCESS_TRANSFER_WRITE_BIT;
+    default:
+        return 0;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct Dependency
+{
+    int from;
+    VkPipelineStageFlags srcStages;
+    VkAccessFlags srcAccess;
+    VkPipelineStageFlags dstStages;
+    VkAccessFlags dstAccess;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Program order state of one buffer
+struct Hazards
+{
+    int lastWriter = -1;
+    BufferAccess lastWrite = BufferAccess::ShaderWrite;
+
+    // Passes which read it since lastWriter
+    std::vector<std::pair<int, BufferAccess>> readers;
+};
+}   // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+ComputeGraph::ComputeGraph(std::shared_ptr<VulkanContext> context)
+    : context_(context)
+{
+    device_ = context_->GetDevice();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ComputeGraph::~ComputeGraph()
+{
+    for (const auto& resource : buffers_)
+    {
+        if (resource.transient && resource.buffer.buffer)
+        {
+            vkDestroyBuffer(device_, resource.buffer.buffer, nullptr);
+        }
+    }
+
+    if (transientMemory_)
+    {
+        vkFreeMemory(device_, transientMemory_, nullptr);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ComputeGraph::BufferHandle ComputeGraph::ImportBuffer(const Buffer& buffer)
+{
+    assert(!compiled_);
+
+    Resource resource;
+    resource.buffer = buffer;
+    buffers_.push_back(resource);
+
+    return static_cast<BufferHandle> (buffers_.size() - 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ComputeGraph::BufferHandle ComputeGraph::CreateTransientBuffer(const VkDeviceSize size)
+{
+    assert(!compiled_);
+
+    Resource resource;
+    resource.buffer.size = size;
+    resource.transient = true;
+    buffers_.push_back(resource);
+
+    return static_cast<BufferHandle> (buffers_.size() - 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ComputeGraph::AddPass(const std::string& name,
+    const std::vector<BufferUse>& uses, RecordFunction record)
+{
+    assert(!compiled_);
+
+    Pass pass;
+    pass.name = name;
+    pass.uses = uses;
+    pass.record = record;
+    passes_.push_back(pass);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ComputeGraph::Compile()
+{
+    AMD_TRACE_SCOPE("CompileGraph");
+
+    assert(!compiled_);
+    compiled_ = true;
+
+    Schedule();
+    AllocateTransients();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ComputeGraph::Schedule()
+{
+    const int passCount = static_cast<int> (passes_.size());
+
+    // Incoming dependencies of every pass, from program order
+    std::vector<std::vector<Dependency>> dependencies(passCount);
+    std::vector<Hazards> hazards(buffers_.size());
+
+    for (int pass = 0; pass < passCount; ++pass)
+    {
+        for (const auto& use : passes_[pass].uses)
+        {
+            auto& state = hazards[use.buffer];
+
+            const VkPipelineStageFlags dstStages = GetStage(use.access);
+            const VkAccessFlags dstAccess = GetAccess(use.access);
+
+            // Reads and writes wait for the last write
+            if (state.lastWriter >= 0)
+            {
+                const Dependency dependency = { state.lastWriter,
+                    GetStage(state.lastWrite), GetWriteAccess(state.lastWrite),
+                    dstStages, dstAccess };
+                dependencies[pass].push_back(dependency);
+            }
+
+            if (IsWrite(use.access))
+            {
+                // Writes also wait for the reads before them, but nothing
+                // has to be made visible
+                for (const auto& reader : state.readers)
+                {
+                    const Dependency dependency = { reader.first,
+                        GetStage(reader.second), 0, dstStages, 0 };
+                    dependencies[pass].push_back(dependency);
+                }
+
+                state.lastWriter = pass;
+                state.lastWrite = use.access;
+                state.readers.clear();
+            }
+            else
+            {
+                state.readers.push_back(std::make_pair(pass, use.access));
+            }
+        }
+    }
+
+    // As early as possible first, which gives the number of levels ...
+    std::vector<int> earliest(passCount, 0);
+    std::vector<std::vector<int>> successors(passCount);
+
+    for (int pass = 0; pass < passCount; ++pass)
+    {
+        for (const auto& dependency : dependencies[pass])
+        {
+            earliest[pass] = std::max(earliest[pass], earliest[dependency.from] + 1);
+            successors[dependency.from].push_back(pass);
+        }
+    }
+
+    // ... then as late as the successors allow. Passes without successors
+    // stay early, delaying them would only stretch the lifetimes of what
+    // they read
+    for (int pass = passCount - 1; pass >= 0; --pass)
+    {
+        int level = earliest[pass];
+
+        if (!successors[pass].empty())
+        {
+            level = passCount;
+            for (const int successor : successors[pass])
+            {
+                level = std::min(level, passes_[successor].level - 1);
+            }
+        }
+
+        passes_[pass].level = level;
+    }
+
+    // Drop the levels nothing ended up in
+    std::vector<int> usedLevels;
+    for (const auto& pass : passes_)
+    {
+        usedLevels.push_back(pass.level);
+    }
+
+    std::sort(usedLevels.begin(), usedLevels.end());
+    usedLevels.erase(std::unique(usedLevels.begin(), usedLevels.end()), usedLevels.end());
+
+    levels_.assign(usedLevels.size(), std::vector<int>());
+    barriers_.assign(usedLevels.size(), Barrier());
+
+    for (int pass = 0; pass < passCount; ++pass)
+    {
+        auto& level = passes_[pass].level;
+        level = static_cast<int> (std::lower_bound(usedLevels.begin(),
+            usedLevels.end(), level) - usedLevels.begin());
+
+        levels_[level].push_back(pass);
+
+        auto& barrier = barriers_[level];
+        for (const auto& dependency : dependencies[pass])
+        {
+            assert(passes_[dependency.from].level < level);
+
+            barrier.srcStages |= dependency.srcStages;
+            barrier.srcAccess |= dependency.srcAccess;
+            barrier.dstStages |= dependency.dstStages;
+            barrier.dstAccess |= dependency.dstAccess;
+        }
+
+        for (const auto& use : passes_[pass].uses)
+        {
+            auto& resource = buffers_[use.buffer];
+
+            resource.firstLevel = (resource.firstLevel < 0) ? level
+                : std::min(resource.firstLevel, level);
+            resource.lastLevel = std::max(resource.lastLevel, level);
+            resource.stages |= GetStage(use.access);
+            resource.access |= GetAccess(use.access);
+            resource.writeAccess |= GetWriteAccess(use.access);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ComputeGraph::AllocateTransients()
+{
+    std::vector<int> transients;
+    for (int i = 0; i < static_cast<int> (buffers_.size()); ++i)
+    {
+        if (buffers_[i].transient)
+        {
+            transients.push_back(i);
+        }
+    }
+
+    if (transients.empty())
+    {
+        return;
+    }
+
+    const int lastLevel = std::max(0, GetLevelCount() - 1);
+
+    std::vector<VkMemoryRequirements> requirements(buffers_.size());
+    std::vector<VkDeviceSize> offsets(buffers_.size(), 0);
+    uint32_t memoryTypeBits = ~0u;
+
+    for (const int i : transients)
+    {
+        auto& resource = buffers_[i];
+
+        // Unused transients are given the whole graph, so they alias
+        // nothing
+        if (resource.firstLevel < 0)
+        {
+            resource.firstLevel = 0;
+            resource.lastLevel = lastLevel;
+        }
+
+        VkBufferCreateInfo bufferCreateInfo = {};
+        bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufferCreateInfo.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+            | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        bufferCreateInfo.size = resource.buffer.size;
+
+        vkCreateBuffer(device_, &bufferCreateInfo, nullptr, &resource.buffer.buffer);
+        vkGetBufferMemoryRequirements(device_, resource.buffer.buffer, &requirements[i]);
+
+        memoryTypeBits &= requirements[i].memoryTypeBits;
+        unaliasedTransientMemorySize_ += requirements[i].size;
+    }
+
+    // Largest first, each at the lowest offset which doesn't collide with
+    // a transient placed before it that is alive at the same time
+    std::stable_sort(transients.begin(), transients.end(), [&](int a, int b) {
+        return requirements[a].size > requirements[b].size;
+    });
+
+    std::vector<int> placed;
+
+    for (const int i : transients)
+    {
+        auto& resource = buffers_[i];
+        const VkDeviceSize size = requirements[i].size;
+        const VkDeviceSize alignment = std::max<VkDeviceSize>(requirements[i].alignment, 1);
+
+        std::vector<int> alive;
+        for (const int other : placed)
+        {
+            if (buffers_[other].firstLevel <= resource.lastLevel &&
+                resource.firstLevel <= buffers_[other].lastLevel)
+            {
+                alive.push_back(other);
+            }
+        }
+
+        std::sort(alive.begin(), alive.end(), [&](int a, int b) {
+            return offsets[a] < offsets[b];
+        });
+
+        VkDeviceSize offset = 0;
+        for (const int other : alive)
+        {
+            if (RoundToNextMultiple(offset, alignment) + size <= offsets[other])
+            {
+                break;
+            }
+
+            offset = std::max(offset, offsets[other] + requirements[other].size);
+        }
+
+        offsets[i] = RoundToNextMultiple(offset, alignment);
+        transientMemorySize_ = std::max(transientMemorySize_, offsets[i] + size);
+
+        // Sharing memory with a transient from other levels is a hazard
+        // like any other: the later one waits for the earlier one
+        for (const int other : placed)
+        {
+            const bool overlaps = offsets[i] < offsets[other] + requirements[other].size
+                && offsets[other] < offsets[i] + size;
+
+            if (!overlaps)
+            {
+                continue;
+            }
+
+            const bool otherFirst = buffers_[other].lastLevel < resource.firstLevel;
+            const Resource& earlier = otherFirst ? buffers_[other] : resource;
+            const Resource& later = otherFirst ? resource : buffers_[other];
+
+            auto& barrier = barriers_[later.firstLevel];
+            barrier.srcStages |= earlier.stages;
+            barrier.srcAccess |= earlier.writeAccess;
+            barrier.dstStages |= later.stages;
+            barrier.dstAccess |= later.access;
+        }
+
+        placed.push_back(i);
+    }
+
+    const MemoryTypeInfo* memoryInfo = FindMemoryType(
+        context_->GetCapabilities().memoryTypes, memoryTypeBits,
+        MemoryLocation::DeviceLocal);
+    assert(memoryInfo);
+
+    VkMemoryAllocateInfo memoryAllocateInfo = {};
+    memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    memoryAllocateInfo.memoryTypeIndex = memoryInfo->index;
+    memoryAllocateInfo.allocationSize = transientMemorySize_;
+
+    vkAllocateMemory(device_, &memoryAllocateInfo, nullptr, &transientMemory_);
+
+    for (const int i : transients)
+    {
+        auto& buffer = buffers_[i].buffer;
+        buffer.memory = transientMemory_;
+        buffer.hostVisible = memoryInfo->hostVisible;
+        buffer.hostCoherent = memoryInfo->hostCoherent;
+
+        vkBindBufferMemory(device_, buffer.buffer, transientMemory_, offsets[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ComputeGraph::Record(VkCommandBuffer commandBuffer) const
+{
+    assert(compiled_);
+
+    for (std::size_t level = 0; level < levels_.size(); ++level)
+    {
+        const auto& barrier = barriers_[level];
+
+        if (barrier.srcStages)
+        {
+            // Write-after-read needs an execution dependency only
+            VkMemoryBarrier memoryBarrier = {};
+            memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            memoryBarrier.srcAccessMask = barrier.srcAccess;
+            memoryBarrier.dstAccessMask = barrier.dstAccess;
+
+            const uint32_t memoryBarrierCount = barrier.srcAccess ? 1 : 0;
+            vkCmdPipelineBarrier(commandBuffer, barrier.srcStages,
+                barrier.dstStages, 0,
+                memoryBarrierCount, &memoryBarrier, 0, nullptr, 0, nullptr);
+        }
+
+        for (const int pass : levels_[level])
+        {
+            passes_[pass].record(commandBuffer, *this);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int ComputeGraph::GetBarrierCount() const
+{
+    int result = 0;
+
+    for (const auto& barrier : barriers_)
+    {
+        if (barrier.srcStages)
+        {
+            ++result;
+        }
+    }
+
+    return result;
+}
+}   // namespace AMD
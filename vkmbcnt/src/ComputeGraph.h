@@ -0,0 +1,194 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef AMD_VULKAN_SAMPLE_COMPUTE_GRAPH_H_
+#define AMD_VULKAN_SAMPLE_COMPUTE_GRAPH_H_
+
+#include "VulkanContext.h"
+#include "VulkanUtility.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace AMD
+{
+///////////////////////////////////////////////////////////////////////////////
+// How a pass uses a buffer
+enum class BufferAccess
+{
+    ShaderRead,
+
+    // Includes reading, for instance atomics or in-place kernels
+    ShaderWrite,
+
+    TransferRead,
+    TransferWrite
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Records a chain of compute and transfer passes into one command buffer
+// and places the barriers between them.
+//
+// Passes are added in program order and declare every buffer they touch.
+// Compile derives the read-after-write, write-after-write and
+// write-after-read hazards from that order, and groups the passes into
+// levels: a pass only depends on passes of earlier levels, so the passes
+// of one level are recorded back to back and may overlap on the GPU. A
+// single merged vkCmdPipelineBarrier goes in front of every level which
+// depends on an earlier one. Passes are placed as late as their consumers
+// allow, which takes as many levels as placing them early but keeps
+// transient buffers alive for less time.
+//
+// Transient buffers only exist inside the graph. Compile places them in
+// one DEVICE_LOCAL allocation, and transients whose levels don't overlap
+// share memory. Their contents are undefined until a pass writes them.
+//
+// Synchronization with work outside the graph, such as host writes before
+// or host reads after, stays with the caller.
+class ComputeGraph
+{
+public:
+    ComputeGraph(const ComputeGraph&) = delete;
+    ComputeGraph& operator= (const ComputeGraph&) = delete;
+
+    typedef int BufferHandle;
+
+    struct BufferUse
+    {
+        BufferHandle buffer;
+        BufferAccess access;
+    };
+
+    // Records the commands of a pass. Buffers are looked up with
+    // graph.GetBuffer. Passes must not record barriers for buffers they
+    // declared
+    typedef std::function<void(VkCommandBuffer commandBuffer,
+        const ComputeGraph& graph)> RecordFunction;
+
+    explicit ComputeGraph(std::shared_ptr<VulkanContext> context = VulkanContext::Get());
+    ~ComputeGraph();
+
+    // buffer must outlive the graph
+    BufferHandle ImportBuffer(const Buffer& buffer);
+
+    // Usable for storage and as transfer source and destination
+    BufferHandle CreateTransientBuffer(const VkDeviceSize size);
+
+    // A buffer may only appear once in uses
+    void AddPass(const std::string& name, const std::vector<BufferUse>& uses,
+        RecordFunction record);
+
+    // Schedules the passes, computes the barriers and allocates the
+    // transient buffers. The graph can't change afterwards
+    void Compile();
+
+    // Records the whole graph into commandBuffer, which must be recording.
+    // Can be called any number of times after Compile
+    void Record(VkCommandBuffer commandBuffer) const;
+
+    // Transient buffers are only valid after Compile
+    const Buffer& GetBuffer(const BufferHandle handle) const
+    {
+        return buffers_[handle].buffer;
+    }
+
+    int GetPassCount() const
+    {
+        return static_cast<int> (passes_.size());
+    }
+
+    int GetLevelCount() const
+    {
+        return static_cast<int> (levels_.size());
+    }
+
+    int GetBarrierCount() const;
+
+    // Size of the transient allocation, and what it would take without
+    // aliasing
+    VkDeviceSize GetTransientMemorySize() const
+    {
+        return transientMemorySize_;
+    }
+
+    VkDeviceSize GetUnaliasedTransientMemorySize() const
+    {
+        return unaliasedTransientMemorySize_;
+    }
+
+private:
+    struct Resource
+    {
+        Buffer buffer;
+        bool transient = false;
+
+        // Levels of the first and last pass using it, set by Compile
+        int firstLevel = -1;
+        int lastLevel = -1;
+
+        // Union of all uses, for hazards between aliased transients
+        VkPipelineStageFlags stages = 0;
+        VkAccessFlags access = 0;
+        VkAccessFlags writeAccess = 0;
+    };
+
+    struct Pass
+    {
+        std::string name;
+        std::vector<BufferUse> uses;
+        RecordFunction record;
+        int level = 0;
+    };
+
+    // Merged barrier in front of a level. No stages means no barrier
+    struct Barrier
+    {
+        VkPipelineStageFlags srcStages = 0;
+        VkPipelineStageFlags dstStages = 0;
+        VkAccessFlags srcAccess = 0;
+        VkAccessFlags dstAccess = 0;
+    };
+
+    void Schedule();
+    void AllocateTransients();
+
+    std::shared_ptr<VulkanContext> context_;
+    VkDevice device_ = VK_NULL_HANDLE;
+
+    std::vector<Resource> buffers_;
+    std::vector<Pass> passes_;
+
+    // Pass indices, in program order within a level
+    std::vector<std::vector<int>> levels_;
+    std::vector<Barrier> barriers_;
+
+    VkDeviceMemory transientMemory_ = VK_NULL_HANDLE;
+    VkDeviceSize transientMemorySize_ = 0;
+    VkDeviceSize unaliasedTransientMemorySize_ = 0;
+    bool compiled_ = false;
+};
+}   // namespace AMD
+
+#endif
@@ -0,0 +1,201 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Culling.h"
+
+#include "Shaders.h"
+
+#include <cassert>
+#include <cmath>
+
+namespace AMD
+{
+namespace
+{
+// Must match the push constants of cull.comp
+struct CullingParameters
+{
+    float planes[6][4];
+    uint32_t instanceCount;
+};
+
+// Bounds, mesh indices, meshes, visible instances, draw commands, count
+const int BufferCount = 6;
+}   // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+Frustum ExtractFrustum(const float* viewProjection)
+{
+    // Row i of the matrix is (m [i], m [4 + i], m [8 + i], m [12 + i]). A
+    // clip space point is inside if -w <= x, y <= w and 0 <= z <= w
+    const struct
+    {
+        int row;
+        float sign;
+    } combinations[6] = {
+        { 0, 1 }, { 0, -1 },    // left, right
+        { 1, 1 }, { 1, -1 },    // bottom, top
+        { 2, 0 }, { 2, -1 }     // near, far
+    };
+
+    Frustum result;
+
+    for (int i = 0; i < 6; ++i)
+    {
+        float* plane = result.planes[i];
+
+        for (int column = 0; column < 4; ++column)
+        {
+            const float w = viewProjection[column * 4 + 3];
+            const float v = viewProjection[column * 4 + combinations[i].row];
+
+            // Near is z >= 0 on its own, without w
+            plane[column] = (i == 4) ? v : w + combinations[i].sign * v;
+        }
+
+        const float length = std::sqrt(plane[0] * plane[0]
+            + plane[1] * plane[1] + plane[2] * plane[2]);
+
+        for (int j = 0; j < 4; ++j)
+        {
+            plane[j] /= length;
+        }
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+InstanceCuller::InstanceCuller(std::shared_ptr<VulkanContext> context)
+    : context_(context)
+{
+    device_ = context_->GetDevice();
+
+    // Both variants have the same set layout, so a set created against
+    // either works with both
+    for (int i = 0; i < 2; ++i)
+    {
+        const VkBool32 boxBounds = (i == static_cast<int> (BoundsType::Box)) ? 1u : 0u;
+
+        VkSpecializationMapEntry mapEntry = {};
+        mapEntry.constantID = 0;
+        mapEntry.size = sizeof(boxBounds);
+
+        VkSpecializationInfo specializationInfo = {};
+        specializationInfo.mapEntryCount = 1;
+        specializationInfo.pMapEntries = &mapEntry;
+        specializationInfo.dataSize = sizeof(boxBounds);
+        specializationInfo.pData = &boxBounds;
+
+        pipelines_[i] = CreateComputePipeline(device_, context_->GetPipelineCache(),
+            CullShader, sizeof(CullShader), BufferCount, sizeof(CullingParameters),
+            0, &specializationInfo);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+InstanceCuller::~InstanceCuller()
+{
+    if (descriptorPool_)
+    {
+        vkDestroyDescriptorPool(device_, descriptorPool_, nullptr);
+    }
+
+    for (const auto& pipeline : pipelines_)
+    {
+        DestroyComputePipeline(device_, pipeline);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void InstanceCuller::SetBuffers(const CullingBuffers& buffers)
+{
+    if (descriptorPool_)
+    {
+        vkDestroyDescriptorPool(device_, descriptorPool_, nullptr);
+    }
+
+    const Buffer bindings[BufferCount] = {
+        buffers.bounds, buffers.meshIndices, buffers.meshes,
+        buffers.visibleInstances, buffers.drawCommands, buffers.drawCount
+    };
+
+    descriptorSet_ = CreateStorageBufferDescriptorSet(device_,
+        pipelines_[0].descriptorSetLayout, bindings, BufferCount,
+        &descriptorPool_);
+    drawCount_ = buffers.drawCount;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void InstanceCuller::Record(VkCommandBuffer commandBuffer, const Frustum& frustum,
+    const std::size_t instanceCount, const BoundsType boundsType,
+    const VkPipelineStageFlags consumerStages)
+{
+    assert(descriptorSet_);
+    assert(instanceCount <= 0xFFFFFFFFu);
+
+    // The previous frame's draws may still read the count and commands
+    VkMemoryBarrier memoryBarrier = {};
+    memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    vkCmdPipelineBarrier(commandBuffer, consumerStages,
+        VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+        0, nullptr, 0, nullptr, 0, nullptr);
+
+    vkCmdFillBuffer(commandBuffer, drawCount_.buffer, 0, sizeof(uint32_t), 0);
+
+    memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    memoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+        1, &memoryBarrier, 0, nullptr, 0, nullptr);
+
+    CullingParameters parameters;
+    for (int i = 0; i < 6; ++i)
+    {
+        for (int j = 0; j < 4; ++j)
+        {
+            parameters.planes[i][j] = frustum.planes[i][j];
+        }
+    }
+    parameters.instanceCount = static_cast<uint32_t> (instanceCount);
+
+    const ComputePipeline& pipeline = pipelines_[static_cast<int> (boundsType)];
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+        pipeline.pipeline);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+        pipeline.pipelineLayout, 0, 1, &descriptorSet_, 0, nullptr);
+    vkCmdPushConstants(commandBuffer, pipeline.pipelineLayout,
+        VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(parameters), &parameters);
+
+    // One instance per lane
+    DispatchFlat(commandBuffer, static_cast<uint32_t> ((instanceCount + 63) / 64));
+
+    memoryBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    memoryBarrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT
+        | VK_ACCESS_SHADER_READ_BIT;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        consumerStages, 0,
+        1, &memoryBarrier, 0, nullptr, 0, nullptr);
+}
+}   // namespace AMD
@@ -0,0 +1,145 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef AMD_VULKAN_SAMPLE_CULLING_H_
+#define AMD_VULKAN_SAMPLE_CULLING_H_
+
+#include "VulkanContext.h"
+#include "VulkanUtility.h"
+
+#include <cstddef>
+#include <memory>
+
+namespace AMD
+{
+///////////////////////////////////////////////////////////////////////////////
+// Six planes ax + by + cz + d, with (a, b, c) normalized. A point is inside
+// if all six are >= 0
+struct Frustum
+{
+    float planes[6][4];
+};
+
+// Planes of the frustum of a column-major view-projection matrix, with
+// clip space depth in [0, w] as in Vulkan
+Frustum ExtractFrustum(const float* viewProjection);
+
+///////////////////////////////////////////////////////////////////////////////
+// Index range of a mesh, copied into the draw command of every visible
+// instance which uses the mesh
+struct MeshDraw
+{
+    uint32_t indexCount;
+    uint32_t firstIndex;
+    int32_t vertexOffset;
+    uint32_t padding;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+enum class BoundsType
+{
+    // One (center, radius) vec4 per instance
+    Sphere,
+
+    // Axis-aligned boxes, (center, unused) followed by (half extents,
+    // unused) per instance
+    Box
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Buffers of InstanceCuller::SetBuffers. All need STORAGE usage
+struct CullingBuffers
+{
+    Buffer bounds;
+
+    // Mesh of every instance, an index into meshes
+    Buffer meshIndices;
+    Buffer meshes;
+
+    // Room for one uint32_t and one VkDrawIndexedIndirectCommand per
+    // instance. The commands need INDIRECT usage
+    Buffer visibleInstances;
+    Buffer drawCommands;
+
+    // One uint32_t, needs INDIRECT and TRANSFER_DST usage
+    Buffer drawCount;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// GPU frustum culling which produces the draw list directly.
+//
+// cull.comp tests the bounds of every instance against the frustum, which
+// is passed as push constants, and compacts the visible instances with
+// ballot/mbcnt. For each of them it writes the instance ID and a
+// VkDrawIndexedIndirectCommand for its mesh, with the ID as firstInstance,
+// and the number of commands ends up in the draw count. That is what
+// vkCmdDrawIndexedIndirectCountKHR consumes; without the extension, the
+// commands can be drawn with vkCmdDrawIndexedIndirect after reading back
+// the count.
+//
+// The buffers are bound once, so recording the culling for a frame costs
+// the same handful of calls however many instances there are.
+//
+// Record only needs a queue with compute support. To draw the results on a
+// graphics queue, record the culling there too, or hand the buffers over
+// with a queue family ownership transfer and a semaphore; the barriers in
+// Record only cover commands on the same queue.
+class InstanceCuller
+{
+public:
+    InstanceCuller(const InstanceCuller&) = delete;
+    InstanceCuller& operator= (const InstanceCuller&) = delete;
+
+    explicit InstanceCuller(std::shared_ptr<VulkanContext> context = VulkanContext::Get());
+    ~InstanceCuller();
+
+    // Binds buffers for all following Record calls. Must not be called
+    // while command buffers recorded with the previous ones are pending
+    void SetBuffers(const CullingBuffers& buffers);
+
+    // Records clearing the draw count and culling instanceCount instances
+    // into commandBuffer, which must be recording. consumerStages are the
+    // stages which read the results. Record waits for the previous frame's
+    // reads in those stages first, and ends with a barrier which makes the
+    // results visible to them. The default is valid on compute-only queues.
+    // Pass VK_PIPELINE_STAGE_VERTEX_SHADER_BIT as well if vertex shaders
+    // read the visible instances, which needs a graphics queue
+    void Record(VkCommandBuffer commandBuffer, const Frustum& frustum,
+        const std::size_t instanceCount, const BoundsType boundsType,
+        const VkPipelineStageFlags consumerStages =
+            VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+
+private:
+    std::shared_ptr<VulkanContext> context_;
+    VkDevice device_ = VK_NULL_HANDLE;
+
+    // Indexed by BoundsType
+    ComputePipeline pipelines_[2];
+
+    Buffer drawCount_;
+    VkDescriptorPool descriptorPool_ = VK_NULL_HANDLE;
+    VkDescriptorSet descriptorSet_ = VK_NULL_HANDLE;
+};
+}   // namespace AMD
+
+#endif
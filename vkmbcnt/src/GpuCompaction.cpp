@@ -0,0 +1,779 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "GpuCompaction.h"
+
+#include "Trace.h"
+#include "Utility.h"
+
+#include "Shaders.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#ifdef max
+#undef max
+#endif
+
+#ifdef min
+#undef min
+#endif
+
+namespace AMD
+{
+namespace
+{
+// Input, output, counter
+const int BufferCount = 3;
+
+///////////////////////////////////////////////////////////////////////////////
+void FillBufferInfos(const Buffer* buffers, VkDescriptorBufferInfo* bufferInfos)
+{
+    for (int i = 0; i < BufferCount; ++i)
+    {
+        bufferInfos[i].buffer = buffers[i].buffer;
+        bufferInfos[i].offset = 0;
+        bufferInfos[i].range = buffers[i].size;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FillWriteDescriptorSets(VkDescriptorSet descriptorSet,
+    const VkDescriptorBufferInfo* bufferInfos,
+    VkWriteDescriptorSet* writeDescriptorSets)
+{
+    for (int i = 0; i < BufferCount; ++i)
+    {
+        writeDescriptorSets[i] = {};
+        writeDescriptorSets[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writeDescriptorSets[i].dstSet = descriptorSet;
+        writeDescriptorSets[i].descriptorCount = 1;
+        writeDescriptorSets[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        writeDescriptorSets[i].dstBinding = i;
+        writeDescriptorSets[i].pBufferInfo = &bufferInfos[i];
+    }
+}
+
+// Usage of the output buffer of the Compact functions. It lives in device
+// memory and is copied out by ReadBack
+const VkBufferUsageFlags OutputBufferUsage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+    | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+}   // namespace
+
+const int GpuCompactor::MaxDescriptorSets;
+const uint32_t GpuCompactor::InPlaceTileSize;
+
+///////////////////////////////////////////////////////////////////////////////
+GpuCompactor::GpuCompactor(std::shared_ptr<VulkanContext> context)
+    : context_(context)
+    , submitter_(*context, "Compaction")
+{
+    device_ = context_->GetDevice();
+    importTable_ = &context_->GetImportTable();
+
+    kernel_ = CreateKernel(CompactShader, sizeof(CompactShader), 64);
+    inPlaceKernel_ = CreateKernel(InPlaceCompactShader,
+        sizeof(InPlaceCompactShader), InPlaceTileSize);
+
+    if (importTable_->vkCreateDescriptorUpdateTemplateKHR)
+    {
+        // The data passed to the update is an array of BufferCount
+        // VkDescriptorBufferInfo, one per binding
+        VkDescriptorUpdateTemplateEntryKHR entries[BufferCount] = {};
+        for (int i = 0; i < BufferCount; ++i)
+        {
+            entries[i].dstBinding = i;
+            entries[i].descriptorCount = 1;
+            entries[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            entries[i].offset = i * sizeof(VkDescriptorBufferInfo);
+            entries[i].stride = sizeof(VkDescriptorBufferInfo);
+        }
+
+        VkDescriptorUpdateTemplateCreateInfoKHR templateCreateInfo = {};
+        templateCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO_KHR;
+        templateCreateInfo.descriptorUpdateEntryCount = BufferCount;
+        templateCreateInfo.pDescriptorUpdateEntries = entries;
+        templateCreateInfo.templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET_KHR;
+        templateCreateInfo.descriptorSetLayout = kernel_.pipeline.descriptorSetLayout;
+
+        importTable_->vkCreateDescriptorUpdateTemplateKHR(device_,
+            &templateCreateInfo, nullptr, &updateTemplate_);
+    }
+
+    VkDescriptorPoolSize descriptorPoolSize = {};
+    descriptorPoolSize.descriptorCount = MaxDescriptorSets * BufferCount;
+    descriptorPoolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+
+    // Sets are never freed one by one, only the whole pool is reset
+    VkDescriptorPoolCreateInfo descriptorPoolCreateInfo = {};
+    descriptorPoolCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    descriptorPoolCreateInfo.maxSets = MaxDescriptorSets;
+    descriptorPoolCreateInfo.poolSizeCount = 1;
+    descriptorPoolCreateInfo.pPoolSizes = &descriptorPoolSize;
+
+    vkCreateDescriptorPool(device_, &descriptorPoolCreateInfo, nullptr,
+        &descriptorPool_);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+GpuCompactor::~GpuCompactor()
+{
+    for (const auto& buffer : buffers_)
+    {
+        if (buffer.buffer)
+        {
+            DestroyBuffer(device_, buffer);
+        }
+    }
+
+    if (readbackBuffer_.buffer)
+    {
+        DestroyBuffer(device_, readbackBuffer_);
+    }
+
+    vkDestroyDescriptorPool(device_, descriptorPool_, nullptr);
+
+    if (updateTemplate_)
+    {
+        importTable_->vkDestroyDescriptorUpdateTemplateKHR(device_,
+            updateTemplate_, nullptr);
+    }
+
+    for (const auto& formatKernels : packedKernels_)
+    {
+        for (const auto& kernel : formatKernels)
+        {
+            if (kernel.pipeline.pipeline)
+            {
+                DestroyKernel(kernel);
+            }
+        }
+    }
+
+    DestroyKernel(inPlaceKernel_);
+    DestroyKernel(kernel_);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool GpuCompactor::IsSupported(const BindingMode mode) const
+{
+    switch (mode)
+    {
+    case BindingMode::PushDescriptor:
+        return kernel_.pushPipeline.pipeline != VK_NULL_HANDLE;
+    case BindingMode::UpdateTemplate:
+        return updateTemplate_ != VK_NULL_HANDLE;
+    default:
+        return true;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+BindingMode GpuCompactor::GetBestBindingMode() const
+{
+    if (IsSupported(BindingMode::PushDescriptor))
+    {
+        return BindingMode::PushDescriptor;
+    }
+    else if (IsSupported(BindingMode::UpdateTemplate))
+    {
+        return BindingMode::UpdateTemplate;
+    }
+    else
+    {
+        return BindingMode::DescriptorSet;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void GpuCompactor::Record(VkCommandBuffer commandBuffer, const Buffer* buffers,
+    const CompactionParameters& parameters, const BindingMode mode,
+    const bool clearCounter)
+{
+    Bind(commandBuffer, kernel_, buffers, mode);
+
+    const auto& pipeline = (mode == BindingMode::PushDescriptor)
+        ? kernel_.pushPipeline : kernel_.pipeline;
+    RecordDispatch(commandBuffer, pipeline, kernel_.tileSize,
+        buffers[2], sizeof(uint32_t), parameters, nullptr, clearCounter);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void GpuCompactor::Record(VkCommandBuffer commandBuffer, const Buffer* buffers,
+    VkDescriptorSet descriptorSet, const CompactionParameters& parameters)
+{
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+        kernel_.pipeline.pipelineLayout, 0, 1, &descriptorSet, 0, nullptr);
+
+    RecordDispatch(commandBuffer, kernel_.pipeline, kernel_.tileSize,
+        buffers[2], sizeof(uint32_t), parameters);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void GpuCompactor::RecordInPlace(VkCommandBuffer commandBuffer, const Buffer& data,
+    const Buffer& state, const CompactionParameters& parameters,
+    const BindingMode mode)
+{
+    // The ready bit of the tile prefixes takes the top bit
+    assert(parameters.elementCount < 0x80000000u);
+    assert(state.size >= GetInPlaceStateSize(parameters.elementCount));
+
+    // The output binding isn't used by the kernel, but the set layout is
+    // shared with the out of place kernel so it has to point somewhere
+    const Buffer buffers[BufferCount] = { data, data, state };
+    Bind(commandBuffer, inPlaceKernel_, buffers, mode);
+
+    // All tiles have to start out as not ready
+    const auto& pipeline = (mode == BindingMode::PushDescriptor)
+        ? inPlaceKernel_.pushPipeline : inPlaceKernel_.pipeline;
+    RecordDispatch(commandBuffer, pipeline, inPlaceKernel_.tileSize,
+        state, GetInPlaceStateSize(parameters.elementCount), parameters);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+VkDeviceSize GpuCompactor::GetInPlaceStateSize(const std::size_t elementCount)
+{
+    // Output count, next tile and one prefix per tile
+    const std::size_t tileCount = (elementCount + InPlaceTileSize - 1) / InPlaceTileSize;
+    return (2 + tileCount) * sizeof(uint32_t);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void GpuCompactor::RecordPacked(VkCommandBuffer commandBuffer, const Buffer* buffers,
+    const CompactionParameters& parameters, const InputFormat format,
+    const bool widenOutput, const BindingMode mode)
+{
+    const Kernel& kernel = GetPackedKernel(format, widenOutput);
+    Bind(commandBuffer, kernel, buffers, mode);
+
+    // Only packed elements smaller than a word are merged into the output
+    const bool mergesOutput = !widenOutput && GetElementSize(format) < 4;
+
+    const auto& pipeline = (mode == BindingMode::PushDescriptor)
+        ? kernel.pushPipeline : kernel.pipeline;
+    RecordDispatch(commandBuffer, pipeline, kernel.tileSize,
+        buffers[2], sizeof(uint32_t), parameters,
+        mergesOutput ? &buffers[1] : nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void GpuCompactor::ResetDescriptors()
+{
+    vkResetDescriptorPool(device_, descriptorPool_, 0);
+    usedDescriptorSets_ = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t GpuCompactor::Compact(const float* input, const std::size_t elementCount,
+    float* output, const float threshold, const OutputSizing sizing)
+{
+    AMD_TRACE_SCOPE("GpuCompact");
+
+    if (elementCount == 0)
+    {
+        return 0;
+    }
+
+    // The kernels and CompactionParameters count elements in 32 bits, in
+    // place even in 31
+    assert(elementCount <= 0xFFFFFFFFu);
+
+    const bool inPlace = (output == input);
+    const bool countFirst = !inPlace && (sizing == OutputSizing::CountFirst);
+
+    {
+        AMD_TRACE_SCOPE("Allocate");
+
+        const VkDeviceSize size = elementCount * sizeof(float);
+        const auto& memoryTypes = context_->GetCapabilities().memoryTypes;
+
+        // In place there is no output buffer at all, and the input is
+        // read back instead. Counting first allocates it once the count
+        // is known
+        ReserveBuffer(device_, memoryTypes, size,
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+            &buffers_[0]);
+
+        if (!inPlace && !countFirst)
+        {
+            ReserveBuffer(device_, memoryTypes, size, OutputBufferUsage,
+                &buffers_[1], MemoryLocation::DeviceLocal);
+        }
+
+        ReserveBuffer(device_, memoryTypes,
+            inPlace ? GetInPlaceStateSize(elementCount) : sizeof(uint32_t),
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+            &buffers_[2]);
+    }
+
+    Upload(input, elementCount * sizeof(float));
+
+    if (inPlace)
+    {
+        {
+            AMD_TRACE_SCOPE("Record");
+
+            const VkCommandBuffer commandBuffer = submitter_.Begin();
+
+            CompactionParameters parameters;
+            parameters.elementCount = static_cast<uint32_t> (elementCount);
+            parameters.threshold = threshold;
+
+            RecordInPlace(commandBuffer, buffers_[0], buffers_[2], parameters,
+                GetBestBindingMode());
+        }
+
+        SubmitAndWait();
+
+        const std::size_t result = ReadCount();
+
+        ReadBack(buffers_[0], result * sizeof(float), output);
+
+        return result;
+    }
+
+    uint32_t outputCapacity = 0xFFFFFFFFu;
+
+    if (countFirst)
+    {
+        const std::size_t count = RunCompaction(elementCount, threshold, 0);
+
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        {
+            AMD_TRACE_SCOPE("Allocate");
+            ReserveBuffer(device_, context_->GetCapabilities().memoryTypes,
+                count * sizeof(float), OutputBufferUsage, &buffers_[1],
+                MemoryLocation::DeviceLocal);
+        }
+
+        outputCapacity = static_cast<uint32_t> (count);
+    }
+
+    const std::size_t result = RunCompaction(elementCount, threshold, outputCapacity);
+
+    ReadBack(buffers_[1], result * sizeof(float), output);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t GpuCompactor::CompactBounded(const float* input,
+    const std::size_t elementCount, float* output,
+    const std::size_t outputCapacity, const float threshold)
+{
+    AMD_TRACE_SCOPE("GpuCompactBounded");
+
+    if (elementCount == 0)
+    {
+        return 0;
+    }
+
+    // The kernel counts elements in 32 bits
+    assert(elementCount <= 0xFFFFFFFFu);
+
+    // More than elementCount is never needed
+    const uint32_t capacity = static_cast<uint32_t> (std::min(outputCapacity, elementCount));
+
+    {
+        AMD_TRACE_SCOPE("Allocate");
+
+        const auto& memoryTypes = context_->GetCapabilities().memoryTypes;
+
+        ReserveBuffer(device_, memoryTypes, elementCount * sizeof(float),
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+            &buffers_[0]);
+
+        if (capacity > 0)
+        {
+            ReserveBuffer(device_, memoryTypes, capacity * sizeof(float),
+                OutputBufferUsage, &buffers_[1], MemoryLocation::DeviceLocal);
+        }
+
+        ReserveBuffer(device_, memoryTypes, sizeof(uint32_t),
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+            &buffers_[2]);
+    }
+
+    Upload(input, elementCount * sizeof(float));
+
+    const std::size_t result = RunCompaction(elementCount, threshold, capacity);
+
+    ReadBack(buffers_[1], std::min<std::size_t>(result, capacity) * sizeof(float), output);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t GpuCompactor::CompactPacked(const void* input, const std::size_t elementCount,
+    const InputFormat format, void* output, const bool widenOutput,
+    const float threshold, const float scale)
+{
+    AMD_TRACE_SCOPE("GpuCompactPacked");
+
+    if (elementCount == 0)
+    {
+        return 0;
+    }
+
+    const std::size_t inputSize = elementCount * GetElementSize(format);
+    const std::size_t outputElementSize = widenOutput ? sizeof(float) : GetElementSize(format);
+
+    {
+        AMD_TRACE_SCOPE("Allocate");
+
+        const auto& memoryTypes = context_->GetCapabilities().memoryTypes;
+
+        // The kernel reads whole words
+        ReserveBuffer(device_, memoryTypes, RoundToNextMultiple<std::size_t>(inputSize, 4),
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+            &buffers_[0]);
+        ReserveBuffer(device_, memoryTypes,
+            RoundToNextMultiple<std::size_t>(elementCount * outputElementSize, 4),
+            OutputBufferUsage, &buffers_[1], MemoryLocation::DeviceLocal);
+        ReserveBuffer(device_, memoryTypes, sizeof(uint32_t),
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+            &buffers_[2]);
+    }
+
+    Upload(input, inputSize);
+
+    {
+        AMD_TRACE_SCOPE("Record");
+
+        const VkCommandBuffer commandBuffer = submitter_.Begin();
+
+        CompactionParameters parameters;
+        parameters.elementCount = static_cast<uint32_t> (elementCount);
+        parameters.threshold = threshold;
+        parameters.scale = scale;
+
+        RecordPacked(commandBuffer, buffers_, parameters, format, widenOutput,
+            GetBestBindingMode());
+    }
+
+    SubmitAndWait();
+
+    const std::size_t result = ReadCount();
+
+    ReadBack(buffers_[1], result * outputElementSize, output);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void GpuCompactor::Upload(const void* input, const std::size_t size)
+{
+    AMD_TRACE_SCOPE("Upload");
+
+    void* mapping = MapBuffer(device_, buffers_[0]);
+    std::memcpy(mapping, input, size);
+    UnmapBuffer(device_, buffers_[0]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Compacts the uploaded input into buffers_[1] and returns the counter.
+// With outputCapacity 0 nothing is written, and the output binding points
+// at the counter, so buffers_[1] doesn't have to exist yet
+std::size_t GpuCompactor::RunCompaction(const std::size_t elementCount,
+    const float threshold, const uint32_t outputCapacity)
+{
+    {
+        AMD_TRACE_SCOPE("Record");
+
+        const VkCommandBuffer commandBuffer = submitter_.Begin();
+
+        CompactionParameters parameters;
+        parameters.elementCount = static_cast<uint32_t> (elementCount);
+        parameters.threshold = threshold;
+        parameters.outputCapacity = outputCapacity;
+
+        const Buffer buffers[BufferCount] = {
+            buffers_[0], outputCapacity ? buffers_[1] : buffers_[2], buffers_[2]
+        };
+
+        Record(commandBuffer, buffers, parameters, GetBestBindingMode());
+    }
+
+    SubmitAndWait();
+
+    return ReadCount();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void GpuCompactor::SubmitAndWait()
+{
+    submitter_.SubmitAndWait();
+
+    // The submission is done with the descriptor sets of this round
+    ResetDescriptors();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t GpuCompactor::ReadCount()
+{
+    // The counter, or the first word of the in-place state
+    const std::size_t result = *static_cast<const uint32_t*> (MapBuffer(device_, buffers_[2]));
+    vkUnmapMemory(device_, buffers_[2].memory);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void GpuCompactor::ReadBack(const Buffer& source, const std::size_t size, void* output)
+{
+    AMD_TRACE_SCOPE("Readback");
+
+    // The count is known by now, so only the valid prefix crosses the bus,
+    // and the host reads it from cached memory
+    if (size == 0)
+    {
+        return;
+    }
+
+    const VkDeviceSize nonCoherentAtomSize =
+        context_->GetCapabilities().properties.limits.nonCoherentAtomSize;
+
+    // In place the result is in the input buffer, which the host can map
+    // already. SubmitAndWait made the shader writes visible to the host
+    if (source.hostVisible)
+    {
+        const void* mapping = MapBufferRange(device_, source, 0, size,
+            nonCoherentAtomSize);
+        std::memcpy(output, mapping, size);
+        vkUnmapMemory(device_, source.memory);
+
+        return;
+    }
+
+    ReserveBuffer(device_, context_->GetCapabilities().memoryTypes, size,
+        VK_BUFFER_USAGE_TRANSFER_DST_BIT, &readbackBuffer_,
+        MemoryLocation::HostCached);
+
+    const VkCommandBuffer commandBuffer = submitter_.Begin();
+
+    // SubmitAndWait only made the shader writes available to the host
+    VkMemoryBarrier memoryBarrier = {};
+    memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    memoryBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    memoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+        1, &memoryBarrier, 0, nullptr, 0, nullptr);
+
+    VkBufferCopy region = {};
+    region.size = size;
+    vkCmdCopyBuffer(commandBuffer, source.buffer, readbackBuffer_.buffer, 1, &region);
+
+    memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    memoryBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_PIPELINE_STAGE_HOST_BIT, 0,
+        1, &memoryBarrier, 0, nullptr, 0, nullptr);
+
+    SubmitAndWait();
+
+    const void* mapping = MapBufferRange(device_, readbackBuffer_, 0, size,
+        nonCoherentAtomSize);
+    std::memcpy(output, mapping, size);
+    vkUnmapMemory(device_, readbackBuffer_.memory);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+GpuCompactor::Kernel GpuCompactor::CreateKernel(const void* shaderContents,
+    const size_t shaderSize, const uint32_t tileSize,
+    const VkSpecializationInfo* specializationInfo)
+{
+    Kernel result;
+    result.tileSize = tileSize;
+
+    result.pipeline = CreateComputePipeline(device_, context_->GetPipelineCache(),
+        shaderContents, shaderSize, BufferCount, sizeof(CompactionParameters),
+        0, specializationInfo);
+
+    if (importTable_->vkCmdPushDescriptorSetKHR)
+    {
+        result.pushPipeline = CreateComputePipeline(device_, context_->GetPipelineCache(),
+            shaderContents, shaderSize, BufferCount, sizeof(CompactionParameters),
+            VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR,
+            specializationInfo);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void GpuCompactor::DestroyKernel(const Kernel& kernel)
+{
+    if (kernel.pushPipeline.pipeline)
+    {
+        DestroyComputePipeline(device_, kernel.pushPipeline);
+    }
+
+    DestroyComputePipeline(device_, kernel.pipeline);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const GpuCompactor::Kernel& GpuCompactor::GetPackedKernel(const InputFormat format,
+    const bool widenOutput)
+{
+    Kernel& kernel = packedKernels_[static_cast<int> (format)][widenOutput ? 1 : 0];
+
+    if (!kernel.pipeline.pipeline)
+    {
+        // Constant 0 is the format, 1 is widenOutput (a 32-bit bool)
+        const uint32_t constants[2] = {
+            static_cast<uint32_t> (format),
+            widenOutput ? 1u : 0u
+        };
+
+        VkSpecializationMapEntry mapEntries[2] = {};
+        for (uint32_t i = 0; i < 2; ++i)
+        {
+            mapEntries[i].constantID = i;
+            mapEntries[i].offset = i * sizeof(uint32_t);
+            mapEntries[i].size = sizeof(uint32_t);
+        }
+
+        VkSpecializationInfo specializationInfo = {};
+        specializationInfo.mapEntryCount = 2;
+        specializationInfo.pMapEntries = mapEntries;
+        specializationInfo.dataSize = sizeof(constants);
+        specializationInfo.pData = constants;
+
+        // One word per lane
+        const uint32_t tileSize = static_cast<uint32_t> (64 * 4 / GetElementSize(format));
+
+        kernel = CreateKernel(PackedCompactShader, sizeof(PackedCompactShader),
+            tileSize, &specializationInfo);
+    }
+
+    return kernel;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void GpuCompactor::Bind(VkCommandBuffer commandBuffer, const Kernel& kernel,
+    const Buffer* buffers, const BindingMode mode)
+{
+    assert(IsSupported(mode));
+
+    VkDescriptorBufferInfo bufferInfos[BufferCount];
+    FillBufferInfos(buffers, bufferInfos);
+
+    if (mode == BindingMode::PushDescriptor)
+    {
+        VkWriteDescriptorSet writeDescriptorSets[BufferCount];
+        FillWriteDescriptorSets(VK_NULL_HANDLE, bufferInfos, writeDescriptorSets);
+
+        importTable_->vkCmdPushDescriptorSetKHR(commandBuffer,
+            VK_PIPELINE_BIND_POINT_COMPUTE, kernel.pushPipeline.pipelineLayout, 0,
+            BufferCount, writeDescriptorSets);
+        return;
+    }
+
+    VkDescriptorSet descriptorSet = AllocateDescriptorSet();
+
+    if (mode == BindingMode::UpdateTemplate)
+    {
+        importTable_->vkUpdateDescriptorSetWithTemplateKHR(device_,
+            descriptorSet, updateTemplate_, bufferInfos);
+    }
+    else
+    {
+        VkWriteDescriptorSet writeDescriptorSets[BufferCount];
+        FillWriteDescriptorSets(descriptorSet, bufferInfos, writeDescriptorSets);
+
+        vkUpdateDescriptorSets(device_, BufferCount, writeDescriptorSets,
+            0, nullptr);
+    }
+
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+        kernel.pipeline.pipelineLayout, 0, 1, &descriptorSet, 0, nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void GpuCompactor::RecordDispatch(VkCommandBuffer commandBuffer,
+    const ComputePipeline& pipeline, const uint32_t tileSize,
+    const Buffer& counter, const VkDeviceSize counterSize,
+    const CompactionParameters& parameters, const Buffer* clearBuffer,
+    const bool clearCounter)
+{
+    if (clearCounter)
+    {
+        // The counter (and clearBuffer) may still be in use by a previous
+        // dispatch recorded into the same command buffer
+        VkMemoryBarrier memoryBarrier = {};
+        memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        memoryBarrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+        memoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+            VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+            1, &memoryBarrier, 0, nullptr, 0, nullptr);
+
+        vkCmdFillBuffer(commandBuffer, counter.buffer, 0, counterSize, 0);
+
+        if (clearBuffer)
+        {
+            vkCmdFillBuffer(commandBuffer, clearBuffer->buffer, 0, VK_WHOLE_SIZE, 0);
+        }
+
+        memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        memoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+            1, &memoryBarrier, 0, nullptr, 0, nullptr);
+    }
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+        pipeline.pipeline);
+    vkCmdPushConstants(commandBuffer, pipeline.pipelineLayout,
+        VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(parameters), &parameters);
+
+    // One tile per work group
+    DispatchFlat(commandBuffer, (parameters.elementCount + tileSize - 1) / tileSize);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+VkDescriptorSet GpuCompactor::AllocateDescriptorSet()
+{
+    // Callers recording more than MaxDescriptorSets dispatches between two
+    // ResetDescriptors need push descriptors
+    assert(usedDescriptorSets_ < MaxDescriptorSets);
+    ++usedDescriptorSets_;
+
+    VkDescriptorSetAllocateInfo descriptorSetAllocateInfo = {};
+    descriptorSetAllocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    descriptorSetAllocateInfo.pSetLayouts = &kernel_.pipeline.descriptorSetLayout;
+    descriptorSetAllocateInfo.descriptorSetCount = 1;
+    descriptorSetAllocateInfo.descriptorPool = descriptorPool_;
+
+    VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+    vkAllocateDescriptorSets(device_, &descriptorSetAllocateInfo, &descriptorSet);
+
+    return descriptorSet;
+}
+}   // namespace AMD
@@ -0,0 +1,258 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef AMD_VULKAN_SAMPLE_GPU_COMPACTION_H_
+#define AMD_VULKAN_SAMPLE_GPU_COMPACTION_H_
+
+#include "PackedFormats.h"
+#include "VulkanContext.h"
+#include "VulkanUtility.h"
+
+#include <cstddef>
+#include <memory>
+
+namespace AMD
+{
+///////////////////////////////////////////////////////////////////////////////
+// Push constants of the compaction kernels
+struct CompactionParameters
+{
+    uint32_t elementCount = 0;
+    float threshold = 0;
+
+    // Decoded value = integer * scale, only used for InputFormat::Int8
+    // and Int16
+    float scale = 1;
+
+    // Only used by Record. Survivors past the first outputCapacity are
+    // counted but not written, so the counter ends up with the total and
+    // the number dropped is the counter minus outputCapacity. 0 makes the
+    // dispatch count only
+    uint32_t outputCapacity = 0xFFFFFFFFu;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// How GpuCompactor::Compact sizes the device output buffer
+enum class OutputSizing
+{
+    // Room for every element, a single pass
+    WorstCase,
+
+    // A count-only pass first, then an output buffer of exactly the number
+    // of survivors. Costs a second pass over the input and a second
+    // submission, but highly selective filters only need memory for what
+    // they keep
+    CountFirst
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// How GpuCompactor::Record binds the three buffers
+enum class BindingMode
+{
+    // Allocates a set from a pool and fills it with vkUpdateDescriptorSets
+    DescriptorSet,
+
+    // Allocates a set and fills it from a descriptor update template, which
+    // skips building and validating the VkWriteDescriptorSet array
+    UpdateTemplate,
+
+    // Writes the descriptors straight into the command buffer, no set and
+    // no pool at all. Needs VK_KHR_push_descriptor
+    PushDescriptor
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Low-overhead dispatch of compact.comp. Everything which doesn't depend on
+// the buffers (pipelines, layouts, templates, the descriptor pool) is
+// created once, and scalar parameters go through push constants, so
+// recording a dispatch costs a handful of calls. Meant for high-rate small
+// jobs where Run ()-style setup per dispatch would dominate.
+class GpuCompactor
+{
+public:
+    GpuCompactor(const GpuCompactor&) = delete;
+    GpuCompactor& operator= (const GpuCompactor&) = delete;
+
+    explicit GpuCompactor(std::shared_ptr<VulkanContext> context = VulkanContext::Get());
+    ~GpuCompactor();
+
+    bool IsSupported(const BindingMode mode) const;
+
+    // Push descriptors if available, then templates, then plain sets
+    BindingMode GetBestBindingMode() const;
+
+    // Records clearing the counter and the dispatch into commandBuffer,
+    // which must be recording. buffers are the input, the output (room for
+    // elementCount floats) and the counter (one uint32_t, needs
+    // TRANSFER_DST usage). Recording is not thread safe.
+    //
+    // Without clearCounter only the binding and the dispatch are recorded:
+    // the counter must already be 0 and visible to the shader. This leaves
+    // all synchronization to the caller, for instance a ComputeGraph
+    void Record(VkCommandBuffer commandBuffer, const Buffer* buffers,
+        const CompactionParameters& parameters, const BindingMode mode,
+        const bool clearCounter = true);
+
+    // Same, but binds a set the caller created against
+    // GetDescriptorSetLayout ()
+    void Record(VkCommandBuffer commandBuffer, const Buffer* buffers,
+        VkDescriptorSet descriptorSet, const CompactionParameters& parameters);
+
+    // In-place version of Record: the survivors overwrite the start of data,
+    // in order. state needs GetInPlaceStateSize () bytes and TRANSFER_DST
+    // usage, the count ends up in its first uint32_t just like the counter
+    // of Record
+    void RecordInPlace(VkCommandBuffer commandBuffer, const Buffer& data,
+        const Buffer& state, const CompactionParameters& parameters,
+        const BindingMode mode);
+
+    static VkDeviceSize GetInPlaceStateSize(const std::size_t elementCount);
+
+    // Record for packed input: buffers[0] holds elementCount elements of
+    // format, rounded up to whole 32-bit words. The predicate applies to the
+    // decoded values; buffers[1] receives either the packed elements as they
+    // were or the decoded floats if widenOutput is set. It is cleared first,
+    // so it needs TRANSFER_DST usage
+    void RecordPacked(VkCommandBuffer commandBuffer, const Buffer* buffers,
+        const CompactionParameters& parameters, const InputFormat format,
+        const bool widenOutput, const BindingMode mode);
+
+    VkDescriptorSetLayout GetDescriptorSetLayout() const
+    {
+        return kernel_.pipeline.descriptorSetLayout;
+    }
+
+    // DescriptorSet and UpdateTemplate take one set per Record from a pool
+    // of MaxDescriptorSets sets. Call this once the command buffers using
+    // them have finished executing
+    void ResetDescriptors();
+
+    // Convenience path: uploads input, compacts it with the best binding
+    // mode and copies the survivors to output, which needs room for
+    // elementCount elements. Buffers are kept around for the next call.
+    // Returns the number of elements written.
+    //
+    // The output stays in device memory. Once the count is known, only the
+    // survivors are copied to a HOST_CACHED staging buffer, which costs a
+    // second submission but no uncached reads over the whole output.
+    //
+    // If output == input the compaction runs in place on the device, which
+    // keeps the order and needs only one data buffer instead of two. sizing
+    // is ignored then, and the survivors are read straight from the
+    // host-visible input buffer.
+    //
+    // elementCount must fit in 32 bits, in place in 31
+    std::size_t Compact(const float* input, const std::size_t elementCount,
+        float* output, const float threshold = 0.0f,
+        const OutputSizing sizing = OutputSizing::WorstCase);
+
+    // Compact with an output of outputCapacity elements, on the device and
+    // in output. Returns the total number of survivors: if that is more
+    // than outputCapacity, only the first outputCapacity that finished were
+    // written, and calling again with the returned count as capacity is
+    // guaranteed to fit. elementCount must fit in 32 bits
+    std::size_t CompactBounded(const float* input, const std::size_t elementCount,
+        float* output, const std::size_t outputCapacity,
+        const float threshold = 0.0f);
+
+    // Size of the device output buffer kept for the Compact functions
+    VkDeviceSize GetOutputBufferSize() const
+    {
+        return buffers_[1].size;
+    }
+
+    // Same for packed input. output needs room for elementCount elements of
+    // format, or floats if widenOutput is set
+    std::size_t CompactPacked(const void* input, const std::size_t elementCount,
+        const InputFormat format, void* output, const bool widenOutput,
+        const float threshold = 0.0f, const float scale = 1.0f);
+
+    static const int MaxDescriptorSets = 1024;
+
+    // Elements handled by one work group of the in-place kernel
+    static const uint32_t InPlaceTileSize = 1024;
+
+private:
+    // Both kernels use the same bindings and push constants, so their
+    // layouts are compatible and sets can be shared between them
+    struct Kernel
+    {
+        ComputePipeline pipeline;
+
+        // Same shader, but the set layout is created for push descriptors
+        ComputePipeline pushPipeline;
+
+        // Elements handled by one work group
+        uint32_t tileSize = 64;
+    };
+
+    Kernel CreateKernel(const void* shaderContents, const size_t shaderSize,
+        const uint32_t tileSize,
+        const VkSpecializationInfo* specializationInfo = nullptr);
+    void DestroyKernel(const Kernel& kernel);
+
+    // Created on first use
+    const Kernel& GetPackedKernel(const InputFormat format, const bool widenOutput);
+
+    void Bind(VkCommandBuffer commandBuffer, const Kernel& kernel,
+        const Buffer* buffers, const BindingMode mode);
+    void RecordDispatch(VkCommandBuffer commandBuffer, const ComputePipeline& pipeline,
+        const uint32_t tileSize, const Buffer& counter, const VkDeviceSize counterSize,
+        const CompactionParameters& parameters, const Buffer* clearBuffer = nullptr,
+        const bool clearCounter = true);
+    VkDescriptorSet AllocateDescriptorSet();
+
+    // Used by the Compact functions
+    void Upload(const void* input, const std::size_t size);
+    std::size_t RunCompaction(const std::size_t elementCount,
+        const float threshold, const uint32_t outputCapacity);
+    void SubmitAndWait();
+    std::size_t ReadCount();
+
+    // Copies the first size bytes of source to output, through
+    // readbackBuffer_ unless source is host visible
+    void ReadBack(const Buffer& source, const std::size_t size, void* output);
+
+    std::shared_ptr<VulkanContext> context_;
+    VkDevice device_ = VK_NULL_HANDLE;
+    const ImportTable* importTable_ = nullptr;
+
+    Kernel kernel_;
+    Kernel inPlaceKernel_;
+
+    // Indexed by format, then widenOutput
+    Kernel packedKernels_[InputFormatCount][2];
+
+    VkDescriptorUpdateTemplateKHR updateTemplate_ = VK_NULL_HANDLE;
+    VkDescriptorPool descriptorPool_ = VK_NULL_HANDLE;
+    int usedDescriptorSets_ = 0;
+
+    CommandSubmitter submitter_;
+
+    // For Compact: input, output (only for out of place) and counter
+    Buffer buffers_[3];
+    Buffer readbackBuffer_;
+};
+}   // namespace AMD
+
+#endif
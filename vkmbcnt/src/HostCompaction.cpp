@@ -0,0 +1,224 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "HostCompaction.h"
+
+#include "Trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#ifdef max
+#undef max
+#endif
+
+#ifdef min
+#undef min
+#endif
+
+namespace AMD
+{
+namespace
+{
+///////////////////////////////////////////////////////////////////////////////
+std::size_t CountChunk(const float* input, const std::size_t count,
+    const float threshold)
+{
+    std::size_t result = 0;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        result += (input[i] > threshold) ? 1 : 0;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Branch-free: every element is stored, but the output pointer only moves
+// on for the ones which pass. output must have room for count elements
+std::size_t FilterChunk(const float* input, const std::size_t count,
+    float* output, const float threshold)
+{
+    std::size_t written = 0;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const float value = input[i];
+        output[written] = value;
+        written += (value > threshold) ? 1 : 0;
+    }
+
+    return written;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Like FilterChunk, but stops once outputCount elements have been written,
+// so it never touches the next chunk's part of the shared output
+void ScatterChunk(const float* input, const std::size_t count,
+    float* output, const std::size_t outputCount, const float threshold)
+{
+    std::size_t written = 0;
+
+    for (std::size_t i = 0; i < count && written < outputCount; ++i)
+    {
+        const float value = input[i];
+        output[written] = value;
+        written += (value > threshold) ? 1 : 0;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int GetChunkCount(const std::size_t elementCount)
+{
+    return static_cast<int> ((elementCount + HostCompactor::ChunkSize - 1)
+        / HostCompactor::ChunkSize);
+}
+}   // namespace
+
+const std::size_t HostCompactor::ChunkSize;
+
+///////////////////////////////////////////////////////////////////////////////
+HostCompactor::HostCompactor(int threadCount)
+    : pool_(threadCount)
+{
+    threadBuffers_.resize(pool_.GetThreadCount());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t HostCompactor::Compact(const float* input, const std::size_t elementCount,
+    float* output, const CompactionOrder order, const float threshold)
+{
+    AMD_TRACE_SCOPE("HostCompact");
+
+    // A single chunk isn't worth waking up the pool for, and both orders
+    // give the same result
+    if (elementCount <= ChunkSize)
+    {
+        return FilterChunk(input, elementCount, output, threshold);
+    }
+
+    if (order == CompactionOrder::Ordered)
+    {
+        return CompactOrdered(input, elementCount, output, threshold);
+    }
+    else
+    {
+        return CompactUnordered(input, elementCount, output, threshold);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t HostCompactor::CompactOrdered(const float* input,
+    const std::size_t elementCount, float* output, const float threshold)
+{
+    const int chunkCount = GetChunkCount(elementCount);
+    chunkCounts_.resize(chunkCount);
+
+    {
+        AMD_TRACE_SCOPE("HostCount");
+        pool_.ParallelFor(chunkCount, [&](int chunk, int /*thread*/) {
+            const std::size_t first = chunk * ChunkSize;
+            const std::size_t count = std::min(ChunkSize, elementCount - first);
+
+            chunkCounts_[chunk].count = CountChunk(input + first, count, threshold);
+        });
+    }
+
+    // There are only elementCount / ChunkSize counts, a serial scan is
+    // negligible next to the other two phases
+    std::size_t total = 0;
+
+    for (int chunk = 0; chunk < chunkCount; ++chunk)
+    {
+        const std::size_t count = chunkCounts_[chunk].count;
+        chunkCounts_[chunk].count = total;
+        total += count;
+    }
+
+    {
+        AMD_TRACE_SCOPE("HostScatter");
+        pool_.ParallelFor(chunkCount, [&](int chunk, int /*thread*/) {
+            const std::size_t first = chunk * ChunkSize;
+            const std::size_t count = std::min(ChunkSize, elementCount - first);
+
+            const std::size_t outputOffset = chunkCounts_[chunk].count;
+            const std::size_t outputEnd = (chunk + 1 < chunkCount)
+                ? chunkCounts_[chunk + 1].count : total;
+
+            ScatterChunk(input + first, count, output + outputOffset,
+                outputEnd - outputOffset, threshold);
+        });
+    }
+
+    return total;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t HostCompactor::CompactUnordered(const float* input,
+    const std::size_t elementCount, float* output, const float threshold)
+{
+    const int chunkCount = GetChunkCount(elementCount);
+    std::atomic<std::size_t> outputOffset(0);
+
+    pool_.ParallelFor(chunkCount, [&](int chunk, int thread) {
+        const std::size_t first = chunk * ChunkSize;
+        const std::size_t count = std::min(ChunkSize, elementCount - first);
+
+        auto& buffer = threadBuffers_[thread];
+        if (buffer.size() < ChunkSize)
+        {
+            buffer.resize(ChunkSize);
+        }
+
+        const std::size_t written = FilterChunk(input + first, count,
+            buffer.data(), threshold);
+
+        const std::size_t offset = outputOffset.fetch_add(written);
+        std::memcpy(output + offset, buffer.data(), written * sizeof(float));
+    });
+
+    return outputOffset.load();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::unique_ptr<float[]> HostCompactor::AllocateBuffer(const std::size_t elementCount)
+{
+    // new float[] leaves the memory uninitialized, so large allocations are
+    // backed by fresh pages which only get placed once written to. Let the
+    // thread which will process a chunk write it first
+    std::unique_ptr<float[]> result(new float[elementCount]);
+
+    const int chunkCount = GetChunkCount(elementCount);
+    float* data = result.get();
+
+    pool_.ParallelFor(chunkCount, [&](int chunk, int /*thread*/) {
+        const std::size_t first = chunk * ChunkSize;
+        const std::size_t count = std::min(ChunkSize, elementCount - first);
+
+        std::memset(data + first, 0, count * sizeof(float));
+    });
+
+    return result;
+}
+}   // namespace AMD
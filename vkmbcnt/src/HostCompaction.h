@@ -0,0 +1,107 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef AMD_VULKAN_SAMPLE_HOST_COMPACTION_H_
+#define AMD_VULKAN_SAMPLE_HOST_COMPACTION_H_
+
+#include "ThreadPool.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace AMD
+{
+///////////////////////////////////////////////////////////////////////////////
+enum class CompactionOrder
+{
+    // Surviving elements keep their relative order
+    Ordered,
+
+    // Surviving elements are grouped by chunk, and chunks are written in
+    // whatever order they finish, like the waves in cs.comp
+    Unordered
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// CPU implementation of the stream compaction done by cs.comp: keeps every
+// element which is greater than the threshold. Used when there is no
+// suitable GPU, or when the input is too small to be worth a dispatch.
+//
+// The input is split into fixed-size chunks. Ordered compaction counts the
+// survivors of every chunk, computes an exclusive prefix sum over the
+// counts and then scatters every chunk to its offset. Unordered compaction
+// filters every chunk into a per-thread buffer and reserves space in the
+// output with a single atomic add per chunk, which saves the second pass
+// over the input.
+class HostCompactor
+{
+public:
+    HostCompactor(const HostCompactor&) = delete;
+    HostCompactor& operator= (const HostCompactor&) = delete;
+
+    // threadCount as for ThreadPool
+    explicit HostCompactor(int threadCount = 0);
+
+    int GetThreadCount() const
+    {
+        return pool_.GetThreadCount();
+    }
+
+    // output must have room for elementCount elements. Returns the number
+    // of elements written
+    std::size_t Compact(const float* input, const std::size_t elementCount,
+        float* output, const CompactionOrder order,
+        const float threshold = 0.0f);
+
+    // Allocates a buffer for elementCount floats and clears it in parallel,
+    // chunk by chunk as Compact splits it, so every page is first touched
+    // by the thread which usually processes it later. That is no NUMA
+    // placement: threads may migrate and stolen chunks run elsewhere
+    std::unique_ptr<float[]> AllocateBuffer(const std::size_t elementCount);
+
+    // Number of elements processed by one task
+    static const std::size_t ChunkSize = 64 * 1024;
+
+private:
+    std::size_t CompactOrdered(const float* input, const std::size_t elementCount,
+        float* output, const float threshold);
+    std::size_t CompactUnordered(const float* input, const std::size_t elementCount,
+        float* output, const float threshold);
+
+    // One counter per chunk, each on its own cache line so threads finishing
+    // neighbouring chunks don't write to the same line
+    struct alignas(64) ChunkCount
+    {
+        std::size_t count;
+    };
+
+    ThreadPool pool_;
+    std::vector<ChunkCount> chunkCounts_;
+
+    // Staging for unordered compaction. Each one is only ever resized by its
+    // own thread, so its pages are local to that thread
+    std::vector<std::vector<float>> threadBuffers_;
+};
+}   // namespace AMD
+
+#endif
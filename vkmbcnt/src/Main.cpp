@@ -21,13 +21,385 @@
 //
 
 #include "VulkanSample.h"
+#include "Benchmarks.h"
+#include "Trace.h"
 
-int main(int /*argc*/, char* /*argv*/[])
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <stdlib.h>
+#include <string.h>
+
+namespace
+{
+///////////////////////////////////////////////////////////////////////////////
+// Runs the bitmap output mode on the same alternating input as Run () and
+// checks rank/select against the input
+int RunBitmap(AMD::VulkanComputeSample& sample, const size_t elementCount)
 {
-    auto sample = new AMD::VulkanComputeSample;
+    std::vector<float> input(elementCount);
+    for (size_t i = 0; i < elementCount; ++i)
+    {
+        input[i] = ((i & 1) == 1) ? static_cast<float> (i) : -static_cast<float> (i);
+    }
+
+    const auto bitmap = sample.ComputeBitmap(input.data(), elementCount);
+
+    size_t rank = 0;
+    for (size_t i = 0; i < elementCount; ++i)
+    {
+        if (bitmap.Rank(i) != rank || bitmap.Test(i) != (input[i] > 0))
+        {
+            std::cerr << "Bitmap mismatch at element " << i << std::endl;
+            return 1;
+        }
 
-    sample->Run();
-    delete sample;
+        if (input[i] > 0)
+        {
+            if (bitmap.Select(rank) != i)
+            {
+                std::cerr << "Select mismatch for rank " << rank << std::endl;
+                return 1;
+            }
+
+            ++rank;
+        }
+    }
+
+    std::cout << bitmap.GetCount() << " of " << elementCount
+        << " elements passed, read back "
+        << bitmap.GetMasks().size() * sizeof(uint64_t) << " bytes of masks instead of "
+        << bitmap.GetCount() * sizeof(float) << " bytes of values\n";
 
     return 0;
 }
+}   // namespace
+
+int main(int argc, char* argv[])
+{
+    AMD::VulkanContext::Options contextOptions;
+    size_t bitmapElementCount = 0;
+    size_t dispatchElementCount = 0;
+    size_t formatElementCount = 0;
+    size_t topKElementCount = 0;
+    size_t topK = 0;
+    std::string filterExpression;
+    size_t filterRowCount = 0;
+    size_t graphElementCount = 0;
+    int graphStageCount = 0;
+    size_t sizingElementCount = 0;
+    float sizingThreshold = 0;
+    int bfsScale = 0;
+    int bfsEdgeFactor = 0;
+    size_t cullingInstanceCount = 0;
+    bool extractionBenchmark = false;
+    size_t libraryCallCount = 0;
+    size_t libraryElementCount = 0;
+    size_t textMegabytes = 0;
+    size_t csrSize = 0;
+    size_t hostElementCount = 0;
+    int hostThreadCount = 0;
+    int contextRunCount = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        // --trace <file> writes a Chrome trace of the run to <file>
+        if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+        {
+            AMD::Trace::Enable(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--headless") == 0)
+        {
+            contextOptions.headless = true;
+        }
+        else if (strcmp(argv[i], "--pipeline-cache") == 0 && i + 1 < argc)
+        {
+            contextOptions.pipelineCacheFilename = argv[++i];
+        }
+        // --bitmap [elements] reads back ballot masks instead of values
+        else if (strcmp(argv[i], "--bitmap") == 0)
+        {
+            bitmapElementCount = 1 << 20;
+
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                bitmapElementCount = strtoull(argv[++i], nullptr, 10);
+            }
+        }
+        // --dispatch-benchmark [elements] measures the host cost of
+        // recording a dispatch with each descriptor binding mode
+        else if (strcmp(argv[i], "--dispatch-benchmark") == 0)
+        {
+            dispatchElementCount = 4096;
+
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                dispatchElementCount = strtoull(argv[++i], nullptr, 10);
+            }
+        }
+        // --format-benchmark [elements] compacts fp16, bf16, int8 and int16
+        // input without widening it on the host first
+        else if (strcmp(argv[i], "--format-benchmark") == 0)
+        {
+            formatElementCount = 1 << 24;
+
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                formatElementCount = strtoull(argv[++i], nullptr, 10);
+            }
+        }
+        // --top-k [elements [k]] selects the k largest values on the GPU
+        else if (strcmp(argv[i], "--top-k") == 0)
+        {
+            topKElementCount = 1 << 24;
+            topK = 1000;
+
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                topKElementCount = strtoull(argv[++i], nullptr, 10);
+            }
+
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                topK = strtoull(argv[++i], nullptr, 10);
+            }
+        }
+        // --filter [expression [rows]] compiles expression over the columns
+        // a, b and c into a compute shader and filters random rows with it.
+        // Expressions may start with '-' or '!', only "--" ends them
+        else if (strcmp(argv[i], "--filter") == 0)
+        {
+            filterExpression = "a > 3.5 && (b == 7 || c < 0)";
+            filterRowCount = 1 << 24;
+
+            if (i + 1 < argc && strncmp(argv[i + 1], "--", 2) != 0)
+            {
+                filterExpression = argv[++i];
+            }
+
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                filterRowCount = strtoull(argv[++i], nullptr, 10);
+            }
+        }
+        // --graph [elements [stages]] runs two chains of compactions as a
+        // ComputeGraph, against a barrier after every pass
+        else if (strcmp(argv[i], "--graph") == 0)
+        {
+            graphElementCount = 1 << 22;
+            graphStageCount = 6;
+
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                graphElementCount = strtoull(argv[++i], nullptr, 10);
+            }
+
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                graphStageCount = atoi(argv[++i]);
+            }
+        }
+        // --output-sizing [elements [threshold]] compares sizing the output
+        // for the worst case with counting first and with a bounded output
+        else if (strcmp(argv[i], "--output-sizing") == 0)
+        {
+            sizingElementCount = 1 << 24;
+            sizingThreshold = 0.98f;
+
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                sizingElementCount = strtoull(argv[++i], nullptr, 10);
+            }
+
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                sizingThreshold = static_cast<float> (atof(argv[++i]));
+            }
+        }
+        // --bfs [scale [edgefactor]] runs breadth-first searches on an
+        // R-MAT graph with 2^scale vertices
+        else if (strcmp(argv[i], "--bfs") == 0)
+        {
+            bfsScale = 20;
+            bfsEdgeFactor = 16;
+
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                bfsScale = atoi(argv[++i]);
+            }
+
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                bfsEdgeFactor = atoi(argv[++i]);
+            }
+        }
+        // --cull [instances] builds indexed indirect draw lists from
+        // frustum culling on the GPU
+        else if (strcmp(argv[i], "--cull") == 0)
+        {
+            cullingInstanceCount = 1 << 20;
+
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                cullingInstanceCount = strtoull(argv[++i], nullptr, 10);
+            }
+        }
+        // --extract-2d compares tile shapes for extracting pixels from 4K
+        // and 8K images
+        else if (strcmp(argv[i], "--extract-2d") == 0)
+        {
+            extractionBenchmark = true;
+        }
+        // --library [calls [elements]] issues many small compactions
+        // through the C interface of VkMBCNTLib
+        else if (strcmp(argv[i], "--library") == 0)
+        {
+            libraryCallCount = 100000;
+            libraryElementCount = 4096;
+
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                libraryCallCount = strtoull(argv[++i], nullptr, 10);
+            }
+
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                libraryElementCount = strtoull(argv[++i], nullptr, 10);
+            }
+        }
+        // --text-index [megabytes] finds the structural characters of
+        // synthetic CSV on the GPU and the CPU
+        else if (strcmp(argv[i], "--text-index") == 0)
+        {
+            textMegabytes = 256;
+
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                textMegabytes = strtoull(argv[++i], nullptr, 10);
+            }
+        }
+        // --dense-to-csr [size] converts pruned size x size matrices and
+        // larger ones to CSR
+        else if (strcmp(argv[i], "--dense-to-csr") == 0)
+        {
+            csrSize = 10000;
+
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                csrSize = strtoull(argv[++i], nullptr, 10);
+            }
+        }
+        // --host-benchmark [elements [threads]] runs the CPU compaction
+        // engine with 1 .. threads threads, doesn't need a GPU
+        else if (strcmp(argv[i], "--host-benchmark") == 0)
+        {
+            hostElementCount = 1 << 26;
+
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                hostElementCount = strtoull(argv[++i], nullptr, 10);
+            }
+
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                hostThreadCount = atoi(argv[++i]);
+            }
+        }
+        // --context-benchmark [runs] creates and uses a context runs times
+        // to compare the cold start with warm ones
+        else if (strcmp(argv[i], "--context-benchmark") == 0)
+        {
+            contextRunCount = 5;
+
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                contextRunCount = atoi(argv[++i]);
+            }
+        }
+    }
+
+    int result = 0;
+
+    // The host benchmark doesn't need a GPU, the context and library
+    // benchmarks create their own contexts
+    if (hostElementCount > 0)
+    {
+        result = AMD::RunHostCompactionBenchmark(hostElementCount, hostThreadCount);
+    }
+    else if (contextRunCount != 0)
+    {
+        result = AMD::RunContextBenchmark(contextOptions, contextRunCount);
+    }
+    else if (libraryCallCount > 0)
+    {
+        result = AMD::RunLibraryBenchmark(libraryCallCount, libraryElementCount);
+    }
+    else
+    {
+        AMD::VulkanContext::Initialize(contextOptions);
+
+        auto sample = new AMD::VulkanComputeSample;
+
+        if (dispatchElementCount > 0)
+        {
+            result = AMD::RunDispatchBenchmark(dispatchElementCount);
+        }
+        else if (formatElementCount > 0)
+        {
+            result = AMD::RunFormatBenchmark(formatElementCount);
+        }
+        else if (topKElementCount > 0)
+        {
+            result = AMD::RunTopKBenchmark(topKElementCount, topK);
+        }
+        else if (filterRowCount > 0)
+        {
+            result = AMD::RunFilterBenchmark(filterExpression, filterRowCount);
+        }
+        else if (graphElementCount > 0)
+        {
+            result = AMD::RunGraphBenchmark(graphElementCount, graphStageCount);
+        }
+        else if (sizingElementCount > 0)
+        {
+            result = AMD::RunOutputSizingBenchmark(sizingElementCount, sizingThreshold);
+        }
+        else if (bfsScale > 0)
+        {
+            result = AMD::RunBfsBenchmark(bfsScale, bfsEdgeFactor);
+        }
+        else if (cullingInstanceCount > 0)
+        {
+            result = AMD::RunCullingBenchmark(cullingInstanceCount);
+        }
+        else if (extractionBenchmark)
+        {
+            result = AMD::RunExtractionBenchmark();
+        }
+        else if (textMegabytes > 0)
+        {
+            result = AMD::RunTextIndexBenchmark(textMegabytes);
+        }
+        else if (csrSize > 0)
+        {
+            result = AMD::RunCsrBenchmark(csrSize);
+        }
+        else if (bitmapElementCount > 0)
+        {
+            result = RunBitmap(*sample, bitmapElementCount);
+        }
+        else
+        {
+            sample->Run();
+        }
+
+        delete sample;
+
+        AMD::VulkanContext::Shutdown();
+    }
+
+    AMD::Trace::Flush();
+
+    return result;
+}
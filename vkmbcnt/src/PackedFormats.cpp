@@ -0,0 +1,177 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "PackedFormats.h"
+
+#include <cstring>
+
+namespace AMD
+{
+namespace
+{
+///////////////////////////////////////////////////////////////////////////////
+uint32_t FloatBits(const float value)
+{
+    uint32_t result;
+    std::memcpy(&result, &value, sizeof(result));
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+float BitsToFloat(const uint32_t bits)
+{
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+}   // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+const char* GetInputFormatName(const InputFormat format)
+{
+    switch (format)
+    {
+    case InputFormat::Float16:  return "fp16";
+    case InputFormat::BFloat16: return "bf16";
+    case InputFormat::Int8:     return "int8";
+    case InputFormat::Int16:    return "int16";
+    default:                    return "fp32";
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t GetElementSize(const InputFormat format)
+{
+    switch (format)
+    {
+    case InputFormat::Float16:
+    case InputFormat::BFloat16:
+    case InputFormat::Int16:
+        return 2;
+    case InputFormat::Int8:
+        return 1;
+    default:
+        return 4;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+float DecodeElement(const void* data, const std::size_t index,
+    const InputFormat format, const float scale)
+{
+    switch (format)
+    {
+    case InputFormat::Float16:
+        return HalfToFloat(static_cast<const uint16_t*> (data)[index]);
+    case InputFormat::BFloat16:
+        return BFloat16ToFloat(static_cast<const uint16_t*> (data)[index]);
+    case InputFormat::Int8:
+        return static_cast<float> (static_cast<const int8_t*> (data)[index]) * scale;
+    case InputFormat::Int16:
+        return static_cast<float> (static_cast<const int16_t*> (data)[index]) * scale;
+    default:
+        return static_cast<const float*> (data)[index];
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+uint16_t FloatToHalf(const float value)
+{
+    const uint32_t bits = FloatBits(value);
+    const uint16_t sign = static_cast<uint16_t> ((bits >> 16) & 0x8000);
+    const int exponent = static_cast<int> ((bits >> 23) & 0xFF) - 127 + 15;
+    uint32_t mantissa = bits & 0x7FFFFF;
+
+    if (((bits >> 23) & 0xFF) == 0xFF)
+    {
+        // Inf stays inf, NaN stays NaN
+        return static_cast<uint16_t> (sign | 0x7C00 | (mantissa ? 0x200 : 0));
+    }
+
+    if (exponent <= 0)
+    {
+        return sign;
+    }
+
+    // Round to nearest even on the 13 bits which are dropped
+    const uint32_t dropped = mantissa & 0x1FFF;
+    mantissa >>= 13;
+
+    uint32_t result = (static_cast<uint32_t> (exponent) << 10) | mantissa;
+    if (dropped > 0x1000 || (dropped == 0x1000 && (mantissa & 1)))
+    {
+        // May carry into the exponent, which is what we want
+        ++result;
+    }
+
+    if (result >= 0x7C00)
+    {
+        return static_cast<uint16_t> (sign | 0x7C00);
+    }
+
+    return static_cast<uint16_t> (sign | result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+float HalfToFloat(const uint16_t value)
+{
+    const uint32_t sign = static_cast<uint32_t> (value & 0x8000) << 16;
+    const uint32_t exponent = (value >> 10) & 0x1F;
+    const uint32_t mantissa = value & 0x3FF;
+
+    if (exponent == 0)
+    {
+        // Zero or denormal, mantissa * 2^-24
+        const float magnitude = static_cast<float> (mantissa) / 16777216.0f;
+        return sign ? -magnitude : magnitude;
+    }
+
+    if (exponent == 0x1F)
+    {
+        return BitsToFloat(sign | 0x7F800000 | (mantissa << 13));
+    }
+
+    return BitsToFloat(sign | ((exponent - 15 + 127) << 23) | (mantissa << 13));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+uint16_t FloatToBFloat16(const float value)
+{
+    const uint32_t bits = FloatBits(value);
+
+    if ((bits & 0x7FFFFFFF) > 0x7F800000)
+    {
+        // Keep NaNs quiet instead of rounding them to inf
+        return static_cast<uint16_t> ((bits >> 16) | 0x40);
+    }
+
+    const uint32_t roundingBias = 0x7FFF + ((bits >> 16) & 1);
+    return static_cast<uint16_t> ((bits + roundingBias) >> 16);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+float BFloat16ToFloat(const uint16_t value)
+{
+    return BitsToFloat(static_cast<uint32_t> (value) << 16);
+}
+}   // namespace AMD
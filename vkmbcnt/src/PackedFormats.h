@@ -0,0 +1,70 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef AMD_VULKAN_SAMPLE_PACKED_FORMATS_H_
+#define AMD_VULKAN_SAMPLE_PACKED_FORMATS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace AMD
+{
+///////////////////////////////////////////////////////////////////////////////
+// Element formats formats.comp can read. Elements are packed tightly, in
+// little-endian order within every 32-bit word. The values must match the
+// FORMAT_ defines in formats.comp
+enum class InputFormat
+{
+    Float32,
+    Float16,
+
+    // Upper half of a float32
+    BFloat16,
+
+    // Signed integers, multiplied by a scale when decoded
+    Int8,
+    Int16
+};
+
+const int InputFormatCount = 5;
+
+const char* GetInputFormatName(const InputFormat format);
+
+// Size of one element in bytes
+std::size_t GetElementSize(const InputFormat format);
+
+// Decodes element index of data the way formats.comp does. scale only
+// applies to the integer formats
+float DecodeElement(const void* data, const std::size_t index,
+    const InputFormat format, const float scale);
+
+// Round to nearest even. Values too small for a normal half become 0
+uint16_t FloatToHalf(const float value);
+float HalfToFloat(const uint16_t value);
+
+// Round to nearest even
+uint16_t FloatToBFloat16(const float value);
+float BFloat16ToFloat(const uint16_t value);
+}   // namespace AMD
+
+#endif
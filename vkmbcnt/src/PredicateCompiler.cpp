@@ -0,0 +1,1093 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "PredicateCompiler.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <initializer_list>
+#include <locale>
+#include <map>
+#include <sstream>
+
+namespace AMD
+{
+namespace
+{
+///////////////////////////////////////////////////////////////////////////////
+struct Token
+{
+    enum Type
+    {
+        Identifier,
+        Number,
+        Operator,
+        End
+    };
+
+    Type type;
+    std::string text;
+    float value;
+    std::size_t position;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+bool Tokenize(const std::string& expression, std::vector<Token>* tokens,
+    std::string* error)
+{
+    static const char* const operators[] = {
+        "&&", "||", "<=", ">=", "==", "!=", "<", ">", "!", "(", ")"
+    };
+
+    std::size_t i = 0;
+    while (i < expression.size())
+    {
+        const char c = expression[i];
+
+        if (std::isspace(static_cast<unsigned char> (c)))
+        {
+            ++i;
+            continue;
+        }
+
+        Token token;
+        token.position = i;
+        token.value = 0;
+
+        if (std::isalpha(static_cast<unsigned char> (c)) || c == '_')
+        {
+            std::size_t end = i;
+            while (end < expression.size() &&
+                (std::isalnum(static_cast<unsigned char> (expression[end])) || expression[end] == '_'))
+            {
+                ++end;
+            }
+
+            token.type = Token::Identifier;
+            token.text = expression.substr(i, end - i);
+            tokens->push_back(token);
+            i = end;
+            continue;
+        }
+
+        // Operands are never subtracted, so a sign always belongs to a number.
+        // strtof would follow the global locale and might want a decimal
+        // comma, so read it with the classic one
+        if (std::isdigit(static_cast<unsigned char> (c)) || c == '.' || c == '-' || c == '+')
+        {
+            std::istringstream stream(expression.substr(i));
+            stream.imbue(std::locale::classic());
+
+            float value = 0;
+            stream >> value;
+
+            if (stream.fail())
+            {
+                *error = "Invalid number at position " + std::to_string(i);
+                return false;
+            }
+
+            // tellg fails once the number ends the expression
+            const std::size_t length = stream.eof()
+                ? expression.size() - i : static_cast<std::size_t> (stream.tellg());
+
+            token.type = Token::Number;
+            token.text = expression.substr(i, length);
+            token.value = value;
+            tokens->push_back(token);
+            i += length;
+            continue;
+        }
+
+        bool found = false;
+        for (const auto op : operators)
+        {
+            const std::size_t length = std::strlen(op);
+            if (expression.compare(i, length, op) == 0)
+            {
+                token.type = Token::Operator;
+                token.text = op;
+                tokens->push_back(token);
+                i += length;
+                found = true;
+                break;
+            }
+        }
+
+        if (!found)
+        {
+            *error = std::string("Unexpected '") + c + "' at position " + std::to_string(i);
+            return false;
+        }
+    }
+
+    Token end;
+    end.type = Token::End;
+    end.value = 0;
+    end.position = expression.size();
+    tokens->push_back(end);
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Recursive descent over the grammar in PredicateCompiler.h
+class Parser
+{
+public:
+    Parser(const std::vector<Token>& tokens, const std::vector<std::string>& columnNames,
+        std::vector<Predicate::Node>* nodes)
+        : tokens_(tokens), columnNames_(columnNames), nodes_(nodes)
+    {
+    }
+
+    // Returns the root node, or -1
+    int Parse(std::string* error)
+    {
+        const int result = ParseOr();
+
+        if (result >= 0 && tokens_[next_].type != Token::End)
+        {
+            Fail("Unexpected '" + tokens_[next_].text + "'");
+        }
+
+        if (!error_.empty())
+        {
+            *error = error_;
+            return -1;
+        }
+
+        return result;
+    }
+
+private:
+    bool Accept(const char* op)
+    {
+        if (tokens_[next_].type == Token::Operator && tokens_[next_].text == op)
+        {
+            ++next_;
+            return true;
+        }
+
+        return false;
+    }
+
+    int Fail(const std::string& message)
+    {
+        if (error_.empty())
+        {
+            error_ = message + " at position " + std::to_string(tokens_[next_].position);
+        }
+
+        return -1;
+    }
+
+    // Fails if the node would make the tree deeper than MaxDepth. Chains of
+    // && and || are parsed in a loop, but still make the tree deep
+    int AddNode(const Predicate::Node& node)
+    {
+        int depth = 1;
+
+        for (const int child : node.children)
+        {
+            if (child >= 0)
+            {
+                depth = std::max(depth, depths_[child] + 1);
+            }
+        }
+
+        if (depth > Predicate::MaxDepth)
+        {
+            return Fail("Expression is nested too deeply");
+        }
+
+        nodes_->push_back(node);
+        depths_.push_back(depth);
+
+        return static_cast<int> (nodes_->size() - 1);
+    }
+
+    int ParseOr()
+    {
+        int left = ParseAnd();
+
+        while (left >= 0 && Accept("||"))
+        {
+            Predicate::Node node;
+            node.type = Predicate::NodeType::Or;
+            node.children[0] = left;
+            node.children[1] = ParseAnd();
+
+            left = (node.children[1] < 0) ? -1 : AddNode(node);
+        }
+
+        return left;
+    }
+
+    int ParseAnd()
+    {
+        int left = ParseUnary();
+
+        while (left >= 0 && Accept("&&"))
+        {
+            Predicate::Node node;
+            node.type = Predicate::NodeType::And;
+            node.children[0] = left;
+            node.children[1] = ParseUnary();
+
+            left = (node.children[1] < 0) ? -1 : AddNode(node);
+        }
+
+        return left;
+    }
+
+    // Limits the recursion of ParseUnary, which nested parentheses go
+    // through without adding nodes
+    struct DepthGuard
+    {
+        explicit DepthGuard(int* depth) : depth_(depth)
+        {
+            ++*depth_;
+        }
+
+        ~DepthGuard()
+        {
+            --*depth_;
+        }
+
+        int* depth_;
+    };
+
+    int ParseUnary()
+    {
+        DepthGuard guard(&recursionDepth_);
+
+        if (recursionDepth_ > Predicate::MaxDepth)
+        {
+            return Fail("Expression is nested too deeply");
+        }
+
+        if (Accept("!"))
+        {
+            Predicate::Node node;
+            node.type = Predicate::NodeType::Not;
+            node.children[0] = ParseUnary();
+
+            return (node.children[0] < 0) ? -1 : AddNode(node);
+        }
+
+        if (Accept("("))
+        {
+            const int result = ParseOr();
+
+            if (result >= 0 && !Accept(")"))
+            {
+                return Fail("Expected ')'");
+            }
+
+            return result;
+        }
+
+        Predicate::Node node;
+        node.type = Predicate::NodeType::Compare;
+
+        if (!ParseOperand(&node.operands[0]))
+        {
+            return -1;
+        }
+
+        static const struct
+        {
+            const char* text;
+            Predicate::CompareOp op;
+        } compareOps[] = {
+            { "<=", Predicate::CompareOp::LessEqual },
+            { ">=", Predicate::CompareOp::GreaterEqual },
+            { "==", Predicate::CompareOp::Equal },
+            { "!=", Predicate::CompareOp::NotEqual },
+            { "<", Predicate::CompareOp::Less },
+            { ">", Predicate::CompareOp::Greater }
+        };
+
+        bool found = false;
+        for (const auto& compareOp : compareOps)
+        {
+            if (Accept(compareOp.text))
+            {
+                node.op = compareOp.op;
+                found = true;
+                break;
+            }
+        }
+
+        if (!found)
+        {
+            return Fail("Expected a comparison");
+        }
+
+        if (!ParseOperand(&node.operands[1]))
+        {
+            return -1;
+        }
+
+        return AddNode(node);
+    }
+
+    bool ParseOperand(Predicate::Operand* operand)
+    {
+        const Token& token = tokens_[next_];
+
+        if (token.type == Token::Number)
+        {
+            operand->constant = token.value;
+            ++next_;
+            return true;
+        }
+
+        if (token.type == Token::Identifier)
+        {
+            for (std::size_t i = 0; i < columnNames_.size(); ++i)
+            {
+                if (columnNames_[i] == token.text)
+                {
+                    operand->column = static_cast<int> (i);
+                    ++next_;
+                    return true;
+                }
+            }
+
+            Fail("Unknown column '" + token.text + "'");
+            return false;
+        }
+
+        Fail("Expected a column or a number");
+        return false;
+    }
+
+    const std::vector<Token>& tokens_;
+    const std::vector<std::string>& columnNames_;
+    std::vector<Predicate::Node>* nodes_;
+    std::size_t next_ = 0;
+    std::string error_;
+
+    // Depth of the subtree below every node in nodes_
+    std::vector<int> depths_;
+    int recursionDepth_ = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+std::string ToString(const Predicate::Operand& operand)
+{
+    if (operand.column >= 0)
+    {
+        return "c" + std::to_string(operand.column);
+    }
+
+    // Enough digits to get the same float back, and a decimal point in
+    // every locale, so the canonical form and its hash don't depend on it
+    std::ostringstream stream;
+    stream.imbue(std::locale::classic());
+    stream.precision(9);
+    stream << operand.constant;
+
+    return stream.str();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string ToString(const std::vector<Predicate::Node>& nodes, const int index)
+{
+    static const char* const compareOps[] = { "<", "<=", ">", ">=", "==", "!=" };
+
+    const auto& node = nodes[index];
+
+    switch (node.type)
+    {
+    case Predicate::NodeType::Compare:
+        return "(" + ToString(node.operands[0]) + " "
+            + compareOps[static_cast<int> (node.op)] + " "
+            + ToString(node.operands[1]) + ")";
+    case Predicate::NodeType::And:
+        return "(" + ToString(nodes, node.children[0]) + " && "
+            + ToString(nodes, node.children[1]) + ")";
+    case Predicate::NodeType::Or:
+        return "(" + ToString(nodes, node.children[0]) + " || "
+            + ToString(nodes, node.children[1]) + ")";
+    default:
+        return "!" + ToString(nodes, node.children[0]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+float GetValue(const Predicate::Operand& operand, const float* const* columns,
+    const std::size_t row)
+{
+    return (operand.column >= 0) ? columns[operand.column][row] : operand.constant;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Evaluate(const std::vector<Predicate::Node>& nodes, const int index,
+    const float* const* columns, const std::size_t row)
+{
+    const auto& node = nodes[index];
+
+    switch (node.type)
+    {
+    case Predicate::NodeType::Compare:
+    {
+        const float a = GetValue(node.operands[0], columns, row);
+        const float b = GetValue(node.operands[1], columns, row);
+
+        switch (node.op)
+        {
+        case Predicate::CompareOp::Less:            return a < b;
+        case Predicate::CompareOp::LessEqual:       return a <= b;
+        case Predicate::CompareOp::Greater:         return a > b;
+        case Predicate::CompareOp::GreaterEqual:    return a >= b;
+        case Predicate::CompareOp::Equal:           return a == b;
+        default:                                    return a != b;
+        }
+    }
+    case Predicate::NodeType::And:
+        return Evaluate(nodes, node.children[0], columns, row)
+            && Evaluate(nodes, node.children[1], columns, row);
+    case Predicate::NodeType::Or:
+        return Evaluate(nodes, node.children[0], columns, row)
+            || Evaluate(nodes, node.children[1], columns, row);
+    default:
+        return !Evaluate(nodes, node.children[0], columns, row);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Just enough of SPIR-V to write the filter kernel. Enumerant values are
+// from the SPIR-V 1.0 specification and the GLSL.std.450 and
+// SPV_AMD_shader_ballot extended instruction sets
+namespace Spv
+{
+enum Op
+{
+    OpExtension = 10,
+    OpExtInstImport = 11,
+    OpExtInst = 12,
+    OpMemoryModel = 14,
+    OpEntryPoint = 15,
+    OpExecutionMode = 16,
+    OpCapability = 17,
+    OpTypeVoid = 19,
+    OpTypeBool = 20,
+    OpTypeInt = 21,
+    OpTypeFloat = 22,
+    OpTypeVector = 23,
+    OpTypeRuntimeArray = 29,
+    OpTypeStruct = 30,
+    OpTypePointer = 32,
+    OpTypeFunction = 33,
+    OpConstant = 43,
+    OpFunction = 54,
+    OpFunctionEnd = 56,
+    OpVariable = 59,
+    OpLoad = 61,
+    OpStore = 62,
+    OpAccessChain = 65,
+    OpDecorate = 71,
+    OpMemberDecorate = 72,
+    OpCompositeConstruct = 80,
+    OpCompositeExtract = 81,
+    OpBitcast = 124,
+    OpIAdd = 128,
+    OpISub = 130,
+    OpIMul = 132,
+    OpLogicalOr = 166,
+    OpLogicalAnd = 167,
+    OpLogicalNot = 168,
+    OpIEqual = 170,
+    OpULessThan = 176,
+    OpFOrdEqual = 180,
+    OpFUnordNotEqual = 183,
+    OpFOrdLessThan = 184,
+    OpFOrdGreaterThan = 186,
+    OpFOrdLessThanEqual = 188,
+    OpFOrdGreaterThanEqual = 190,
+    OpBitCount = 205,
+    OpAtomicIAdd = 234,
+    OpPhi = 245,
+    OpSelectionMerge = 247,
+    OpLabel = 248,
+    OpBranch = 249,
+    OpBranchConditional = 250,
+    OpReturn = 253,
+    OpSubgroupBallotKHR = 4421,
+    OpSubgroupFirstInvocationKHR = 4422
+};
+
+const uint32_t MagicNumber = 0x07230203;
+const uint32_t Version10 = 0x00010000;
+
+const uint32_t CapabilityShader = 1;
+const uint32_t CapabilityInt64 = 11;
+const uint32_t CapabilitySubgroupBallotKHR = 4423;
+
+const uint32_t AddressingModelLogical = 0;
+const uint32_t MemoryModelGLSL450 = 1;
+const uint32_t ExecutionModelGLCompute = 5;
+const uint32_t ExecutionModeLocalSize = 17;
+
+const uint32_t StorageClassInput = 1;
+const uint32_t StorageClassUniform = 2;
+const uint32_t StorageClassPushConstant = 9;
+
+const uint32_t DecorationBlock = 2;
+const uint32_t DecorationBufferBlock = 3;
+const uint32_t DecorationArrayStride = 6;
+const uint32_t DecorationBuiltIn = 11;
+const uint32_t DecorationBinding = 33;
+const uint32_t DecorationDescriptorSet = 34;
+const uint32_t DecorationOffset = 35;
+
+const uint32_t BuiltInNumWorkgroups = 24;
+const uint32_t BuiltInWorkgroupId = 26;
+const uint32_t BuiltInLocalInvocationId = 27;
+
+const uint32_t ScopeDevice = 1;
+
+const uint32_t GLSLstd450UMin = 38;
+const uint32_t MbcntAMD = 4;
+}   // namespace Spv
+
+///////////////////////////////////////////////////////////////////////////////
+class SpirvBuilder
+{
+public:
+    uint32_t NewId()
+    {
+        return nextId_++;
+    }
+
+    void Emit(std::vector<uint32_t>* section, const Spv::Op op,
+        std::initializer_list<uint32_t> operands)
+    {
+        Emit(section, op, std::vector<uint32_t>(operands));
+    }
+
+    void Emit(std::vector<uint32_t>* section, const Spv::Op op,
+        const std::vector<uint32_t>& operands)
+    {
+        section->push_back(static_cast<uint32_t> ((operands.size() + 1) << 16) | op);
+        section->insert(section->end(), operands.begin(), operands.end());
+    }
+
+    // Emits an instruction with a result type and returns the new result id
+    uint32_t Emit(std::vector<uint32_t>* section, const Spv::Op op,
+        const uint32_t resultType, std::initializer_list<uint32_t> operands)
+    {
+        const uint32_t result = NewId();
+
+        std::vector<uint32_t> words;
+        words.push_back(resultType);
+        words.push_back(result);
+        words.insert(words.end(), operands.begin(), operands.end());
+
+        Emit(section, op, words);
+        return result;
+    }
+
+    // Null terminated and padded to a whole word
+    static void AppendString(std::vector<uint32_t>* words, const char* s)
+    {
+        const std::size_t length = std::strlen(s) + 1;
+
+        for (std::size_t i = 0; i < length; i += 4)
+        {
+            uint32_t word = 0;
+            for (std::size_t j = 0; j < 4 && i + j < length; ++j)
+            {
+                word |= static_cast<uint32_t> (static_cast<unsigned char> (s[i + j])) << (j * 8);
+            }
+
+            words->push_back(word);
+        }
+    }
+
+    std::vector<uint32_t> Finish() const
+    {
+        std::vector<uint32_t> result = {
+            Spv::MagicNumber, Spv::Version10, 0 /* generator */, nextId_, 0
+        };
+
+        for (const auto section : { &preamble, &decorations, &globals, &code })
+        {
+            result.insert(result.end(), section->begin(), section->end());
+        }
+
+        return result;
+    }
+
+    // Capabilities up to and including the execution mode
+    std::vector<uint32_t> preamble;
+    std::vector<uint32_t> decorations;
+    // Types, constants and global variables
+    std::vector<uint32_t> globals;
+    std::vector<uint32_t> code;
+
+private:
+    uint32_t nextId_ = 1;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Emits the predicate as straight-line code: every column is loaded once up
+// front and both sides of && and || are always evaluated. Comparisons are
+// far cheaper than the divergence short-circuiting would cause
+class PredicateEmitter
+{
+public:
+    PredicateEmitter(const std::vector<Predicate::Node>& nodes, SpirvBuilder* builder,
+        const uint32_t boolType, const uint32_t floatType)
+        : nodes_(nodes), builder_(builder), boolType_(boolType), floatType_(floatType)
+    {
+    }
+
+    // Float constants go into the globals section
+    void DeclareConstants()
+    {
+        for (const auto& node : nodes_)
+        {
+            if (node.type != Predicate::NodeType::Compare)
+            {
+                continue;
+            }
+
+            for (const auto& operand : node.operands)
+            {
+                if (operand.column >= 0)
+                {
+                    continue;
+                }
+
+                uint32_t bits;
+                std::memcpy(&bits, &operand.constant, sizeof(bits));
+
+                if (constants_.find(bits) == constants_.end())
+                {
+                    constants_[bits] = builder_->Emit(&builder_->globals,
+                        Spv::OpConstant, floatType_, { bits });
+                }
+            }
+        }
+    }
+
+    void SetColumnValue(const int column, const uint32_t id)
+    {
+        columnValues_[column] = id;
+    }
+
+    uint32_t Emit(const int index)
+    {
+        const auto& node = nodes_[index];
+
+        switch (node.type)
+        {
+        case Predicate::NodeType::Compare:
+        {
+            static const Spv::Op compareOps[] = {
+                Spv::OpFOrdLessThan,
+                Spv::OpFOrdLessThanEqual,
+                Spv::OpFOrdGreaterThan,
+                Spv::OpFOrdGreaterThanEqual,
+                Spv::OpFOrdEqual,
+                // Like C, != is true if either side is NaN
+                Spv::OpFUnordNotEqual
+            };
+
+            return builder_->Emit(&builder_->code,
+                compareOps[static_cast<int> (node.op)], boolType_,
+                { GetValue(node.operands[0]), GetValue(node.operands[1]) });
+        }
+        case Predicate::NodeType::And:
+        case Predicate::NodeType::Or:
+        {
+            const uint32_t left = Emit(node.children[0]);
+            const uint32_t right = Emit(node.children[1]);
+
+            return builder_->Emit(&builder_->code,
+                (node.type == Predicate::NodeType::And) ? Spv::OpLogicalAnd : Spv::OpLogicalOr,
+                boolType_, { left, right });
+        }
+        default:
+            return builder_->Emit(&builder_->code, Spv::OpLogicalNot, boolType_,
+                { Emit(node.children[0]) });
+        }
+    }
+
+private:
+    uint32_t GetValue(const Predicate::Operand& operand)
+    {
+        if (operand.column >= 0)
+        {
+            return columnValues_[operand.column];
+        }
+
+        uint32_t bits;
+        std::memcpy(&bits, &operand.constant, sizeof(bits));
+
+        return constants_[bits];
+    }
+
+    const std::vector<Predicate::Node>& nodes_;
+    SpirvBuilder* builder_;
+    uint32_t boolType_;
+    uint32_t floatType_;
+    std::map<uint32_t, uint32_t> constants_;
+    std::map<int, uint32_t> columnValues_;
+};
+}   // namespace
+
+const int Predicate::MaxDepth;
+
+///////////////////////////////////////////////////////////////////////////////
+bool Predicate::Parse(const std::string& expression,
+    const std::vector<std::string>& columnNames, Predicate* result,
+    std::string* error)
+{
+    std::vector<Token> tokens;
+    if (!Tokenize(expression, &tokens, error))
+    {
+        return false;
+    }
+
+    Predicate predicate;
+    Parser parser(tokens, columnNames, &predicate.nodes_);
+
+    predicate.root_ = parser.Parse(error);
+    if (predicate.root_ < 0)
+    {
+        return false;
+    }
+
+    predicate.columnCount_ = static_cast<int> (columnNames.size());
+    predicate.canonicalForm_ = ToString(predicate.nodes_, predicate.root_);
+
+    *result = std::move(predicate);
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+uint64_t Predicate::GetHash() const
+{
+    const std::string key = std::to_string(columnCount_) + ":" + canonicalForm_;
+
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (const char c : key)
+    {
+        hash ^= static_cast<unsigned char> (c);
+        hash *= 0x100000001b3ull;
+    }
+
+    return hash;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Predicate::Evaluate(const float* const* columns, const std::size_t row) const
+{
+    return AMD::Evaluate(nodes_, root_, columns, row);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<uint32_t> Predicate::CompileToSpirv() const
+{
+    SpirvBuilder b;
+
+    auto& preamble = b.preamble;
+    auto& decorations = b.decorations;
+    auto& globals = b.globals;
+    auto& code = b.code;
+
+    const uint32_t glslExtInst = b.NewId();
+    const uint32_t amdExtInst = b.NewId();
+    const uint32_t mainFunction = b.NewId();
+
+    // Types
+    const uint32_t voidType = b.NewId();
+    const uint32_t mainType = b.NewId();
+    const uint32_t boolType = b.NewId();
+    const uint32_t intType = b.NewId();
+    const uint32_t uintType = b.NewId();
+    const uint32_t uint64Type = b.NewId();
+    const uint32_t floatType = b.NewId();
+    const uint32_t uvec2Type = b.NewId();
+    const uint32_t uvec3Type = b.NewId();
+    const uint32_t uvec4Type = b.NewId();
+
+    b.Emit(&globals, Spv::OpTypeVoid, { voidType });
+    b.Emit(&globals, Spv::OpTypeFunction, { mainType, voidType });
+    b.Emit(&globals, Spv::OpTypeBool, { boolType });
+    b.Emit(&globals, Spv::OpTypeInt, { intType, 32, 1 });
+    b.Emit(&globals, Spv::OpTypeInt, { uintType, 32, 0 });
+    b.Emit(&globals, Spv::OpTypeInt, { uint64Type, 64, 0 });
+    b.Emit(&globals, Spv::OpTypeFloat, { floatType, 32 });
+    b.Emit(&globals, Spv::OpTypeVector, { uvec2Type, uintType, 2 });
+    b.Emit(&globals, Spv::OpTypeVector, { uvec3Type, uintType, 3 });
+    b.Emit(&globals, Spv::OpTypeVector, { uvec4Type, uintType, 4 });
+
+    // Storage buffers: struct { float data[]; } for the columns and
+    // struct { uint data[]; } for the output and the counter
+    const uint32_t floatArrayType = b.NewId();
+    const uint32_t uintArrayType = b.NewId();
+    const uint32_t floatBufferType = b.NewId();
+    const uint32_t uintBufferType = b.NewId();
+    const uint32_t parametersType = b.NewId();
+
+    b.Emit(&globals, Spv::OpTypeRuntimeArray, { floatArrayType, floatType });
+    b.Emit(&globals, Spv::OpTypeRuntimeArray, { uintArrayType, uintType });
+    b.Emit(&globals, Spv::OpTypeStruct, { floatBufferType, floatArrayType });
+    b.Emit(&globals, Spv::OpTypeStruct, { uintBufferType, uintArrayType });
+    b.Emit(&globals, Spv::OpTypeStruct, { parametersType, uintType });
+
+    b.Emit(&decorations, Spv::OpDecorate, { floatArrayType, Spv::DecorationArrayStride, 4 });
+    b.Emit(&decorations, Spv::OpDecorate, { uintArrayType, Spv::DecorationArrayStride, 4 });
+    b.Emit(&decorations, Spv::OpDecorate, { floatBufferType, Spv::DecorationBufferBlock });
+    b.Emit(&decorations, Spv::OpMemberDecorate, { floatBufferType, 0, Spv::DecorationOffset, 0 });
+    b.Emit(&decorations, Spv::OpDecorate, { uintBufferType, Spv::DecorationBufferBlock });
+    b.Emit(&decorations, Spv::OpMemberDecorate, { uintBufferType, 0, Spv::DecorationOffset, 0 });
+    b.Emit(&decorations, Spv::OpDecorate, { parametersType, Spv::DecorationBlock });
+    b.Emit(&decorations, Spv::OpMemberDecorate, { parametersType, 0, Spv::DecorationOffset, 0 });
+
+    const uint32_t inputUvec3Pointer = b.NewId();
+    const uint32_t floatBufferPointer = b.NewId();
+    const uint32_t uintBufferPointer = b.NewId();
+    const uint32_t floatPointer = b.NewId();
+    const uint32_t uintPointer = b.NewId();
+    const uint32_t parametersPointer = b.NewId();
+    const uint32_t parameterPointer = b.NewId();
+
+    b.Emit(&globals, Spv::OpTypePointer, { inputUvec3Pointer, Spv::StorageClassInput, uvec3Type });
+    b.Emit(&globals, Spv::OpTypePointer, { floatBufferPointer, Spv::StorageClassUniform, floatBufferType });
+    b.Emit(&globals, Spv::OpTypePointer, { uintBufferPointer, Spv::StorageClassUniform, uintBufferType });
+    b.Emit(&globals, Spv::OpTypePointer, { floatPointer, Spv::StorageClassUniform, floatType });
+    b.Emit(&globals, Spv::OpTypePointer, { uintPointer, Spv::StorageClassUniform, uintType });
+    b.Emit(&globals, Spv::OpTypePointer, { parametersPointer, Spv::StorageClassPushConstant, parametersType });
+    b.Emit(&globals, Spv::OpTypePointer, { parameterPointer, Spv::StorageClassPushConstant, uintType });
+
+    // Constants
+    const uint32_t memberIndex = b.Emit(&globals, Spv::OpConstant, intType, { 0 });
+    const uint32_t uint0 = b.Emit(&globals, Spv::OpConstant, uintType, { 0 });
+    const uint32_t uint1 = b.Emit(&globals, Spv::OpConstant, uintType, { 1 });
+    const uint32_t groupSize = b.Emit(&globals, Spv::OpConstant, uintType, { 64 });
+    const uint32_t scopeDevice = (Spv::ScopeDevice == 1) ? uint1
+        : b.Emit(&globals, Spv::OpConstant, uintType, { Spv::ScopeDevice });
+
+    PredicateEmitter emitter(nodes_, &b, boolType, floatType);
+    emitter.DeclareConstants();
+
+    // Variables
+    const uint32_t workGroupId = b.Emit(&globals, Spv::OpVariable, inputUvec3Pointer,
+        { Spv::StorageClassInput });
+    const uint32_t numWorkGroups = b.Emit(&globals, Spv::OpVariable, inputUvec3Pointer,
+        { Spv::StorageClassInput });
+    const uint32_t localInvocationId = b.Emit(&globals, Spv::OpVariable, inputUvec3Pointer,
+        { Spv::StorageClassInput });
+
+    b.Emit(&decorations, Spv::OpDecorate, { workGroupId, Spv::DecorationBuiltIn, Spv::BuiltInWorkgroupId });
+    b.Emit(&decorations, Spv::OpDecorate, { numWorkGroups, Spv::DecorationBuiltIn, Spv::BuiltInNumWorkgroups });
+    b.Emit(&decorations, Spv::OpDecorate, { localInvocationId, Spv::DecorationBuiltIn, Spv::BuiltInLocalInvocationId });
+
+    std::vector<uint32_t> columns;
+    for (int i = 0; i < columnCount_; ++i)
+    {
+        columns.push_back(b.Emit(&globals, Spv::OpVariable, floatBufferPointer,
+            { Spv::StorageClassUniform }));
+    }
+
+    const uint32_t output = b.Emit(&globals, Spv::OpVariable, uintBufferPointer,
+        { Spv::StorageClassUniform });
+    const uint32_t counter = b.Emit(&globals, Spv::OpVariable, uintBufferPointer,
+        { Spv::StorageClassUniform });
+    const uint32_t parameters = b.Emit(&globals, Spv::OpVariable, parametersPointer,
+        { Spv::StorageClassPushConstant });
+
+    for (int i = 0; i < columnCount_ + 2; ++i)
+    {
+        const uint32_t variable = (i < columnCount_) ? columns[i]
+            : ((i == columnCount_) ? output : counter);
+
+        b.Emit(&decorations, Spv::OpDecorate, { variable, Spv::DecorationDescriptorSet, 0 });
+        b.Emit(&decorations, Spv::OpDecorate,
+            { variable, Spv::DecorationBinding, static_cast<uint32_t> (i) });
+    }
+
+    // Header
+    for (const uint32_t capability : {
+        Spv::CapabilityShader, Spv::CapabilityInt64, Spv::CapabilitySubgroupBallotKHR })
+    {
+        b.Emit(&preamble, Spv::OpCapability, { capability });
+    }
+
+    for (const char* extension : { "SPV_AMD_shader_ballot", "SPV_KHR_shader_ballot" })
+    {
+        std::vector<uint32_t> operands;
+        SpirvBuilder::AppendString(&operands, extension);
+        b.Emit(&preamble, Spv::OpExtension, operands);
+    }
+
+    {
+        std::vector<uint32_t> operands = { glslExtInst };
+        SpirvBuilder::AppendString(&operands, "GLSL.std.450");
+        b.Emit(&preamble, Spv::OpExtInstImport, operands);
+
+        operands = { amdExtInst };
+        SpirvBuilder::AppendString(&operands, "SPV_AMD_shader_ballot");
+        b.Emit(&preamble, Spv::OpExtInstImport, operands);
+    }
+
+    b.Emit(&preamble, Spv::OpMemoryModel,
+        { Spv::AddressingModelLogical, Spv::MemoryModelGLSL450 });
+
+    {
+        std::vector<uint32_t> operands = { Spv::ExecutionModelGLCompute, mainFunction };
+        SpirvBuilder::AppendString(&operands, "main");
+        operands.push_back(workGroupId);
+        operands.push_back(numWorkGroups);
+        operands.push_back(localInvocationId);
+        b.Emit(&preamble, Spv::OpEntryPoint, operands);
+    }
+
+    b.Emit(&preamble, Spv::OpExecutionMode,
+        { mainFunction, Spv::ExecutionModeLocalSize, 64, 1, 1 });
+
+    // main. Same structure as compact.comp, except that out of range lanes
+    // load the last row instead of branching around the loads
+    const uint32_t entryLabel = b.NewId();
+    const uint32_t reserveLabel = b.NewId();
+    const uint32_t reserveMergeLabel = b.NewId();
+    const uint32_t storeLabel = b.NewId();
+    const uint32_t endLabel = b.NewId();
+
+    b.Emit(&code, Spv::OpFunction, { voidType, mainFunction, 0, mainType });
+    b.Emit(&code, Spv::OpLabel, { entryLabel });
+
+    // uint groupIndex = gl_WorkGroupID.y * gl_NumWorkGroups.x + gl_WorkGroupID.x;
+    // uint index = groupIndex * 64 + gl_LocalInvocationID.x;
+    const uint32_t groupId = b.Emit(&code, Spv::OpLoad, uvec3Type, { workGroupId });
+    const uint32_t groupCount = b.Emit(&code, Spv::OpLoad, uvec3Type, { numWorkGroups });
+    const uint32_t localId = b.Emit(&code, Spv::OpLoad, uvec3Type, { localInvocationId });
+    const uint32_t groupX = b.Emit(&code, Spv::OpCompositeExtract, uintType, { groupId, 0 });
+    const uint32_t groupY = b.Emit(&code, Spv::OpCompositeExtract, uintType, { groupId, 1 });
+    const uint32_t groupCountX = b.Emit(&code, Spv::OpCompositeExtract, uintType, { groupCount, 0 });
+    const uint32_t localX = b.Emit(&code, Spv::OpCompositeExtract, uintType, { localId, 0 });
+
+    const uint32_t rowOffset = b.Emit(&code, Spv::OpIMul, uintType, { groupY, groupCountX });
+    const uint32_t groupIndex = b.Emit(&code, Spv::OpIAdd, uintType, { rowOffset, groupX });
+    const uint32_t firstIndex = b.Emit(&code, Spv::OpIMul, uintType, { groupIndex, groupSize });
+    const uint32_t index = b.Emit(&code, Spv::OpIAdd, uintType, { firstIndex, localX });
+
+    // bool inRange = index < parameters.rowCount;
+    const uint32_t rowCountPointer = b.Emit(&code, Spv::OpAccessChain, parameterPointer,
+        { parameters, memberIndex });
+    const uint32_t rowCount = b.Emit(&code, Spv::OpLoad, uintType, { rowCountPointer });
+    const uint32_t inRange = b.Emit(&code, Spv::OpULessThan, boolType, { index, rowCount });
+
+    // The row count is never 0, ColumnFilter skips the dispatch instead
+    const uint32_t lastRow = b.Emit(&code, Spv::OpISub, uintType, { rowCount, uint1 });
+    const uint32_t row = b.Emit(&code, Spv::OpExtInst, uintType,
+        { glslExtInst, Spv::GLSLstd450UMin, index, lastRow });
+
+    std::vector<bool> used(columnCount_, false);
+    for (const auto& node : nodes_)
+    {
+        if (node.type == NodeType::Compare)
+        {
+            for (const auto& operand : node.operands)
+            {
+                if (operand.column >= 0)
+                {
+                    used[operand.column] = true;
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < columnCount_; ++i)
+    {
+        if (used[i])
+        {
+            const uint32_t pointer = b.Emit(&code, Spv::OpAccessChain, floatPointer,
+                { columns[i], memberIndex, row });
+            emitter.SetColumnValue(i, b.Emit(&code, Spv::OpLoad, floatType, { pointer }));
+        }
+    }
+
+    const uint32_t match = emitter.Emit(root_);
+    const uint32_t laneActive = b.Emit(&code, Spv::OpLogicalAnd, boolType, { inRange, match });
+
+    // uint64_t mask = ballotARB (laneActive);
+    const uint32_t ballot = b.Emit(&code, Spv::OpSubgroupBallotKHR, uvec4Type, { laneActive });
+    const uint32_t maskLow = b.Emit(&code, Spv::OpCompositeExtract, uintType, { ballot, 0 });
+    const uint32_t maskHigh = b.Emit(&code, Spv::OpCompositeExtract, uintType, { ballot, 1 });
+    const uint32_t maskParts = b.Emit(&code, Spv::OpCompositeConstruct, uvec2Type, { maskLow, maskHigh });
+    const uint32_t mask = b.Emit(&code, Spv::OpBitcast, uint64Type, { maskParts });
+
+    const uint32_t countLow = b.Emit(&code, Spv::OpBitCount, uintType, { maskLow });
+    const uint32_t countHigh = b.Emit(&code, Spv::OpBitCount, uintType, { maskHigh });
+    const uint32_t waveCount = b.Emit(&code, Spv::OpIAdd, uintType, { countLow, countHigh });
+
+    // if (gl_LocalInvocationID.x == 0) waveOffset = atomicAdd (...);
+    const uint32_t firstLane = b.Emit(&code, Spv::OpIEqual, boolType, { localX, uint0 });
+    b.Emit(&code, Spv::OpSelectionMerge, { reserveMergeLabel, 0 });
+    b.Emit(&code, Spv::OpBranchConditional, { firstLane, reserveLabel, reserveMergeLabel });
+
+    b.Emit(&code, Spv::OpLabel, { reserveLabel });
+    const uint32_t counterPointer = b.Emit(&code, Spv::OpAccessChain, uintPointer,
+        { counter, memberIndex, uint0 });
+    const uint32_t reserved = b.Emit(&code, Spv::OpAtomicIAdd, uintType,
+        { counterPointer, scopeDevice, uint0, waveCount });
+    b.Emit(&code, Spv::OpBranch, { reserveMergeLabel });
+
+    b.Emit(&code, Spv::OpLabel, { reserveMergeLabel });
+    const uint32_t laneOffset = b.Emit(&code, Spv::OpPhi, uintType,
+        { uint0, entryLabel, reserved, reserveLabel });
+
+    // waveOffset = readFirstInvocationARB (waveOffset);
+    const uint32_t waveOffset = b.Emit(&code, Spv::OpSubgroupFirstInvocationKHR, uintType,
+        { laneOffset });
+    const uint32_t prefix = b.Emit(&code, Spv::OpExtInst, uintType,
+        { amdExtInst, Spv::MbcntAMD, mask });
+    const uint32_t slot = b.Emit(&code, Spv::OpIAdd, uintType, { waveOffset, prefix });
+
+    // if (laneActive) outputDataArray [waveOffset + mbcntAMD (mask)] = index;
+    b.Emit(&code, Spv::OpSelectionMerge, { endLabel, 0 });
+    b.Emit(&code, Spv::OpBranchConditional, { laneActive, storeLabel, endLabel });
+
+    b.Emit(&code, Spv::OpLabel, { storeLabel });
+    const uint32_t outputPointer = b.Emit(&code, Spv::OpAccessChain, uintPointer,
+        { output, memberIndex, slot });
+    b.Emit(&code, Spv::OpStore, { outputPointer, index });
+    b.Emit(&code, Spv::OpBranch, { endLabel });
+
+    b.Emit(&code, Spv::OpLabel, { endLabel });
+    b.Emit(&code, Spv::OpReturn, {});
+    b.Emit(&code, Spv::OpFunctionEnd, {});
+
+    return b.Finish();
+}
+}   // namespace AMD
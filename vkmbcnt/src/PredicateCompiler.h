@@ -0,0 +1,156 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef AMD_VULKAN_SAMPLE_PREDICATE_COMPILER_H_
+#define AMD_VULKAN_SAMPLE_PREDICATE_COMPILER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace AMD
+{
+///////////////////////////////////////////////////////////////////////////////
+// A filter over float columns, for instance
+//
+//     a > 3.5 && (b == 7 || c < 0)
+//
+// Grammar:
+//
+//     expression := and ('||' and)*
+//     and        := unary ('&&' unary)*
+//     unary      := '!' unary | '(' expression ')' | operand compare operand
+//     compare    := '<' | '<=' | '>' | '>=' | '==' | '!='
+//     operand    := column name | number
+//
+// Comparisons follow C: they are false if either side is NaN, except !=.
+// CompileToSpirv turns a predicate into a compute shader which evaluates it
+// for one row per lane and compacts the indices of the matching rows with
+// ballot/mbcnt, like compact.comp.
+class Predicate
+{
+public:
+    // Parses expression. Column names refer to columnNames, whose order
+    // gives the column (and binding) index. Numbers are read in the "C"
+    // locale. Returns false and sets error if the expression is invalid or
+    // nests deeper than MaxDepth
+    static bool Parse(const std::string& expression,
+        const std::vector<std::string>& columnNames, Predicate* result,
+        std::string* error);
+
+    // Deepest tree Parse accepts, counting both nested parentheses and
+    // operators. Evaluate and CompileToSpirv recurse over the tree, so this
+    // bounds their stack use too
+    static const int MaxDepth = 256;
+
+    // Fully parenthesized form with columns by index, for example
+    // "((c0 > 3.5) && ((c1 == 7) || (c2 < 0)))". Expressions which only
+    // differ in spacing, redundant parentheses or column names share it
+    const std::string& GetCanonicalForm() const
+    {
+        return canonicalForm_;
+    }
+
+    // FNV-1a of the canonical form and the column count, which together
+    // determine the shader
+    uint64_t GetHash() const;
+
+    // Number of columns the shader binds, matching columnNames
+    int GetColumnCount() const
+    {
+        return columnCount_;
+    }
+
+    // Host reference: evaluates the predicate for row
+    bool Evaluate(const float* const* columns, const std::size_t row) const;
+
+    // Compute shader with local size 64 and these bindings in set 0:
+    //   0 .. columnCount-1  float columns
+    //   columnCount         uint matching row indices
+    //   columnCount + 1     uint counter, must be 0 before the dispatch
+    // and the row count as a single uint push constant. Rows are spread
+    // over y like DispatchFlat
+    std::vector<uint32_t> CompileToSpirv() const;
+
+    enum class NodeType
+    {
+        Compare,
+        And,
+        Or,
+        Not
+    };
+
+    enum class CompareOp
+    {
+        Less,
+        LessEqual,
+        Greater,
+        GreaterEqual,
+        Equal,
+        NotEqual
+    };
+
+    // Either a column or a constant
+    struct Operand
+    {
+        int column = -1;
+        float constant = 0;
+    };
+
+    struct Node
+    {
+        Node()
+        {
+            children[0] = children[1] = -1;
+        }
+
+        NodeType type = NodeType::Compare;
+
+        // Compare only
+        CompareOp op = CompareOp::Less;
+        Operand operands[2];
+
+        // And and Or use both, Not only the first
+        int children[2];
+    };
+
+    const std::vector<Node>& GetNodes() const
+    {
+        return nodes_;
+    }
+
+    int GetRoot() const
+    {
+        return root_;
+    }
+
+private:
+    std::vector<Node> nodes_;
+    int root_ = -1;
+    int columnCount_ = 0;
+    std::string canonicalForm_;
+};
+}   // namespace AMD
+
+#endif
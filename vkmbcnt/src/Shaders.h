@@ -130,3 +130,5737 @@ const unsigned char BasicComputeShader [] = {
 	0xf8, 0x0 , 0x2 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0xfd, 0x0 , 0x1 , 0x0 , 0x38, 
 	0x0 , 0x1 , 0x0 , 
 };
+const unsigned char BallotBitmapShader [] = {
+	0x3 , 0x2 , 0x23, 0x7 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x6f, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x2 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x11, 0x0 , 0x2 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x2 , 
+	0x0 , 0x47, 0x11, 0x0 , 0x0 , 0xa , 0x0 , 0x7 , 0x0 , 0x53, 0x50, 0x56, 0x5f, 
+	0x4b, 0x48, 0x52, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 
+	0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x6 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 
+	0x30, 0x0 , 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x8 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x16, 
+	0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x1c, 0x0 , 
+	0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x6 , 
+	0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x3 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0xc2, 0x1 , 0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 
+	0x5f, 0x41, 0x52, 0x42, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 
+	0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 
+	0x47, 0x4c, 0x5f, 0x41, 0x52, 0x42, 0x5f, 0x67, 0x70, 0x75, 0x5f, 0x73, 0x68, 
+	0x61, 0x64, 0x65, 0x72, 0x5f, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x0 , 0x5 , 0x0 , 
+	0x4 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x69, 0x6e, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x69, 0x6e, 0x70, 0x75, 
+	0x74, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0x7 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x69, 0x6e, 0x70, 0x75, 0x74, 0x44, 
+	0x61, 0x74, 0x61, 0x41, 0x72, 0x72, 0x61, 0x79, 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 
+	0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x73, 0x6b, 0x44, 0x61, 0x74, 0x61, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x73, 0x6b, 0x41, 0x72, 0x72, 0x61, 0x79, 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x77, 0x61, 0x76, 
+	0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 0x0 , 
+	0x6 , 0x0 , 0x7 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x77, 
+	0x61, 0x76, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x41, 0x72, 0x72, 0x61, 0x79, 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x67, 0x72, 0x6f, 
+	0x75, 0x70, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x0 , 0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 
+	0x1c, 0x0 , 0x0 , 0x0 , 0x67, 0x6c, 0x5f, 0x57, 0x6f, 0x72, 0x6b, 0x47, 0x72, 
+	0x6f, 0x75, 0x70, 0x49, 0x44, 0x0 , 0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x22, 0x0 , 
+	0x0 , 0x0 , 0x67, 0x6c, 0x5f, 0x4e, 0x75, 0x6d, 0x57, 0x6f, 0x72, 0x6b, 0x47, 
+	0x72, 0x6f, 0x75, 0x70, 0x73, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 
+	0x29, 0x0 , 0x0 , 0x0 , 0x69, 0x6e, 0x64, 0x65, 0x78, 0x0 , 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x8 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0x67, 0x6c, 0x5f, 0x4c, 0x6f, 0x63, 
+	0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 
+	0x44, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 
+	0x6c, 0x61, 0x6e, 0x65, 0x41, 0x63, 0x74, 0x69, 0x76, 0x65, 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x4 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x73, 0x6b, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x73, 
+	0x6b, 0x50, 0x61, 0x72, 0x74, 0x73, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 
+	0x6 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x48, 
+	0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 
+	0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 
+	0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0xd , 
+	0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 
+	0x47, 0x0 , 0x4 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 
+	0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 
+	0x10, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 
+	0x0 , 0x4 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 
+	0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 
+	0xb , 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x2f, 
+	0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 
+	0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 
+	0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 
+	0x40, 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x3 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x20, 
+	0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x3 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 
+	0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x4 , 
+	0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x1d, 0x0 , 0x3 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x1e, 
+	0x0 , 0x3 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 
+	0x4 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xf , 
+	0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 
+	0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x3 , 
+	0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 
+	0x13, 0x0 , 0x0 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x14, 
+	0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x4 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x13, 0x0 , 0x2 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x21, 
+	0x0 , 0x3 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 
+	0x4 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 
+	0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 
+	0x3 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 
+	0x0 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 
+	0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 
+	0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 0x0 , 
+	0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 0x6 , 0x0 , 
+	0x1d, 0x0 , 0x0 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x2c, 
+	0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 
+	0x0 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 0x2 , 
+	0x0 , 0x34, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x34, 0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 0x3 , 0x0 , 0x34, 
+	0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x40, 0x0 , 
+	0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x20, 0x0 , 0x4 , 0x0 , 0x45, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0xb , 
+	0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0x48, 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 
+	0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0x4c, 0x0 , 0x0 , 
+	0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 
+	0x11, 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x20, 
+	0x0 , 0x4 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x4c, 0x0 , 
+	0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x6e, 0x0 , 0x0 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x5 , 0x0 , 0x17, 
+	0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 
+	0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 
+	0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x4 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x7 , 
+	0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x33, 0x0 , 
+	0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x45, 0x0 , 0x0 , 
+	0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x5d, 0x0 , 0x0 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x5 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x1c, 0x0 , 
+	0x0 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 0x0 , 
+	0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 
+	0x20, 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x9 , 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x24, 0x0 , 
+	0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0x11, 0x0 , 0x0 , 
+	0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 
+	0x41, 0x0 , 0x5 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x1c, 
+	0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 
+	0x0 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 
+	0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 
+	0x27, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x28, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 
+	0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0x11, 0x0 , 0x0 , 
+	0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 
+	0x41, 0x0 , 0x5 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x30, 0x0 , 0x0 , 0x0 , 0x2f, 
+	0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 
+	0x0 , 0x0 , 0x31, 0x0 , 0x0 , 0x0 , 0x30, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 
+	0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 
+	0x31, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x32, 
+	0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x37, 0x0 , 0x0 , 
+	0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x44, 0x0 , 0x5 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 
+	0x38, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x7c, 
+	0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0x38, 0x0 , 
+	0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 
+	0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 0x34, 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x0 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0xf7, 
+	0x0 , 0x3 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 
+	0x4 , 0x0 , 0x3b, 0x0 , 0x0 , 0x0 , 0x3c, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x3c, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x11, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x6 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x3f, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x3f, 0x0 , 0x0 , 0x0 , 
+	0xba, 0x0 , 0x5 , 0x0 , 0x34, 0x0 , 0x0 , 0x0 , 0x43, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x33, 0x0 , 
+	0x0 , 0x0 , 0x43, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x3d, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x34, 0x0 , 0x0 , 0x0 , 0x46, 0x0 , 0x0 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0x45, 
+	0x11, 0x4 , 0x0 , 0x48, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x46, 0x0 , 
+	0x0 , 0x0 , 0x51, 0x0 , 0x5 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x49, 0x0 , 0x0 , 
+	0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 0x0 , 
+	0x11, 0x0 , 0x0 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x5 , 0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 0x4b, 0x0 , 
+	0x0 , 0x0 , 0x49, 0x0 , 0x0 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 
+	0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x4d, 0x0 , 0x0 , 0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0x4d, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x5 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x2f, 0x0 , 
+	0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 0x0 , 
+	0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x5 , 0x0 , 
+	0x34, 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0x50, 
+	0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0x52, 0x0 , 0x0 , 
+	0x0 , 0x53, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x52, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x54, 0x0 , 0x0 , 0x0 , 0x1a, 
+	0x0 , 0x0 , 0x0 , 0x44, 0x0 , 0x5 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x55, 0x0 , 
+	0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x56, 0x0 , 0x0 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 
+	0x7c, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x57, 0x0 , 0x0 , 0x0 , 0x56, 
+	0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 0x34, 0x0 , 0x0 , 0x0 , 0x58, 0x0 , 
+	0x0 , 0x0 , 0x54, 0x0 , 0x0 , 0x0 , 0x57, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 
+	0x0 , 0x53, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 
+	0xf5, 0x0 , 0x7 , 0x0 , 0x34, 0x0 , 0x0 , 0x0 , 0x59, 0x0 , 0x0 , 0x0 , 0x51, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0x52, 0x0 , 
+	0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x5b, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x59, 0x0 , 0x0 , 0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 
+	0x5b, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 0x44, 0x0 , 
+	0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 0x5f, 0x0 , 0x0 , 
+	0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 
+	0x5f, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x60, 
+	0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xb , 0x0 , 
+	0x0 , 0x0 , 0x61, 0x0 , 0x0 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 
+	0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0x62, 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 
+	0x9 , 0x0 , 0x0 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x62, 
+	0x0 , 0x0 , 0x0 , 0x61, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 
+	0x0 , 0x0 , 0x64, 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 
+	0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x65, 0x0 , 0x0 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 
+	0x9 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x66, 
+	0x0 , 0x0 , 0x0 , 0x65, 0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 0x66, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 
+	0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x68, 0x0 , 0x0 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 
+	0xf , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x69, 
+	0x0 , 0x0 , 0x0 , 0x68, 0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x6a, 0x0 , 0x0 , 0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 
+	0x6a, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x6c, 
+	0x0 , 0x0 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x6e, 0x0 , 
+	0x0 , 0x0 , 0x6d, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 
+	0x0 , 0x64, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x6d, 0x0 , 0x0 , 0x0 , 
+	0x6c, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x5b, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0x5b, 0x0 , 0x0 , 0x0 , 0xfd, 0x0 , 0x1 , 0x0 , 0x38, 0x0 , 
+	0x1 , 0x0 , 
+};
+const unsigned char CompactShader [] = {
+	0x3 , 0x2 , 0x23, 0x7 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x81, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x2 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x11, 0x0 , 0x2 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x2 , 
+	0x0 , 0x47, 0x11, 0x0 , 0x0 , 0xa , 0x0 , 0x7 , 0x0 , 0x53, 0x50, 0x56, 0x5f, 
+	0x4b, 0x48, 0x52, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 
+	0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x7 , 0x0 , 0x53, 0x50, 
+	0x56, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 
+	0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x6 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 
+	0x34, 0x35, 0x30, 0x0 , 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x8 , 0x0 , 0x70, 0x0 , 
+	0x0 , 0x0 , 0x53, 0x50, 0x56, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 0x73, 0x68, 0x61, 
+	0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 
+	0xe , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0xf , 
+	0x0 , 0x8 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 
+	0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 
+	0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x6 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 
+	0x11, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x3 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xc2, 0x1 , 
+	0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 
+	0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 0x5f, 0x41, 0x52, 
+	0x42, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 
+	0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 0x5f, 
+	0x41, 0x52, 0x42, 0x5f, 0x67, 0x70, 0x75, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 
+	0x72, 0x5f, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x16, 
+	0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 
+	0x65, 0x72, 0x73, 0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x43, 0x6f, 
+	0x75, 0x6e, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x74, 0x68, 0x72, 0x65, 0x73, 0x68, 0x6f, 
+	0x6c, 0x64, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x73, 0x63, 0x61, 0x6c, 0x65, 0x0 , 0x0 , 0x0 , 0x6 , 
+	0x0 , 0x7 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x6f, 0x75, 
+	0x74, 0x70, 0x75, 0x74, 0x43, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x0 , 
+	0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x70, 0x61, 0x72, 0x61, 
+	0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0xb , 
+	0x0 , 0x0 , 0x0 , 0x69, 0x6e, 0x70, 0x75, 0x74, 0x44, 0x61, 0x74, 0x61, 0x0 , 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x69, 0x6e, 0x70, 0x75, 0x74, 0x44, 0x61, 0x74, 0x61, 0x41, 0x72, 0x72, 
+	0x61, 0x79, 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x6f, 
+	0x75, 0x74, 0x70, 0x75, 0x74, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 0x6 , 0x0 , 
+	0x7 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x6f, 0x75, 0x74, 
+	0x70, 0x75, 0x74, 0x44, 0x61, 0x74, 0x61, 0x41, 0x72, 0x72, 0x61, 0x79, 0x0 , 
+	0x5 , 0x0 , 0x5 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x63, 0x6f, 0x75, 0x6e, 0x74, 
+	0x65, 0x72, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x13, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x43, 
+	0x6f, 0x75, 0x6e, 0x74, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 
+	0x67, 0x72, 0x6f, 0x75, 0x70, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x6 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0x67, 0x6c, 0x5f, 0x57, 0x6f, 0x72, 
+	0x6b, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x49, 0x44, 0x0 , 0x0 , 0x5 , 0x0 , 0x7 , 
+	0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x67, 0x6c, 0x5f, 0x4e, 0x75, 0x6d, 0x57, 0x6f, 
+	0x72, 0x6b, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x4 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x69, 0x6e, 0x64, 0x65, 0x78, 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0x67, 0x6c, 0x5f, 
+	0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 
+	0x6f, 0x6e, 0x49, 0x44, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 0x33, 
+	0x0 , 0x0 , 0x0 , 0x74, 0x68, 0x69, 0x73, 0x4c, 0x61, 0x6e, 0x65, 0x44, 0x61, 
+	0x74, 0x61, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x36, 0x0 , 0x0 , 
+	0x0 , 0x6c, 0x61, 0x6e, 0x65, 0x41, 0x63, 0x74, 0x69, 0x76, 0x65, 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x4 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x73, 0x6b, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x77, 0x61, 
+	0x76, 0x65, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 
+	0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x73, 0x6b, 0x50, 0x61, 0x72, 0x74, 
+	0x73, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x6d, 0x0 , 0x0 , 0x0 , 0x6f, 
+	0x75, 0x74, 0x70, 0x75, 0x74, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x0 , 0x48, 0x0 , 
+	0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x48, 
+	0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 
+	0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 
+	0x47, 0x0 , 0x3 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x47, 
+	0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 
+	0xb , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x9 , 
+	0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 
+	0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0xf , 
+	0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0xe , 0x0 , 
+	0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 
+	0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 
+	0x48, 0x0 , 0x5 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x13, 0x0 , 
+	0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x12, 0x0 , 0x0 , 
+	0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 
+	0x12, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x47, 
+	0x0 , 0x4 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 
+	0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 
+	0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 
+	0xb , 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x4 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 
+	0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 
+	0x0 , 0x15, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x3 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x20, 
+	0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x3 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0xb , 0x0 , 0x0 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0xc , 
+	0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 
+	0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 
+	0x20, 0x0 , 0x4 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xf , 
+	0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 
+	0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 
+	0x13, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x14, 
+	0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x4 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x13, 0x0 , 0x2 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x21, 
+	0x0 , 0x3 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 
+	0x4 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x3 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 
+	0x0 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 
+	0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 
+	0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 0x6 , 0x0 , 
+	0x1d, 0x0 , 0x0 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x2c, 
+	0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 
+	0x0 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 
+	0x0 , 0x34, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 
+	0x2b, 0x0 , 0x4 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x14, 0x0 , 0x2 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 
+	0x4 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x37, 0x0 , 0x0 , 
+	0x0 , 0x2a, 0x0 , 0x3 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 
+	0x20, 0x0 , 0x4 , 0x0 , 0x3c, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x43, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x47, 0x0 , 0x0 , 
+	0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x4 , 0x0 , 
+	0x4b, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x20, 
+	0x0 , 0x4 , 0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x4b, 0x0 , 
+	0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0x56, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 
+	0x4 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x53, 0x0 , 0x0 , 
+	0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x77, 
+	0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x5 , 0x0 , 0x17, 0x0 , 
+	0x0 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x1b, 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 
+	0x0 , 0x4 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x34, 0x0 , 0x0 , 0x0 , 0x33, 0x0 , 0x0 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 
+	0x36, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x4c, 
+	0x0 , 0x0 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x4 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x6d, 
+	0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x20, 0x0 , 
+	0x0 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 
+	0x1f, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x23, 
+	0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 
+	0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 
+	0x21, 0x0 , 0x0 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x20, 
+	0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x27, 0x0 , 0x0 , 
+	0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x28, 0x0 , 0x0 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 
+	0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 
+	0x2a, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x20, 
+	0x0 , 0x0 , 0x0 , 0x30, 0x0 , 0x0 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x31, 0x0 , 0x0 , 
+	0x0 , 0x30, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x32, 0x0 , 0x0 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x31, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x3 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 
+	0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x5 , 0x0 , 0x3c, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 
+	0x37, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0x3f, 0x0 , 0x0 , 
+	0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x3f, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x29, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x43, 0x0 , 0x0 , 0x0 , 0x42, 0x0 , 
+	0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 
+	0x42, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0x44, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x45, 0x0 , 
+	0x0 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x47, 0x0 , 0x0 , 
+	0x0 , 0x46, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x0 , 0x0 , 0x46, 
+	0x0 , 0x0 , 0x0 , 0xba, 0x0 , 0x5 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0x49, 0x0 , 
+	0x0 , 0x0 , 0x45, 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 
+	0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x49, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 
+	0x40, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0x4d, 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 
+	0x0 , 0x0 , 0x45, 0x11, 0x4 , 0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0x4e, 0x0 , 0x0 , 
+	0x0 , 0x4d, 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x50, 0x0 , 0x0 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x51, 
+	0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0x4e, 0x0 , 
+	0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x5 , 0x0 , 0x53, 0x0 , 0x0 , 
+	0x0 , 0x52, 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x0 , 0x0 , 
+	0x7c, 0x0 , 0x4 , 0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 0x54, 0x0 , 0x0 , 0x0 , 0x52, 
+	0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x54, 0x0 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x56, 0x0 , 0x0 , 
+	0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x57, 0x0 , 0x0 , 0x0 , 
+	0x2f, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0x57, 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 
+	0x5 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0x59, 0x0 , 0x0 , 0x0 , 0x58, 0x0 , 0x0 , 
+	0x0 , 0x56, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x5b, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x59, 0x0 , 0x0 , 0x0 , 0x5a, 
+	0x0 , 0x0 , 0x0 , 0x5b, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x5a, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 0x5e, 0x0 , 0x0 , 
+	0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 
+	0x5f, 0x0 , 0x0 , 0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x5c, 
+	0x0 , 0x0 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x1b, 0x0 , 
+	0x0 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x61, 0x0 , 0x0 , 0x0 , 
+	0x60, 0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x62, 
+	0x0 , 0x0 , 0x0 , 0x61, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x1b, 0x0 , 
+	0x0 , 0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x64, 0x0 , 0x0 , 0x0 , 
+	0x63, 0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x65, 
+	0x0 , 0x0 , 0x0 , 0x64, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x66, 0x0 , 0x0 , 0x0 , 0x62, 0x0 , 0x0 , 0x0 , 0x65, 0x0 , 0x0 , 
+	0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 
+	0x66, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0x68, 
+	0x0 , 0x0 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0xea, 0x0 , 
+	0x7 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x6a, 0x0 , 0x0 , 0x0 , 0x68, 0x0 , 0x0 , 
+	0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x56, 0x0 , 0x0 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x6a, 0x0 , 0x0 , 0x0 , 0xf9, 
+	0x0 , 0x2 , 0x0 , 0x5b, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x5b, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x6b, 0x0 , 0x0 , 
+	0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x46, 0x11, 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x6c, 0x0 , 0x0 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x55, 
+	0x0 , 0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x6e, 0x0 , 0x0 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 0x6f, 0x0 , 0x0 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 
+	0xc , 0x0 , 0x6 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x71, 0x0 , 0x0 , 0x0 , 0x70, 
+	0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x6f, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 
+	0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x72, 0x0 , 0x0 , 0x0 , 0x6e, 0x0 , 0x0 , 
+	0x0 , 0x71, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x6d, 0x0 , 0x0 , 0x0 , 
+	0x72, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0x73, 
+	0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x75, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x73, 0x0 , 0x0 , 
+	0x0 , 0x74, 0x0 , 0x0 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0x74, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x76, 
+	0x0 , 0x0 , 0x0 , 0x6d, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x3c, 0x0 , 
+	0x0 , 0x0 , 0x78, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x77, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x79, 0x0 , 0x0 , 0x0 , 
+	0x78, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0x7a, 
+	0x0 , 0x0 , 0x0 , 0x76, 0x0 , 0x0 , 0x0 , 0x79, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 
+	0x2 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x75, 0x0 , 0x0 , 
+	0x0 , 0xf5, 0x0 , 0x7 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 
+	0x73, 0x0 , 0x0 , 0x0 , 0x5b, 0x0 , 0x0 , 0x0 , 0x7a, 0x0 , 0x0 , 0x0 , 0x74, 
+	0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x7d, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x0 , 
+	0x0 , 0x7d, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x7c, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x7e, 0x0 , 0x0 , 0x0 , 0x6d, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x7f, 0x0 , 
+	0x0 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x43, 0x0 , 0x0 , 
+	0x0 , 0x80, 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 
+	0x7e, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x80, 0x0 , 0x0 , 0x0 , 0x7f, 
+	0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x7d, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 
+	0x2 , 0x0 , 0x7d, 0x0 , 0x0 , 0x0 , 0xfd, 0x0 , 0x1 , 0x0 , 0x38, 0x0 , 0x1 , 
+	0x0 , 
+};
+const unsigned char InPlaceCompactShader [] = {
+	0x3 , 0x2 , 0x23, 0x7 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xee, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x2 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x11, 0x0 , 0x2 , 0x0 , 0x47, 0x11, 0x0 , 0x0 , 0x11, 0x0 , 0x2 , 
+	0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x7 , 0x0 , 0x53, 0x50, 0x56, 0x5f, 
+	0x4b, 0x48, 0x52, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 
+	0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x7 , 0x0 , 0x53, 0x50, 
+	0x56, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 
+	0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x6 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 
+	0x34, 0x35, 0x30, 0x0 , 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x8 , 0x0 , 0xd6, 0x0 , 
+	0x0 , 0x0 , 0x53, 0x50, 0x56, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 0x73, 0x68, 0x61, 
+	0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 
+	0xe , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0xf , 
+	0x0 , 0x6 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 
+	0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x6 , 
+	0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x3 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0xc2, 0x1 , 0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 
+	0x5f, 0x41, 0x4d, 0x44, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 
+	0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 
+	0x47, 0x4c, 0x5f, 0x41, 0x52, 0x42, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 
+	0x5f, 0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 
+	0x7 , 0x0 , 0x47, 0x4c, 0x5f, 0x41, 0x52, 0x42, 0x5f, 0x67, 0x70, 0x75, 0x5f, 
+	0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x0 , 
+	0x5 , 0x0 , 0x4 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x69, 0x6e, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x50, 0x61, 
+	0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x65, 0x6c, 0x65, 0x6d, 
+	0x65, 0x6e, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x6 , 
+	0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x74, 0x68, 
+	0x72, 0x65, 0x73, 0x68, 0x6f, 0x6c, 0x64, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 
+	0x72, 0x73, 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x64, 
+	0x61, 0x74, 0x61, 0x0 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0xb , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x64, 0x61, 0x74, 0x61, 0x41, 0x72, 0x72, 
+	0x61, 0x79, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 
+	0x73, 0x74, 0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 0x0 , 0x6 , 
+	0x0 , 0x6 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x6f, 0x75, 
+	0x74, 0x70, 0x75, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x0 , 0x6 , 0x0 , 0x6 , 
+	0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x6e, 0x65, 0x78, 0x74, 
+	0x54, 0x69, 0x6c, 0x65, 0x0 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0x10, 
+	0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x74, 0x69, 0x6c, 0x65, 0x50, 0x72, 
+	0x65, 0x66, 0x69, 0x78, 0x41, 0x72, 0x72, 0x61, 0x79, 0x0 , 0x5 , 0x0 , 0x4 , 
+	0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x74, 0x69, 0x6c, 0x65, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x8 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x67, 0x6c, 0x5f, 0x4c, 0x6f, 
+	0x63, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 
+	0x49, 0x44, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x2c, 0x0 , 0x0 , 
+	0x0 , 0x74, 0x69, 0x6c, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x5 , 0x0 , 0x3b, 0x0 , 0x0 , 0x0 , 0x74, 0x69, 0x6c, 0x65, 0x53, 
+	0x74, 0x61, 0x72, 0x74, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x3e, 0x0 , 
+	0x0 , 0x0 , 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 
+	0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x73, 0x6b, 0x73, 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x6 , 0x0 , 0x46, 0x0 , 0x0 , 0x0 , 0x74, 0x69, 0x6c, 0x65, 0x53, 
+	0x75, 0x72, 0x76, 0x69, 0x76, 0x6f, 0x72, 0x73, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x3 , 0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 
+	0x0 , 0x50, 0x0 , 0x0 , 0x0 , 0x69, 0x6e, 0x64, 0x65, 0x78, 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x5 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 0x6c, 0x61, 0x6e, 0x65, 0x41, 
+	0x63, 0x74, 0x69, 0x76, 0x65, 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x7e, 0x0 , 
+	0x0 , 0x0 , 0x6d, 0x61, 0x73, 0x6b, 0x50, 0x61, 0x72, 0x74, 0x73, 0x0 , 0x0 , 
+	0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x90, 0x0 , 0x0 , 0x0 , 0x74, 0x69, 0x6c, 0x65, 
+	0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x9a, 
+	0x0 , 0x0 , 0x0 , 0x70, 0x72, 0x65, 0x76, 0x69, 0x6f, 0x75, 0x73, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x3 , 0x0 , 0xbe, 0x0 , 0x0 , 0x0 , 0x69, 0x0 , 0x0 , 
+	0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0xdd, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x73, 0x6b, 
+	0x50, 0x61, 0x72, 0x74, 0x73, 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x7 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 
+	0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0xa , 
+	0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 
+	0x5 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 
+	0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x22, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 
+	0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 
+	0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x48, 0x0 , 0x5 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x10, 0x0 , 
+	0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0x23, 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x4 , 0x0 , 0x10, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 
+	0x4 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x0 , 
+	0x0 , 0x48, 0x0 , 0x4 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0x17, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x3 , 
+	0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0xe , 0x0 , 0x0 , 
+	0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 
+	0x1b, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x15, 
+	0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 
+	0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x20, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x3 , 0x0 , 0x6 , 
+	0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 
+	0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x4 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x9 , 
+	0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x3 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 
+	0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 
+	0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0xb , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x9 , 
+	0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x3 , 
+	0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x5 , 0x0 , 
+	0x10, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xf , 
+	0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 0x0 , 
+	0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x80, 0x13, 0x0 , 0x2 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x3 , 
+	0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 
+	0x19, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x2b, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x1d, 
+	0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 
+	0x4 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x14, 0x0 , 0x2 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x2b, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 
+	0x9 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0x30, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 
+	0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x31, 0x0 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3f, 
+	0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x1c, 0x0 , 0x4 , 0x0 , 0x40, 0x0 , 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x3f, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 
+	0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 
+	0x15, 0x0 , 0x4 , 0x0 , 0x43, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x1c, 0x0 , 0x4 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0x43, 0x0 , 
+	0x0 , 0x0 , 0x3f, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x45, 0x0 , 0x0 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 
+	0x48, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 
+	0x0 , 0x4 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 0x3 , 0x0 , 0x22, 
+	0x0 , 0x0 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x69, 0x0 , 
+	0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 
+	0x0 , 0x70, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 
+	0x17, 0x0 , 0x4 , 0x0 , 0x76, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0x7a, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x7d, 0x0 , 0x0 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x43, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 
+	0x7f, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x7a, 0x0 , 0x0 , 0x0 , 0x2b, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xa7, 0x0 , 0x0 , 0x0 , 0xff, 0xff, 
+	0xff, 0x7f, 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xa9, 0x0 , 0x0 , 
+	0x0 , 0x48, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x5 , 0x0 , 0x43, 0x0 , 0x0 , 0x0 , 
+	0xc9, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x2b, 
+	0x0 , 0x5 , 0x0 , 0x43, 0x0 , 0x0 , 0x0 , 0xce, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x5 , 0x0 , 0x15, 0x0 , 0x0 , 
+	0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x19, 
+	0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x4 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x45, 0x0 , 
+	0x0 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 
+	0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x46, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x4 , 0x0 , 0x48, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x7 , 
+	0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 
+	0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x5e, 0x0 , 0x0 , 
+	0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x7f, 0x0 , 0x0 , 0x0 , 0x7e, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 
+	0x0 , 0x4 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x90, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x9a, 0x0 , 0x0 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x48, 0x0 , 0x0 , 0x0 , 
+	0xbe, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x7f, 
+	0x0 , 0x0 , 0x0 , 0xdd, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x3 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 
+	0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 
+	0xd , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x20, 
+	0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x5 , 0x0 , 0x22, 0x0 , 
+	0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 
+	0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0xfa, 0x0 , 0x4 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x24, 
+	0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 
+	0x5 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 
+	0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0xea, 0x0 , 0x7 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x29, 0x0 , 0x0 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x1a, 
+	0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x18, 0x0 , 
+	0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x24, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x46, 
+	0x11, 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x0 , 
+	0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 
+	0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0x2f, 0x0 , 0x0 , 
+	0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x34, 0x0 , 0x0 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x86, 
+	0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x34, 0x0 , 
+	0x0 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x2c, 0x0 , 0x0 , 
+	0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x36, 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0xae, 0x0 , 
+	0x5 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x0 , 
+	0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x39, 
+	0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x39, 0x0 , 
+	0x0 , 0x0 , 0xfd, 0x0 , 0x1 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x3a, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3c, 0x0 , 0x0 , 0x0 , 
+	0x18, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x0 , 0x0 , 0x3c, 0x0 , 0x0 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x3 , 0x0 , 0x3b, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 
+	0x0 , 0x46, 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0x47, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x49, 
+	0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x49, 0x0 , 0x0 , 0x0 , 0xf6, 0x0 , 
+	0x4 , 0x0 , 0x4d, 0x0 , 0x0 , 0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0x4a, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x4e, 
+	0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0xb1, 0x0 , 0x5 , 0x0 , 0x22, 0x0 , 
+	0x0 , 0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x30, 0x0 , 0x0 , 
+	0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 
+	0x4d, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x52, 0x0 , 0x0 , 
+	0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0x53, 0x0 , 0x0 , 0x0 , 0x52, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x7c, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x54, 0x0 , 0x0 , 0x0 , 0x53, 0x0 , 
+	0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x55, 0x0 , 0x0 , 
+	0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0x54, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 
+	0x1f, 0x0 , 0x0 , 0x0 , 0x56, 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0xd , 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x57, 0x0 , 
+	0x0 , 0x0 , 0x56, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x57, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x50, 0x0 , 0x0 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x59, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 
+	0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0x5b, 0x0 , 0x0 , 
+	0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0x59, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0x5b, 0x0 , 0x0 , 0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x5d, 
+	0x0 , 0x0 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 
+	0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x61, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0xd , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x62, 
+	0x0 , 0x0 , 0x0 , 0x61, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 0x22, 0x0 , 
+	0x0 , 0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0x62, 0x0 , 0x0 , 
+	0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x65, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0xfa, 0x0 , 0x4 , 0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0x64, 0x0 , 0x0 , 0x0 , 0x65, 
+	0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x64, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x66, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 
+	0x50, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0x68, 
+	0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x67, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x6a, 0x0 , 0x0 , 
+	0x0 , 0x68, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 
+	0x6b, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0x66, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0x6a, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x0 , 
+	0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0x6d, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x6 , 
+	0x0 , 0x0 , 0x0 , 0x6e, 0x0 , 0x0 , 0x0 , 0x6d, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 
+	0x5 , 0x0 , 0x70, 0x0 , 0x0 , 0x0 , 0x6f, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 
+	0x71, 0x0 , 0x0 , 0x0 , 0x6f, 0x0 , 0x0 , 0x0 , 0xba, 0x0 , 0x5 , 0x0 , 0x22, 
+	0x0 , 0x0 , 0x0 , 0x72, 0x0 , 0x0 , 0x0 , 0x6e, 0x0 , 0x0 , 0x0 , 0x71, 0x0 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 0x72, 0x0 , 0x0 , 
+	0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x65, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0x65, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x73, 
+	0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x22, 0x0 , 
+	0x0 , 0x0 , 0x74, 0x0 , 0x0 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 0x45, 0x11, 0x4 , 
+	0x0 , 0x76, 0x0 , 0x0 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x74, 0x0 , 0x0 , 0x0 , 
+	0x51, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x77, 0x0 , 0x0 , 0x0 , 0x75, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x78, 0x0 , 0x0 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 
+	0x0 , 0x50, 0x0 , 0x5 , 0x0 , 0x7a, 0x0 , 0x0 , 0x0 , 0x79, 0x0 , 0x0 , 0x0 , 
+	0x77, 0x0 , 0x0 , 0x0 , 0x78, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x43, 
+	0x0 , 0x0 , 0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 0x79, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 
+	0x5 , 0x0 , 0x7d, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 
+	0x0 , 0x73, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x7c, 0x0 , 0x0 , 0x0 , 
+	0x7b, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x80, 
+	0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x7d, 0x0 , 
+	0x0 , 0x0 , 0x81, 0x0 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x43, 0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x0 , 0x0 , 
+	0x81, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x7a, 0x0 , 0x0 , 0x0 , 0x83, 
+	0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x7e, 0x0 , 
+	0x0 , 0x0 , 0x83, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x19, 0x0 , 0x0 , 
+	0x0 , 0x84, 0x0 , 0x0 , 0x0 , 0x7e, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x85, 0x0 , 0x0 , 0x0 , 0x84, 
+	0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x86, 0x0 , 
+	0x0 , 0x0 , 0x85, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x19, 0x0 , 0x0 , 
+	0x0 , 0x87, 0x0 , 0x0 , 0x0 , 0x7e, 0x0 , 0x0 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x88, 0x0 , 0x0 , 0x0 , 0x87, 
+	0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x89, 0x0 , 
+	0x0 , 0x0 , 0x88, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0x8a, 0x0 , 0x0 , 0x0 , 0x86, 0x0 , 0x0 , 0x0 , 0x89, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x8b, 0x0 , 0x0 , 0x0 , 0x46, 
+	0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x8c, 0x0 , 
+	0x0 , 0x0 , 0x8a, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x8d, 0x0 , 0x0 , 0x0 , 0x8b, 0x0 , 0x0 , 0x0 , 0x8c, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x46, 0x0 , 0x0 , 0x0 , 0x8d, 0x0 , 0x0 , 0x0 , 0xf9, 
+	0x0 , 0x2 , 0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x4c, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x8e, 0x0 , 0x0 , 
+	0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0x8f, 0x0 , 0x0 , 0x0 , 0x8e, 0x0 , 0x0 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 
+	0x2 , 0x0 , 0x49, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x4d, 0x0 , 0x0 , 
+	0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x90, 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 
+	0x41, 0x0 , 0x5 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x91, 0x0 , 0x0 , 0x0 , 0x1b, 
+	0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x92, 0x0 , 0x0 , 0x0 , 0x91, 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x5 , 
+	0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x93, 0x0 , 0x0 , 0x0 , 0x92, 0x0 , 0x0 , 0x0 , 
+	0x1a, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x95, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x93, 0x0 , 0x0 , 0x0 , 0x94, 0x0 , 
+	0x0 , 0x0 , 0x95, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x94, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x96, 0x0 , 0x0 , 0x0 , 
+	0x18, 0x0 , 0x0 , 0x0 , 0xac, 0x0 , 0x5 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x97, 
+	0x0 , 0x0 , 0x0 , 0x96, 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 
+	0x3 , 0x0 , 0x99, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 
+	0x0 , 0x97, 0x0 , 0x0 , 0x0 , 0x98, 0x0 , 0x0 , 0x0 , 0x99, 0x0 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0x98, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x9a, 
+	0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x9b, 0x0 , 
+	0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x9b, 0x0 , 0x0 , 0x0 , 0xf6, 0x0 , 0x4 , 
+	0x0 , 0x9e, 0x0 , 0x0 , 0x0 , 0x9d, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0xf9, 0x0 , 0x2 , 0x0 , 0x9c, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x9c, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x9f, 0x0 , 
+	0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0xa0, 0x0 , 0x0 , 0x0 , 0x9f, 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 
+	0x41, 0x0 , 0x6 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0xa1, 0x0 , 0x0 , 0x0 , 0xe , 
+	0x0 , 0x0 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0xa0, 0x0 , 0x0 , 0x0 , 0xf1, 0x0 , 
+	0x7 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xa2, 0x0 , 0x0 , 0x0 , 0xa1, 0x0 , 0x0 , 
+	0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x9a, 0x0 , 0x0 , 0x0 , 0xa2, 0x0 , 0x0 , 0x0 , 0xf9, 
+	0x0 , 0x2 , 0x0 , 0x9d, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x9d, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xa3, 0x0 , 0x0 , 
+	0x0 , 0x9a, 0x0 , 0x0 , 0x0 , 0xc7, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0xa4, 0x0 , 0x0 , 0x0 , 0xa3, 0x0 , 0x0 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0xaa, 
+	0x0 , 0x5 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0xa5, 0x0 , 0x0 , 0x0 , 0xa4, 0x0 , 
+	0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0xa5, 0x0 , 0x0 , 
+	0x0 , 0x9b, 0x0 , 0x0 , 0x0 , 0x9e, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0x9e, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xa6, 
+	0x0 , 0x0 , 0x0 , 0x9a, 0x0 , 0x0 , 0x0 , 0xc7, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0xa8, 0x0 , 0x0 , 0x0 , 0xa6, 0x0 , 0x0 , 0x0 , 0xa7, 0x0 , 0x0 , 
+	0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x90, 0x0 , 0x0 , 0x0 , 0xa8, 0x0 , 0x0 , 0x0 , 
+	0xf9, 0x0 , 0x2 , 0x0 , 0x99, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x99, 
+	0x0 , 0x0 , 0x0 , 0xe1, 0x0 , 0x3 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0xa9, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x0 , 
+	0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0xab, 0x0 , 0x0 , 0x0 , 0x90, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0xac, 0x0 , 0x0 , 0x0 , 0x46, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 
+	0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xad, 0x0 , 0x0 , 0x0 , 0xab, 0x0 , 0x0 , 
+	0x0 , 0xac, 0x0 , 0x0 , 0x0 , 0xc5, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0xae, 0x0 , 0x0 , 0x0 , 0xad, 0x0 , 0x0 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x6 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0xaf, 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 
+	0x0 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x0 , 0x0 , 0xe5, 0x0 , 0x7 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x0 , 0x0 , 0xaf, 0x0 , 0x0 , 0x0 , 
+	0x26, 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0xae, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xb1, 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xb2, 0x0 , 0x0 , 
+	0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0xb3, 0x0 , 0x0 , 0x0 , 0xb2, 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0xaa, 
+	0x0 , 0x5 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0xb4, 0x0 , 0x0 , 0x0 , 0xb1, 0x0 , 
+	0x0 , 0x0 , 0xb3, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0xb6, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0xb4, 0x0 , 0x0 , 0x0 , 
+	0xb5, 0x0 , 0x0 , 0x0 , 0xb6, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xb5, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xb7, 0x0 , 
+	0x0 , 0x0 , 0x90, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0xb8, 0x0 , 0x0 , 0x0 , 0x46, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0xb9, 0x0 , 0x0 , 0x0 , 0xb7, 0x0 , 0x0 , 0x0 , 0xb8, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0xba, 0x0 , 
+	0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0xe5, 0x0 , 0x7 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xbb, 0x0 , 0x0 , 0x0 , 0xba, 0x0 , 0x0 , 0x0 , 
+	0x26, 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0xb9, 0x0 , 0x0 , 0x0 , 0xf9, 
+	0x0 , 0x2 , 0x0 , 0xb6, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xb6, 0x0 , 
+	0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x95, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 
+	0x0 , 0x95, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0xbc, 0x0 , 0x0 , 0x0 , 0x90, 0x0 , 0x0 , 0x0 , 0x46, 0x11, 0x4 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0xbd, 0x0 , 0x0 , 0x0 , 0xbc, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x3 , 0x0 , 0x90, 0x0 , 0x0 , 0x0 , 0xbd, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 
+	0x0 , 0xbe, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 
+	0xbf, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xbf, 0x0 , 0x0 , 0x0 , 0xf6, 
+	0x0 , 0x4 , 0x0 , 0xc3, 0x0 , 0x0 , 0x0 , 0xc2, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xc0, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 
+	0x0 , 0xc0, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0xc4, 0x0 , 0x0 , 0x0 , 0xbe, 0x0 , 0x0 , 0x0 , 0xb1, 0x0 , 0x5 , 0x0 , 0x22, 
+	0x0 , 0x0 , 0x0 , 0xc5, 0x0 , 0x0 , 0x0 , 0xc4, 0x0 , 0x0 , 0x0 , 0x30, 0x0 , 
+	0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0xc5, 0x0 , 0x0 , 0x0 , 0xc1, 0x0 , 0x0 , 
+	0x0 , 0xc3, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xc1, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xc6, 0x0 , 0x0 , 0x0 , 0xbe, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x7d, 0x0 , 0x0 , 0x0 , 0xc7, 0x0 , 
+	0x0 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0xc6, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x43, 0x0 , 0x0 , 0x0 , 0xc8, 0x0 , 0x0 , 0x0 , 0xc7, 0x0 , 0x0 , 0x0 , 
+	0x41, 0x0 , 0x5 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0xca, 0x0 , 0x0 , 0x0 , 0x1b, 
+	0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0xcb, 0x0 , 0x0 , 0x0 , 0xca, 0x0 , 0x0 , 0x0 , 0xc4, 0x0 , 0x5 , 
+	0x0 , 0x43, 0x0 , 0x0 , 0x0 , 0xcc, 0x0 , 0x0 , 0x0 , 0xc9, 0x0 , 0x0 , 0x0 , 
+	0xcb, 0x0 , 0x0 , 0x0 , 0xc7, 0x0 , 0x5 , 0x0 , 0x43, 0x0 , 0x0 , 0x0 , 0xcd, 
+	0x0 , 0x0 , 0x0 , 0xc8, 0x0 , 0x0 , 0x0 , 0xcc, 0x0 , 0x0 , 0x0 , 0xab, 0x0 , 
+	0x5 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0xcf, 0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 0x0 , 
+	0x0 , 0xce, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0xd1, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0xcf, 0x0 , 0x0 , 0x0 , 0xd0, 
+	0x0 , 0x0 , 0x0 , 0xd1, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xd0, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xd2, 0x0 , 0x0 , 
+	0x0 , 0x90, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0xd3, 0x0 , 0x0 , 0x0 , 0xbe, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x7d, 
+	0x0 , 0x0 , 0x0 , 0xd4, 0x0 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0xd3, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x43, 0x0 , 0x0 , 0x0 , 0xd5, 0x0 , 0x0 , 
+	0x0 , 0xd4, 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x6 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0xd7, 0x0 , 0x0 , 0x0 , 0xd6, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xd5, 
+	0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xd8, 0x0 , 
+	0x0 , 0x0 , 0xd2, 0x0 , 0x0 , 0x0 , 0xd7, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xd9, 0x0 , 0x0 , 0x0 , 0xbe, 0x0 , 0x0 , 0x0 , 
+	0x41, 0x0 , 0x5 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0xda, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x0 , 0x0 , 0xd9, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x6 , 0x0 , 
+	0x0 , 0x0 , 0xdb, 0x0 , 0x0 , 0x0 , 0xda, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 
+	0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0xdc, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 
+	0xd , 0x0 , 0x0 , 0x0 , 0xd8, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xdc, 
+	0x0 , 0x0 , 0x0 , 0xdb, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xd1, 0x0 , 
+	0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xd1, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xde, 0x0 , 0x0 , 0x0 , 0xbe, 0x0 , 0x0 , 0x0 , 
+	0x41, 0x0 , 0x5 , 0x0 , 0x7d, 0x0 , 0x0 , 0x0 , 0xdf, 0x0 , 0x0 , 0x0 , 0x42, 
+	0x0 , 0x0 , 0x0 , 0xde, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x43, 0x0 , 
+	0x0 , 0x0 , 0xe0, 0x0 , 0x0 , 0x0 , 0xdf, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 
+	0x0 , 0x7a, 0x0 , 0x0 , 0x0 , 0xe1, 0x0 , 0x0 , 0x0 , 0xe0, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0xdd, 0x0 , 0x0 , 0x0 , 0xe1, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x5 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0xe2, 0x0 , 0x0 , 0x0 , 0xdd, 0x0 , 
+	0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0xe3, 0x0 , 0x0 , 0x0 , 0xe2, 0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 0x4 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0xe4, 0x0 , 0x0 , 0x0 , 0xe3, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x5 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0xe5, 0x0 , 0x0 , 0x0 , 0xdd, 0x0 , 
+	0x0 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0xe6, 0x0 , 0x0 , 0x0 , 0xe5, 0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 0x4 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0xe7, 0x0 , 0x0 , 0x0 , 0xe6, 0x0 , 0x0 , 0x0 , 0x80, 
+	0x0 , 0x5 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xe8, 0x0 , 0x0 , 0x0 , 0xe4, 0x0 , 
+	0x0 , 0x0 , 0xe7, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0xe9, 0x0 , 0x0 , 0x0 , 0x90, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0xea, 0x0 , 0x0 , 0x0 , 0xe8, 0x0 , 0x0 , 0x0 , 0x80, 
+	0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xeb, 0x0 , 0x0 , 0x0 , 0xe9, 0x0 , 
+	0x0 , 0x0 , 0xea, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x90, 0x0 , 0x0 , 
+	0x0 , 0xeb, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xc2, 0x0 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0xc2, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0xec, 0x0 , 0x0 , 0x0 , 0xbe, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 
+	0x5 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xed, 0x0 , 0x0 , 0x0 , 0xec, 0x0 , 0x0 , 
+	0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xbe, 0x0 , 0x0 , 0x0 , 
+	0xed, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xbf, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0xc3, 0x0 , 0x0 , 0x0 , 0xfd, 0x0 , 0x1 , 0x0 , 0x38, 0x0 , 
+	0x1 , 0x0 , 
+};
+const unsigned char PackedCompactShader [] = {
+	0x3 , 0x2 , 0x23, 0x7 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x14, 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x2 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x11, 0x0 , 0x2 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x2 , 
+	0x0 , 0x47, 0x11, 0x0 , 0x0 , 0xa , 0x0 , 0x7 , 0x0 , 0x53, 0x50, 0x56, 0x5f, 
+	0x4b, 0x48, 0x52, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 
+	0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x7 , 0x0 , 0x53, 0x50, 
+	0x56, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 
+	0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x6 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 
+	0x34, 0x35, 0x30, 0x0 , 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x8 , 0x0 , 0xc3, 0x0 , 
+	0x0 , 0x0 , 0x53, 0x50, 0x56, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 0x73, 0x68, 0x61, 
+	0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 
+	0xe , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0xf , 
+	0x0 , 0x8 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 
+	0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0x69, 0x0 , 0x0 , 
+	0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x6 , 0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 
+	0x11, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x3 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xc2, 0x1 , 
+	0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 
+	0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 0x5f, 0x41, 0x52, 
+	0x42, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 
+	0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 0x5f, 
+	0x41, 0x52, 0x42, 0x5f, 0x67, 0x70, 0x75, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 
+	0x72, 0x5f, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x5e, 
+	0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x69, 0x6e, 0x70, 0x75, 0x74, 0x46, 0x6f, 
+	0x72, 0x6d, 0x61, 0x74, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 
+	0x77, 0x69, 0x64, 0x65, 0x6e, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x0 , 0x5 , 
+	0x0 , 0x6 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 
+	0x74, 0x73, 0x50, 0x65, 0x72, 0x57, 0x6f, 0x72, 0x64, 0x0 , 0x5 , 0x0 , 0x6 , 
+	0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x62, 0x69, 0x74, 0x73, 0x50, 0x65, 0x72, 0x45, 
+	0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x1b, 
+	0x0 , 0x0 , 0x0 , 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x74, 0x68, 0x72, 0x65, 0x73, 0x68, 0x6f, 0x6c, 0x64, 0x0 , 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x5 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0x73, 0x63, 0x61, 0x6c, 0x65, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 
+	0x19, 0x0 , 0x0 , 0x0 , 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 
+	0x73, 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x69, 0x6e, 
+	0x70, 0x75, 0x74, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 
+	0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x69, 0x6e, 0x70, 0x75, 
+	0x74, 0x44, 0x61, 0x74, 0x61, 0x41, 0x72, 0x72, 0x61, 0x79, 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x5 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 
+	0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0x22, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x44, 0x61, 
+	0x74, 0x61, 0x41, 0x72, 0x72, 0x61, 0x79, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x25, 
+	0x0 , 0x0 , 0x0 , 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x44, 0x61, 0x74, 
+	0x61, 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x0 , 
+	0x5 , 0x0 , 0x4 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x44, 0x65, 0x63, 0x6f, 0x64, 
+	0x65, 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x77, 0x6f, 
+	0x72, 0x64, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x2a, 0x0 , 0x0 , 
+	0x0 , 0x73, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 
+	0x2c, 0x0 , 0x0 , 0x0 , 0x77, 0x6f, 0x72, 0x64, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x73, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x62, 0x0 , 0x0 , 0x0 , 0x67, 0x72, 0x6f, 
+	0x75, 0x70, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x0 , 0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 
+	0x63, 0x0 , 0x0 , 0x0 , 0x67, 0x6c, 0x5f, 0x57, 0x6f, 0x72, 0x6b, 0x47, 0x72, 
+	0x6f, 0x75, 0x70, 0x49, 0x44, 0x0 , 0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x69, 0x0 , 
+	0x0 , 0x0 , 0x67, 0x6c, 0x5f, 0x4e, 0x75, 0x6d, 0x57, 0x6f, 0x72, 0x6b, 0x47, 
+	0x72, 0x6f, 0x75, 0x70, 0x73, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 
+	0x70, 0x0 , 0x0 , 0x0 , 0x77, 0x6f, 0x72, 0x64, 0x49, 0x6e, 0x64, 0x65, 0x78, 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x67, 0x6c, 
+	0x5f, 0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 
+	0x69, 0x6f, 0x6e, 0x49, 0x44, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 
+	0x79, 0x0 , 0x0 , 0x0 , 0x77, 0x6f, 0x72, 0x64, 0x43, 0x6f, 0x75, 0x6e, 0x74, 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x80, 0x0 , 0x0 , 0x0 , 0x77, 0x6f, 
+	0x72, 0x64, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x8a, 0x0 , 0x0 , 
+	0x0 , 0x6c, 0x61, 0x6e, 0x65, 0x53, 0x6c, 0x6f, 0x74, 0x73, 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x7 , 0x0 , 0x8b, 0x0 , 0x0 , 0x0 , 0x6c, 0x6f, 0x77, 0x65, 0x72, 
+	0x4c, 0x61, 0x6e, 0x65, 0x53, 0x75, 0x72, 0x76, 0x69, 0x76, 0x6f, 0x72, 0x73, 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 0x8c, 0x0 , 0x0 , 0x0 , 0x77, 0x61, 0x76, 
+	0x65, 0x53, 0x75, 0x72, 0x76, 0x69, 0x76, 0x6f, 0x72, 0x73, 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x4 , 0x0 , 0x8d, 0x0 , 0x0 , 0x0 , 0x73, 0x6c, 0x6f, 0x74, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x95, 0x0 , 0x0 , 0x0 , 0x69, 0x6e, 
+	0x64, 0x65, 0x78, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x9a, 0x0 , 0x0 , 
+	0x0 , 0x6c, 0x61, 0x6e, 0x65, 0x41, 0x63, 0x74, 0x69, 0x76, 0x65, 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x4 , 0x0 , 0xa9, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x73, 0x6b, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0xb4, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 
+	0x73, 0x6b, 0x50, 0x61, 0x72, 0x74, 0x73, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 
+	0x0 , 0xd0, 0x0 , 0x0 , 0x0 , 0x77, 0x61, 0x76, 0x65, 0x4f, 0x66, 0x66, 0x73, 
+	0x65, 0x74, 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0xdb, 0x0 , 0x0 , 0x0 , 0x6f, 
+	0x75, 0x74, 0x70, 0x75, 0x74, 0x53, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x4 , 0x0 , 0xdf, 0x0 , 0x0 , 0x0 , 0x73, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0xfe, 0x0 , 0x0 , 0x0 , 0x62, 0x69, 0x74, 0x73, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x5 , 0x1 , 0x0 , 0x0 , 0x73, 
+	0x68, 0x69, 0x66, 0x74, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 
+	0x48, 0x0 , 0x5 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x1b, 0x0 , 
+	0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0x23, 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x1b, 
+	0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 
+	0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x3 , 
+	0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x1d, 0x0 , 0x0 , 
+	0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 
+	0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 
+	0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 
+	0x21, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x25, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 
+	0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x21, 
+	0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x63, 0x0 , 
+	0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 
+	0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 
+	0x47, 0x0 , 0x4 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x1b, 
+	0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 
+	0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x15, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 
+	0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x32, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 0x2 , 0x0 , 0x8 , 
+	0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 0x3 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 
+	0x0 , 0x0 , 0x31, 0x0 , 0x3 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 
+	0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 
+	0x3 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xc , 
+	0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x34, 0x0 , 0x6 , 0x0 , 0x8 , 0x0 , 
+	0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0xe , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x34, 0x0 , 
+	0x6 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x0 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x34, 
+	0x0 , 0x7 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0xa9, 0x0 , 
+	0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 
+	0x0 , 0x34, 0x0 , 0x7 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 
+	0xa9, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x12, 
+	0x0 , 0x0 , 0x0 , 0x34, 0x0 , 0x6 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 
+	0x0 , 0x0 , 0x80, 0x0 , 0x0 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 
+	0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 
+	0x20, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x16, 
+	0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x34, 0x0 , 0x6 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x86, 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x0 , 
+	0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0x18, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x3 , 0x0 , 0x1a, 
+	0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x5 , 0x0 , 0x1b, 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 
+	0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 
+	0x1b, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0x19, 
+	0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x3 , 0x0 , 0x1e, 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0x1f, 0x0 , 0x0 , 
+	0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x20, 
+	0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 
+	0x3 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 
+	0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 
+	0x24, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x5 , 0x0 , 0x28, 
+	0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 
+	0x1a, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 
+	0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xff, 
+	0xff, 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x0 , 0x0 , 
+	0x8 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x48, 
+	0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x4e, 0x0 , 
+	0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x54, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 
+	0x13, 0x0 , 0x2 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x3 , 0x0 , 0x60, 
+	0x0 , 0x0 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0x64, 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 
+	0x0 , 0x65, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x64, 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x4 , 0x0 , 0x65, 0x0 , 0x0 , 0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x65, 0x0 , 0x0 , 
+	0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x72, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x2c, 
+	0x0 , 0x6 , 0x0 , 0x64, 0x0 , 0x0 , 0x0 , 0x73, 0x0 , 0x0 , 0x0 , 0x72, 0x0 , 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 
+	0x0 , 0x65, 0x0 , 0x0 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 
+	0x20, 0x0 , 0x4 , 0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x88, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x9b, 0x0 , 0x0 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x4 , 0x0 , 
+	0xaa, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x20, 
+	0x0 , 0x4 , 0x0 , 0xab, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 
+	0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0xae, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0xb2, 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0xb5, 
+	0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0xb2, 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 
+	0x5 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x37, 0x0 , 0x3 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x29, 0x0 , 0x0 , 0x0 , 0x37, 0x0 , 0x3 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x2a, 
+	0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x4 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x29, 
+	0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 
+	0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0xfb, 0x0 , 0xb , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x34, 0x0 , 0x0 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x30, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x31, 
+	0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x30, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 
+	0x2c, 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x6 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0x36, 
+	0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0x35, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x38, 0x0 , 0x0 , 
+	0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x4d, 0x0 , 0x5 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 
+	0x39, 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0xfe, 
+	0x0 , 0x2 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x31, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 
+	0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3c, 0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 
+	0x0 , 0x0 , 0xc4, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x0 , 
+	0x0 , 0x3c, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x3f, 0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0xc7, 
+	0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x3f, 0x0 , 
+	0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0xa9, 0x0 , 0x6 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 
+	0x41, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x43, 
+	0x0 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0xfe, 0x0 , 0x2 , 0x0 , 0x43, 0x0 , 
+	0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 
+	0x7c, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x45, 0x0 , 0x0 , 0x0 , 0x44, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x46, 0x0 , 
+	0x0 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x49, 0x0 , 0x0 , 0x0 , 0x46, 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x0 , 0x0 , 
+	0x7c, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x49, 
+	0x0 , 0x0 , 0x0 , 0xca, 0x0 , 0x6 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x4b, 0x0 , 
+	0x0 , 0x0 , 0x45, 0x0 , 0x0 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x0 , 
+	0x0 , 0x6f, 0x0 , 0x4 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 
+	0x4b, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x4d, 
+	0x0 , 0x0 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0x4d, 0x0 , 0x0 , 
+	0x0 , 0x85, 0x0 , 0x5 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x0 , 0x0 , 
+	0x4c, 0x0 , 0x0 , 0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0xfe, 0x0 , 0x2 , 0x0 , 0x50, 
+	0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 0x0 , 
+	0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x52, 0x0 , 0x0 , 0x0 , 
+	0x51, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x53, 
+	0x0 , 0x0 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 0x54, 0x0 , 0x0 , 
+	0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x56, 0x0 , 0x0 , 0x0 , 
+	0x55, 0x0 , 0x0 , 0x0 , 0xca, 0x0 , 0x6 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x57, 
+	0x0 , 0x0 , 0x0 , 0x52, 0x0 , 0x0 , 0x0 , 0x56, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x0 , 0x0 , 0x6f, 0x0 , 0x4 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x58, 0x0 , 0x0 , 
+	0x0 , 0x57, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 
+	0x59, 0x0 , 0x0 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0x59, 0x0 , 
+	0x0 , 0x0 , 0x85, 0x0 , 0x5 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x5b, 0x0 , 0x0 , 
+	0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0xfe, 0x0 , 0x2 , 0x0 , 
+	0x5b, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x34, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 
+	0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x5d, 0x0 , 0x0 , 
+	0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0xfe, 0x0 , 0x2 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0xff, 0x0 , 0x1 , 0x0 , 0x38, 
+	0x0 , 0x1 , 0x0 , 0x36, 0x0 , 0x5 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0x5e, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 
+	0x0 , 0x61, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 
+	0x62, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2d, 
+	0x0 , 0x0 , 0x0 , 0x70, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x4 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0x79, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0x8a, 
+	0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2d, 0x0 , 
+	0x0 , 0x0 , 0x8b, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 
+	0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0x8c, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x4 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0x8d, 0x0 , 0x0 , 0x0 , 0x7 , 
+	0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0x95, 0x0 , 
+	0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x9b, 0x0 , 0x0 , 
+	0x0 , 0x9a, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0xab, 0x0 , 0x0 , 0x0 , 0xa9, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 
+	0x0 , 0x4 , 0x0 , 0xb5, 0x0 , 0x0 , 0x0 , 0xb4, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0xd0, 0x0 , 0x0 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 
+	0xdb, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2d, 
+	0x0 , 0x0 , 0x0 , 0xdf, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x4 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0xfe, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0x5 , 0x1 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 0x66, 
+	0x0 , 0x0 , 0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x68, 0x0 , 0x0 , 0x0 , 0x66, 0x0 , 0x0 , 
+	0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 0x6a, 0x0 , 0x0 , 0x0 , 
+	0x69, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0x6a, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 
+	0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x68, 0x0 , 0x0 , 
+	0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 
+	0x6d, 0x0 , 0x0 , 0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x6e, 0x0 , 0x0 , 0x0 , 0x6d, 0x0 , 
+	0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x6f, 0x0 , 0x0 , 
+	0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x6e, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0x62, 0x0 , 0x0 , 0x0 , 0x6f, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0x71, 0x0 , 0x0 , 0x0 , 0x62, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 
+	0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x74, 0x0 , 0x0 , 0x0 , 0x71, 0x0 , 0x0 , 
+	0x0 , 0x72, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 
+	0x76, 0x0 , 0x0 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x77, 0x0 , 0x0 , 0x0 , 0x76, 0x0 , 
+	0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x78, 0x0 , 0x0 , 
+	0x0 , 0x74, 0x0 , 0x0 , 0x0 , 0x77, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0x70, 0x0 , 0x0 , 0x0 , 0x78, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x7b, 
+	0x0 , 0x0 , 0x0 , 0x7a, 0x0 , 0x0 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x0 , 
+	0x0 , 0x7a, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x7d, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x82, 
+	0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x7e, 0x0 , 0x0 , 0x0 , 0x7d, 0x0 , 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x86, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x7f, 0x0 , 0x0 , 0x0 , 0x7e, 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x79, 0x0 , 0x0 , 0x0 , 0x7f, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0x80, 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x81, 0x0 , 0x0 , 0x0 , 0x70, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x0 , 0x0 , 
+	0x79, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x83, 
+	0x0 , 0x0 , 0x0 , 0x81, 0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 
+	0x3 , 0x0 , 0x85, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 
+	0x0 , 0x83, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x0 , 0x0 , 0x85, 0x0 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0x84, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0x86, 0x0 , 0x0 , 0x0 , 0x70, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 
+	0x6 , 0x0 , 0x88, 0x0 , 0x0 , 0x0 , 0x87, 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x0 , 
+	0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x86, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x89, 0x0 , 0x0 , 0x0 , 0x87, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0x80, 0x0 , 0x0 , 0x0 , 0x89, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 
+	0x2 , 0x0 , 0x85, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x85, 0x0 , 0x0 , 
+	0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x8a, 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x8b, 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0x8c, 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x3 , 0x0 , 0x8d, 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 
+	0x0 , 0x8e, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x8e, 0x0 , 0x0 , 0x0 , 
+	0xf6, 0x0 , 0x4 , 0x0 , 0x92, 0x0 , 0x0 , 0x0 , 0x91, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 
+	0x2 , 0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x93, 0x0 , 0x0 , 0x0 , 0x8d, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 
+	0x8 , 0x0 , 0x0 , 0x0 , 0x94, 0x0 , 0x0 , 0x0 , 0x93, 0x0 , 0x0 , 0x0 , 0x14, 
+	0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x94, 0x0 , 0x0 , 0x0 , 0x90, 0x0 , 
+	0x0 , 0x0 , 0x92, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x90, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x96, 0x0 , 0x0 , 0x0 , 
+	0x70, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x97, 
+	0x0 , 0x0 , 0x0 , 0x96, 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x98, 0x0 , 0x0 , 0x0 , 0x8d, 0x0 , 0x0 , 
+	0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x99, 0x0 , 0x0 , 0x0 , 
+	0x97, 0x0 , 0x0 , 0x0 , 0x98, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x95, 
+	0x0 , 0x0 , 0x0 , 0x99, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x9c, 0x0 , 0x0 , 0x0 , 0x95, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 
+	0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 0x9d, 0x0 , 0x0 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 
+	0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x9e, 
+	0x0 , 0x0 , 0x0 , 0x9d, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 
+	0x0 , 0x0 , 0x9f, 0x0 , 0x0 , 0x0 , 0x9c, 0x0 , 0x0 , 0x0 , 0x9e, 0x0 , 0x0 , 
+	0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0xa1, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0xfa, 0x0 , 0x4 , 0x0 , 0x9f, 0x0 , 0x0 , 0x0 , 0xa0, 0x0 , 0x0 , 0x0 , 0xa1, 
+	0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xa0, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xa2, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xa3, 0x0 , 0x0 , 0x0 , 
+	0x8d, 0x0 , 0x0 , 0x0 , 0x39, 0x0 , 0x6 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0xa4, 
+	0x0 , 0x0 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0xa2, 0x0 , 0x0 , 0x0 , 0xa3, 0x0 , 
+	0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0xa5, 0x0 , 0x0 , 
+	0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x1a, 0x0 , 0x0 , 0x0 , 0xa6, 0x0 , 0x0 , 0x0 , 0xa5, 0x0 , 0x0 , 0x0 , 0xba, 
+	0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0xa7, 0x0 , 0x0 , 0x0 , 0xa4, 0x0 , 
+	0x0 , 0x0 , 0xa6, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xa1, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xa1, 0x0 , 0x0 , 0x0 , 0xf5, 0x0 , 0x7 , 0x0 , 
+	0x8 , 0x0 , 0x0 , 0x0 , 0xa8, 0x0 , 0x0 , 0x0 , 0x9f, 0x0 , 0x0 , 0x0 , 0x90, 
+	0x0 , 0x0 , 0x0 , 0xa7, 0x0 , 0x0 , 0x0 , 0xa0, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x3 , 0x0 , 0x9a, 0x0 , 0x0 , 0x0 , 0xa8, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0xac, 0x0 , 0x0 , 0x0 , 0x9a, 0x0 , 0x0 , 0x0 , 
+	0x45, 0x11, 0x4 , 0x0 , 0xae, 0x0 , 0x0 , 0x0 , 0xad, 0x0 , 0x0 , 0x0 , 0xac, 
+	0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xaf, 0x0 , 
+	0x0 , 0x0 , 0xad, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x0 , 0x0 , 0xad, 0x0 , 0x0 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x5 , 0x0 , 0xb2, 0x0 , 0x0 , 0x0 , 0xb1, 
+	0x0 , 0x0 , 0x0 , 0xaf, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 
+	0x4 , 0x0 , 0xaa, 0x0 , 0x0 , 0x0 , 0xb3, 0x0 , 0x0 , 0x0 , 0xb1, 0x0 , 0x0 , 
+	0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xa9, 0x0 , 0x0 , 0x0 , 0xb3, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0xaa, 0x0 , 0x0 , 0x0 , 0xb6, 0x0 , 0x0 , 0x0 , 0xa9, 
+	0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0xb2, 0x0 , 0x0 , 0x0 , 0xb7, 0x0 , 
+	0x0 , 0x0 , 0xb6, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xb4, 0x0 , 0x0 , 
+	0x0 , 0xb7, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 
+	0xb8, 0x0 , 0x0 , 0x0 , 0xb4, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xb9, 0x0 , 0x0 , 0x0 , 0xb8, 0x0 , 
+	0x0 , 0x0 , 0xcd, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xba, 0x0 , 0x0 , 
+	0x0 , 0xb9, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 
+	0xbb, 0x0 , 0x0 , 0x0 , 0xb4, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xbc, 0x0 , 0x0 , 0x0 , 0xbb, 0x0 , 
+	0x0 , 0x0 , 0xcd, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xbd, 0x0 , 0x0 , 
+	0x0 , 0xbc, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0xbe, 0x0 , 0x0 , 0x0 , 0xba, 0x0 , 0x0 , 0x0 , 0xbd, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xbf, 0x0 , 0x0 , 0x0 , 0x8c, 0x0 , 
+	0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xc0, 0x0 , 0x0 , 
+	0x0 , 0xbe, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0xc1, 0x0 , 0x0 , 0x0 , 0xbf, 0x0 , 0x0 , 0x0 , 0xc0, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0x8c, 0x0 , 0x0 , 0x0 , 0xc1, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0xaa, 0x0 , 0x0 , 0x0 , 0xc2, 0x0 , 0x0 , 0x0 , 0xa9, 0x0 , 0x0 , 
+	0x0 , 0xc , 0x0 , 0x6 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xc4, 0x0 , 0x0 , 0x0 , 
+	0xc3, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xc2, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xc5, 0x0 , 0x0 , 0x0 , 0x8b, 0x0 , 
+	0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xc6, 0x0 , 0x0 , 
+	0x0 , 0xc5, 0x0 , 0x0 , 0x0 , 0xc4, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0x8b, 0x0 , 0x0 , 0x0 , 0xc6, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x8 , 
+	0x0 , 0x0 , 0x0 , 0xc7, 0x0 , 0x0 , 0x0 , 0x9a, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 
+	0x3 , 0x0 , 0xc9, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 
+	0x0 , 0xc7, 0x0 , 0x0 , 0x0 , 0xc8, 0x0 , 0x0 , 0x0 , 0xc9, 0x0 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0xc8, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0xca, 0x0 , 0x0 , 0x0 , 0x8d, 0x0 , 0x0 , 0x0 , 0xc4, 0x0 , 
+	0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xcb, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 
+	0x0 , 0xca, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0xcc, 0x0 , 0x0 , 0x0 , 0x8a, 0x0 , 0x0 , 0x0 , 0xc5, 0x0 , 0x5 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 0x0 , 0x0 , 0xcc, 0x0 , 0x0 , 0x0 , 0xcb, 0x0 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x8a, 0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 0x0 , 
+	0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xc9, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0xc9, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x91, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0x91, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0xce, 0x0 , 0x0 , 0x0 , 0x8d, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xcf, 0x0 , 0x0 , 0x0 , 0xce, 0x0 , 0x0 , 0x0 , 
+	0x6 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x8d, 0x0 , 0x0 , 0x0 , 0xcf, 
+	0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x8e, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 
+	0x2 , 0x0 , 0x92, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xd0, 0x0 , 0x0 , 
+	0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 
+	0xd1, 0x0 , 0x0 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xd2, 0x0 , 0x0 , 0x0 , 0xd1, 0x0 , 
+	0x0 , 0x0 , 0xaa, 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0xd3, 0x0 , 0x0 , 
+	0x0 , 0xd2, 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 
+	0xd5, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0xd3, 
+	0x0 , 0x0 , 0x0 , 0xd4, 0x0 , 0x0 , 0x0 , 0xd5, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 
+	0x2 , 0x0 , 0xd4, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0xd6, 0x0 , 0x0 , 0x0 , 0x8c, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 
+	0x88, 0x0 , 0x0 , 0x0 , 0xd7, 0x0 , 0x0 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x3 , 
+	0x0 , 0x0 , 0x0 , 0xea, 0x0 , 0x7 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xd8, 0x0 , 
+	0x0 , 0x0 , 0xd7, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 
+	0x0 , 0xd6, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xd0, 0x0 , 0x0 , 0x0 , 
+	0xd8, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xd5, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0xd5, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0xd9, 0x0 , 0x0 , 0x0 , 0xd0, 0x0 , 0x0 , 0x0 , 0x46, 0x11, 0x4 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xda, 0x0 , 0x0 , 0x0 , 0xd9, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0xd0, 0x0 , 0x0 , 0x0 , 0xda, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xdc, 0x0 , 0x0 , 0x0 , 0xd0, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xdd, 0x0 , 0x0 , 
+	0x0 , 0x8b, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0xde, 0x0 , 0x0 , 0x0 , 0xdc, 0x0 , 0x0 , 0x0 , 0xdd, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0xdb, 0x0 , 0x0 , 0x0 , 0xde, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x3 , 0x0 , 0xdf, 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 
+	0x0 , 0xe0, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xe0, 0x0 , 0x0 , 0x0 , 
+	0xf6, 0x0 , 0x4 , 0x0 , 0xe4, 0x0 , 0x0 , 0x0 , 0xe3, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xe1, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 
+	0x2 , 0x0 , 0xe1, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0xe5, 0x0 , 0x0 , 0x0 , 0xdf, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 
+	0x8 , 0x0 , 0x0 , 0x0 , 0xe6, 0x0 , 0x0 , 0x0 , 0xe5, 0x0 , 0x0 , 0x0 , 0x14, 
+	0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0xe6, 0x0 , 0x0 , 0x0 , 0xe2, 0x0 , 
+	0x0 , 0x0 , 0xe4, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xe2, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xe7, 0x0 , 0x0 , 0x0 , 
+	0x8a, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xe8, 
+	0x0 , 0x0 , 0x0 , 0xdf, 0x0 , 0x0 , 0x0 , 0xc4, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0xe9, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0xe8, 0x0 , 0x0 , 
+	0x0 , 0xc7, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xea, 0x0 , 0x0 , 0x0 , 
+	0xe7, 0x0 , 0x0 , 0x0 , 0xe9, 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x5 , 0x0 , 0x8 , 
+	0x0 , 0x0 , 0x0 , 0xeb, 0x0 , 0x0 , 0x0 , 0xea, 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 
+	0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0xed, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0xeb, 0x0 , 0x0 , 0x0 , 0xec, 0x0 , 0x0 , 0x0 , 
+	0xed, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xec, 0x0 , 0x0 , 0x0 , 0xf9, 
+	0x0 , 0x2 , 0x0 , 0xe3, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xed, 0x0 , 
+	0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0xef, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xee, 0x0 , 0x0 , 0x0 , 
+	0xf0, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xee, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xf1, 0x0 , 0x0 , 0x0 , 0xdb, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xf2, 0x0 , 0x0 , 
+	0x0 , 0x80, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0xf3, 0x0 , 0x0 , 0x0 , 0xdf, 0x0 , 0x0 , 0x0 , 0x39, 0x0 , 0x6 , 0x0 , 0x1a, 
+	0x0 , 0x0 , 0x0 , 0xf4, 0x0 , 0x0 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0xf2, 0x0 , 
+	0x0 , 0x0 , 0xf3, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0xf5, 0x0 , 0x0 , 0x0 , 0xf4, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 
+	0x88, 0x0 , 0x0 , 0x0 , 0xf6, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x3 , 
+	0x0 , 0x0 , 0x0 , 0xf1, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xf6, 0x0 , 
+	0x0 , 0x0 , 0xf5, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xef, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xf0, 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x5 , 0x0 , 
+	0x8 , 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x6 , 
+	0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0xf9, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0xf7, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x0 , 
+	0x0 , 0xfa, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xf8, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xfb, 0x0 , 0x0 , 0x0 , 0xdb, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xfc, 0x0 , 
+	0x0 , 0x0 , 0x80, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x88, 0x0 , 0x0 , 
+	0x0 , 0xfd, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 
+	0xfb, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xfd, 0x0 , 0x0 , 0x0 , 0xfc, 
+	0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xf9, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 
+	0x2 , 0x0 , 0xfa, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0xff, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0xdf, 0x0 , 0x0 , 0x0 , 0x84, 
+	0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x1 , 0x1 , 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0x2 , 0x1 , 0x0 , 0x0 , 0x1 , 0x1 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x3 , 0x1 , 0x0 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0xcb, 
+	0x0 , 0x6 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x4 , 0x1 , 0x0 , 0x0 , 0xff, 0x0 , 
+	0x0 , 0x0 , 0x2 , 0x1 , 0x0 , 0x0 , 0x3 , 0x1 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 
+	0x0 , 0xfe, 0x0 , 0x0 , 0x0 , 0x4 , 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x6 , 0x1 , 0x0 , 0x0 , 0xdb, 0x0 , 0x0 , 0x0 , 0x89, 
+	0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x7 , 0x1 , 0x0 , 0x0 , 0x6 , 0x1 , 
+	0x0 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x8 , 0x1 , 0x0 , 0x0 , 0x7 , 0x1 , 0x0 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x5 , 0x1 , 0x0 , 0x0 , 0x8 , 0x1 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x9 , 0x1 , 0x0 , 0x0 , 0xdb, 0x0 , 
+	0x0 , 0x0 , 0x86, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xa , 0x1 , 0x0 , 
+	0x0 , 0x9 , 0x1 , 0x0 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0xb , 0x1 , 0x0 , 0x0 , 0xfe, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xc , 0x1 , 0x0 , 0x0 , 0x5 , 0x1 , 
+	0x0 , 0x0 , 0xc4, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xd , 0x1 , 0x0 , 
+	0x0 , 0xb , 0x1 , 0x0 , 0x0 , 0xc , 0x1 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 
+	0x88, 0x0 , 0x0 , 0x0 , 0xe , 0x1 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x3 , 
+	0x0 , 0x0 , 0x0 , 0xa , 0x1 , 0x0 , 0x0 , 0xf1, 0x0 , 0x7 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0xf , 0x1 , 0x0 , 0x0 , 0xe , 0x1 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 
+	0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0xd , 0x1 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 
+	0xf9, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xf9, 0x0 , 0x0 , 0x0 , 0xf9, 
+	0x0 , 0x2 , 0x0 , 0xef, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xef, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x10, 0x1 , 0x0 , 
+	0x0 , 0xdb, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x11, 0x1 , 0x0 , 0x0 , 0x10, 0x1 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0xdb, 0x0 , 0x0 , 0x0 , 0x11, 0x1 , 0x0 , 0x0 , 0xf9, 0x0 , 
+	0x2 , 0x0 , 0xe3, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xe3, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x12, 0x1 , 0x0 , 0x0 , 
+	0xdf, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x13, 
+	0x1 , 0x0 , 0x0 , 0x12, 0x1 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x3 , 0x0 , 0xdf, 0x0 , 0x0 , 0x0 , 0x13, 0x1 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 
+	0x0 , 0xe0, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xe4, 0x0 , 0x0 , 0x0 , 
+	0xfd, 0x0 , 0x1 , 0x0 , 0x38, 0x0 , 0x1 , 0x0 , 
+};
+const unsigned char TopKHistogramShader [] = {
+	0x3 , 0x2 , 0x23, 0x7 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xbd, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x2 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0xb , 0x0 , 0x6 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x47, 0x4c, 0x53, 
+	0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0xe , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0xf , 
+	0x0 , 0x8 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x34, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 
+	0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0x4f, 0x0 , 0x0 , 
+	0x0 , 0x52, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x6 , 0x0 , 0x34, 0x0 , 0x0 , 0x0 , 
+	0x11, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x3 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xc2, 0x1 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x34, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x69, 
+	0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0 , 0x0 , 0x6 , 
+	0x0 , 0x7 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x65, 0x6c, 
+	0x65, 0x6d, 0x65, 0x6e, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x6 , 0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 
+	0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x7 , 
+	0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 
+	0x4d, 0x61, 0x73, 0x6b, 0x0 , 0x0 , 0x6 , 0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x73, 0x68, 0x69, 0x66, 0x74, 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x70, 0x61, 0x72, 0x61, 0x6d, 
+	0x65, 0x74, 0x65, 0x72, 0x73, 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0xc , 0x0 , 
+	0x0 , 0x0 , 0x69, 0x6e, 0x70, 0x75, 0x74, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 
+	0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x69, 0x6e, 0x70, 0x75, 0x74, 0x44, 0x61, 0x74, 0x61, 0x41, 0x72, 0x72, 0x61, 
+	0x79, 0x0 , 0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x68, 0x69, 
+	0x73, 0x74, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 
+	0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x68, 0x69, 0x73, 0x74, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x41, 0x72, 0x72, 0x61, 
+	0x79, 0x0 , 0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x6c, 0x6f, 
+	0x63, 0x61, 0x6c, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x0 , 
+	0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x47, 0x65, 0x74, 0x4b, 
+	0x65, 0x79, 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x69, 
+	0x6e, 0x64, 0x65, 0x78, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x1d, 0x0 , 
+	0x0 , 0x0 , 0x69, 0x6e, 0x64, 0x65, 0x78, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 
+	0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x62, 0x69, 0x74, 0x73, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x4 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x66, 0x6c, 0x69, 0x70, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x3 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x69, 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0x67, 0x6c, 0x5f, 
+	0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 
+	0x6f, 0x6e, 0x49, 0x44, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x4e, 
+	0x0 , 0x0 , 0x0 , 0x67, 0x72, 0x6f, 0x75, 0x70, 0x49, 0x6e, 0x64, 0x65, 0x78, 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0x67, 0x6c, 0x5f, 
+	0x57, 0x6f, 0x72, 0x6b, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x49, 0x44, 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x7 , 0x0 , 0x52, 0x0 , 0x0 , 0x0 , 0x67, 0x6c, 0x5f, 0x4e, 0x75, 
+	0x6d, 0x57, 0x6f, 0x72, 0x6b, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x59, 0x0 , 0x0 , 0x0 , 0x74, 0x69, 0x6c, 
+	0x65, 0x53, 0x74, 0x61, 0x72, 0x74, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x3 , 0x0 , 
+	0x5f, 0x0 , 0x0 , 0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x68, 
+	0x0 , 0x0 , 0x0 , 0x69, 0x6e, 0x64, 0x65, 0x78, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x3 , 0x0 , 0x77, 0x0 , 0x0 , 0x0 , 0x6b, 0x65, 0x79, 0x0 , 0x5 , 0x0 , 0x4 , 
+	0x0 , 0x88, 0x0 , 0x0 , 0x0 , 0x64, 0x69, 0x67, 0x69, 0x74, 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x3 , 0x0 , 0xa4, 0x0 , 0x0 , 0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0x48, 
+	0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 
+	0x48, 0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x23, 
+	0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 
+	0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0x47, 0x0 , 0x4 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 
+	0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 
+	0x9 , 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 
+	0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 
+	0x0 , 0x3 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 
+	0x4 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0xb , 
+	0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x4f, 0x0 , 
+	0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 
+	0x0 , 0x52, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 
+	0x15, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 
+	0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 
+	0x6 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x1e, 
+	0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 
+	0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x4 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x9 , 
+	0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x3 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 
+	0x0 , 0x0 , 0x1d, 0x0 , 0x3 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 
+	0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 
+	0x20, 0x0 , 0x4 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xc , 
+	0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 
+	0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x2b, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x1c, 0x0 , 0x4 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 
+	0x12, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x14, 0x0 , 
+	0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 
+	0x1c, 0x0 , 0x4 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x11, 
+	0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x18, 0x0 , 0x0 , 
+	0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x4 , 0x0 , 
+	0x1a, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x20, 
+	0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x27, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x80, 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 
+	0x2 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0xff, 0xff, 0xff, 0xff, 0x13, 0x0 , 0x2 , 0x0 , 
+	0x35, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x3 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x35, 
+	0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x3b, 0x0 , 0x0 , 
+	0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x3b, 0x0 , 0x0 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x20, 
+	0x0 , 0x4 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x48, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x4a, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 
+	0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x4d, 0x0 , 0x0 , 0x0 , 0x8 , 0x1 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x3b, 0x0 , 0x0 , 0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x3b, 0x0 , 0x0 , 0x0 , 0x52, 
+	0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x5b, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x66, 0x0 , 
+	0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x72, 0x0 , 0x0 , 
+	0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 
+	0x78, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x2b, 
+	0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x7e, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 
+	0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0x84, 0x0 , 0x0 , 0x0 , 
+	0x2b, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0x89, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 
+	0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x8c, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 
+	0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x8d, 0x0 , 0x0 , 0x0 , 
+	0x20, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x9c, 
+	0x0 , 0x0 , 0x0 , 0xff, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x9d, 0x0 , 0x0 , 0x0 , 0xff, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x9f, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 
+	0x20, 0x0 , 0x4 , 0x0 , 0xb9, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x19, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x37, 0x0 , 0x3 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0x1c, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x1d, 
+	0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 
+	0x0 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 
+	0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 
+	0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 
+	0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x21, 
+	0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x24, 0x0 , 
+	0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x1f, 0x0 , 0x0 , 
+	0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x26, 0x0 , 0x0 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0xc7, 0x0 , 0x5 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x27, 0x0 , 
+	0x0 , 0x0 , 0xab, 0x0 , 0x5 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 0x0 , 
+	0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0xa9, 0x0 , 0x6 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 0x0 , 0x0 , 0x2c, 
+	0x0 , 0x0 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x25, 0x0 , 
+	0x0 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0xc6, 
+	0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x30, 0x0 , 0x0 , 0x0 , 0x2e, 0x0 , 
+	0x0 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x31, 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 0xc8, 0x0 , 0x4 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x31, 0x0 , 0x0 , 0x0 , 0x50, 
+	0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0x30, 0x0 , 
+	0x0 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0xfe, 0x0 , 0x2 , 0x0 , 0x33, 0x0 , 0x0 , 
+	0x0 , 0x38, 0x0 , 0x1 , 0x0 , 0x36, 0x0 , 0x5 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 
+	0x34, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 
+	0x0 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 
+	0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x59, 0x0 , 0x0 , 0x0 , 0x7 , 
+	0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x5f, 0x0 , 
+	0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 0x0 , 
+	0x0 , 0x68, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x78, 0x0 , 0x0 , 0x0 , 0x77, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 
+	0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x88, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0xa4, 0x0 , 0x0 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 
+	0x3c, 0x0 , 0x0 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0x3c, 0x0 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x0 , 
+	0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x3f, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0x3f, 0x0 , 0x0 , 0x0 , 0xf6, 0x0 , 0x4 , 0x0 , 0x43, 0x0 , 0x0 , 0x0 , 0x42, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x40, 0x0 , 
+	0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 
+	0xb0, 0x0 , 0x5 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x45, 0x0 , 0x0 , 0x0 , 0x44, 
+	0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x45, 0x0 , 
+	0x0 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x43, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 
+	0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x46, 0x0 , 0x0 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x48, 
+	0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x46, 0x0 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x29, 0x0 , 0x0 , 
+	0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0x42, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x49, 
+	0x0 , 0x0 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 0x49, 0x0 , 0x0 , 0x0 , 0x4a, 0x0 , 0x0 , 
+	0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 
+	0xf9, 0x0 , 0x2 , 0x0 , 0x3f, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x43, 
+	0x0 , 0x0 , 0x0 , 0xe0, 0x0 , 0x4 , 0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 0x4c, 0x0 , 
+	0x0 , 0x0 , 0x4d, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x3d, 0x0 , 0x0 , 
+	0x0 , 0x50, 0x0 , 0x0 , 0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0x50, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x53, 0x0 , 
+	0x0 , 0x0 , 0x52, 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x54, 0x0 , 0x0 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 
+	0x84, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x51, 
+	0x0 , 0x0 , 0x0 , 0x54, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x3d, 0x0 , 
+	0x0 , 0x0 , 0x56, 0x0 , 0x0 , 0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x57, 0x0 , 0x0 , 0x0 , 
+	0x56, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x58, 
+	0x0 , 0x0 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x57, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x3 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 
+	0x84, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 0x5a, 
+	0x0 , 0x0 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x59, 0x0 , 
+	0x0 , 0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x5f, 0x0 , 0x0 , 
+	0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0xf6, 0x0 , 0x4 , 0x0 , 0x64, 
+	0x0 , 0x0 , 0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 
+	0x2 , 0x0 , 0x61, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x61, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x65, 0x0 , 0x0 , 0x0 , 
+	0x5f, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x67, 
+	0x0 , 0x0 , 0x0 , 0x65, 0x0 , 0x0 , 0x0 , 0x66, 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 
+	0x4 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 0x62, 0x0 , 0x0 , 0x0 , 0x64, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x62, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0x59, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x6a, 0x0 , 0x0 , 0x0 , 0x5f, 0x0 , 
+	0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x6b, 0x0 , 0x0 , 
+	0x0 , 0x6a, 0x0 , 0x0 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0x6b, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x6d, 0x0 , 
+	0x0 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x6e, 0x0 , 0x0 , 0x0 , 0x6d, 0x0 , 0x0 , 0x0 , 
+	0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x6f, 0x0 , 0x0 , 0x0 , 0x6c, 
+	0x0 , 0x0 , 0x0 , 0x6e, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x68, 0x0 , 
+	0x0 , 0x0 , 0x6f, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x70, 0x0 , 0x0 , 0x0 , 0x68, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 
+	0x72, 0x0 , 0x0 , 0x0 , 0x71, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xe , 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x73, 0x0 , 
+	0x0 , 0x0 , 0x71, 0x0 , 0x0 , 0x0 , 0xae, 0x0 , 0x5 , 0x0 , 0x2b, 0x0 , 0x0 , 
+	0x0 , 0x74, 0x0 , 0x0 , 0x0 , 0x70, 0x0 , 0x0 , 0x0 , 0x73, 0x0 , 0x0 , 0x0 , 
+	0xf7, 0x0 , 0x3 , 0x0 , 0x76, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 
+	0x0 , 0x4 , 0x0 , 0x74, 0x0 , 0x0 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x76, 0x0 , 
+	0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 
+	0x0 , 0x64, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x76, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x79, 0x0 , 0x0 , 0x0 , 0x68, 
+	0x0 , 0x0 , 0x0 , 0x39, 0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x7a, 0x0 , 
+	0x0 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x79, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 
+	0x0 , 0x77, 0x0 , 0x0 , 0x0 , 0x7a, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x6 , 0x0 , 0x0 , 0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 0x77, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x5 , 0x0 , 0x7e, 0x0 , 0x0 , 0x0 , 0x7d, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0x7c, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x6 , 0x0 , 0x0 , 
+	0x0 , 0x7f, 0x0 , 0x0 , 0x0 , 0x7d, 0x0 , 0x0 , 0x0 , 0xc7, 0x0 , 0x5 , 0x0 , 
+	0x6 , 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x0 , 0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 0x7f, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x7e, 0x0 , 0x0 , 0x0 , 0x81, 0x0 , 
+	0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x0 , 0x0 , 0x81, 0x0 , 0x0 , 0x0 , 
+	0xab, 0x0 , 0x5 , 0x0 , 0x84, 0x0 , 0x0 , 0x0 , 0x83, 0x0 , 0x0 , 0x0 , 0x80, 
+	0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x0 , 0x0 , 0x9a, 0x0 , 0x4 , 0x0 , 0x2b, 0x0 , 
+	0x0 , 0x0 , 0x85, 0x0 , 0x0 , 0x0 , 0x83, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 
+	0x0 , 0x87, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 
+	0x85, 0x0 , 0x0 , 0x0 , 0x86, 0x0 , 0x0 , 0x0 , 0x87, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0x86, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x63, 0x0 , 
+	0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x87, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 
+	0x0 , 0x72, 0x0 , 0x0 , 0x0 , 0x8a, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x89, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x8b, 
+	0x0 , 0x0 , 0x0 , 0x8a, 0x0 , 0x0 , 0x0 , 0xae, 0x0 , 0x5 , 0x0 , 0x2b, 0x0 , 
+	0x0 , 0x0 , 0x8e, 0x0 , 0x0 , 0x0 , 0x8b, 0x0 , 0x0 , 0x0 , 0x8d, 0x0 , 0x0 , 
+	0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 
+	0x77, 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0x90, 0x0 , 0x0 , 0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 
+	0x5 , 0x0 , 0x72, 0x0 , 0x0 , 0x0 , 0x91, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x89, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x92, 0x0 , 0x0 , 0x0 , 0x91, 0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x5 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0x93, 0x0 , 0x0 , 0x0 , 0x92, 0x0 , 0x0 , 0x0 , 0x8d, 0x0 , 
+	0x0 , 0x0 , 0xc2, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x94, 0x0 , 0x0 , 
+	0x0 , 0x90, 0x0 , 0x0 , 0x0 , 0x93, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 
+	0x1e, 0x0 , 0x0 , 0x0 , 0x95, 0x0 , 0x0 , 0x0 , 0x77, 0x0 , 0x0 , 0x0 , 0x15, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x96, 0x0 , 
+	0x0 , 0x0 , 0x95, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x72, 0x0 , 0x0 , 
+	0x0 , 0x97, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x89, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x98, 0x0 , 0x0 , 0x0 , 0x97, 
+	0x0 , 0x0 , 0x0 , 0xc2, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x99, 0x0 , 
+	0x0 , 0x0 , 0x96, 0x0 , 0x0 , 0x0 , 0x98, 0x0 , 0x0 , 0x0 , 0xa9, 0x0 , 0x6 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x9a, 0x0 , 0x0 , 0x0 , 0x8e, 0x0 , 0x0 , 0x0 , 
+	0x94, 0x0 , 0x0 , 0x0 , 0x99, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x88, 
+	0x0 , 0x0 , 0x0 , 0x9a, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x9b, 0x0 , 0x0 , 0x0 , 0x88, 0x0 , 0x0 , 0x0 , 0xc7, 0x0 , 0x5 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x9e, 0x0 , 0x0 , 0x0 , 0x9b, 0x0 , 0x0 , 0x0 , 
+	0x9d, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x48, 0x0 , 0x0 , 0x0 , 0xa0, 
+	0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x9e, 0x0 , 0x0 , 0x0 , 0xea, 0x0 , 
+	0x7 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xa1, 0x0 , 0x0 , 0x0 , 0xa0, 0x0 , 0x0 , 
+	0x0 , 0x9f, 0x0 , 0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x9f, 0x0 , 0x0 , 0x0 , 
+	0xf9, 0x0 , 0x2 , 0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x63, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xa2, 0x0 , 
+	0x0 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0xa3, 0x0 , 0x0 , 0x0 , 0xa2, 0x0 , 0x0 , 0x0 , 0x9f, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0xa3, 0x0 , 0x0 , 0x0 , 0xf9, 
+	0x0 , 0x2 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x64, 0x0 , 
+	0x0 , 0x0 , 0xe0, 0x0 , 0x4 , 0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 0x4c, 0x0 , 0x0 , 
+	0x0 , 0x4d, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 
+	0xa5, 0x0 , 0x0 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xa6, 0x0 , 0x0 , 0x0 , 0xa5, 0x0 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xa4, 0x0 , 0x0 , 0x0 , 0xa6, 0x0 , 0x0 , 
+	0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xa7, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0xa7, 0x0 , 0x0 , 0x0 , 0xf6, 0x0 , 0x4 , 0x0 , 0xab, 0x0 , 0x0 , 0x0 , 0xaa, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xa8, 0x0 , 
+	0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xa8, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xac, 0x0 , 0x0 , 0x0 , 0xa4, 0x0 , 0x0 , 0x0 , 
+	0xb0, 0x0 , 0x5 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0xad, 0x0 , 0x0 , 0x0 , 0xac, 
+	0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0xad, 0x0 , 
+	0x0 , 0x0 , 0xa9, 0x0 , 0x0 , 0x0 , 0xab, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 
+	0x0 , 0xa9, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0xae, 0x0 , 0x0 , 0x0 , 0xa4, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x48, 
+	0x0 , 0x0 , 0x0 , 0xaf, 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0xae, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x0 , 
+	0x0 , 0xaf, 0x0 , 0x0 , 0x0 , 0xab, 0x0 , 0x5 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 
+	0xb1, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0xf7, 
+	0x0 , 0x3 , 0x0 , 0xb3, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 
+	0x4 , 0x0 , 0xb1, 0x0 , 0x0 , 0x0 , 0xb2, 0x0 , 0x0 , 0x0 , 0xb3, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xb2, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0xb4, 0x0 , 0x0 , 0x0 , 0xa4, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xb5, 0x0 , 0x0 , 0x0 , 0xa4, 0x0 , 
+	0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x48, 0x0 , 0x0 , 0x0 , 0xb6, 0x0 , 0x0 , 
+	0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0xb5, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0xb7, 0x0 , 0x0 , 0x0 , 0xb6, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x6 , 0x0 , 0xb9, 0x0 , 0x0 , 0x0 , 0xb8, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 
+	0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0xb4, 0x0 , 0x0 , 0x0 , 0xea, 0x0 , 0x7 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xba, 0x0 , 0x0 , 0x0 , 0xb8, 0x0 , 0x0 , 0x0 , 
+	0x9f, 0x0 , 0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0xb7, 0x0 , 0x0 , 0x0 , 0xf9, 
+	0x0 , 0x2 , 0x0 , 0xb3, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xb3, 0x0 , 
+	0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xaa, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 
+	0x0 , 0xaa, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0xbb, 0x0 , 0x0 , 0x0 , 0xa4, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0xbc, 0x0 , 0x0 , 0x0 , 0xbb, 0x0 , 0x0 , 0x0 , 0x4a, 0x0 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xa4, 0x0 , 0x0 , 0x0 , 0xbc, 0x0 , 0x0 , 
+	0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xa7, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0xab, 0x0 , 0x0 , 0x0 , 0xfd, 0x0 , 0x1 , 0x0 , 0x38, 0x0 , 0x1 , 0x0 , 
+};
+const unsigned char TopKSelectShader [] = {
+	0x3 , 0x2 , 0x23, 0x7 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x9b, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x2 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x11, 0x0 , 0x2 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x2 , 
+	0x0 , 0x47, 0x11, 0x0 , 0x0 , 0xa , 0x0 , 0x7 , 0x0 , 0x53, 0x50, 0x56, 0x5f, 
+	0x4b, 0x48, 0x52, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 
+	0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x7 , 0x0 , 0x53, 0x50, 
+	0x56, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 
+	0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x6 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 
+	0x34, 0x35, 0x30, 0x0 , 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x8 , 0x0 , 0x92, 0x0 , 
+	0x0 , 0x0 , 0x53, 0x50, 0x56, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 0x73, 0x68, 0x61, 
+	0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 
+	0xe , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0xf , 
+	0x0 , 0x8 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 
+	0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x28, 0x0 , 0x0 , 
+	0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x6 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 
+	0x11, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x3 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xc2, 0x1 , 
+	0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 
+	0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 0x5f, 0x41, 0x52, 
+	0x42, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 
+	0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 0x5f, 
+	0x41, 0x52, 0x42, 0x5f, 0x67, 0x70, 0x75, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 
+	0x72, 0x5f, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x1c, 
+	0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 
+	0x65, 0x72, 0x73, 0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x43, 0x6f, 
+	0x75, 0x6e, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x74, 0x68, 0x72, 0x65, 0x73, 0x68, 0x6f, 
+	0x6c, 0x64, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x5 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x69, 0x6e, 0x70, 0x75, 0x74, 0x44, 
+	0x61, 0x74, 0x61, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0xc , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x69, 0x6e, 0x70, 0x75, 0x74, 0x44, 0x61, 0x74, 
+	0x61, 0x41, 0x72, 0x72, 0x61, 0x79, 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x10, 
+	0x0 , 0x0 , 0x0 , 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x44, 0x61, 0x74, 0x61, 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x44, 0x61, 0x74, 0x61, 0x41, 0x72, 
+	0x72, 0x61, 0x79, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x63, 
+	0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x6 , 0x0 , 
+	0x6 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x6f, 0x75, 0x74, 
+	0x70, 0x75, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 
+	0x19, 0x0 , 0x0 , 0x0 , 0x69, 0x6e, 0x64, 0x65, 0x78, 0x44, 0x61, 0x74, 0x61, 
+	0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x8 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x49, 0x6e, 0x64, 0x65, 0x78, 
+	0x41, 0x72, 0x72, 0x61, 0x79, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 
+	0x20, 0x0 , 0x0 , 0x0 , 0x67, 0x72, 0x6f, 0x75, 0x70, 0x49, 0x6e, 0x64, 0x65, 
+	0x78, 0x0 , 0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x67, 0x6c, 
+	0x5f, 0x57, 0x6f, 0x72, 0x6b, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x49, 0x44, 0x0 , 
+	0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x67, 0x6c, 0x5f, 0x4e, 
+	0x75, 0x6d, 0x57, 0x6f, 0x72, 0x6b, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0x69, 0x6e, 
+	0x64, 0x65, 0x78, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 0x35, 0x0 , 0x0 , 
+	0x0 , 0x67, 0x6c, 0x5f, 0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 
+	0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x6 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0x74, 0x68, 0x69, 0x73, 0x4c, 0x61, 
+	0x6e, 0x65, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 
+	0x0 , 0x3c, 0x0 , 0x0 , 0x0 , 0x6c, 0x61, 0x6e, 0x65, 0x41, 0x63, 0x74, 0x69, 
+	0x76, 0x65, 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 0x62, 
+	0x69, 0x74, 0x73, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x3 , 0x0 , 0x4e, 0x0 , 
+	0x0 , 0x0 , 0x6b, 0x65, 0x79, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x6b, 0x0 , 0x0 , 
+	0x0 , 0x6d, 0x61, 0x73, 0x6b, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 
+	0x75, 0x0 , 0x0 , 0x0 , 0x77, 0x61, 0x76, 0x65, 0x4f, 0x66, 0x66, 0x73, 0x65, 
+	0x74, 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 
+	0x73, 0x6b, 0x50, 0x61, 0x72, 0x74, 0x73, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 
+	0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 0x73, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x48, 0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 
+	0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0x47, 0x0 , 0x4 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 
+	0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 
+	0x9 , 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 
+	0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 
+	0x10, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0xf , 
+	0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 
+	0x4 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 
+	0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x14, 
+	0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x13, 0x0 , 
+	0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 
+	0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0x47, 0x0 , 0x4 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 
+	0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 
+	0x17, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 
+	0x0 , 0x4 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 
+	0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 
+	0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 
+	0xb , 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x35, 
+	0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 
+	0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 
+	0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 
+	0x40, 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x20, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0x6 , 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x4 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 
+	0x20, 0x0 , 0x4 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x7 , 
+	0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x3 , 0x0 , 0xa , 0x0 , 0x0 , 
+	0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x3 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 
+	0xa , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xb , 
+	0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0xd , 0x0 , 0x0 , 
+	0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1e, 
+	0x0 , 0x3 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 
+	0x4 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x12, 
+	0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0x14, 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x15, 0x0 , 0x0 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x15, 0x0 , 0x0 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 
+	0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x1d, 0x0 , 0x3 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 
+	0x20, 0x0 , 0x4 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x19, 
+	0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 
+	0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x13, 0x0 , 0x2 , 0x0 , 
+	0x1d, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x3 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x1d, 
+	0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 
+	0x24, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x3b, 
+	0x0 , 0x4 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 
+	0x28, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0x31, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 
+	0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 
+	0x0 , 0x2c, 0x0 , 0x6 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 
+	0x31, 0x0 , 0x0 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x3b, 
+	0x0 , 0x4 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 0x2 , 0x0 , 0x3d, 
+	0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 0x3 , 0x0 , 0x3d, 0x0 , 0x0 , 
+	0x0 , 0x3f, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 
+	0x9 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x49, 
+	0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 
+	0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x80, 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x55, 
+	0x0 , 0x0 , 0x0 , 0xff, 0xff, 0xff, 0xff, 0x15, 0x0 , 0x4 , 0x0 , 0x6c, 0x0 , 
+	0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 
+	0x0 , 0x6d, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 
+	0x17, 0x0 , 0x4 , 0x0 , 0x70, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x7c, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x88, 0x0 , 0x0 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x5 , 0x0 , 
+	0x1d, 0x0 , 0x0 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1e, 
+	0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x4 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0x39, 
+	0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x3e, 0x0 , 
+	0x0 , 0x0 , 0x3c, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 
+	0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x4 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x7 , 
+	0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x6d, 0x0 , 0x0 , 0x0 , 0x6b, 0x0 , 
+	0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x21, 0x0 , 0x0 , 
+	0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x7c, 0x0 , 0x0 , 0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 
+	0x0 , 0x4 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x25, 0x0 , 0x0 , 
+	0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x5 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x28, 0x0 , 
+	0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x2a, 0x0 , 0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x2a, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 
+	0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 
+	0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x2b, 
+	0x0 , 0x0 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x20, 0x0 , 
+	0x0 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x30, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x34, 0x0 , 0x0 , 0x0 , 0x30, 0x0 , 0x0 , 0x0 , 0x31, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 
+	0x0 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 
+	0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x34, 
+	0x0 , 0x0 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x2f, 0x0 , 
+	0x0 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x39, 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x3c, 0x0 , 0x0 , 0x0 , 
+	0x3f, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x40, 
+	0x0 , 0x0 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x42, 0x0 , 
+	0x0 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x43, 0x0 , 0x0 , 0x0 , 
+	0x41, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x44, 
+	0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x43, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 
+	0x3 , 0x0 , 0x46, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 
+	0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0x45, 0x0 , 0x0 , 0x0 , 0x46, 0x0 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0x45, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 
+	0x6 , 0x0 , 0x49, 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 
+	0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0xa , 0x0 , 0x0 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 0x39, 0x0 , 0x0 , 
+	0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x4d, 0x0 , 0x0 , 0x0 , 
+	0x4c, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 0x4d, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x4f, 0x0 , 
+	0x0 , 0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x50, 0x0 , 0x0 , 0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 0xc7, 0x0 , 0x5 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x52, 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x0 , 0x0 , 0x51, 
+	0x0 , 0x0 , 0x0 , 0xab, 0x0 , 0x5 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x54, 0x0 , 
+	0x0 , 0x0 , 0x52, 0x0 , 0x0 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 0xa9, 0x0 , 0x6 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x56, 0x0 , 0x0 , 0x0 , 0x54, 0x0 , 0x0 , 0x0 , 
+	0x55, 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0xc6, 0x0 , 0x5 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0x57, 0x0 , 0x0 , 0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0x56, 0x0 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x57, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 
+	0x4e, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0x59, 
+	0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x5a, 0x0 , 0x0 , 
+	0x0 , 0x59, 0x0 , 0x0 , 0x0 , 0xac, 0x0 , 0x5 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 
+	0x5b, 0x0 , 0x0 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0xf7, 
+	0x0 , 0x3 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 
+	0x4 , 0x0 , 0x5b, 0x0 , 0x0 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 0x5c, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x6 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 
+	0xaa, 0x0 , 0x5 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x61, 0x0 , 0x0 , 0x0 , 0x5e, 
+	0x0 , 0x0 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x63, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x61, 0x0 , 0x0 , 
+	0x0 , 0x62, 0x0 , 0x0 , 0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0x62, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x64, 
+	0x0 , 0x0 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0xc8, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x65, 0x0 , 0x0 , 0x0 , 0x64, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 
+	0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0x66, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x12, 0x0 , 0x0 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 0x66, 0x0 , 0x0 , 0x0 , 0xae, 0x0 , 
+	0x5 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x68, 0x0 , 0x0 , 0x0 , 0x65, 0x0 , 0x0 , 
+	0x0 , 0x67, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x63, 0x0 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0xf5, 0x0 , 0x7 , 0x0 , 0x3d, 
+	0x0 , 0x0 , 0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0x61, 0x0 , 0x0 , 0x0 , 0x5c, 0x0 , 
+	0x0 , 0x0 , 0x68, 0x0 , 0x0 , 0x0 , 0x62, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 
+	0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 
+	0xf5, 0x0 , 0x7 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x6a, 0x0 , 0x0 , 0x0 , 0x5b, 
+	0x0 , 0x0 , 0x0 , 0x45, 0x0 , 0x0 , 0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0x63, 0x0 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x3c, 0x0 , 0x0 , 0x0 , 0x6a, 0x0 , 0x0 , 
+	0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x46, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0x46, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x6e, 
+	0x0 , 0x0 , 0x0 , 0x3c, 0x0 , 0x0 , 0x0 , 0x45, 0x11, 0x4 , 0x0 , 0x70, 0x0 , 
+	0x0 , 0x0 , 0x6f, 0x0 , 0x0 , 0x0 , 0x6e, 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x71, 0x0 , 0x0 , 0x0 , 0x6f, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x72, 
+	0x0 , 0x0 , 0x0 , 0x6f, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 
+	0x5 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x73, 0x0 , 0x0 , 0x0 , 0x71, 0x0 , 0x0 , 
+	0x0 , 0x72, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 
+	0x74, 0x0 , 0x0 , 0x0 , 0x73, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x6b, 
+	0x0 , 0x0 , 0x0 , 0x74, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x75, 0x0 , 
+	0x0 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x26, 0x0 , 0x0 , 
+	0x0 , 0x76, 0x0 , 0x0 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x77, 0x0 , 0x0 , 0x0 , 0x76, 
+	0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x5 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x78, 0x0 , 
+	0x0 , 0x0 , 0x77, 0x0 , 0x0 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 
+	0x0 , 0x7a, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 
+	0x78, 0x0 , 0x0 , 0x0 , 0x79, 0x0 , 0x0 , 0x0 , 0x7a, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0x79, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x6c, 0x0 , 
+	0x0 , 0x0 , 0x7d, 0x0 , 0x0 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 
+	0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x7e, 0x0 , 0x0 , 0x0 , 0x7d, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 0x7e, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x5 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x7f, 0x0 , 0x0 , 0x0 , 0x7b, 0x0 , 
+	0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x80, 0x0 , 0x0 , 0x0 , 0x7f, 0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 0x4 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x81, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x5 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x0 , 0x0 , 0x7b, 0x0 , 
+	0x0 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x83, 0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 0x4 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x0 , 0x0 , 0x83, 0x0 , 0x0 , 0x0 , 0x80, 
+	0x0 , 0x5 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x85, 0x0 , 0x0 , 0x0 , 0x81, 0x0 , 
+	0x0 , 0x0 , 0x84, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x86, 0x0 , 0x0 , 0x0 , 0x85, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 
+	0x88, 0x0 , 0x0 , 0x0 , 0x87, 0x0 , 0x0 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0xe , 
+	0x0 , 0x0 , 0x0 , 0xea, 0x0 , 0x7 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x89, 0x0 , 
+	0x0 , 0x0 , 0x87, 0x0 , 0x0 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x53, 0x0 , 0x0 , 
+	0x0 , 0x86, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 
+	0x89, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x7a, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0x7a, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x8a, 0x0 , 0x0 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x46, 0x11, 0x4 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x8b, 0x0 , 0x0 , 0x0 , 0x8a, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x8b, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x8c, 0x0 , 0x0 , 0x0 , 0x3c, 0x0 , 
+	0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x8e, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x8c, 0x0 , 0x0 , 0x0 , 0x8d, 0x0 , 0x0 , 0x0 , 
+	0x8e, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x8d, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x90, 0x0 , 0x0 , 0x0 , 0x75, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x91, 0x0 , 0x0 , 
+	0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x6 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x93, 0x0 , 0x0 , 0x0 , 0x92, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x91, 
+	0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x94, 0x0 , 
+	0x0 , 0x0 , 0x90, 0x0 , 0x0 , 0x0 , 0x93, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 
+	0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 0x94, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x95, 0x0 , 0x0 , 0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x96, 0x0 , 0x0 , 0x0 , 0x39, 0x0 , 
+	0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x49, 0x0 , 0x0 , 0x0 , 0x97, 0x0 , 0x0 , 
+	0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x95, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x97, 0x0 , 0x0 , 0x0 , 0x96, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x98, 0x0 , 0x0 , 0x0 , 0x8f, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x99, 0x0 , 0x0 , 
+	0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x88, 0x0 , 0x0 , 0x0 , 
+	0x9a, 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x98, 
+	0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x9a, 0x0 , 0x0 , 0x0 , 0x99, 0x0 , 
+	0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x8e, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 
+	0x0 , 0x8e, 0x0 , 0x0 , 0x0 , 0xfd, 0x0 , 0x1 , 0x0 , 0x38, 0x0 , 0x1 , 0x0 , 
+};
+const unsigned char BfsExpandShader [] = {
+	0x3 , 0x2 , 0x23, 0x7 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x24, 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x2 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x11, 0x0 , 0x2 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x2 , 
+	0x0 , 0x47, 0x11, 0x0 , 0x0 , 0xa , 0x0 , 0x7 , 0x0 , 0x53, 0x50, 0x56, 0x5f, 
+	0x4b, 0x48, 0x52, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 
+	0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x7 , 0x0 , 0x53, 0x50, 
+	0x56, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 
+	0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x6 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 
+	0x34, 0x35, 0x30, 0x0 , 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x8 , 0x0 , 0x85, 0x0 , 
+	0x0 , 0x0 , 0x53, 0x50, 0x56, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 0x73, 0x68, 0x61, 
+	0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 
+	0xe , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0xf , 
+	0x0 , 0x8 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x90, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 
+	0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x68, 0x0 , 0x0 , 0x0 , 0x94, 0x0 , 0x0 , 
+	0x0 , 0x97, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x6 , 0x0 , 0x90, 0x0 , 0x0 , 0x0 , 
+	0x11, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x3 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xc2, 0x1 , 
+	0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 
+	0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 0x5f, 0x41, 0x52, 
+	0x42, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 
+	0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 0x5f, 
+	0x41, 0x52, 0x42, 0x5f, 0x67, 0x70, 0x75, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 
+	0x72, 0x5f, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x90, 
+	0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 
+	0x65, 0x72, 0x73, 0x0 , 0x0 , 0x6 , 0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x0 , 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 
+	0x74, 0x65, 0x72, 0x73, 0x0 , 0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 0xb , 0x0 , 0x0 , 
+	0x0 , 0x72, 0x6f, 0x77, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x44, 0x61, 0x74, 
+	0x61, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x72, 0x6f, 0x77, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x41, 
+	0x72, 0x72, 0x61, 0x79, 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0xf , 0x0 , 0x0 , 
+	0x0 , 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 
+	0x6 , 0x0 , 0x6 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x63, 
+	0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x41, 0x72, 0x72, 0x61, 0x79, 0x0 , 0x5 , 0x0 , 
+	0x5 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x76, 0x69, 0x73, 0x69, 0x74, 0x65, 0x64, 
+	0x44, 0x61, 0x74, 0x61, 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x76, 0x69, 0x73, 0x69, 0x74, 0x65, 0x64, 0x41, 0x72, 
+	0x72, 0x61, 0x79, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x17, 0x0 , 
+	0x0 , 0x0 , 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 
+	0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x6c, 0x65, 0x76, 0x65, 0x6c, 0x41, 0x72, 0x72, 0x61, 0x79, 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x6 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x66, 0x72, 0x6f, 0x6e, 0x74, 0x69, 
+	0x65, 0x72, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 
+	0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x66, 0x72, 0x6f, 0x6e, 
+	0x74, 0x69, 0x65, 0x72, 0x41, 0x72, 0x72, 0x61, 0x79, 0x0 , 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x7 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x6e, 0x65, 0x78, 0x74, 0x46, 0x72, 
+	0x6f, 0x6e, 0x74, 0x69, 0x65, 0x72, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x6 , 0x0 , 0x8 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x6e, 0x65, 0x78, 0x74, 0x46, 0x72, 0x6f, 0x6e, 0x74, 0x69, 0x65, 0x72, 0x41, 
+	0x72, 0x72, 0x61, 0x79, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x24, 0x0 , 
+	0x0 , 0x0 , 0x73, 0x74, 0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 
+	0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x64, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x53, 0x69, 0x7a, 0x65, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x66, 0x72, 0x6f, 0x6e, 0x74, 0x69, 0x65, 0x72, 0x43, 0x6f, 0x75, 
+	0x6e, 0x74, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x8 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x6e, 0x65, 0x78, 0x74, 0x46, 0x72, 0x6f, 0x6e, 0x74, 
+	0x69, 0x65, 0x72, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 
+	0x6 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x6c, 0x65, 0x76, 
+	0x65, 0x6c, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 
+	0x27, 0x0 , 0x0 , 0x0 , 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x4f, 0x77, 0x6e, 
+	0x65, 0x72, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x73, 0x68, 
+	0x61, 0x72, 0x65, 0x64, 0x45, 0x64, 0x67, 0x65, 0x0 , 0x0 , 0x5 , 0x0 , 0x6 , 
+	0x0 , 0x2a, 0x0 , 0x0 , 0x0 , 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x45, 0x64, 
+	0x67, 0x65, 0x45, 0x6e, 0x64, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x2b, 
+	0x0 , 0x0 , 0x0 , 0x56, 0x69, 0x73, 0x69, 0x74, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x5 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x6e, 0x65, 0x69, 0x67, 0x68, 0x62, 0x6f, 
+	0x75, 0x72, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x30, 0x0 , 0x0 , 0x0 , 
+	0x6e, 0x65, 0x69, 0x67, 0x68, 0x62, 0x6f, 0x75, 0x72, 0x0 , 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x4 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x77, 0x6f, 0x72, 0x64, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x3 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x62, 0x69, 0x74, 
+	0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x41, 0x70, 0x70, 0x65, 
+	0x6e, 0x64, 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0x64, 
+	0x69, 0x73, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x5 , 0x0 , 0x52, 0x0 , 0x0 , 0x0 , 0x6e, 0x65, 0x69, 0x67, 0x68, 0x62, 0x6f, 
+	0x75, 0x72, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x54, 0x0 , 0x0 , 0x0 , 
+	0x64, 0x69, 0x73, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x5 , 0x0 , 0x56, 0x0 , 0x0 , 0x0 , 0x6e, 0x65, 0x69, 0x67, 0x68, 0x62, 
+	0x6f, 0x75, 0x72, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x57, 0x0 , 0x0 , 
+	0x0 , 0x6d, 0x61, 0x73, 0x6b, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 
+	0x67, 0x0 , 0x0 , 0x0 , 0x77, 0x61, 0x76, 0x65, 0x4f, 0x66, 0x66, 0x73, 0x65, 
+	0x74, 0x0 , 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 0x68, 0x0 , 0x0 , 0x0 , 0x67, 0x6c, 
+	0x5f, 0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 
+	0x69, 0x6f, 0x6e, 0x49, 0x44, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 
+	0x70, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x73, 0x6b, 0x50, 0x61, 0x72, 0x74, 0x73, 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x93, 0x0 , 0x0 , 0x0 , 0x67, 0x72, 
+	0x6f, 0x75, 0x70, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x0 , 0x0 , 0x5 , 0x0 , 0x6 , 
+	0x0 , 0x94, 0x0 , 0x0 , 0x0 , 0x67, 0x6c, 0x5f, 0x57, 0x6f, 0x72, 0x6b, 0x47, 
+	0x72, 0x6f, 0x75, 0x70, 0x49, 0x44, 0x0 , 0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x97, 
+	0x0 , 0x0 , 0x0 , 0x67, 0x6c, 0x5f, 0x4e, 0x75, 0x6d, 0x57, 0x6f, 0x72, 0x6b, 
+	0x47, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 
+	0x0 , 0x9e, 0x0 , 0x0 , 0x0 , 0x69, 0x6e, 0x64, 0x65, 0x78, 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x4 , 0x0 , 0xa5, 0x0 , 0x0 , 0x0 , 0x65, 0x64, 0x67, 0x65, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0xa6, 0x0 , 0x0 , 0x0 , 0x65, 0x64, 
+	0x67, 0x65, 0x45, 0x6e, 0x64, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0xad, 0x0 , 0x0 , 
+	0x0 , 0x76, 0x65, 0x72, 0x74, 0x65, 0x78, 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 
+	0xbd, 0x0 , 0x0 , 0x0 , 0x69, 0x73, 0x4c, 0x6f, 0x6e, 0x67, 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x5 , 0x0 , 0xdb, 0x0 , 0x0 , 0x0 , 0x77, 0x61, 0x76, 0x65, 0x45, 0x64, 
+	0x67, 0x65, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0xe0, 0x0 , 0x0 , 
+	0x0 , 0x77, 0x61, 0x76, 0x65, 0x45, 0x64, 0x67, 0x65, 0x45, 0x6e, 0x64, 0x0 , 
+	0x5 , 0x0 , 0x4 , 0x0 , 0xe7, 0x0 , 0x0 , 0x0 , 0x68, 0x61, 0x73, 0x45, 0x64, 
+	0x67, 0x65, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0xf4, 0x0 , 0x0 , 0x0 , 0x6e, 0x65, 
+	0x69, 0x67, 0x68, 0x62, 0x6f, 0x75, 0x72, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 
+	0x0 , 0xf5, 0x0 , 0x0 , 0x0 , 0x64, 0x69, 0x73, 0x63, 0x6f, 0x76, 0x65, 0x72, 
+	0x65, 0x64, 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x8 , 0x1 , 0x0 , 0x0 , 0x68, 
+	0x61, 0x73, 0x45, 0x64, 0x67, 0x65, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x15, 0x1 , 
+	0x0 , 0x0 , 0x6e, 0x65, 0x69, 0x67, 0x68, 0x62, 0x6f, 0x75, 0x72, 0x0 , 0x0 , 
+	0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x16, 0x1 , 0x0 , 0x0 , 0x64, 0x69, 0x73, 0x63, 
+	0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x7 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 
+	0x3 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 
+	0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x47, 0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 
+	0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 
+	0xe , 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 
+	0x0 , 0x4 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 
+	0x13, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x12, 
+	0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 
+	0x4 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x17, 
+	0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x16, 0x0 , 
+	0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 
+	0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 
+	0x48, 0x0 , 0x5 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x1b, 0x0 , 
+	0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x1a, 0x0 , 0x0 , 
+	0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 
+	0x1a, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x48, 
+	0x0 , 0x5 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x1f, 0x0 , 0x0 , 
+	0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 
+	0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x1e, 
+	0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 
+	0x5 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x48, 
+	0x0 , 0x5 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 
+	0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x24, 0x0 , 0x0 , 
+	0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 
+	0x47, 0x0 , 0x3 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 
+	0x0 , 0x4 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 
+	0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x68, 0x0 , 0x0 , 0x0 , 
+	0xb , 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x94, 
+	0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 
+	0x4 , 0x0 , 0x97, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 
+	0x0 , 0x15, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x3 , 
+	0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 
+	0x1e, 0x0 , 0x3 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x20, 
+	0x0 , 0x4 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 
+	0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x3 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0xa , 
+	0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 
+	0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1e, 
+	0x0 , 0x3 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 
+	0x4 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x11, 
+	0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0x13, 0x0 , 
+	0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x14, 0x0 , 0x0 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x14, 0x0 , 0x0 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 
+	0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 
+	0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0x17, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x16, 
+	0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 
+	0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 
+	0x1c, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x3b, 
+	0x0 , 0x4 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x0 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 
+	0xa , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x20, 0x0 , 
+	0x0 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x17, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x3 , 
+	0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x6 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 
+	0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0x24, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x22, 
+	0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 
+	0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x4 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x29, 0x0 , 
+	0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x28, 0x0 , 0x0 , 
+	0x0 , 0x2a, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 0x2 , 0x0 , 
+	0x2c, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x4 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0x2c, 
+	0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x31, 0x0 , 
+	0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 
+	0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x1f, 
+	0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x39, 0x0 , 
+	0x0 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x3e, 0x0 , 0x0 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x2a, 
+	0x0 , 0x3 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x46, 0x0 , 0x0 , 0x0 , 0x13, 0x0 , 
+	0x2 , 0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x5 , 0x0 , 0x50, 0x0 , 0x0 , 
+	0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x20, 0x0 , 0x4 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x2c, 
+	0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x4 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x59, 0x0 , 0x0 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 
+	0x5c, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x17, 
+	0x0 , 0x4 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x2b, 0x0 , 0x5 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0x63, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 
+	0x69, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x3b, 
+	0x0 , 0x4 , 0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0x68, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x71, 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x8c, 
+	0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 
+	0x3 , 0x0 , 0x91, 0x0 , 0x0 , 0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 
+	0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0x94, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x4 , 0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0x97, 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 0x6 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0xa0, 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x0 , 
+	0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xd0, 0x0 , 0x0 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xd1, 
+	0x0 , 0x0 , 0x0 , 0x8 , 0x1 , 0x0 , 0x0 , 0x36, 0x0 , 0x5 , 0x0 , 0x2c, 0x0 , 
+	0x0 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x2d, 0x0 , 0x0 , 
+	0x0 , 0x37, 0x0 , 0x3 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x31, 
+	0x0 , 0x0 , 0x0 , 0x30, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x4 , 0x0 , 0x31, 0x0 , 0x0 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x31, 0x0 , 0x0 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x30, 0x0 , 0x0 , 0x0 , 0x2e, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x33, 0x0 , 
+	0x0 , 0x0 , 0x30, 0x0 , 0x0 , 0x0 , 0xc2, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x34, 0x0 , 0x0 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x34, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0x30, 0x0 , 
+	0x0 , 0x0 , 0xc7, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 
+	0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0xc4, 0x0 , 0x5 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x3a, 
+	0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x3c, 0x0 , 0x0 , 
+	0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x0 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x3c, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x3f, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0xc7, 0x0 , 0x5 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x3f, 0x0 , 0x0 , 0x0 , 0x40, 
+	0x0 , 0x0 , 0x0 , 0xab, 0x0 , 0x5 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x43, 0x0 , 
+	0x0 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 
+	0x0 , 0x45, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 
+	0x43, 0x0 , 0x0 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0x45, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0xfe, 0x0 , 0x2 , 0x0 , 0x46, 0x0 , 
+	0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x45, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x0 , 0x0 , 0x35, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0x49, 0x0 , 
+	0x0 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x0 , 
+	0x0 , 0xf1, 0x0 , 0x7 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 
+	0x49, 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0x48, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x4b, 0x0 , 
+	0x0 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0xc7, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 
+	0xaa, 0x0 , 0x5 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x4d, 0x0 , 0x0 , 0x0 , 0x4c, 
+	0x0 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0xfe, 0x0 , 0x2 , 0x0 , 0x4d, 0x0 , 
+	0x0 , 0x0 , 0x38, 0x0 , 0x1 , 0x0 , 0x36, 0x0 , 0x5 , 0x0 , 0x4f, 0x0 , 0x0 , 
+	0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x0 , 0x0 , 
+	0x37, 0x0 , 0x3 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0x37, 
+	0x0 , 0x3 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x52, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 
+	0x2 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x55, 0x0 , 0x0 , 
+	0x0 , 0x54, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x31, 0x0 , 0x0 , 0x0 , 0x56, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 
+	0x0 , 0x4 , 0x0 , 0x59, 0x0 , 0x0 , 0x0 , 0x57, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x31, 0x0 , 0x0 , 0x0 , 0x67, 0x0 , 0x0 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x71, 0x0 , 0x0 , 0x0 , 
+	0x70, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x54, 
+	0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x56, 0x0 , 
+	0x0 , 0x0 , 0x52, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x2c, 0x0 , 0x0 , 
+	0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0x54, 0x0 , 0x0 , 0x0 , 0x45, 0x11, 0x4 , 0x0 , 
+	0x5c, 0x0 , 0x0 , 0x0 , 0x5b, 0x0 , 0x0 , 0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0x51, 
+	0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 0x5b, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 0x5b, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 
+	0x50, 0x0 , 0x5 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0x5d, 
+	0x0 , 0x0 , 0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x58, 0x0 , 
+	0x0 , 0x0 , 0x61, 0x0 , 0x0 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 
+	0x0 , 0x57, 0x0 , 0x0 , 0x0 , 0x61, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x58, 0x0 , 0x0 , 0x0 , 0x62, 0x0 , 0x0 , 0x0 , 0x57, 0x0 , 0x0 , 0x0 , 0xaa, 
+	0x0 , 0x5 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x64, 0x0 , 0x0 , 0x0 , 0x62, 0x0 , 
+	0x0 , 0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x66, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x64, 0x0 , 0x0 , 0x0 , 
+	0x65, 0x0 , 0x0 , 0x0 , 0x66, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x65, 
+	0x0 , 0x0 , 0x0 , 0xfd, 0x0 , 0x1 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x66, 0x0 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 
+	0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0x6a, 0x0 , 0x0 , 0x0 , 
+	0x68, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x6a, 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 
+	0x5 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x6d, 0x0 , 0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 
+	0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x6f, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x6d, 0x0 , 0x0 , 0x0 , 0x6e, 
+	0x0 , 0x0 , 0x0 , 0x6f, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x6e, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0x72, 0x0 , 0x0 , 
+	0x0 , 0x57, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 
+	0x73, 0x0 , 0x0 , 0x0 , 0x72, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x70, 
+	0x0 , 0x0 , 0x0 , 0x73, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x31, 0x0 , 
+	0x0 , 0x0 , 0x74, 0x0 , 0x0 , 0x0 , 0x70, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 
+	0x74, 0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x76, 
+	0x0 , 0x0 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x31, 0x0 , 
+	0x0 , 0x0 , 0x77, 0x0 , 0x0 , 0x0 , 0x70, 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x78, 0x0 , 0x0 , 0x0 , 
+	0x77, 0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x79, 
+	0x0 , 0x0 , 0x0 , 0x78, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x7a, 0x0 , 0x0 , 0x0 , 0x76, 0x0 , 0x0 , 0x0 , 0x79, 0x0 , 0x0 , 
+	0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 
+	0x7a, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0x7c, 
+	0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0xea, 0x0 , 
+	0x7 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x7d, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x0 , 
+	0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 0x7d, 0x0 , 0x0 , 0x0 , 0xf9, 
+	0x0 , 0x2 , 0x0 , 0x6f, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x6f, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x7e, 0x0 , 0x0 , 
+	0x0 , 0x67, 0x0 , 0x0 , 0x0 , 0x46, 0x11, 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x7f, 0x0 , 0x0 , 0x0 , 0x7e, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x67, 
+	0x0 , 0x0 , 0x0 , 0x7f, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x2c, 0x0 , 
+	0x0 , 0x0 , 0x80, 0x0 , 0x0 , 0x0 , 0x54, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 
+	0x0 , 0x82, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 
+	0x80, 0x0 , 0x0 , 0x0 , 0x81, 0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0x81, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0x83, 0x0 , 0x0 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x0 , 0x0 , 0x57, 0x0 , 0x0 , 0x0 , 
+	0xc , 0x0 , 0x6 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x86, 0x0 , 0x0 , 0x0 , 0x85, 
+	0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 
+	0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x87, 0x0 , 0x0 , 0x0 , 0x83, 0x0 , 0x0 , 
+	0x0 , 0x86, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x88, 0x0 , 0x0 , 0x0 , 0x56, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x3e, 
+	0x0 , 0x0 , 0x0 , 0x89, 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 
+	0x0 , 0x0 , 0x87, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x89, 0x0 , 0x0 , 
+	0x0 , 0x88, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x8a, 0x0 , 0x0 , 0x0 , 0x56, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x8c, 
+	0x0 , 0x0 , 0x0 , 0x8b, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x8d, 0x0 , 0x0 , 
+	0x0 , 0x8b, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x8e, 0x0 , 0x0 , 0x0 , 0x8d, 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x6 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 
+	0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x8a, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 
+	0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 0x8e, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 
+	0x82, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x82, 0x0 , 0x0 , 0x0 , 0xfd, 
+	0x0 , 0x1 , 0x0 , 0x38, 0x0 , 0x1 , 0x0 , 0x36, 0x0 , 0x5 , 0x0 , 0x4f, 0x0 , 
+	0x0 , 0x0 , 0x90, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x91, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x92, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x31, 0x0 , 0x0 , 0x0 , 0x93, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 
+	0x0 , 0x4 , 0x0 , 0x31, 0x0 , 0x0 , 0x0 , 0x9e, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x31, 0x0 , 0x0 , 0x0 , 0xa5, 0x0 , 0x0 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x31, 0x0 , 0x0 , 0x0 , 
+	0xa6, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x31, 
+	0x0 , 0x0 , 0x0 , 0xad, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x4 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0xbd, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x31, 0x0 , 0x0 , 0x0 , 0xdb, 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x31, 0x0 , 0x0 , 0x0 , 0xe0, 
+	0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x55, 0x0 , 
+	0x0 , 0x0 , 0xe7, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 
+	0x0 , 0x31, 0x0 , 0x0 , 0x0 , 0xf4, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x4 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0xf5, 0x0 , 0x0 , 0x0 , 0x7 , 
+	0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x8 , 0x1 , 
+	0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x31, 0x0 , 0x0 , 
+	0x0 , 0x15, 0x1 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x55, 0x0 , 0x0 , 0x0 , 0x16, 0x1 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x5 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0x95, 0x0 , 0x0 , 0x0 , 0x94, 0x0 , 
+	0x0 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x96, 0x0 , 0x0 , 0x0 , 0x95, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 
+	0x6b, 0x0 , 0x0 , 0x0 , 0x98, 0x0 , 0x0 , 0x0 , 0x97, 0x0 , 0x0 , 0x0 , 0xd , 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x99, 0x0 , 
+	0x0 , 0x0 , 0x98, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x9a, 0x0 , 0x0 , 0x0 , 0x96, 0x0 , 0x0 , 0x0 , 0x99, 0x0 , 0x0 , 0x0 , 
+	0x41, 0x0 , 0x5 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0x9b, 0x0 , 0x0 , 0x0 , 0x94, 
+	0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0x9c, 0x0 , 0x0 , 0x0 , 0x9b, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x9d, 0x0 , 0x0 , 0x0 , 0x9a, 0x0 , 0x0 , 0x0 , 
+	0x9c, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x93, 0x0 , 0x0 , 0x0 , 0x9d, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x9f, 0x0 , 
+	0x0 , 0x0 , 0x93, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0xa1, 0x0 , 0x0 , 0x0 , 0x9f, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x41, 0x0 , 0x5 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0xa2, 0x0 , 0x0 , 0x0 , 0x68, 
+	0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0xa3, 0x0 , 0x0 , 0x0 , 0xa2, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xa4, 0x0 , 0x0 , 0x0 , 0xa1, 0x0 , 0x0 , 0x0 , 
+	0xa3, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x9e, 0x0 , 0x0 , 0x0 , 0xa4, 
+	0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xa5, 0x0 , 0x0 , 0x0 , 0x42, 0x0 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xa6, 0x0 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xa7, 0x0 , 0x0 , 0x0 , 
+	0x9e, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0xa8, 
+	0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xa9, 0x0 , 0x0 , 0x0 , 0xa8, 0x0 , 0x0 , 
+	0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x0 , 0x0 , 
+	0xa7, 0x0 , 0x0 , 0x0 , 0xa9, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0xac, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0xaa, 0x0 , 
+	0x0 , 0x0 , 0xab, 0x0 , 0x0 , 0x0 , 0xac, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 
+	0x0 , 0xab, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0xae, 0x0 , 0x0 , 0x0 , 0x9e, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x3e, 
+	0x0 , 0x0 , 0x0 , 0xaf, 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 
+	0x0 , 0x0 , 0xae, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0xb0, 0x0 , 0x0 , 0x0 , 0xaf, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0xad, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0xb1, 0x0 , 0x0 , 0x0 , 0xad, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 
+	0x6 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0xb2, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 
+	0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0xb1, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0xb3, 0x0 , 0x0 , 0x0 , 0xb2, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0xa5, 0x0 , 0x0 , 0x0 , 0xb3, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xb4, 0x0 , 0x0 , 0x0 , 0xad, 0x0 , 0x0 , 
+	0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xb5, 0x0 , 0x0 , 0x0 , 
+	0xb4, 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x3e, 
+	0x0 , 0x0 , 0x0 , 0xb6, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 
+	0x0 , 0x0 , 0xb5, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0xb7, 0x0 , 0x0 , 0x0 , 0xb6, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0xa6, 0x0 , 0x0 , 0x0 , 0xb7, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xac, 
+	0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xac, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 
+	0x2 , 0x0 , 0xb8, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xb8, 0x0 , 0x0 , 
+	0x0 , 0xf6, 0x0 , 0x4 , 0x0 , 0xbc, 0x0 , 0x0 , 0x0 , 0xbb, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xba, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0xba, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0xbe, 0x0 , 0x0 , 0x0 , 0xa6, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xbf, 0x0 , 0x0 , 0x0 , 0xa5, 0x0 , 0x0 , 0x0 , 
+	0x82, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xc0, 0x0 , 0x0 , 0x0 , 0xbe, 
+	0x0 , 0x0 , 0x0 , 0xbf, 0x0 , 0x0 , 0x0 , 0xae, 0x0 , 0x5 , 0x0 , 0x2c, 0x0 , 
+	0x0 , 0x0 , 0xc1, 0x0 , 0x0 , 0x0 , 0xc0, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xbd, 0x0 , 0x0 , 0x0 , 0xc1, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0xc2, 0x0 , 0x0 , 0x0 , 0xbd, 
+	0x0 , 0x0 , 0x0 , 0x45, 0x11, 0x4 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0xc3, 0x0 , 
+	0x0 , 0x0 , 0xc2, 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0xc4, 0x0 , 0x0 , 0x0 , 0xc3, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x51, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xc5, 0x0 , 0x0 , 0x0 , 0xc3, 
+	0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x5 , 0x0 , 0x60, 0x0 , 
+	0x0 , 0x0 , 0xc6, 0x0 , 0x0 , 0x0 , 0xc4, 0x0 , 0x0 , 0x0 , 0xc5, 0x0 , 0x0 , 
+	0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0xc7, 0x0 , 0x0 , 0x0 , 
+	0xc6, 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x5 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0xc8, 
+	0x0 , 0x0 , 0x0 , 0xc7, 0x0 , 0x0 , 0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 
+	0x3 , 0x0 , 0xca, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 
+	0x0 , 0xc8, 0x0 , 0x0 , 0x0 , 0xc9, 0x0 , 0x0 , 0x0 , 0xca, 0x0 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0xc9, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xbc, 
+	0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xca, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0xcb, 0x0 , 0x0 , 0x0 , 0xbd, 0x0 , 0x0 , 
+	0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0xcd, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0xfa, 0x0 , 0x4 , 0x0 , 0xcb, 0x0 , 0x0 , 0x0 , 0xcc, 0x0 , 0x0 , 0x0 , 0xcd, 
+	0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xcc, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 
+	0x5 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0xce, 0x0 , 0x0 , 0x0 , 0x68, 0x0 , 0x0 , 
+	0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0xcf, 0x0 , 0x0 , 0x0 , 0xce, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x27, 
+	0x0 , 0x0 , 0x0 , 0xcf, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xcd, 0x0 , 
+	0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xcd, 0x0 , 0x0 , 0x0 , 0xe0, 0x0 , 0x4 , 
+	0x0 , 0xd0, 0x0 , 0x0 , 0x0 , 0xd0, 0x0 , 0x0 , 0x0 , 0xd1, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xd2, 0x0 , 0x0 , 0x0 , 0x27, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0xd3, 0x0 , 
+	0x0 , 0x0 , 0x68, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xd4, 0x0 , 0x0 , 0x0 , 0xd3, 0x0 , 0x0 , 0x0 , 
+	0xaa, 0x0 , 0x5 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0xd5, 0x0 , 0x0 , 0x0 , 0xd2, 
+	0x0 , 0x0 , 0x0 , 0xd4, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0xd7, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0xd5, 0x0 , 0x0 , 
+	0x0 , 0xd6, 0x0 , 0x0 , 0x0 , 0xd7, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0xd6, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xd8, 
+	0x0 , 0x0 , 0x0 , 0xa5, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x29, 0x0 , 
+	0x0 , 0x0 , 0xd8, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0xd9, 0x0 , 0x0 , 0x0 , 0xa6, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0x2a, 0x0 , 0x0 , 0x0 , 0xd9, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0xda, 0x0 , 0x0 , 0x0 , 0xa6, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x3 , 0x0 , 0xa5, 0x0 , 0x0 , 0x0 , 0xda, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 
+	0x0 , 0xd7, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xd7, 0x0 , 0x0 , 0x0 , 
+	0xe0, 0x0 , 0x4 , 0x0 , 0xd0, 0x0 , 0x0 , 0x0 , 0xd0, 0x0 , 0x0 , 0x0 , 0xd1, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xdc, 0x0 , 
+	0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x6b, 0x0 , 0x0 , 
+	0x0 , 0xdd, 0x0 , 0x0 , 0x0 , 0x68, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xde, 0x0 , 0x0 , 0x0 , 0xdd, 
+	0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xdf, 0x0 , 
+	0x0 , 0x0 , 0xdc, 0x0 , 0x0 , 0x0 , 0xde, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 
+	0x0 , 0xdb, 0x0 , 0x0 , 0x0 , 0xdf, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0xe1, 0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0xe0, 0x0 , 0x0 , 0x0 , 0xe1, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 
+	0x2 , 0x0 , 0xe2, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xe2, 0x0 , 0x0 , 
+	0x0 , 0xf6, 0x0 , 0x4 , 0x0 , 0xe6, 0x0 , 0x0 , 0x0 , 0xe5, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xe4, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0xe4, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0xe8, 0x0 , 0x0 , 0x0 , 0xdb, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xe9, 0x0 , 0x0 , 0x0 , 0xe0, 0x0 , 0x0 , 0x0 , 
+	0xb0, 0x0 , 0x5 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0xea, 0x0 , 0x0 , 0x0 , 0xe8, 
+	0x0 , 0x0 , 0x0 , 0xe9, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xe7, 0x0 , 
+	0x0 , 0x0 , 0xea, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x2c, 0x0 , 0x0 , 
+	0x0 , 0xeb, 0x0 , 0x0 , 0x0 , 0xe7, 0x0 , 0x0 , 0x0 , 0x45, 0x11, 0x4 , 0x0 , 
+	0x5c, 0x0 , 0x0 , 0x0 , 0xec, 0x0 , 0x0 , 0x0 , 0xeb, 0x0 , 0x0 , 0x0 , 0x51, 
+	0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xed, 0x0 , 0x0 , 0x0 , 0xec, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0xee, 0x0 , 0x0 , 0x0 , 0xec, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 
+	0x50, 0x0 , 0x5 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0xef, 0x0 , 0x0 , 0x0 , 0xed, 
+	0x0 , 0x0 , 0x0 , 0xee, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x58, 0x0 , 
+	0x0 , 0x0 , 0xf0, 0x0 , 0x0 , 0x0 , 0xef, 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x5 , 
+	0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0xf1, 0x0 , 0x0 , 0x0 , 0xf0, 0x0 , 0x0 , 0x0 , 
+	0x63, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0xf3, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0xf1, 0x0 , 0x0 , 0x0 , 0xf2, 0x0 , 
+	0x0 , 0x0 , 0xf3, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xf2, 0x0 , 0x0 , 
+	0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xe6, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0xf3, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xf4, 0x0 , 0x0 , 0x0 , 0x42, 
+	0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xf5, 0x0 , 0x0 , 0x0 , 0x46, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0xf6, 0x0 , 0x0 , 
+	0x0 , 0xe7, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0xf8, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0xf6, 0x0 , 0x0 , 0x0 , 0xf7, 
+	0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xf7, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x0 , 
+	0x0 , 0xdb, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 
+	0xfa, 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0xf9, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xfb, 0x0 , 
+	0x0 , 0x0 , 0xfa, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xf4, 0x0 , 0x0 , 
+	0x0 , 0xfb, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0xfc, 0x0 , 0x0 , 0x0 , 0xdb, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0xfd, 0x0 , 0x0 , 0x0 , 0xfc, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xdb, 0x0 , 0x0 , 0x0 , 0xfd, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xfe, 0x0 , 0x0 , 0x0 , 
+	0xf4, 0x0 , 0x0 , 0x0 , 0x39, 0x0 , 0x5 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0xff, 
+	0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0xfe, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x3 , 0x0 , 0xf5, 0x0 , 0x0 , 0x0 , 0xff, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 
+	0x0 , 0xf8, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xf8, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0xf5, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x1 , 0x1 , 
+	0x0 , 0x0 , 0xf4, 0x0 , 0x0 , 0x0 , 0x39, 0x0 , 0x6 , 0x0 , 0x4f, 0x0 , 0x0 , 
+	0x0 , 0x2 , 0x1 , 0x0 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 
+	0x1 , 0x1 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xe5, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0xe5, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xe2, 0x0 , 
+	0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xe6, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 
+	0x0 , 0xbb, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xbb, 0x0 , 0x0 , 0x0 , 
+	0xf9, 0x0 , 0x2 , 0x0 , 0xb8, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xbc, 
+	0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x3 , 0x1 , 0x0 , 0x0 , 0xf8, 0x0 , 
+	0x2 , 0x0 , 0x3 , 0x1 , 0x0 , 0x0 , 0xf6, 0x0 , 0x4 , 0x0 , 0x7 , 0x1 , 0x0 , 
+	0x0 , 0x6 , 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 
+	0x5 , 0x1 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x5 , 0x1 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x9 , 0x1 , 0x0 , 0x0 , 0xa5, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xa , 0x1 , 0x0 , 
+	0x0 , 0xa6, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 
+	0xb , 0x1 , 0x0 , 0x0 , 0x9 , 0x1 , 0x0 , 0x0 , 0xa , 0x1 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0x8 , 0x1 , 0x0 , 0x0 , 0xb , 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0xc , 0x1 , 0x0 , 0x0 , 0x8 , 0x1 , 0x0 , 
+	0x0 , 0x45, 0x11, 0x4 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0xd , 0x1 , 0x0 , 0x0 , 
+	0xc , 0x1 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xe , 
+	0x1 , 0x0 , 0x0 , 0xd , 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 
+	0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xf , 0x1 , 0x0 , 0x0 , 0xd , 0x1 , 0x0 , 
+	0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x5 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 
+	0x10, 0x1 , 0x0 , 0x0 , 0xe , 0x1 , 0x0 , 0x0 , 0xf , 0x1 , 0x0 , 0x0 , 0x7c, 
+	0x0 , 0x4 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0x11, 0x1 , 0x0 , 0x0 , 0x10, 0x1 , 
+	0x0 , 0x0 , 0xaa, 0x0 , 0x5 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x12, 0x1 , 0x0 , 
+	0x0 , 0x11, 0x1 , 0x0 , 0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 
+	0x14, 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x12, 
+	0x1 , 0x0 , 0x0 , 0x13, 0x1 , 0x0 , 0x0 , 0x14, 0x1 , 0x0 , 0x0 , 0xf8, 0x0 , 
+	0x2 , 0x0 , 0x13, 0x1 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x7 , 0x1 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x14, 0x1 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0x15, 0x1 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x16, 
+	0x1 , 0x0 , 0x0 , 0x46, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x2c, 0x0 , 
+	0x0 , 0x0 , 0x17, 0x1 , 0x0 , 0x0 , 0x8 , 0x1 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 
+	0x0 , 0x19, 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 
+	0x17, 0x1 , 0x0 , 0x0 , 0x18, 0x1 , 0x0 , 0x0 , 0x19, 0x1 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0x18, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0x1a, 0x1 , 0x0 , 0x0 , 0xa5, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 
+	0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0x1b, 0x1 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 
+	0xd , 0x0 , 0x0 , 0x0 , 0x1a, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x1c, 0x1 , 0x0 , 0x0 , 0x1b, 0x1 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x3 , 0x0 , 0x15, 0x1 , 0x0 , 0x0 , 0x1c, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x1d, 0x1 , 0x0 , 0x0 , 0xa5, 0x0 , 0x0 , 0x0 , 
+	0x80, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x1e, 0x1 , 0x0 , 0x0 , 0x1d, 
+	0x1 , 0x0 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xa5, 0x0 , 
+	0x0 , 0x0 , 0x1e, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x1f, 0x1 , 0x0 , 0x0 , 0x15, 0x1 , 0x0 , 0x0 , 0x39, 0x0 , 0x5 , 0x0 , 
+	0x2c, 0x0 , 0x0 , 0x0 , 0x20, 0x1 , 0x0 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x1f, 
+	0x1 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x16, 0x1 , 0x0 , 0x0 , 0x20, 0x1 , 
+	0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x19, 0x1 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 
+	0x0 , 0x19, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 
+	0x21, 0x1 , 0x0 , 0x0 , 0x16, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x22, 0x1 , 0x0 , 0x0 , 0x15, 0x1 , 0x0 , 0x0 , 0x39, 0x0 , 
+	0x6 , 0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0x23, 0x1 , 0x0 , 0x0 , 0x4e, 0x0 , 0x0 , 
+	0x0 , 0x21, 0x1 , 0x0 , 0x0 , 0x22, 0x1 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 
+	0x6 , 0x1 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x6 , 0x1 , 0x0 , 0x0 , 0xf9, 
+	0x0 , 0x2 , 0x0 , 0x3 , 0x1 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x7 , 0x1 , 
+	0x0 , 0x0 , 0xfd, 0x0 , 0x1 , 0x0 , 0x38, 0x0 , 0x1 , 0x0 , 
+};
+const unsigned char BfsAdvanceShader [] = {
+	0x3 , 0x2 , 0x23, 0x7 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x2 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0xb , 0x0 , 0x6 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x47, 0x4c, 0x53, 
+	0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0xe , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0xf , 
+	0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 
+	0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x6 , 0x0 , 0xa , 0x0 , 0x0 , 
+	0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x3 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xc2, 
+	0x1 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 
+	0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x73, 0x74, 0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 0x0 , 
+	0x6 , 0x0 , 0x7 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x64, 
+	0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x53, 0x69, 0x7a, 0x65, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 
+	0x0 , 0x66, 0x72, 0x6f, 0x6e, 0x74, 0x69, 0x65, 0x72, 0x43, 0x6f, 0x75, 0x6e, 
+	0x74, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x8 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0x6e, 0x65, 0x78, 0x74, 0x46, 0x72, 0x6f, 0x6e, 0x74, 0x69, 
+	0x65, 0x72, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x6c, 0x65, 0x76, 0x65, 
+	0x6c, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0xe , 
+	0x0 , 0x0 , 0x0 , 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x5 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x67, 0x72, 0x6f, 0x75, 0x70, 0x43, 0x6f, 
+	0x75, 0x6e, 0x74, 0x0 , 0x0 , 0x5 , 0x0 , 0x3 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 
+	0x78, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x3 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0x79, 
+	0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 
+	0xc , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 
+	0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 
+	0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x22, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x4 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 
+	0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0x6 , 0x0 , 0x0 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x6 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x8 , 0x0 , 
+	0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 
+	0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x13, 0x0 , 0x2 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 
+	0x3 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 
+	0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 0x2 , 0x0 , 
+	0x1a, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x1d, 
+	0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x3f, 0x0 , 0x0 , 0x0 , 
+	0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x3f, 
+	0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x28, 0x0 , 
+	0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0xff, 0xff, 0x0 , 0x0 , 0x20, 
+	0x0 , 0x4 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 
+	0x0 , 0x0 , 0x36, 0x0 , 0x5 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0xd , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0xe , 
+	0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0xf , 0x0 , 
+	0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 
+	0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x4 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0x7 , 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 
+	0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 
+	0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x0 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0x15, 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x12, 
+	0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 
+	0xe , 0x0 , 0x0 , 0x0 , 0xac, 0x0 , 0x5 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x19, 
+	0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 
+	0x3 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 
+	0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x12, 
+	0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x1f, 0x0 , 0x0 , 
+	0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x21, 0x0 , 0x0 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x5 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x22, 0x0 , 0x0 , 
+	0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 
+	0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x24, 0x0 , 0x0 , 
+	0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x86, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x2a, 0x0 , 0x0 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 
+	0x0 , 0xc , 0x0 , 0x7 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x2d, 
+	0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x2e, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x30, 0x0 , 0x0 , 
+	0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x5 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 
+	0x31, 0x0 , 0x0 , 0x0 , 0x30, 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0xf7, 
+	0x0 , 0x3 , 0x0 , 0x34, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 
+	0x4 , 0x0 , 0x31, 0x0 , 0x0 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x33, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 
+	0x34, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x0 , 
+	0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x37, 0x0 , 0x0 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x82, 
+	0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x37, 0x0 , 
+	0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x86, 0x0 , 0x5 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x39, 
+	0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x34, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 
+	0x2 , 0x0 , 0x34, 0x0 , 0x0 , 0x0 , 0xf5, 0x0 , 0x7 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 
+	0x3a, 0x0 , 0x0 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x2f, 
+	0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x3c, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 
+	0x50, 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0x3c, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 
+	0x5 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x3f, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x3f, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x0 , 0x0 , 0xfd, 0x0 , 0x1 , 0x0 , 0x38, 0x0 , 0x1 , 0x0 , 
+};
+const unsigned char CullShader [] = {
+	0x3 , 0x2 , 0x23, 0x7 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xf3, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x2 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x11, 0x0 , 0x2 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x2 , 
+	0x0 , 0x47, 0x11, 0x0 , 0x0 , 0xa , 0x0 , 0x7 , 0x0 , 0x53, 0x50, 0x56, 0x5f, 
+	0x4b, 0x48, 0x52, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 
+	0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x7 , 0x0 , 0x53, 0x50, 
+	0x56, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 
+	0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x6 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 
+	0x34, 0x35, 0x30, 0x0 , 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x8 , 0x0 , 0xcd, 0x0 , 
+	0x0 , 0x0 , 0x53, 0x50, 0x56, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 0x73, 0x68, 0x61, 
+	0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 
+	0xe , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0xf , 
+	0x0 , 0x8 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 
+	0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x34, 0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 
+	0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x6 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 
+	0x11, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x3 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xc2, 0x1 , 
+	0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 
+	0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 0x5f, 0x41, 0x52, 
+	0x42, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 
+	0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 0x5f, 
+	0x41, 0x52, 0x42, 0x5f, 0x67, 0x70, 0x75, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 
+	0x72, 0x5f, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x2e, 
+	0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x5 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x62, 0x6f, 0x78, 0x42, 0x6f, 0x75, 0x6e, 
+	0x64, 0x73, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 
+	0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0 , 0x0 , 0x6 , 
+	0x0 , 0x5 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x70, 0x6c, 
+	0x61, 0x6e, 0x65, 0x73, 0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0xf , 0x0 , 0x0 , 
+	0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 
+	0x43, 0x6f, 0x75, 0x6e, 0x74, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x9 , 
+	0x0 , 0x0 , 0x0 , 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x62, 0x6f, 0x75, 
+	0x6e, 0x64, 0x73, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 
+	0x13, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x62, 0x6f, 0x75, 0x6e, 0x64, 
+	0x73, 0x41, 0x72, 0x72, 0x61, 0x79, 0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 0x17, 0x0 , 
+	0x0 , 0x0 , 0x6d, 0x65, 0x73, 0x68, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x44, 0x61, 
+	0x74, 0x61, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x6d, 0x65, 0x73, 0x68, 0x49, 0x6e, 0x64, 0x65, 0x78, 
+	0x41, 0x72, 0x72, 0x61, 0x79, 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x1b, 0x0 , 
+	0x0 , 0x0 , 0x4d, 0x65, 0x73, 0x68, 0x44, 0x72, 0x61, 0x77, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x69, 0x6e, 0x64, 0x65, 0x78, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x0 , 0x0 , 0x6 , 
+	0x0 , 0x6 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x66, 0x69, 
+	0x72, 0x73, 0x74, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 
+	0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x76, 0x65, 0x72, 0x74, 
+	0x65, 0x78, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x6 , 
+	0x0 , 0x5 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x70, 0x61, 
+	0x64, 0x64, 0x69, 0x6e, 0x67, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x1d, 0x0 , 0x0 , 
+	0x0 , 0x6d, 0x65, 0x73, 0x68, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x6 , 0x0 , 0x6 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x6d, 
+	0x65, 0x73, 0x68, 0x41, 0x72, 0x72, 0x61, 0x79, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x7 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x76, 0x69, 0x73, 0x69, 0x62, 0x6c, 0x65, 
+	0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x44, 0x61, 0x74, 0x61, 0x0 , 
+	0x6 , 0x0 , 0x9 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x76, 
+	0x69, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 
+	0x65, 0x41, 0x72, 0x72, 0x61, 0x79, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 
+	0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x44, 0x72, 0x61, 0x77, 0x43, 0x6f, 0x6d, 0x6d, 
+	0x61, 0x6e, 0x64, 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x69, 0x6e, 0x64, 0x65, 0x78, 0x43, 0x6f, 0x75, 0x6e, 0x74, 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 
+	0x0 , 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x43, 0x6f, 0x75, 0x6e, 
+	0x74, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0x66, 0x69, 0x72, 0x73, 0x74, 0x49, 0x6e, 0x64, 0x65, 0x78, 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 
+	0x0 , 0x76, 0x65, 0x72, 0x74, 0x65, 0x78, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x66, 0x69, 0x72, 0x73, 0x74, 0x49, 0x6e, 0x73, 0x74, 0x61, 
+	0x6e, 0x63, 0x65, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 0x27, 0x0 , 0x0 , 
+	0x0 , 0x64, 0x72, 0x61, 0x77, 0x43, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x44, 
+	0x61, 0x74, 0x61, 0x0 , 0x6 , 0x0 , 0x8 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x64, 0x72, 0x61, 0x77, 0x43, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 
+	0x64, 0x41, 0x72, 0x72, 0x61, 0x79, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x6 , 
+	0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x64, 0x72, 0x61, 0x77, 0x43, 0x6f, 0x75, 0x6e, 
+	0x74, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x2b, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x64, 0x72, 0x61, 0x77, 0x43, 0x6f, 
+	0x75, 0x6e, 0x74, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x32, 0x0 , 0x0 , 
+	0x0 , 0x67, 0x72, 0x6f, 0x75, 0x70, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x6 , 0x0 , 0x34, 0x0 , 0x0 , 0x0 , 0x67, 0x6c, 0x5f, 0x57, 0x6f, 
+	0x72, 0x6b, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x49, 0x44, 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x7 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0x67, 0x6c, 0x5f, 0x4e, 0x75, 0x6d, 0x57, 
+	0x6f, 0x72, 0x6b, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x4 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x69, 0x6e, 0x64, 0x65, 0x78, 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x67, 0x6c, 
+	0x5f, 0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 
+	0x69, 0x6f, 0x6e, 0x49, 0x44, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 
+	0x4b, 0x0 , 0x0 , 0x0 , 0x6c, 0x61, 0x6e, 0x65, 0x41, 0x63, 0x74, 0x69, 0x76, 
+	0x65, 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x54, 0x0 , 0x0 , 0x0 , 0x63, 0x65, 
+	0x6e, 0x74, 0x65, 0x72, 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x57, 0x0 , 0x0 , 
+	0x0 , 0x65, 0x78, 0x74, 0x65, 0x6e, 0x74, 0x73, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 
+	0x5a, 0x0 , 0x0 , 0x0 , 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x4 , 0x0 , 0x71, 0x0 , 0x0 , 0x0 , 0x73, 0x70, 0x68, 0x65, 0x72, 0x65, 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x3 , 0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 0x69, 0x0 , 0x0 , 
+	0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x84, 0x0 , 0x0 , 0x0 , 0x70, 0x6c, 0x61, 0x6e, 
+	0x65, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x89, 0x0 , 0x0 , 0x0 , 0x72, 
+	0x65, 0x61, 0x63, 0x68, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0xa4, 0x0 , 
+	0x0 , 0x0 , 0x6d, 0x61, 0x73, 0x6b, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 
+	0x0 , 0xaf, 0x0 , 0x0 , 0x0 , 0x77, 0x61, 0x76, 0x65, 0x4f, 0x66, 0x66, 0x73, 
+	0x65, 0x74, 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0xb6, 0x0 , 0x0 , 0x0 , 0x6d, 
+	0x61, 0x73, 0x6b, 0x50, 0x61, 0x72, 0x74, 0x73, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x4 , 0x0 , 0xca, 0x0 , 0x0 , 0x0 , 0x73, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0xd1, 0x0 , 0x0 , 0x0 , 0x4d, 0x65, 0x73, 0x68, 
+	0x44, 0x72, 0x61, 0x77, 0x0 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0xd1, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x69, 0x6e, 0x64, 0x65, 0x78, 0x43, 
+	0x6f, 0x75, 0x6e, 0x74, 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0xd1, 0x0 , 0x0 , 
+	0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x66, 0x69, 0x72, 0x73, 0x74, 0x49, 0x6e, 0x64, 
+	0x65, 0x78, 0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0xd1, 0x0 , 0x0 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0x76, 0x65, 0x72, 0x74, 0x65, 0x78, 0x4f, 0x66, 0x66, 0x73, 
+	0x65, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x5 , 0x0 , 0xd1, 0x0 , 0x0 , 
+	0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x0 , 
+	0x5 , 0x0 , 0x4 , 0x0 , 0xd0, 0x0 , 0x0 , 0x0 , 0x6d, 0x65, 0x73, 0x68, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0xea, 0x0 , 0x0 , 0x0 , 0x44, 0x72, 
+	0x61, 0x77, 0x43, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x0 , 0x6 , 0x0 , 0x6 , 
+	0x0 , 0xea, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x69, 0x6e, 0x64, 0x65, 
+	0x78, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0xea, 
+	0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 
+	0x63, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 
+	0x0 , 0xea, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x66, 0x69, 0x72, 0x73, 
+	0x74, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0xea, 
+	0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x76, 0x65, 0x72, 0x74, 0x65, 0x78, 
+	0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 
+	0x0 , 0xea, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x66, 0x69, 0x72, 0x73, 
+	0x74, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x0 , 0x0 , 0x0 , 0x47, 
+	0x0 , 0x4 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 
+	0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x48, 
+	0x0 , 0x5 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 
+	0x0 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0xf , 0x0 , 0x0 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 
+	0x6 , 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x13, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 
+	0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x21, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x16, 0x0 , 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 
+	0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x3 , 
+	0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x15, 0x0 , 0x0 , 
+	0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 
+	0x1b, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 
+	0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 
+	0x8 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x3 , 
+	0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 
+	0x4 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 
+	0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x1d, 
+	0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x1a, 0x0 , 
+	0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 
+	0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0x48, 0x0 , 0x5 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x21, 0x0 , 
+	0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x20, 0x0 , 0x0 , 
+	0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 
+	0x20, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x48, 
+	0x0 , 0x5 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x25, 0x0 , 0x0 , 
+	0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x48, 0x0 , 0x5 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x23, 
+	0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x25, 0x0 , 
+	0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 
+	0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x23, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x26, 
+	0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 
+	0x5 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 
+	0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x22, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x24, 0x0 , 
+	0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 
+	0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x3 , 
+	0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x2a, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x2a, 0x0 , 0x0 , 
+	0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 
+	0x34, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x47, 
+	0x0 , 0x4 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 
+	0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 
+	0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0x20, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 
+	0x2 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 0x3 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x31, 0x0 , 0x3 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x6 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x7 , 
+	0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x3 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 
+	0xb , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x15, 
+	0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 
+	0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x1c, 0x0 , 0x4 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 
+	0xb , 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x4 , 0x0 , 0xf , 
+	0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 
+	0x4 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 
+	0x9 , 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x3 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0xb , 
+	0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x12, 0x0 , 
+	0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 
+	0x11, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x3 , 0x0 , 0x16, 
+	0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0x17, 0x0 , 
+	0x0 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x18, 0x0 , 0x0 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x18, 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 
+	0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x1e, 0x0 , 0x6 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 
+	0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 
+	0x1d, 0x0 , 0x3 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x1e, 
+	0x0 , 0x3 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 
+	0x4 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x1f, 
+	0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0x21, 0x0 , 
+	0x0 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x22, 0x0 , 0x0 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x22, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 
+	0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 
+	0x0 , 0x0 , 0x1e, 0x0 , 0x7 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 
+	0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0xc , 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x3 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x25, 
+	0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 
+	0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 
+	0x24, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 
+	0x3 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 
+	0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x4 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 0x0 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2d, 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x13, 0x0 , 0x2 , 0x0 , 0x2f, 0x0 , 0x0 , 
+	0x0 , 0x21, 0x0 , 0x3 , 0x0 , 0x30, 0x0 , 0x0 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 
+	0x20, 0x0 , 0x4 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0xc , 
+	0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 
+	0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x36, 0x0 , 0x0 , 
+	0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x36, 0x0 , 0x0 , 0x0 , 0x34, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x20, 
+	0x0 , 0x4 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 
+	0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 
+	0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 
+	0x43, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0xc , 
+	0x0 , 0x0 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 
+	0x6 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x45, 0x0 , 0x0 , 0x0 , 0x43, 0x0 , 0x0 , 
+	0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x36, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x20, 
+	0x0 , 0x4 , 0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 
+	0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 
+	0xa , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x56, 
+	0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 
+	0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x2c, 0x0 , 0x6 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x59, 0x0 , 0x0 , 0x0 , 
+	0x58, 0x0 , 0x0 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0x20, 
+	0x0 , 0x4 , 0x0 , 0x5b, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x60, 0x0 , 0x0 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x65, 0x0 , 0x0 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x72, 
+	0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x29, 0x0 , 
+	0x3 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x7a, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 
+	0x0 , 0x7c, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0x20, 0x0 , 0x4 , 0x0 , 0x87, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0xb , 
+	0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x4 , 0x0 , 0xa5, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0xa6, 0x0 , 0x0 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0xa5, 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 
+	0xa9, 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x17, 
+	0x0 , 0x4 , 0x0 , 0xad, 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0xb7, 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0xad, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0xc3, 
+	0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 
+	0x6 , 0x0 , 0xd1, 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 
+	0xd2, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0xd1, 0x0 , 0x0 , 0x0 , 0x20, 
+	0x0 , 0x4 , 0x0 , 0xd7, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 
+	0x0 , 0x0 , 0x1e, 0x0 , 0x7 , 0x0 , 0xea, 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 
+	0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0xc , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0xf2, 0x0 , 0x0 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x5 , 0x0 , 0x2f, 0x0 , 
+	0x0 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x30, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x31, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x33, 0x0 , 0x0 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 
+	0x0 , 0x4 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 0x4b, 0x0 , 0x0 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x56, 0x0 , 0x0 , 0x0 , 
+	0x54, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x56, 
+	0x0 , 0x0 , 0x0 , 0x57, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x4 , 0x0 , 0x5b, 0x0 , 0x0 , 0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x72, 0x0 , 0x0 , 0x0 , 0x71, 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x7c, 0x0 , 0x0 , 0x0 , 0x7b, 
+	0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x72, 0x0 , 
+	0x0 , 0x0 , 0x84, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 
+	0x0 , 0x5b, 0x0 , 0x0 , 0x0 , 0x89, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x4 , 0x0 , 0xa6, 0x0 , 0x0 , 0x0 , 0xa4, 0x0 , 0x0 , 0x0 , 0x7 , 
+	0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0xaf, 0x0 , 
+	0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0xb7, 0x0 , 0x0 , 
+	0x0 , 0xb6, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x33, 0x0 , 0x0 , 0x0 , 0xca, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 
+	0x0 , 0x4 , 0x0 , 0xd2, 0x0 , 0x0 , 0x0 , 0xd0, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x37, 0x0 , 0x0 , 
+	0x0 , 0x34, 0x0 , 0x0 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0xc , 0x0 , 0x0 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x5 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 
+	0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 
+	0x0 , 0x3c, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 
+	0xc , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0x3c, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x0 , 0x0 , 0x34, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x3f, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 
+	0x80, 0x0 , 0x5 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x0 , 0x0 , 0x3f, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x32, 0x0 , 
+	0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 
+	0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 
+	0xc , 0x0 , 0x0 , 0x0 , 0x46, 0x0 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0x43, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 
+	0x0 , 0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x49, 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x0 , 0x0 , 
+	0x80, 0x0 , 0x5 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x46, 
+	0x0 , 0x0 , 0x0 , 0x49, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x41, 0x0 , 
+	0x0 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x4b, 0x0 , 0x0 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 
+	0x4d, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x4f, 
+	0x0 , 0x0 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x19, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x0 , 
+	0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x51, 0x0 , 0x0 , 0x0 , 0x4d, 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x0 , 0x0 , 0xf7, 
+	0x0 , 0x3 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 
+	0x4 , 0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0x52, 0x0 , 0x0 , 0x0 , 0x53, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x52, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0x57, 0x0 , 0x0 , 0x0 , 0x59, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x5a, 
+	0x0 , 0x0 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x5d, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x6 , 0x0 , 0x0 , 
+	0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0x5c, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x5f, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0xc , 0x0 , 
+	0x0 , 0x0 , 0x61, 0x0 , 0x0 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0x5f, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x62, 0x0 , 0x0 , 0x0 , 
+	0x41, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x63, 
+	0x0 , 0x0 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0x62, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 
+	0x6 , 0x0 , 0x65, 0x0 , 0x0 , 0x0 , 0x64, 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 
+	0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0xb , 0x0 , 0x0 , 0x0 , 0x66, 0x0 , 0x0 , 0x0 , 0x64, 0x0 , 0x0 , 0x0 , 0x4f, 
+	0x0 , 0x8 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 0x66, 0x0 , 
+	0x0 , 0x0 , 0x66, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x54, 0x0 , 0x0 , 0x0 , 
+	0x67, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x68, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0xc , 0x0 , 
+	0x0 , 0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0x68, 0x0 , 0x0 , 
+	0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x6a, 0x0 , 0x0 , 0x0 , 
+	0x69, 0x0 , 0x0 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xc , 
+	0x0 , 0x0 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 
+	0x5 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x60, 0x0 , 0x0 , 
+	0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 
+	0x6d, 0x0 , 0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x6 , 0x0 , 0x65, 0x0 , 0x0 , 0x0 , 0x6e, 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 
+	0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x6d, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x6f, 0x0 , 0x0 , 0x0 , 0x6e, 0x0 , 0x0 , 0x0 , 
+	0x4f, 0x0 , 0x8 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x70, 0x0 , 0x0 , 0x0 , 0x6f, 
+	0x0 , 0x0 , 0x0 , 0x6f, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x57, 0x0 , 0x0 , 
+	0x0 , 0x70, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xc , 
+	0x0 , 0x0 , 0x0 , 0x73, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 
+	0x6 , 0x0 , 0x65, 0x0 , 0x0 , 0x0 , 0x74, 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 
+	0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x73, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0xb , 0x0 , 0x0 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x74, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0x71, 0x0 , 0x0 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x76, 0x0 , 0x0 , 0x0 , 0x71, 0x0 , 0x0 , 
+	0x0 , 0x4f, 0x0 , 0x8 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x77, 0x0 , 0x0 , 0x0 , 
+	0x76, 0x0 , 0x0 , 0x0 , 0x76, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x54, 0x0 , 
+	0x0 , 0x0 , 0x77, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x5b, 0x0 , 0x0 , 
+	0x0 , 0x78, 0x0 , 0x0 , 0x0 , 0x71, 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x79, 0x0 , 0x0 , 0x0 , 0x78, 
+	0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0x79, 0x0 , 
+	0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 
+	0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 
+	0x7a, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 0x3 , 
+	0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x7d, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 
+	0x2 , 0x0 , 0x7d, 0x0 , 0x0 , 0x0 , 0xf6, 0x0 , 0x4 , 0x0 , 0x81, 0x0 , 0x0 , 
+	0x0 , 0x80, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 
+	0x7e, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x7e, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x0 , 0x0 , 0x7b, 0x0 , 
+	0x0 , 0x0 , 0xb1, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x83, 0x0 , 0x0 , 
+	0x0 , 0x82, 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 
+	0x83, 0x0 , 0x0 , 0x0 , 0x7f, 0x0 , 0x0 , 0x0 , 0x81, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0x7f, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x85, 0x0 , 0x0 , 0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 
+	0x0 , 0x87, 0x0 , 0x0 , 0x0 , 0x86, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 
+	0x3 , 0x0 , 0x0 , 0x0 , 0x85, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xb , 
+	0x0 , 0x0 , 0x0 , 0x88, 0x0 , 0x0 , 0x0 , 0x86, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x3 , 0x0 , 0x84, 0x0 , 0x0 , 0x0 , 0x88, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 
+	0x0 , 0x8c, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 
+	0x6 , 0x0 , 0x0 , 0x0 , 0x8a, 0x0 , 0x0 , 0x0 , 0x8b, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0x8a, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xb , 0x0 , 
+	0x0 , 0x0 , 0x8d, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x0 , 0x0 , 0x4f, 0x0 , 0x8 , 
+	0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x8e, 0x0 , 0x0 , 0x0 , 0x8d, 0x0 , 0x0 , 0x0 , 
+	0x8d, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x6 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x8f, 0x0 , 
+	0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x8e, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x90, 0x0 , 0x0 , 0x0 , 
+	0x57, 0x0 , 0x0 , 0x0 , 0x94, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x91, 
+	0x0 , 0x0 , 0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 0x90, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 
+	0x2 , 0x0 , 0x8c, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x8b, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x92, 0x0 , 0x0 , 0x0 , 
+	0x5a, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x8c, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0x8c, 0x0 , 0x0 , 0x0 , 0xf5, 0x0 , 0x7 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0x93, 0x0 , 0x0 , 0x0 , 0x91, 0x0 , 0x0 , 0x0 , 0x8a, 0x0 , 0x0 , 
+	0x0 , 0x92, 0x0 , 0x0 , 0x0 , 0x8b, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0x89, 0x0 , 0x0 , 0x0 , 0x93, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x94, 0x0 , 0x0 , 0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 
+	0x3 , 0x0 , 0x96, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 
+	0x0 , 0x94, 0x0 , 0x0 , 0x0 , 0x95, 0x0 , 0x0 , 0x0 , 0x96, 0x0 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0x95, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xb , 
+	0x0 , 0x0 , 0x0 , 0x97, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x0 , 0x0 , 0x4f, 0x0 , 
+	0x8 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x98, 0x0 , 0x0 , 0x0 , 0x97, 0x0 , 0x0 , 
+	0x0 , 0x97, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x99, 
+	0x0 , 0x0 , 0x0 , 0x54, 0x0 , 0x0 , 0x0 , 0x94, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0x9a, 0x0 , 0x0 , 0x0 , 0x98, 0x0 , 0x0 , 0x0 , 0x99, 0x0 , 0x0 , 
+	0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x5b, 0x0 , 0x0 , 0x0 , 0x9b, 0x0 , 0x0 , 0x0 , 
+	0x84, 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 
+	0x0 , 0x0 , 0x0 , 0x9c, 0x0 , 0x0 , 0x0 , 0x9b, 0x0 , 0x0 , 0x0 , 0x81, 0x0 , 
+	0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x9d, 0x0 , 0x0 , 0x0 , 0x9a, 0x0 , 0x0 , 
+	0x0 , 0x9c, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 
+	0x9e, 0x0 , 0x0 , 0x0 , 0x89, 0x0 , 0x0 , 0x0 , 0x7f, 0x0 , 0x4 , 0x0 , 0xa , 
+	0x0 , 0x0 , 0x0 , 0x9f, 0x0 , 0x0 , 0x0 , 0x9e, 0x0 , 0x0 , 0x0 , 0xbe, 0x0 , 
+	0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xa0, 0x0 , 0x0 , 0x0 , 0x9d, 0x0 , 0x0 , 
+	0x0 , 0x9f, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x96, 0x0 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0x96, 0x0 , 0x0 , 0x0 , 0xf5, 0x0 , 0x7 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0xa1, 0x0 , 0x0 , 0x0 , 0x94, 0x0 , 0x0 , 0x0 , 0x8c, 0x0 , 
+	0x0 , 0x0 , 0xa0, 0x0 , 0x0 , 0x0 , 0x95, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 
+	0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 0xa1, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 
+	0x80, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x80, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xa2, 0x0 , 0x0 , 0x0 , 0x7b, 0x0 , 
+	0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xa3, 0x0 , 0x0 , 
+	0x0 , 0xa2, 0x0 , 0x0 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0x7b, 0x0 , 0x0 , 0x0 , 0xa3, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x7d, 
+	0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x81, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 
+	0x2 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x53, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xa7, 0x0 , 0x0 , 0x0 , 
+	0x4b, 0x0 , 0x0 , 0x0 , 0x45, 0x11, 0x4 , 0x0 , 0xa9, 0x0 , 0x0 , 0x0 , 0xa8, 
+	0x0 , 0x0 , 0x0 , 0xa7, 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 0x0 , 0xc , 0x0 , 
+	0x0 , 0x0 , 0xaa, 0x0 , 0x0 , 0x0 , 0xa8, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x51, 0x0 , 0x5 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xab, 0x0 , 0x0 , 0x0 , 
+	0xa8, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x5 , 0x0 , 0xad, 
+	0x0 , 0x0 , 0x0 , 0xac, 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x0 , 0x0 , 0xab, 0x0 , 
+	0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0xa5, 0x0 , 0x0 , 0x0 , 0xae, 0x0 , 0x0 , 
+	0x0 , 0xac, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xa4, 0x0 , 0x0 , 0x0 , 
+	0xae, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xaf, 0x0 , 0x0 , 0x0 , 0xb0, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0xb1, 0x0 , 
+	0x0 , 0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xb2, 0x0 , 0x0 , 0x0 , 0xb1, 0x0 , 0x0 , 0x0 , 
+	0xaa, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xb3, 0x0 , 0x0 , 0x0 , 0xb2, 
+	0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0xb5, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0xb3, 0x0 , 0x0 , 
+	0x0 , 0xb4, 0x0 , 0x0 , 0x0 , 0xb5, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0xb4, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa5, 0x0 , 0x0 , 0x0 , 0xb8, 
+	0x0 , 0x0 , 0x0 , 0xa4, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0xad, 0x0 , 
+	0x0 , 0x0 , 0xb9, 0x0 , 0x0 , 0x0 , 0xb8, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 
+	0x0 , 0xb6, 0x0 , 0x0 , 0x0 , 0xb9, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 
+	0x33, 0x0 , 0x0 , 0x0 , 0xba, 0x0 , 0x0 , 0x0 , 0xb6, 0x0 , 0x0 , 0x0 , 0x3 , 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xbb, 0x0 , 
+	0x0 , 0x0 , 0xba, 0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0xbc, 0x0 , 0x0 , 0x0 , 0xbb, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 
+	0x33, 0x0 , 0x0 , 0x0 , 0xbd, 0x0 , 0x0 , 0x0 , 0xb6, 0x0 , 0x0 , 0x0 , 0x19, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xbe, 0x0 , 
+	0x0 , 0x0 , 0xbd, 0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0xbf, 0x0 , 0x0 , 0x0 , 0xbe, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0xc0, 0x0 , 0x0 , 0x0 , 0xbc, 0x0 , 0x0 , 0x0 , 0xbf, 
+	0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xc1, 0x0 , 
+	0x0 , 0x0 , 0xc0, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0xc3, 0x0 , 0x0 , 
+	0x0 , 0xc2, 0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 
+	0xea, 0x0 , 0x7 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xc4, 0x0 , 0x0 , 0x0 , 0xc2, 
+	0x0 , 0x0 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x0 , 0x0 , 0xc1, 0x0 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xaf, 0x0 , 0x0 , 0x0 , 0xc4, 0x0 , 0x0 , 
+	0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xb5, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0xb5, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xc5, 
+	0x0 , 0x0 , 0x0 , 0xaf, 0x0 , 0x0 , 0x0 , 0x46, 0x11, 0x4 , 0x0 , 0xc , 0x0 , 
+	0x0 , 0x0 , 0xc6, 0x0 , 0x0 , 0x0 , 0xc5, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 
+	0x0 , 0xaf, 0x0 , 0x0 , 0x0 , 0xc6, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0xc7, 0x0 , 0x0 , 0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 0xf7, 
+	0x0 , 0x3 , 0x0 , 0xc9, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 
+	0x4 , 0x0 , 0xc7, 0x0 , 0x0 , 0x0 , 0xc8, 0x0 , 0x0 , 0x0 , 0xc9, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xc8, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0xc , 0x0 , 0x0 , 0x0 , 0xcb, 0x0 , 0x0 , 0x0 , 0xaf, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0xa5, 0x0 , 0x0 , 0x0 , 0xcc, 0x0 , 0x0 , 0x0 , 0xa4, 0x0 , 
+	0x0 , 0x0 , 0xc , 0x0 , 0x6 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xce, 0x0 , 0x0 , 
+	0x0 , 0xcd, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xcc, 0x0 , 0x0 , 0x0 , 
+	0x80, 0x0 , 0x5 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xcf, 0x0 , 0x0 , 0x0 , 0xcb, 
+	0x0 , 0x0 , 0x0 , 0xce, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xca, 0x0 , 
+	0x0 , 0x0 , 0xcf, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 
+	0x0 , 0xd3, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 
+	0xc3, 0x0 , 0x0 , 0x0 , 0xd4, 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x3 , 
+	0x0 , 0x0 , 0x0 , 0xd3, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 
+	0x0 , 0x0 , 0xd5, 0x0 , 0x0 , 0x0 , 0xd4, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 
+	0x0 , 0xd7, 0x0 , 0x0 , 0x0 , 0xd6, 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 
+	0x3 , 0x0 , 0x0 , 0x0 , 0xd5, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x1b, 
+	0x0 , 0x0 , 0x0 , 0xd8, 0x0 , 0x0 , 0x0 , 0xd6, 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 
+	0x5 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xd9, 0x0 , 0x0 , 0x0 , 0xd8, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 
+	0xda, 0x0 , 0x0 , 0x0 , 0xd8, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x51, 
+	0x0 , 0x5 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xdb, 0x0 , 0x0 , 0x0 , 0xd8, 0x0 , 
+	0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 0x0 , 0xc , 0x0 , 0x0 , 
+	0x0 , 0xdc, 0x0 , 0x0 , 0x0 , 0xd8, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 
+	0x50, 0x0 , 0x7 , 0x0 , 0xd1, 0x0 , 0x0 , 0x0 , 0xdd, 0x0 , 0x0 , 0x0 , 0xd9, 
+	0x0 , 0x0 , 0x0 , 0xda, 0x0 , 0x0 , 0x0 , 0xdb, 0x0 , 0x0 , 0x0 , 0xdc, 0x0 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xd0, 0x0 , 0x0 , 0x0 , 0xdd, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xde, 0x0 , 0x0 , 0x0 , 
+	0xca, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xdf, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0xc3, 0x0 , 
+	0x0 , 0x0 , 0xe0, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 
+	0x0 , 0xde, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xe0, 0x0 , 0x0 , 0x0 , 
+	0xdf, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xe1, 
+	0x0 , 0x0 , 0x0 , 0xca, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x33, 0x0 , 
+	0x0 , 0x0 , 0xe2, 0x0 , 0x0 , 0x0 , 0xd0, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xe3, 0x0 , 0x0 , 0x0 , 
+	0xe2, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0xe4, 
+	0x0 , 0x0 , 0x0 , 0xd0, 0x0 , 0x0 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xe5, 0x0 , 0x0 , 0x0 , 0xe4, 0x0 , 0x0 , 
+	0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x7c, 0x0 , 0x0 , 0x0 , 0xe6, 0x0 , 0x0 , 0x0 , 
+	0xd0, 0x0 , 0x0 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0xe7, 0x0 , 0x0 , 0x0 , 0xe6, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xe8, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x0 , 
+	0x0 , 0x50, 0x0 , 0x8 , 0x0 , 0xea, 0x0 , 0x0 , 0x0 , 0xe9, 0x0 , 0x0 , 0x0 , 
+	0xe3, 0x0 , 0x0 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0xe5, 0x0 , 0x0 , 0x0 , 0xe7, 
+	0x0 , 0x0 , 0x0 , 0xe8, 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 0x0 , 0xc , 0x0 , 
+	0x0 , 0x0 , 0xeb, 0x0 , 0x0 , 0x0 , 0xe9, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x51, 0x0 , 0x5 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xec, 0x0 , 0x0 , 0x0 , 
+	0xe9, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 0x0 , 0xc , 
+	0x0 , 0x0 , 0x0 , 0xed, 0x0 , 0x0 , 0x0 , 0xe9, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x51, 0x0 , 0x5 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xee, 0x0 , 0x0 , 
+	0x0 , 0xe9, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 0x0 , 
+	0xc , 0x0 , 0x0 , 0x0 , 0xef, 0x0 , 0x0 , 0x0 , 0xe9, 0x0 , 0x0 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x8 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0xf0, 0x0 , 
+	0x0 , 0x0 , 0xeb, 0x0 , 0x0 , 0x0 , 0xec, 0x0 , 0x0 , 0x0 , 0xed, 0x0 , 0x0 , 
+	0x0 , 0xee, 0x0 , 0x0 , 0x0 , 0xef, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 
+	0xf2, 0x0 , 0x0 , 0x0 , 0xf1, 0x0 , 0x0 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x3 , 
+	0x0 , 0x0 , 0x0 , 0xe1, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xf1, 0x0 , 
+	0x0 , 0x0 , 0xf0, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xc9, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xc9, 0x0 , 0x0 , 0x0 , 0xfd, 0x0 , 0x1 , 0x0 , 
+	0x38, 0x0 , 0x1 , 0x0 , 
+};
+const unsigned char Extract2DShader [] = {
+	0x3 , 0x2 , 0x23, 0x7 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xb4, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x2 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x11, 0x0 , 0x2 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x2 , 
+	0x0 , 0x47, 0x11, 0x0 , 0x0 , 0xa , 0x0 , 0x7 , 0x0 , 0x53, 0x50, 0x56, 0x5f, 
+	0x4b, 0x48, 0x52, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 
+	0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x7 , 0x0 , 0x53, 0x50, 
+	0x56, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 
+	0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x6 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 
+	0x34, 0x35, 0x30, 0x0 , 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x8 , 0x0 , 0x99, 0x0 , 
+	0x0 , 0x0 , 0x53, 0x50, 0x56, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 0x73, 0x68, 0x61, 
+	0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 
+	0xe , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0xf , 
+	0x0 , 0x8 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 
+	0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x29, 0x0 , 0x0 , 
+	0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x6 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 
+	0x11, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x3 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xc2, 0x1 , 
+	0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 
+	0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 0x5f, 0x41, 0x52, 
+	0x42, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 
+	0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 0x5f, 
+	0x41, 0x52, 0x42, 0x5f, 0x67, 0x70, 0x75, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 
+	0x72, 0x5f, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x1d, 
+	0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x74, 0x69, 0x6c, 0x65, 0x57, 0x69, 0x64, 
+	0x74, 0x68, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 
+	0x74, 0x69, 0x6c, 0x65, 0x48, 0x65, 0x69, 0x67, 0x68, 0x74, 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x5 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 
+	0x74, 0x65, 0x72, 0x73, 0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0xe , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x72, 0x65, 0x67, 0x69, 0x6f, 0x6e, 0x4f, 0x72, 
+	0x69, 0x67, 0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0xe , 
+	0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x72, 0x65, 0x67, 0x69, 0x6f, 0x6e, 
+	0x53, 0x69, 0x7a, 0x65, 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0xe , 0x0 , 0x0 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x72, 0x6f, 0x77, 0x50, 0x69, 0x74, 0x63, 0x68, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x3 , 
+	0x0 , 0x0 , 0x0 , 0x74, 0x68, 0x72, 0x65, 0x73, 0x68, 0x6f, 0x6c, 0x64, 0x0 , 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x43, 0x61, 0x70, 0x61, 0x63, 0x69, 
+	0x74, 0x79, 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x70, 
+	0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x5 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x69, 0x6d, 0x61, 0x67, 0x65, 0x44, 0x61, 
+	0x74, 0x61, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x69, 0x6d, 0x61, 0x67, 0x65, 0x41, 0x72, 0x72, 0x61, 
+	0x79, 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x72, 0x65, 
+	0x63, 0x6f, 0x72, 0x64, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 
+	0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x72, 0x65, 0x63, 0x6f, 
+	0x72, 0x64, 0x41, 0x72, 0x72, 0x61, 0x79, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x1a, 
+	0x0 , 0x0 , 0x0 , 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x44, 0x61, 0x74, 
+	0x61, 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x0 , 
+	0x5 , 0x0 , 0x5 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x67, 0x72, 0x6f, 0x75, 0x70, 
+	0x49, 0x6e, 0x64, 0x65, 0x78, 0x0 , 0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 0x23, 0x0 , 
+	0x0 , 0x0 , 0x67, 0x6c, 0x5f, 0x57, 0x6f, 0x72, 0x6b, 0x47, 0x72, 0x6f, 0x75, 
+	0x70, 0x49, 0x44, 0x0 , 0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 
+	0x67, 0x6c, 0x5f, 0x4e, 0x75, 0x6d, 0x57, 0x6f, 0x72, 0x6b, 0x47, 0x72, 0x6f, 
+	0x75, 0x70, 0x73, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x30, 0x0 , 
+	0x0 , 0x0 , 0x74, 0x69, 0x6c, 0x65, 0x73, 0x50, 0x65, 0x72, 0x52, 0x6f, 0x77, 
+	0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x74, 0x69, 0x6c, 0x65, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x6c, 
+	0x6f, 0x63, 0x61, 0x6c, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 0x42, 0x0 , 
+	0x0 , 0x0 , 0x67, 0x6c, 0x5f, 0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x49, 0x6e, 0x76, 
+	0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x5 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x70, 0x6f, 0x73, 0x69, 0x74, 
+	0x69, 0x6f, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 0x50, 0x0 , 
+	0x0 , 0x0 , 0x74, 0x68, 0x69, 0x73, 0x4c, 0x61, 0x6e, 0x65, 0x44, 0x61, 0x74, 
+	0x61, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 
+	0x6c, 0x61, 0x6e, 0x65, 0x41, 0x63, 0x74, 0x69, 0x76, 0x65, 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x4 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x73, 0x6b, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x7f, 0x0 , 0x0 , 0x0 , 0x77, 0x61, 0x76, 
+	0x65, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 
+	0x86, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x73, 0x6b, 0x50, 0x61, 0x72, 0x74, 0x73, 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x96, 0x0 , 0x0 , 0x0 , 0x73, 0x6c, 
+	0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 
+	0xe , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 
+	0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 
+	0x10, 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x3 , 
+	0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 
+	0x5 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 
+	0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x6 , 
+	0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x12, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 
+	0x47, 0x0 , 0x4 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x15, 0x0 , 0x0 , 
+	0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 
+	0x16, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 
+	0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 
+	0x21, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x1a, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 
+	0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x21, 
+	0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 
+	0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 
+	0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 
+	0x47, 0x0 , 0x4 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x1b, 
+	0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 
+	0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x15, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 
+	0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x32, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 
+	0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 
+	0x0 , 0x34, 0x0 , 0x6 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 
+	0x86, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x17, 
+	0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x16, 0x0 , 0x3 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 
+	0x0 , 0x1e, 0x0 , 0x7 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 
+	0xc , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 
+	0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0xf , 0x0 , 0x0 , 
+	0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x3 , 0x0 , 
+	0x11, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0x12, 
+	0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x13, 0x0 , 
+	0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 
+	0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0x1d, 0x0 , 0x3 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x1e, 
+	0x0 , 0x3 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 
+	0x4 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x18, 
+	0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0x1a, 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x1b, 0x0 , 0x0 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x1b, 0x0 , 0x0 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 
+	0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x13, 0x0 , 0x2 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x3 , 
+	0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 
+	0x22, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x17, 
+	0x0 , 0x4 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 
+	0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 
+	0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 
+	0x23, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x27, 
+	0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x4 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 
+	0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x35, 
+	0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x39, 0x0 , 
+	0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 
+	0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 
+	0x20, 0x0 , 0x4 , 0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0xd , 
+	0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x52, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 0x2 , 0x0 , 0x54, 0x0 , 0x0 , 
+	0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x54, 0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 0x3 , 0x0 , 0x54, 0x0 , 0x0 , 0x0 , 0x56, 
+	0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x59, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 
+	0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0x5c, 0x0 , 0x0 , 
+	0x0 , 0x54, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 
+	0x6d, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x2b, 
+	0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x70, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 
+	0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x72, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 
+	0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x4 , 0x0 , 0x76, 0x0 , 0x0 , 0x0 , 
+	0x40, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x77, 
+	0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x76, 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 
+	0x4 , 0x0 , 0x7a, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x92, 0x0 , 0x0 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0xa0, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xac, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 
+	0x20, 0x0 , 0x4 , 0x0 , 0xb3, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xc , 
+	0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x5 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 
+	0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 
+	0x21, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x22, 
+	0x0 , 0x0 , 0x0 , 0x30, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x4 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0x4a, 
+	0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x51, 0x0 , 
+	0x0 , 0x0 , 0x50, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 
+	0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x4 , 0x0 , 0x77, 0x0 , 0x0 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x7 , 
+	0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x7f, 0x0 , 
+	0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x39, 0x0 , 0x0 , 
+	0x0 , 0x86, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x22, 0x0 , 0x0 , 0x0 , 0x96, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x5 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 
+	0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 
+	0x27, 0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x3 , 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 
+	0x0 , 0x0 , 0x2a, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 
+	0x41, 0x0 , 0x5 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0x23, 
+	0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 
+	0x2e, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x2f, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x31, 0x0 , 
+	0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 
+	0x31, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x34, 
+	0x0 , 0x0 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x82, 0x0 , 
+	0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x34, 0x0 , 0x0 , 
+	0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x86, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x37, 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0x30, 0x0 , 0x0 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x0 , 0x0 , 
+	0x30, 0x0 , 0x0 , 0x0 , 0x89, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3c, 
+	0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 
+	0x30, 0x0 , 0x0 , 0x0 , 0x86, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3f, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 
+	0x5 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x3c, 0x0 , 0x0 , 
+	0x0 , 0x3f, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 
+	0x40, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x43, 
+	0x0 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0x43, 0x0 , 0x0 , 
+	0x0 , 0x89, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x45, 0x0 , 0x0 , 0x0 , 
+	0x44, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x27, 
+	0x0 , 0x0 , 0x0 , 0x46, 0x0 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x0 , 
+	0x0 , 0x46, 0x0 , 0x0 , 0x0 , 0x86, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x48, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x50, 
+	0x0 , 0x5 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x49, 0x0 , 0x0 , 0x0 , 0x45, 0x0 , 
+	0x0 , 0x0 , 0x48, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x41, 0x0 , 0x0 , 
+	0x0 , 0x49, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 
+	0x4b, 0x0 , 0x0 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x5 , 0x0 , 0xc , 
+	0x0 , 0x0 , 0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x4d, 0x0 , 0x0 , 
+	0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0xc , 0x0 , 0x0 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x80, 
+	0x0 , 0x5 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0x4d, 0x0 , 
+	0x0 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x4a, 0x0 , 0x0 , 
+	0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x50, 0x0 , 0x0 , 0x0 , 
+	0x52, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 0x56, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x57, 0x0 , 
+	0x0 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x59, 0x0 , 0x0 , 
+	0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0x58, 
+	0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0x5b, 0x0 , 
+	0x0 , 0x0 , 0x57, 0x0 , 0x0 , 0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0x9b, 0x0 , 0x4 , 
+	0x0 , 0x54, 0x0 , 0x0 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 0x5b, 0x0 , 0x0 , 0x0 , 
+	0xf7, 0x0 , 0x3 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 
+	0x0 , 0x4 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 0x5f, 0x0 , 
+	0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 
+	0x0 , 0x59, 0x0 , 0x0 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 
+	0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x61, 
+	0x0 , 0x0 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xc , 0x0 , 
+	0x0 , 0x0 , 0x62, 0x0 , 0x0 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 
+	0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0x62, 0x0 , 0x0 , 0x0 , 
+	0x61, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x63, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x64, 0x0 , 
+	0x0 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x65, 0x0 , 0x0 , 0x0 , 0x64, 0x0 , 0x0 , 0x0 , 
+	0x41, 0x0 , 0x5 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x66, 0x0 , 0x0 , 0x0 , 0xb , 
+	0x0 , 0x0 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 0x66, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x5 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x68, 0x0 , 0x0 , 0x0 , 0x65, 0x0 , 0x0 , 0x0 , 
+	0x67, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x69, 
+	0x0 , 0x0 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x6a, 0x0 , 0x0 , 0x0 , 0x69, 0x0 , 0x0 , 
+	0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 
+	0x68, 0x0 , 0x0 , 0x0 , 0x6a, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x6d, 
+	0x0 , 0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 
+	0x0 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xd , 0x0 , 0x0 , 
+	0x0 , 0x6e, 0x0 , 0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0x50, 0x0 , 0x0 , 0x0 , 0x6e, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xd , 
+	0x0 , 0x0 , 0x0 , 0x6f, 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 
+	0x5 , 0x0 , 0x72, 0x0 , 0x0 , 0x0 , 0x71, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 
+	0x0 , 0x70, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 
+	0x73, 0x0 , 0x0 , 0x0 , 0x71, 0x0 , 0x0 , 0x0 , 0xba, 0x0 , 0x5 , 0x0 , 0x54, 
+	0x0 , 0x0 , 0x0 , 0x74, 0x0 , 0x0 , 0x0 , 0x6f, 0x0 , 0x0 , 0x0 , 0x73, 0x0 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 0x74, 0x0 , 0x0 , 
+	0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0x5f, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x54, 0x0 , 0x0 , 0x0 , 0x78, 
+	0x0 , 0x0 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 0x45, 0x11, 0x4 , 0x0 , 0x7a, 0x0 , 
+	0x0 , 0x0 , 0x79, 0x0 , 0x0 , 0x0 , 0x78, 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 0x79, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x7c, 
+	0x0 , 0x0 , 0x0 , 0x79, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 
+	0x5 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x7d, 0x0 , 0x0 , 0x0 , 0x7b, 0x0 , 0x0 , 
+	0x0 , 0x7c, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x76, 0x0 , 0x0 , 0x0 , 
+	0x7e, 0x0 , 0x0 , 0x0 , 0x7d, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x75, 
+	0x0 , 0x0 , 0x0 , 0x7e, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x7f, 0x0 , 
+	0x0 , 0x0 , 0x80, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x27, 0x0 , 0x0 , 
+	0x0 , 0x81, 0x0 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x0 , 0x0 , 0x81, 
+	0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x5 , 0x0 , 0x54, 0x0 , 0x0 , 0x0 , 0x83, 0x0 , 
+	0x0 , 0x0 , 0x82, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 
+	0x0 , 0x85, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 
+	0x83, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x0 , 0x0 , 0x85, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0x84, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x76, 0x0 , 
+	0x0 , 0x0 , 0x87, 0x0 , 0x0 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 
+	0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x88, 0x0 , 0x0 , 0x0 , 0x87, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x86, 0x0 , 0x0 , 0x0 , 0x88, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x5 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x89, 0x0 , 0x0 , 0x0 , 0x86, 0x0 , 
+	0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x8a, 0x0 , 0x0 , 0x0 , 0x89, 0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 0x4 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x8b, 0x0 , 0x0 , 0x0 , 0x8a, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x5 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x8c, 0x0 , 0x0 , 0x0 , 0x86, 0x0 , 
+	0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x8d, 0x0 , 0x0 , 0x0 , 0x8c, 0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 0x4 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x8e, 0x0 , 0x0 , 0x0 , 0x8d, 0x0 , 0x0 , 0x0 , 0x80, 
+	0x0 , 0x5 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 0x8b, 0x0 , 
+	0x0 , 0x0 , 0x8e, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x90, 0x0 , 0x0 , 0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 
+	0x92, 0x0 , 0x0 , 0x0 , 0x91, 0x0 , 0x0 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x3 , 
+	0x0 , 0x0 , 0x0 , 0xea, 0x0 , 0x7 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x93, 0x0 , 
+	0x0 , 0x0 , 0x91, 0x0 , 0x0 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x0 , 
+	0x0 , 0x90, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x7f, 0x0 , 0x0 , 0x0 , 
+	0x93, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x85, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0x85, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 
+	0x0 , 0x0 , 0x94, 0x0 , 0x0 , 0x0 , 0x7f, 0x0 , 0x0 , 0x0 , 0x46, 0x11, 0x4 , 
+	0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x95, 0x0 , 0x0 , 0x0 , 0x94, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x7f, 0x0 , 0x0 , 0x0 , 0x95, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x97, 0x0 , 0x0 , 0x0 , 0x7f, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x76, 0x0 , 0x0 , 0x0 , 0x98, 0x0 , 0x0 , 
+	0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x6 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x9a, 0x0 , 0x0 , 0x0 , 0x99, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x98, 
+	0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x9b, 0x0 , 
+	0x0 , 0x0 , 0x97, 0x0 , 0x0 , 0x0 , 0x9a, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 
+	0x0 , 0x96, 0x0 , 0x0 , 0x0 , 0x9b, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x54, 0x0 , 0x0 , 0x0 , 0x9c, 0x0 , 0x0 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 0xf7, 
+	0x0 , 0x3 , 0x0 , 0x9e, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 
+	0x4 , 0x0 , 0x9c, 0x0 , 0x0 , 0x0 , 0x9d, 0x0 , 0x0 , 0x0 , 0x9e, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x9d, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x9f, 0x0 , 0x0 , 0x0 , 0x96, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x5 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0xa1, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 
+	0x0 , 0x0 , 0xa0, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0xa2, 0x0 , 0x0 , 0x0 , 0xa1, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 
+	0x54, 0x0 , 0x0 , 0x0 , 0xa3, 0x0 , 0x0 , 0x0 , 0x9f, 0x0 , 0x0 , 0x0 , 0xa2, 
+	0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x9e, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 
+	0x2 , 0x0 , 0x9e, 0x0 , 0x0 , 0x0 , 0xf5, 0x0 , 0x7 , 0x0 , 0x54, 0x0 , 0x0 , 
+	0x0 , 0xa4, 0x0 , 0x0 , 0x0 , 0x9c, 0x0 , 0x0 , 0x0 , 0x85, 0x0 , 0x0 , 0x0 , 
+	0xa3, 0x0 , 0x0 , 0x0 , 0x9d, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0xa6, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0xa4, 0x0 , 
+	0x0 , 0x0 , 0xa5, 0x0 , 0x0 , 0x0 , 0xa6, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 
+	0x0 , 0xa5, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0xa7, 0x0 , 0x0 , 0x0 , 0x96, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x22, 
+	0x0 , 0x0 , 0x0 , 0xa8, 0x0 , 0x0 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xa9, 0x0 , 0x0 , 
+	0x0 , 0xa8, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 
+	0xaa, 0x0 , 0x0 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xab, 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 
+	0x0 , 0x0 , 0xc4, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xad, 0x0 , 0x0 , 
+	0x0 , 0xab, 0x0 , 0x0 , 0x0 , 0xac, 0x0 , 0x0 , 0x0 , 0xc5, 0x0 , 0x5 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0xae, 0x0 , 0x0 , 0x0 , 0xa9, 0x0 , 0x0 , 0x0 , 0xad, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0xaf, 0x0 , 
+	0x0 , 0x0 , 0x50, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0xb0, 0x0 , 0x0 , 0x0 , 0xaf, 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x5 , 0x0 , 
+	0xc , 0x0 , 0x0 , 0x0 , 0xb1, 0x0 , 0x0 , 0x0 , 0xae, 0x0 , 0x0 , 0x0 , 0xb0, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0xb3, 0x0 , 0x0 , 0x0 , 0xb2, 0x0 , 
+	0x0 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0xa7, 0x0 , 0x0 , 
+	0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xb2, 0x0 , 0x0 , 0x0 , 0xb1, 0x0 , 0x0 , 0x0 , 
+	0xf9, 0x0 , 0x2 , 0x0 , 0xa6, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xa6, 
+	0x0 , 0x0 , 0x0 , 0xfd, 0x0 , 0x1 , 0x0 , 0x38, 0x0 , 0x1 , 0x0 , 
+};
+const unsigned char TextClassifyShader [] = {
+	0x3 , 0x2 , 0x23, 0x7 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xd0, 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x2 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x11, 0x0 , 0x2 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x2 , 
+	0x0 , 0x47, 0x11, 0x0 , 0x0 , 0xa , 0x0 , 0x7 , 0x0 , 0x53, 0x50, 0x56, 0x5f, 
+	0x4b, 0x48, 0x52, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 
+	0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x7 , 0x0 , 0x53, 0x50, 
+	0x56, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 
+	0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x6 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 
+	0x34, 0x35, 0x30, 0x0 , 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x8 , 0x0 , 0x5c, 0x1 , 
+	0x0 , 0x0 , 0x53, 0x50, 0x56, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 0x73, 0x68, 0x61, 
+	0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 
+	0xe , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0xf , 
+	0x0 , 0x8 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x9f, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 
+	0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0xa3, 0x0 , 0x0 , 0x0 , 0xa9, 0x0 , 0x0 , 
+	0x0 , 0xb8, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x6 , 0x0 , 0x9f, 0x0 , 0x0 , 0x0 , 
+	0x11, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x3 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xc2, 0x1 , 
+	0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 
+	0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 0x5f, 0x41, 0x52, 
+	0x42, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 
+	0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 0x5f, 
+	0x41, 0x52, 0x42, 0x5f, 0x67, 0x70, 0x75, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 
+	0x72, 0x5f, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x9f, 
+	0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x6 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x77, 0x72, 0x69, 0x74, 0x65, 0x4f, 0x66, 
+	0x66, 0x73, 0x65, 0x74, 0x73, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 
+	0x8 , 0x0 , 0x0 , 0x0 , 0x77, 0x69, 0x64, 0x65, 0x4f, 0x66, 0x66, 0x73, 0x65, 
+	0x74, 0x73, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x50, 0x61, 
+	0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 
+	0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x62, 0x79, 0x74, 0x65, 
+	0x43, 0x6f, 0x75, 0x6e, 0x74, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0xf , 
+	0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x74, 0x69, 0x6c, 0x65, 0x43, 0x6f, 
+	0x75, 0x6e, 0x74, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0xf , 0x0 , 0x0 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x49, 0x6e, 
+	0x51, 0x75, 0x6f, 0x74, 0x65, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0xf , 
+	0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 
+	0x43, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 
+	0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x62, 0x61, 0x73, 0x65, 
+	0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0xf , 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x64, 0x65, 0x6c, 0x69, 0x6d, 0x69, 
+	0x74, 0x65, 0x72, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x5 , 0x0 , 0xf , 0x0 , 0x0 , 
+	0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x71, 0x75, 0x6f, 0x74, 0x65, 0x0 , 0x0 , 0x0 , 
+	0x6 , 0x0 , 0x5 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x6e, 
+	0x65, 0x77, 0x6c, 0x69, 0x6e, 0x65, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0xd , 0x0 , 
+	0x0 , 0x0 , 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0 , 
+	0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x74, 0x65, 0x78, 0x74, 
+	0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x13, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x74, 0x65, 0x78, 0x74, 0x41, 0x72, 
+	0x72, 0x61, 0x79, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x18, 0x0 , 0x0 , 
+	0x0 , 0x74, 0x69, 0x6c, 0x65, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x6 , 0x0 , 0x6 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x74, 
+	0x69, 0x6c, 0x65, 0x41, 0x72, 0x72, 0x61, 0x79, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x5 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x44, 
+	0x61, 0x74, 0x61, 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x41, 0x72, 0x72, 
+	0x61, 0x79, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x72, 0x65, 
+	0x73, 0x75, 0x6c, 0x74, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 
+	0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x6f, 0x75, 0x74, 0x70, 
+	0x75, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x1f, 
+	0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x65, 0x6e, 0x64, 0x73, 0x49, 0x6e, 
+	0x51, 0x75, 0x6f, 0x74, 0x65, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x22, 0x0 , 0x0 , 
+	0x0 , 0x42, 0x69, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x36, 0x34, 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x4 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x73, 0x6b, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 
+	0x73, 0x6b, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x29, 0x0 , 0x0 , 
+	0x0 , 0x6d, 0x61, 0x73, 0x6b, 0x50, 0x61, 0x72, 0x74, 0x73, 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x5 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x50, 0x72, 0x65, 0x66, 0x69, 
+	0x78, 0x58, 0x6f, 0x72, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x38, 0x0 , 
+	0x0 , 0x0 , 0x6d, 0x61, 0x73, 0x6b, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 
+	0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x73, 0x6b, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x5 , 0x0 , 0x57, 0x0 , 0x0 , 0x0 , 0x49, 0x6e, 0x73, 0x69, 0x64, 
+	0x65, 0x42, 0x69, 0x74, 0x73, 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x59, 0x0 , 
+	0x0 , 0x0 , 0x71, 0x75, 0x6f, 0x74, 0x65, 0x42, 0x69, 0x74, 0x73, 0x0 , 0x0 , 
+	0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0x73, 0x74, 0x61, 0x74, 
+	0x65, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0x71, 
+	0x75, 0x6f, 0x74, 0x65, 0x42, 0x69, 0x74, 0x73, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x4 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 0x73, 0x74, 0x61, 0x74, 0x65, 0x0 , 0x0 , 
+	0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 0x72, 0x65, 0x73, 0x75, 
+	0x6c, 0x74, 0x0 , 0x0 , 0x5 , 0x0 , 0x3 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0x6b, 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x78, 0x0 , 0x0 , 0x0 , 0x57, 0x72, 
+	0x69, 0x74, 0x65, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x0 , 0x5 , 0x0 , 0x4 , 
+	0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 0x73, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x5 , 0x0 , 0x7c, 0x0 , 0x0 , 0x0 , 0x70, 0x6f, 0x73, 0x69, 0x74, 
+	0x69, 0x6f, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x7e, 0x0 , 
+	0x0 , 0x0 , 0x73, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 
+	0x0 , 0x7f, 0x0 , 0x0 , 0x0 , 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x80, 0x0 , 0x0 , 0x0 , 0x6f, 
+	0x66, 0x66, 0x73, 0x65, 0x74, 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x8b, 0x0 , 
+	0x0 , 0x0 , 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x50, 0x61, 0x72, 0x74, 0x73, 
+	0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0xa2, 0x0 , 0x0 , 0x0 , 0x67, 0x72, 0x6f, 0x75, 
+	0x70, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x0 , 0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 0xa3, 
+	0x0 , 0x0 , 0x0 , 0x67, 0x6c, 0x5f, 0x57, 0x6f, 0x72, 0x6b, 0x47, 0x72, 0x6f, 
+	0x75, 0x70, 0x49, 0x44, 0x0 , 0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0xa9, 0x0 , 0x0 , 
+	0x0 , 0x67, 0x6c, 0x5f, 0x4e, 0x75, 0x6d, 0x57, 0x6f, 0x72, 0x6b, 0x47, 0x72, 
+	0x6f, 0x75, 0x70, 0x73, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0xb7, 
+	0x0 , 0x0 , 0x0 , 0x6c, 0x61, 0x6e, 0x65, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x8 , 0x0 , 0xb8, 0x0 , 0x0 , 0x0 , 0x67, 0x6c, 0x5f, 0x4c, 0x6f, 0x63, 0x61, 
+	0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0xbb, 0x0 , 0x0 , 0x0 , 0x73, 
+	0x74, 0x61, 0x74, 0x65, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0xbc, 0x0 , 
+	0x0 , 0x0 , 0x73, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 
+	0x0 , 0xbf, 0x0 , 0x0 , 0x0 , 0x74, 0x69, 0x6c, 0x65, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x6 , 0x0 , 0xc9, 0x0 , 0x0 , 0x0 , 0x63, 0x6f, 0x75, 0x6e, 0x74, 
+	0x4f, 0x75, 0x74, 0x73, 0x69, 0x64, 0x65, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x5 , 0x0 , 0xca, 0x0 , 0x0 , 0x0 , 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x49, 0x6e, 
+	0x73, 0x69, 0x64, 0x65, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0xcb, 0x0 , 0x0 , 0x0 , 
+	0x73, 0x74, 0x65, 0x70, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0xd3, 
+	0x0 , 0x0 , 0x0 , 0x77, 0x6f, 0x72, 0x64, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0xdc, 0x0 , 0x0 , 0x0 , 0x66, 0x69, 0x72, 
+	0x73, 0x74, 0x42, 0x79, 0x74, 0x65, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 
+	0xdf, 0x0 , 0x0 , 0x0 , 0x71, 0x75, 0x6f, 0x74, 0x65, 0x42, 0x69, 0x74, 0x73, 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0xe0, 0x0 , 0x0 , 0x0 , 0x6f, 0x74, 
+	0x68, 0x65, 0x72, 0x42, 0x69, 0x74, 0x73, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 
+	0x0 , 0xe7, 0x0 , 0x0 , 0x0 , 0x77, 0x6f, 0x72, 0x64, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x5 , 0x0 , 0xeb, 0x0 , 0x0 , 0x0 , 0x76, 0x61, 0x6c, 0x69, 0x64, 
+	0x42, 0x79, 0x74, 0x65, 0x73, 0x0 , 0x0 , 0x5 , 0x0 , 0x3 , 0x0 , 0xf1, 0x0 , 
+	0x0 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x3 , 0x0 , 0xfa, 0x0 , 0x0 , 
+	0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x21, 0x1 , 0x0 , 0x0 , 
+	0x70, 0x61, 0x72, 0x69, 0x74, 0x79, 0x4d, 0x61, 0x73, 0x6b, 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x4 , 0x0 , 0x2b, 0x1 , 0x0 , 0x0 , 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x30, 0x1 , 0x0 , 0x0 , 0x6c, 0x61, 0x6e, 
+	0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 
+	0x38, 0x1 , 0x0 , 0x0 , 0x69, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x6 , 0x0 , 0x3c, 0x1 , 0x0 , 0x0 , 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 
+	0x75, 0x72, 0x61, 0x6c, 0x42, 0x69, 0x74, 0x73, 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 
+	0x0 , 0x46, 0x1 , 0x0 , 0x0 , 0x72, 0x61, 0x6e, 0x6b, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x5 , 0x0 , 0x47, 0x1 , 0x0 , 0x0 , 0x73, 0x74, 0x65, 0x70, 0x43, 
+	0x6f, 0x75, 0x6e, 0x74, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x3 , 0x0 , 0x48, 0x1 , 
+	0x0 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x50, 0x1 , 0x0 , 
+	0x0 , 0x6d, 0x61, 0x73, 0x6b, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x3 , 0x0 , 
+	0x66, 0x1 , 0x0 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x75, 
+	0x1 , 0x0 , 0x0 , 0x69, 0x6e, 0x64, 0x65, 0x78, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x7 , 0x0 , 0x91, 0x1 , 0x0 , 0x0 , 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 
+	0x72, 0x61, 0x6c, 0x49, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x3 , 0x0 , 0x97, 0x1 , 0x0 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0x47, 
+	0x0 , 0x4 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 
+	0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x48, 
+	0x0 , 0x5 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 
+	0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0xf , 0x0 , 0x0 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 
+	0x48, 0x0 , 0x5 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x23, 
+	0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0xf , 0x0 , 
+	0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 
+	0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x23, 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0xf , 
+	0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x1c, 0x0 , 
+	0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 
+	0xf , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x12, 
+	0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 
+	0x5 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 
+	0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x22, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 
+	0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 
+	0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 
+	0x48, 0x0 , 0x5 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x18, 0x0 , 
+	0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x15, 0x0 , 0x0 , 
+	0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 
+	0x15, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x48, 
+	0x0 , 0x5 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x1b, 0x0 , 0x0 , 
+	0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 
+	0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x1a, 
+	0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 
+	0x5 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x47, 
+	0x0 , 0x3 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 
+	0x4 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 
+	0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0xa3, 0x0 , 0x0 , 0x0 , 0xb , 
+	0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0xa9, 0x0 , 
+	0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 
+	0x0 , 0xb8, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 
+	0x15, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 0x2 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x2a, 0x0 , 0x3 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x31, 0x0 , 0x3 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x2b, 
+	0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x31, 0x0 , 0x3 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 
+	0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 
+	0x10, 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x20, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 
+	0x17, 0x0 , 0x4 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0xa , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 
+	0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 
+	0xa , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x9 , 
+	0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x10, 0x0 , 
+	0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x3 , 
+	0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 
+	0x13, 0x0 , 0x0 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x14, 
+	0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x4 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x3 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x16, 
+	0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 
+	0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 
+	0x15, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0x1b, 
+	0x0 , 0x0 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x1c, 0x0 , 
+	0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 
+	0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x4 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x20, 0x0 , 0x0 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x20, 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 
+	0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 
+	0x0 , 0x0 , 0x15, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x4 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 
+	0xa , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x28, 
+	0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 
+	0x4 , 0x0 , 0x2a, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 
+	0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0xa , 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x4 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0x23, 
+	0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x49, 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 
+	0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x52, 0x0 , 0x0 , 0x0 , 0x20, 
+	0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x5 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x2b, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x6c, 0x0 , 
+	0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x13, 0x0 , 0x2 , 0x0 , 0x79, 0x0 , 0x0 , 
+	0x0 , 0x21, 0x0 , 0x5 , 0x0 , 0x7a, 0x0 , 0x0 , 0x0 , 0x79, 0x0 , 0x0 , 0x0 , 
+	0xa , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x82, 
+	0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 
+	0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x94, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0xa , 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x3 , 0x0 , 0xa0, 0x0 , 0x0 , 0x0 , 0x79, 
+	0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0xa4, 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0xa5, 0x0 , 0x0 , 
+	0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0xa4, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0xa5, 0x0 , 0x0 , 0x0 , 0xa3, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x20, 
+	0x0 , 0x4 , 0x0 , 0xa7, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0xa5, 0x0 , 0x0 , 0x0 , 0xa9, 0x0 , 0x0 , 
+	0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0xb2, 0x0 , 0x0 , 0x0 , 
+	0x9 , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0xa5, 
+	0x0 , 0x0 , 0x0 , 0xb8, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 
+	0x4 , 0x0 , 0xc0, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x0 , 
+	0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0xc3, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0x16, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xd8, 
+	0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0xfd, 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0xff, 0x0 , 0x0 , 0x0 , 
+	0x2b, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x1 , 0x1 , 0x0 , 0x0 , 0xff, 
+	0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x4 , 0x1 , 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0xe , 0x1 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x15, 0x1 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x36, 
+	0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x37, 0x0 , 0x3 , 0x0 , 0x23, 0x0 , 0x0 , 
+	0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x4 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x7 , 
+	0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2a, 0x0 , 0x0 , 0x0 , 0x29, 0x0 , 
+	0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x27, 0x0 , 0x0 , 
+	0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 
+	0x2b, 0x0 , 0x0 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0xe , 
+	0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x3 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 
+	0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 
+	0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x2f, 
+	0x0 , 0x0 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x30, 0x0 , 0x0 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 
+	0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x31, 0x0 , 0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x32, 
+	0x0 , 0x0 , 0x0 , 0x31, 0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x34, 0x0 , 0x0 , 0x0 , 0x30, 0x0 , 0x0 , 0x0 , 
+	0x33, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x35, 
+	0x0 , 0x0 , 0x0 , 0x34, 0x0 , 0x0 , 0x0 , 0xfe, 0x0 , 0x2 , 0x0 , 0x35, 0x0 , 
+	0x0 , 0x0 , 0x38, 0x0 , 0x1 , 0x0 , 0x36, 0x0 , 0x5 , 0x0 , 0x23, 0x0 , 0x0 , 
+	0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 
+	0x37, 0x0 , 0x3 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x28, 0x0 , 
+	0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 
+	0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x23, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0xc4, 
+	0x0 , 0x5 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x3c, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0xc6, 0x0 , 0x5 , 0x0 , 
+	0x23, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x3c, 
+	0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x3f, 0x0 , 0x0 , 
+	0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0xc4, 0x0 , 0x5 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 
+	0x40, 0x0 , 0x0 , 0x0 , 0x3f, 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 
+	0x0 , 0x0 , 0xc6, 0x0 , 0x5 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 
+	0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0x3a, 0x0 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x23, 
+	0x0 , 0x0 , 0x0 , 0x43, 0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0xc4, 0x0 , 
+	0x5 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x45, 0x0 , 0x0 , 0x0 , 0x43, 0x0 , 0x0 , 
+	0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 
+	0x46, 0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0xc6, 0x0 , 0x5 , 0x0 , 0x23, 
+	0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x46, 0x0 , 0x0 , 0x0 , 0x45, 0x0 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x0 , 0x0 , 
+	0x3a, 0x0 , 0x0 , 0x0 , 0xc4, 0x0 , 0x5 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x4a, 
+	0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x0 , 0x0 , 0x49, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 
+	0x0 , 0xc6, 0x0 , 0x5 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 
+	0x4b, 0x0 , 0x0 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x3a, 
+	0x0 , 0x0 , 0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 
+	0x0 , 0x0 , 0x4d, 0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0xc4, 0x0 , 0x5 , 
+	0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x4d, 0x0 , 0x0 , 0x0 , 
+	0x9 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x4f, 
+	0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0xc6, 0x0 , 0x5 , 0x0 , 0x23, 0x0 , 
+	0x0 , 0x0 , 0x50, 0x0 , 0x0 , 0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0x4e, 0x0 , 0x0 , 
+	0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0x3a, 
+	0x0 , 0x0 , 0x0 , 0xc4, 0x0 , 0x5 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x53, 0x0 , 
+	0x0 , 0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0x52, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x54, 0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 
+	0xc6, 0x0 , 0x5 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x54, 
+	0x0 , 0x0 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x3a, 0x0 , 
+	0x0 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 
+	0x0 , 0x56, 0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0xfe, 0x0 , 0x2 , 0x0 , 
+	0x56, 0x0 , 0x0 , 0x0 , 0x38, 0x0 , 0x1 , 0x0 , 0x36, 0x0 , 0x5 , 0x0 , 0xa , 
+	0x0 , 0x0 , 0x0 , 0x57, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x58, 0x0 , 
+	0x0 , 0x0 , 0x37, 0x0 , 0x3 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x59, 0x0 , 0x0 , 
+	0x0 , 0x37, 0x0 , 0x3 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0x5b, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2e, 
+	0x0 , 0x0 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x60, 
+	0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x5c, 0x0 , 
+	0x0 , 0x0 , 0x59, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x5d, 0x0 , 0x0 , 
+	0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 
+	0x5f, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0x5f, 
+	0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x61, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 
+	0x2 , 0x0 , 0x61, 0x0 , 0x0 , 0x0 , 0xf6, 0x0 , 0x4 , 0x0 , 0x65, 0x0 , 0x0 , 
+	0x0 , 0x64, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 
+	0x62, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x62, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x66, 0x0 , 0x0 , 0x0 , 0x60, 0x0 , 
+	0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x68, 0x0 , 0x0 , 
+	0x0 , 0x66, 0x0 , 0x0 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 
+	0x68, 0x0 , 0x0 , 0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0x65, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x6a, 0x0 , 0x0 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 
+	0xc2, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0x69, 
+	0x0 , 0x0 , 0x0 , 0x6a, 0x0 , 0x0 , 0x0 , 0xc7, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0x6d, 0x0 , 0x0 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x6e, 0x0 , 0x0 , 0x0 , 
+	0x5d, 0x0 , 0x0 , 0x0 , 0xc6, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x6f, 
+	0x0 , 0x0 , 0x0 , 0x6e, 0x0 , 0x0 , 0x0 , 0x6d, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x3 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 0x6f, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x70, 0x0 , 0x0 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x71, 0x0 , 0x0 , 0x0 , 0x60, 
+	0x0 , 0x0 , 0x0 , 0xc4, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x72, 0x0 , 
+	0x0 , 0x0 , 0x70, 0x0 , 0x0 , 0x0 , 0x71, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x73, 0x0 , 0x0 , 0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 
+	0xc5, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x74, 0x0 , 0x0 , 0x0 , 0x73, 
+	0x0 , 0x0 , 0x0 , 0x72, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x5e, 0x0 , 
+	0x0 , 0x0 , 0x74, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x64, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x64, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0xa , 0x0 , 0x0 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0x80, 
+	0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x76, 0x0 , 0x0 , 0x0 , 0x75, 0x0 , 
+	0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x60, 0x0 , 0x0 , 
+	0x0 , 0x76, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x61, 0x0 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0x65, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 
+	0x0 , 0x0 , 0x0 , 0x77, 0x0 , 0x0 , 0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 0xfe, 0x0 , 
+	0x2 , 0x0 , 0x77, 0x0 , 0x0 , 0x0 , 0x38, 0x0 , 0x1 , 0x0 , 0x36, 0x0 , 0x5 , 
+	0x0 , 0x79, 0x0 , 0x0 , 0x0 , 0x78, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x7a, 0x0 , 0x0 , 0x0 , 0x37, 0x0 , 0x3 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x7b, 
+	0x0 , 0x0 , 0x0 , 0x37, 0x0 , 0x3 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 
+	0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x7d, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 
+	0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x7e, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x7f, 0x0 , 0x0 , 0x0 , 0x7 , 
+	0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 
+	0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2a, 0x0 , 0x0 , 
+	0x0 , 0x8b, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0x7e, 0x0 , 0x0 , 0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x7f, 
+	0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x82, 0x0 , 
+	0x0 , 0x0 , 0x81, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x44, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x83, 0x0 , 0x0 , 0x0 , 
+	0x81, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x84, 
+	0x0 , 0x0 , 0x0 , 0x83, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0x85, 0x0 , 0x0 , 0x0 , 0x7f, 0x0 , 0x0 , 0x0 , 0x71, 0x0 , 0x4 , 
+	0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x86, 0x0 , 0x0 , 0x0 , 0x85, 0x0 , 0x0 , 0x0 , 
+	0x80, 0x0 , 0x5 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x87, 0x0 , 0x0 , 0x0 , 0x84, 
+	0x0 , 0x0 , 0x0 , 0x86, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x80, 0x0 , 
+	0x0 , 0x0 , 0x87, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x89, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 
+	0x88, 0x0 , 0x0 , 0x0 , 0x8a, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x88, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x8c, 0x0 , 
+	0x0 , 0x0 , 0x80, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0xe , 0x0 , 0x0 , 
+	0x0 , 0x8d, 0x0 , 0x0 , 0x0 , 0x8c, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0x8b, 0x0 , 0x0 , 0x0 , 0x8d, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 
+	0x0 , 0x0 , 0x0 , 0x8e, 0x0 , 0x0 , 0x0 , 0x7e, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 
+	0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x90, 0x0 , 0x0 , 0x0 , 0x8e, 0x0 , 0x0 , 
+	0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 
+	0x91, 0x0 , 0x0 , 0x0 , 0x8b, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x92, 0x0 , 0x0 , 0x0 , 0x91, 0x0 , 
+	0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x94, 0x0 , 0x0 , 0x0 , 0x93, 0x0 , 0x0 , 
+	0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x90, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x93, 0x0 , 0x0 , 0x0 , 0x92, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x95, 0x0 , 0x0 , 0x0 , 0x7e, 0x0 , 
+	0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x96, 0x0 , 0x0 , 
+	0x0 , 0x95, 0x0 , 0x0 , 0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 
+	0xa , 0x0 , 0x0 , 0x0 , 0x97, 0x0 , 0x0 , 0x0 , 0x96, 0x0 , 0x0 , 0x0 , 0x6c, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x98, 0x0 , 
+	0x0 , 0x0 , 0x8b, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x99, 0x0 , 0x0 , 0x0 , 0x98, 0x0 , 0x0 , 0x0 , 
+	0x41, 0x0 , 0x6 , 0x0 , 0x94, 0x0 , 0x0 , 0x0 , 0x9a, 0x0 , 0x0 , 0x0 , 0x1a, 
+	0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x97, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x3 , 0x0 , 0x9a, 0x0 , 0x0 , 0x0 , 0x99, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 
+	0x0 , 0x89, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x8a, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x9b, 0x0 , 0x0 , 0x0 , 0x7e, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x9c, 0x0 , 
+	0x0 , 0x0 , 0x80, 0x0 , 0x0 , 0x0 , 0x71, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 
+	0x0 , 0x9d, 0x0 , 0x0 , 0x0 , 0x9c, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 
+	0x94, 0x0 , 0x0 , 0x0 , 0x9e, 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x3 , 
+	0x0 , 0x0 , 0x0 , 0x9b, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x9e, 0x0 , 
+	0x0 , 0x0 , 0x9d, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x89, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x89, 0x0 , 0x0 , 0x0 , 0xfd, 0x0 , 0x1 , 0x0 , 
+	0x38, 0x0 , 0x1 , 0x0 , 0x36, 0x0 , 0x5 , 0x0 , 0x79, 0x0 , 0x0 , 0x0 , 0x9f, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xa0, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 
+	0x2 , 0x0 , 0xa1, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 
+	0x0 , 0xa2, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x2e, 0x0 , 0x0 , 0x0 , 0xb7, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 
+	0x0 , 0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0xbb, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0xbc, 0x0 , 0x0 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0xc0, 0x0 , 0x0 , 0x0 , 
+	0xbf, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2e, 
+	0x0 , 0x0 , 0x0 , 0xc9, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0xca, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0xcb, 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0xd3, 
+	0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2e, 0x0 , 
+	0x0 , 0x0 , 0xdc, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 
+	0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0xdf, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0xe0, 0x0 , 0x0 , 0x0 , 0x7 , 
+	0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0xe7, 0x0 , 
+	0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 
+	0x0 , 0xeb, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x2e, 0x0 , 0x0 , 0x0 , 0xf1, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 
+	0x0 , 0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x21, 0x1 , 0x0 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 
+	0x2b, 0x1 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2e, 
+	0x0 , 0x0 , 0x0 , 0x30, 0x1 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x38, 0x1 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x3c, 0x1 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x46, 
+	0x1 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2e, 0x0 , 
+	0x0 , 0x0 , 0x47, 0x1 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 
+	0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x48, 0x1 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x4 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x50, 0x1 , 0x0 , 0x0 , 0x7 , 
+	0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x66, 0x1 , 
+	0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 
+	0x0 , 0x75, 0x1 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x2e, 0x0 , 0x0 , 0x0 , 0x91, 0x1 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 
+	0x0 , 0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x97, 0x1 , 0x0 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0xa7, 0x0 , 0x0 , 0x0 , 0xa6, 0x0 , 0x0 , 
+	0x0 , 0xa3, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0xa , 0x0 , 0x0 , 0x0 , 0xa8, 0x0 , 0x0 , 0x0 , 0xa6, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x5 , 0x0 , 0xa7, 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x0 , 0x0 , 0xa9, 0x0 , 
+	0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 
+	0x0 , 0xab, 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 
+	0xa , 0x0 , 0x0 , 0x0 , 0xac, 0x0 , 0x0 , 0x0 , 0xa8, 0x0 , 0x0 , 0x0 , 0xab, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0xa7, 0x0 , 0x0 , 0x0 , 0xad, 0x0 , 
+	0x0 , 0x0 , 0xa3, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xae, 0x0 , 0x0 , 0x0 , 0xad, 0x0 , 0x0 , 0x0 , 
+	0x80, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xaf, 0x0 , 0x0 , 0x0 , 0xac, 
+	0x0 , 0x0 , 0x0 , 0xae, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xa2, 0x0 , 
+	0x0 , 0x0 , 0xaf, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 
+	0x0 , 0xb0, 0x0 , 0x0 , 0x0 , 0xa2, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 
+	0xb2, 0x0 , 0x0 , 0x0 , 0xb1, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x7 , 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xb3, 0x0 , 
+	0x0 , 0x0 , 0xb1, 0x0 , 0x0 , 0x0 , 0xae, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0xb4, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x0 , 0x0 , 0xb3, 0x0 , 0x0 , 0x0 , 
+	0xf7, 0x0 , 0x3 , 0x0 , 0xb6, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 
+	0x0 , 0x4 , 0x0 , 0xb4, 0x0 , 0x0 , 0x0 , 0xb5, 0x0 , 0x0 , 0x0 , 0xb6, 0x0 , 
+	0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xb5, 0x0 , 0x0 , 0x0 , 0xfd, 0x0 , 0x1 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xb6, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 
+	0xa7, 0x0 , 0x0 , 0x0 , 0xb9, 0x0 , 0x0 , 0x0 , 0xb8, 0x0 , 0x0 , 0x0 , 0x3 , 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xba, 0x0 , 
+	0x0 , 0x0 , 0xb9, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xb7, 0x0 , 0x0 , 
+	0x0 , 0xba, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xbb, 0x0 , 0x0 , 0x0 , 
+	0x5f, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xbc, 0x0 , 0x0 , 0x0 , 0x5f, 
+	0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0xbe, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0xbd, 0x0 , 0x0 , 
+	0x0 , 0xbe, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xbd, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xc1, 0x0 , 0x0 , 0x0 , 0xa2, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0xc3, 0x0 , 0x0 , 0x0 , 0xc2, 0x0 , 
+	0x0 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0xc1, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0xc4, 0x0 , 0x0 , 0x0 , 
+	0xc2, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xbf, 0x0 , 0x0 , 0x0 , 0xc4, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0xc5, 0x0 , 
+	0x0 , 0x0 , 0xbf, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xc6, 0x0 , 0x0 , 0x0 , 0xc5, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0xbb, 0x0 , 0x0 , 0x0 , 0xc6, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x5 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0xc7, 0x0 , 0x0 , 0x0 , 0xbf, 0x0 , 
+	0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 
+	0x0 , 0xc8, 0x0 , 0x0 , 0x0 , 0xc7, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0xbc, 0x0 , 0x0 , 0x0 , 0xc8, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xbe, 
+	0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xbe, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x3 , 0x0 , 0xc9, 0x0 , 0x0 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 
+	0x0 , 0xca, 0x0 , 0x0 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0xcb, 0x0 , 0x0 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xcc, 
+	0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xcc, 0x0 , 0x0 , 0x0 , 0xf6, 0x0 , 
+	0x4 , 0x0 , 0xd0, 0x0 , 0x0 , 0x0 , 0xcf, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xcd, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0xcd, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xd1, 
+	0x0 , 0x0 , 0x0 , 0xcb, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0xd2, 0x0 , 0x0 , 0x0 , 0xd1, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 
+	0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0xd2, 0x0 , 0x0 , 0x0 , 0xce, 0x0 , 0x0 , 0x0 , 
+	0xd0, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xce, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xd4, 0x0 , 0x0 , 0x0 , 0xa2, 0x0 , 
+	0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xd5, 0x0 , 0x0 , 
+	0x0 , 0xd4, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0xa , 0x0 , 0x0 , 0x0 , 0xd6, 0x0 , 0x0 , 0x0 , 0xcb, 0x0 , 0x0 , 0x0 , 0x80, 
+	0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xd7, 0x0 , 0x0 , 0x0 , 0xd5, 0x0 , 
+	0x0 , 0x0 , 0xd6, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 
+	0x0 , 0xd9, 0x0 , 0x0 , 0x0 , 0xd7, 0x0 , 0x0 , 0x0 , 0xd8, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xda, 0x0 , 0x0 , 0x0 , 0xb7, 
+	0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xdb, 0x0 , 
+	0x0 , 0x0 , 0xd9, 0x0 , 0x0 , 0x0 , 0xda, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 
+	0x0 , 0xd3, 0x0 , 0x0 , 0x0 , 0xdb, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0xa , 0x0 , 0x0 , 0x0 , 0xdd, 0x0 , 0x0 , 0x0 , 0xd3, 0x0 , 0x0 , 0x0 , 0x84, 
+	0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xde, 0x0 , 0x0 , 0x0 , 0xdd, 0x0 , 
+	0x0 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xdc, 0x0 , 0x0 , 
+	0x0 , 0xde, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xdf, 0x0 , 0x0 , 0x0 , 
+	0x5f, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xe0, 0x0 , 0x0 , 0x0 , 0x5f, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xe1, 0x0 , 
+	0x0 , 0x0 , 0xdc, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0xb2, 0x0 , 0x0 , 
+	0x0 , 0xe2, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xe3, 0x0 , 0x0 , 0x0 , 0xe2, 
+	0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xe4, 0x0 , 
+	0x0 , 0x0 , 0xe1, 0x0 , 0x0 , 0x0 , 0xe3, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 
+	0x0 , 0xe6, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 
+	0xe4, 0x0 , 0x0 , 0x0 , 0xe5, 0x0 , 0x0 , 0x0 , 0xe6, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0xe5, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0xe8, 0x0 , 0x0 , 0x0 , 0xd3, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 
+	0x0 , 0x94, 0x0 , 0x0 , 0x0 , 0xe9, 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 
+	0x3 , 0x0 , 0x0 , 0x0 , 0xe8, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 
+	0x0 , 0x0 , 0x0 , 0xea, 0x0 , 0x0 , 0x0 , 0xe9, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x3 , 0x0 , 0xe7, 0x0 , 0x0 , 0x0 , 0xea, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 
+	0x0 , 0xb2, 0x0 , 0x0 , 0x0 , 0xec, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 
+	0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xed, 
+	0x0 , 0x0 , 0x0 , 0xec, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0xee, 0x0 , 0x0 , 0x0 , 0xdc, 0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x5 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xef, 0x0 , 0x0 , 0x0 , 0xed, 0x0 , 0x0 , 0x0 , 
+	0xee, 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x7 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xf0, 
+	0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x67, 0x0 , 
+	0x0 , 0x0 , 0xef, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xeb, 0x0 , 0x0 , 
+	0x0 , 0xf0, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xf1, 0x0 , 0x0 , 0x0 , 
+	0x5f, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xf2, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0xf2, 0x0 , 0x0 , 0x0 , 0xf6, 0x0 , 0x4 , 0x0 , 0xf6, 0x0 , 
+	0x0 , 0x0 , 0xf5, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 
+	0x0 , 0xf3, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xf3, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x0 , 0x0 , 0xf1, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 
+	0x0 , 0x0 , 0xeb, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0xf9, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x0 , 0x0 , 
+	0xfa, 0x0 , 0x4 , 0x0 , 0xf9, 0x0 , 0x0 , 0x0 , 0xf4, 0x0 , 0x0 , 0x0 , 0xf6, 
+	0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xf4, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xfb, 0x0 , 0x0 , 0x0 , 0xe7, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xfc, 0x0 , 0x0 , 0x0 , 
+	0xf1, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xfe, 
+	0x0 , 0x0 , 0x0 , 0xfc, 0x0 , 0x0 , 0x0 , 0xfd, 0x0 , 0x0 , 0x0 , 0xc2, 0x0 , 
+	0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xff, 0x0 , 0x0 , 0x0 , 0xfb, 0x0 , 0x0 , 
+	0x0 , 0xfe, 0x0 , 0x0 , 0x0 , 0xc7, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 
+	0x2 , 0x1 , 0x0 , 0x0 , 0xff, 0x0 , 0x0 , 0x0 , 0x1 , 0x1 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0xfa, 0x0 , 0x0 , 0x0 , 0x2 , 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x3 , 0x1 , 0x0 , 0x0 , 0xfa, 0x0 , 0x0 , 
+	0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0xb2, 0x0 , 0x0 , 0x0 , 0x5 , 0x1 , 0x0 , 0x0 , 
+	0xd , 0x0 , 0x0 , 0x0 , 0x4 , 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 
+	0x0 , 0x0 , 0x0 , 0x6 , 0x1 , 0x0 , 0x0 , 0x5 , 0x1 , 0x0 , 0x0 , 0xaa, 0x0 , 
+	0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x7 , 0x1 , 0x0 , 0x0 , 0x3 , 0x1 , 0x0 , 
+	0x0 , 0x6 , 0x1 , 0x0 , 0x0 , 0xa9, 0x0 , 0x6 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 
+	0x8 , 0x1 , 0x0 , 0x0 , 0x7 , 0x1 , 0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x5f, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x9 , 0x1 , 
+	0x0 , 0x0 , 0xf1, 0x0 , 0x0 , 0x0 , 0xc4, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 
+	0x0 , 0xa , 0x1 , 0x0 , 0x0 , 0x8 , 0x1 , 0x0 , 0x0 , 0x9 , 0x1 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xb , 0x1 , 0x0 , 0x0 , 0xdf, 
+	0x0 , 0x0 , 0x0 , 0xc5, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xc , 0x1 , 
+	0x0 , 0x0 , 0xb , 0x1 , 0x0 , 0x0 , 0xa , 0x1 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 
+	0x0 , 0xdf, 0x0 , 0x0 , 0x0 , 0xc , 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0xa , 0x0 , 0x0 , 0x0 , 0xd , 0x1 , 0x0 , 0x0 , 0xfa, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x5 , 0x0 , 0xb2, 0x0 , 0x0 , 0x0 , 0xf , 0x1 , 0x0 , 0x0 , 0xd , 0x0 , 
+	0x0 , 0x0 , 0xe , 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 
+	0x0 , 0x10, 0x1 , 0x0 , 0x0 , 0xf , 0x1 , 0x0 , 0x0 , 0xaa, 0x0 , 0x5 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0x11, 0x1 , 0x0 , 0x0 , 0xd , 0x1 , 0x0 , 0x0 , 0x10, 
+	0x1 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x13, 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x11, 0x1 , 0x0 , 0x0 , 0x13, 0x1 , 0x0 , 
+	0x0 , 0x12, 0x1 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x12, 0x1 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x14, 0x1 , 0x0 , 0x0 , 0xfa, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0xb2, 0x0 , 0x0 , 0x0 , 0x16, 0x1 , 
+	0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x15, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x17, 0x1 , 0x0 , 0x0 , 0x16, 0x1 , 0x0 , 0x0 , 
+	0xaa, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x18, 0x1 , 0x0 , 0x0 , 0x14, 
+	0x1 , 0x0 , 0x0 , 0x17, 0x1 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x13, 0x1 , 
+	0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x13, 0x1 , 0x0 , 0x0 , 0xf5, 0x0 , 0x7 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x19, 0x1 , 0x0 , 0x0 , 0x11, 0x1 , 0x0 , 0x0 , 
+	0xf4, 0x0 , 0x0 , 0x0 , 0x18, 0x1 , 0x0 , 0x0 , 0x12, 0x1 , 0x0 , 0x0 , 0xa9, 
+	0x0 , 0x6 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x1a, 0x1 , 0x0 , 0x0 , 0x19, 0x1 , 
+	0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x1b, 0x1 , 0x0 , 0x0 , 0xf1, 0x0 , 0x0 , 0x0 , 
+	0xc4, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x1c, 0x1 , 0x0 , 0x0 , 0x1a, 
+	0x1 , 0x0 , 0x0 , 0x1b, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0x1d, 0x1 , 0x0 , 0x0 , 0xe0, 0x0 , 0x0 , 0x0 , 0xc5, 0x0 , 0x5 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x1e, 0x1 , 0x0 , 0x0 , 0x1d, 0x1 , 0x0 , 0x0 , 
+	0x1c, 0x1 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xe0, 0x0 , 0x0 , 0x0 , 0x1e, 
+	0x1 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xf5, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 
+	0x2 , 0x0 , 0xf5, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 
+	0x0 , 0x1f, 0x1 , 0x0 , 0x0 , 0xf1, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 
+	0xa , 0x0 , 0x0 , 0x0 , 0x20, 0x1 , 0x0 , 0x0 , 0x1f, 0x1 , 0x0 , 0x0 , 0x6c, 
+	0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xf1, 0x0 , 0x0 , 0x0 , 0x20, 0x1 , 
+	0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xf2, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 
+	0x0 , 0xf6, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xe6, 0x0 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0xe6, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 
+	0x0 , 0x0 , 0x0 , 0x22, 0x1 , 0x0 , 0x0 , 0xdf, 0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 
+	0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x23, 0x1 , 0x0 , 0x0 , 0x22, 0x1 , 0x0 , 
+	0x0 , 0xc7, 0x0 , 0x5 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x24, 0x1 , 0x0 , 0x0 , 
+	0x23, 0x1 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0xab, 0x0 , 0x5 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x25, 0x1 , 0x0 , 0x0 , 0x24, 0x1 , 0x0 , 0x0 , 0x3 , 0x0 , 
+	0x0 , 0x0 , 0x45, 0x11, 0x4 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x26, 0x1 , 0x0 , 
+	0x0 , 0x25, 0x1 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 
+	0x27, 0x1 , 0x0 , 0x0 , 0x26, 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x51, 
+	0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x28, 0x1 , 0x0 , 0x0 , 0x26, 0x1 , 
+	0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x5 , 0x0 , 0xe , 0x0 , 0x0 , 
+	0x0 , 0x29, 0x1 , 0x0 , 0x0 , 0x27, 0x1 , 0x0 , 0x0 , 0x28, 0x1 , 0x0 , 0x0 , 
+	0x7c, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x2a, 0x1 , 0x0 , 0x0 , 0x29, 
+	0x1 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x21, 0x1 , 0x0 , 0x0 , 0x2a, 0x1 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x2c, 0x1 , 0x0 , 
+	0x0 , 0x21, 0x1 , 0x0 , 0x0 , 0x39, 0x0 , 0x5 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 
+	0x2d, 0x1 , 0x0 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x2c, 0x1 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x2e, 0x1 , 0x0 , 0x0 , 0x21, 0x1 , 
+	0x0 , 0x0 , 0xc6, 0x0 , 0x5 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x2f, 0x1 , 0x0 , 
+	0x0 , 0x2d, 0x1 , 0x0 , 0x0 , 0x2e, 0x1 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0x2b, 0x1 , 0x0 , 0x0 , 0x2f, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 
+	0x0 , 0x0 , 0x0 , 0x31, 0x1 , 0x0 , 0x0 , 0xbb, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x32, 0x1 , 0x0 , 0x0 , 0x2b, 0x1 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x33, 0x1 , 0x0 , 0x0 , 
+	0xb7, 0x0 , 0x0 , 0x0 , 0xc2, 0x0 , 0x5 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x34, 
+	0x1 , 0x0 , 0x0 , 0x32, 0x1 , 0x0 , 0x0 , 0x33, 0x1 , 0x0 , 0x0 , 0x71, 0x0 , 
+	0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x35, 0x1 , 0x0 , 0x0 , 0x34, 0x1 , 0x0 , 
+	0x0 , 0xc7, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x36, 0x1 , 0x0 , 0x0 , 
+	0x35, 0x1 , 0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0xc6, 0x0 , 0x5 , 0x0 , 0xa , 
+	0x0 , 0x0 , 0x0 , 0x37, 0x1 , 0x0 , 0x0 , 0x31, 0x1 , 0x0 , 0x0 , 0x36, 0x1 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x30, 0x1 , 0x0 , 0x0 , 0x37, 0x1 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x39, 0x1 , 0x0 , 0x0 , 
+	0xdf, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x3a, 
+	0x1 , 0x0 , 0x0 , 0x30, 0x1 , 0x0 , 0x0 , 0x39, 0x0 , 0x6 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0x3b, 0x1 , 0x0 , 0x0 , 0x57, 0x0 , 0x0 , 0x0 , 0x39, 0x1 , 0x0 , 
+	0x0 , 0x3a, 0x1 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x38, 0x1 , 0x0 , 0x0 , 
+	0x3b, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x1 , 0x0 , 0x0 , 0xdf, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0x3e, 0x1 , 0x0 , 0x0 , 0xe0, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x3f, 0x1 , 0x0 , 0x0 , 0x38, 0x1 , 0x0 , 0x0 , 
+	0xc8, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x40, 0x1 , 0x0 , 0x0 , 0x3f, 
+	0x1 , 0x0 , 0x0 , 0xc7, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x41, 0x1 , 
+	0x0 , 0x0 , 0x3e, 0x1 , 0x0 , 0x0 , 0x40, 0x1 , 0x0 , 0x0 , 0xc5, 0x0 , 0x5 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x42, 0x1 , 0x0 , 0x0 , 0x3d, 0x1 , 0x0 , 0x0 , 
+	0x41, 0x1 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x3c, 0x1 , 0x0 , 0x0 , 0x42, 
+	0x1 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x44, 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x43, 0x1 , 0x0 , 
+	0x0 , 0x45, 0x1 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x43, 0x1 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x46, 0x1 , 0x0 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0x47, 0x1 , 0x0 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x3 , 0x0 , 0x48, 0x1 , 0x0 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 
+	0x0 , 0x49, 0x1 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x49, 0x1 , 0x0 , 0x0 , 
+	0xf6, 0x0 , 0x4 , 0x0 , 0x4d, 0x1 , 0x0 , 0x0 , 0x4c, 0x1 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x4a, 0x1 , 0x0 , 0x0 , 0xf8, 0x0 , 
+	0x2 , 0x0 , 0x4a, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 
+	0x0 , 0x4e, 0x1 , 0x0 , 0x0 , 0x48, 0x1 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0x4f, 0x1 , 0x0 , 0x0 , 0x4e, 0x1 , 0x0 , 0x0 , 0x67, 
+	0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x4f, 0x1 , 0x0 , 0x0 , 0x4b, 0x1 , 
+	0x0 , 0x0 , 0x4d, 0x1 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x4b, 0x1 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x51, 0x1 , 0x0 , 0x0 , 
+	0x3c, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x52, 
+	0x1 , 0x0 , 0x0 , 0x48, 0x1 , 0x0 , 0x0 , 0xc2, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0x53, 0x1 , 0x0 , 0x0 , 0x51, 0x1 , 0x0 , 0x0 , 0x52, 0x1 , 0x0 , 
+	0x0 , 0xc7, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x54, 0x1 , 0x0 , 0x0 , 
+	0x53, 0x1 , 0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0xab, 0x0 , 0x5 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x55, 0x1 , 0x0 , 0x0 , 0x54, 0x1 , 0x0 , 0x0 , 0x5f, 0x0 , 
+	0x0 , 0x0 , 0x45, 0x11, 0x4 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x56, 0x1 , 0x0 , 
+	0x0 , 0x55, 0x1 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 
+	0x57, 0x1 , 0x0 , 0x0 , 0x56, 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x51, 
+	0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x58, 0x1 , 0x0 , 0x0 , 0x56, 0x1 , 
+	0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x5 , 0x0 , 0xe , 0x0 , 0x0 , 
+	0x0 , 0x59, 0x1 , 0x0 , 0x0 , 0x57, 0x1 , 0x0 , 0x0 , 0x58, 0x1 , 0x0 , 0x0 , 
+	0x7c, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x5a, 0x1 , 0x0 , 0x0 , 0x59, 
+	0x1 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x50, 0x1 , 0x0 , 0x0 , 0x5a, 0x1 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x5b, 0x1 , 0x0 , 
+	0x0 , 0x50, 0x1 , 0x0 , 0x0 , 0xc , 0x0 , 0x6 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 
+	0x5d, 0x1 , 0x0 , 0x0 , 0x5c, 0x1 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x5b, 
+	0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x5e, 0x1 , 
+	0x0 , 0x0 , 0x46, 0x1 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 
+	0x0 , 0x5f, 0x1 , 0x0 , 0x0 , 0x5e, 0x1 , 0x0 , 0x0 , 0x5d, 0x1 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x46, 0x1 , 0x0 , 0x0 , 0x5f, 0x1 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x60, 0x1 , 0x0 , 0x0 , 0x50, 0x1 , 
+	0x0 , 0x0 , 0x39, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x61, 0x1 , 0x0 , 
+	0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x60, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0xa , 0x0 , 0x0 , 0x0 , 0x62, 0x1 , 0x0 , 0x0 , 0x47, 0x1 , 0x0 , 0x0 , 0x80, 
+	0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x63, 0x1 , 0x0 , 0x0 , 0x62, 0x1 , 
+	0x0 , 0x0 , 0x61, 0x1 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x47, 0x1 , 0x0 , 
+	0x0 , 0x63, 0x1 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x4c, 0x1 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0x4c, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 
+	0x0 , 0x0 , 0x0 , 0x64, 0x1 , 0x0 , 0x0 , 0x48, 0x1 , 0x0 , 0x0 , 0x80, 0x0 , 
+	0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x65, 0x1 , 0x0 , 0x0 , 0x64, 0x1 , 0x0 , 
+	0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x48, 0x1 , 0x0 , 0x0 , 
+	0x65, 0x1 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x49, 0x1 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0x4d, 0x1 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x66, 0x1 , 
+	0x0 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x67, 0x1 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x67, 0x1 , 0x0 , 0x0 , 0xf6, 0x0 , 0x4 , 0x0 , 
+	0x6b, 0x1 , 0x0 , 0x0 , 0x6a, 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xf9, 
+	0x0 , 0x2 , 0x0 , 0x68, 0x1 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x68, 0x1 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x6c, 0x1 , 0x0 , 
+	0x0 , 0x66, 0x1 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x6d, 0x1 , 0x0 , 0x0 , 0x6c, 0x1 , 0x0 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 0xfa, 
+	0x0 , 0x4 , 0x0 , 0x6d, 0x1 , 0x0 , 0x0 , 0x69, 0x1 , 0x0 , 0x0 , 0x6b, 0x1 , 
+	0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x69, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x6e, 0x1 , 0x0 , 0x0 , 0x3c, 0x1 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x6f, 0x1 , 0x0 , 0x0 , 0x66, 
+	0x1 , 0x0 , 0x0 , 0xc2, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x70, 0x1 , 
+	0x0 , 0x0 , 0x6e, 0x1 , 0x0 , 0x0 , 0x6f, 0x1 , 0x0 , 0x0 , 0xc7, 0x0 , 0x5 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x71, 0x1 , 0x0 , 0x0 , 0x70, 0x1 , 0x0 , 0x0 , 
+	0x6c, 0x0 , 0x0 , 0x0 , 0xab, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x72, 
+	0x1 , 0x0 , 0x0 , 0x71, 0x1 , 0x0 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 
+	0x3 , 0x0 , 0x74, 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 
+	0x0 , 0x72, 0x1 , 0x0 , 0x0 , 0x73, 0x1 , 0x0 , 0x0 , 0x74, 0x1 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0x73, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 
+	0x0 , 0x0 , 0x0 , 0x76, 0x1 , 0x0 , 0x0 , 0xbc, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x77, 0x1 , 0x0 , 0x0 , 0x46, 0x1 , 0x0 , 
+	0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x78, 0x1 , 0x0 , 0x0 , 
+	0x76, 0x1 , 0x0 , 0x0 , 0x77, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 
+	0x0 , 0x0 , 0x0 , 0x79, 0x1 , 0x0 , 0x0 , 0x3c, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x7a, 0x1 , 0x0 , 0x0 , 0x66, 0x1 , 0x0 , 
+	0x0 , 0xc4, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x7b, 0x1 , 0x0 , 0x0 , 
+	0x6c, 0x0 , 0x0 , 0x0 , 0x7a, 0x1 , 0x0 , 0x0 , 0x82, 0x0 , 0x5 , 0x0 , 0xa , 
+	0x0 , 0x0 , 0x0 , 0x7c, 0x1 , 0x0 , 0x0 , 0x7b, 0x1 , 0x0 , 0x0 , 0x6c, 0x0 , 
+	0x0 , 0x0 , 0xc7, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x7d, 0x1 , 0x0 , 
+	0x0 , 0x79, 0x1 , 0x0 , 0x0 , 0x7c, 0x1 , 0x0 , 0x0 , 0xcd, 0x0 , 0x4 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x7e, 0x1 , 0x0 , 0x0 , 0x7d, 0x1 , 0x0 , 0x0 , 0x7c, 
+	0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x7f, 0x1 , 0x0 , 0x0 , 0x7e, 0x1 , 
+	0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x80, 0x1 , 0x0 , 
+	0x0 , 0x78, 0x1 , 0x0 , 0x0 , 0x7f, 0x1 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0x75, 0x1 , 0x0 , 0x0 , 0x80, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 
+	0x0 , 0x0 , 0x0 , 0x81, 0x1 , 0x0 , 0x0 , 0x75, 0x1 , 0x0 , 0x0 , 0x41, 0x0 , 
+	0x5 , 0x0 , 0xb2, 0x0 , 0x0 , 0x0 , 0x82, 0x1 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 
+	0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 
+	0x83, 0x1 , 0x0 , 0x0 , 0x82, 0x1 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x84, 0x1 , 0x0 , 0x0 , 0x81, 0x1 , 0x0 , 0x0 , 0x83, 0x1 , 
+	0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x86, 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x84, 0x1 , 0x0 , 0x0 , 0x85, 0x1 , 0x0 , 0x0 , 
+	0x86, 0x1 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x85, 0x1 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x87, 0x1 , 0x0 , 0x0 , 0x75, 0x1 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x88, 0x1 , 0x0 , 
+	0x0 , 0xdc, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 
+	0x89, 0x1 , 0x0 , 0x0 , 0x66, 0x1 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0xa , 
+	0x0 , 0x0 , 0x0 , 0x8a, 0x1 , 0x0 , 0x0 , 0x88, 0x1 , 0x0 , 0x0 , 0x89, 0x1 , 
+	0x0 , 0x0 , 0x39, 0x0 , 0x6 , 0x0 , 0x79, 0x0 , 0x0 , 0x0 , 0x8b, 0x1 , 0x0 , 
+	0x0 , 0x78, 0x0 , 0x0 , 0x0 , 0x87, 0x1 , 0x0 , 0x0 , 0x8a, 0x1 , 0x0 , 0x0 , 
+	0xf9, 0x0 , 0x2 , 0x0 , 0x86, 0x1 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x86, 
+	0x1 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x74, 0x1 , 0x0 , 0x0 , 0xf8, 0x0 , 
+	0x2 , 0x0 , 0x74, 0x1 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x6a, 0x1 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x6a, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0xa , 0x0 , 0x0 , 0x0 , 0x8c, 0x1 , 0x0 , 0x0 , 0x66, 0x1 , 0x0 , 0x0 , 0x80, 
+	0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x8d, 0x1 , 0x0 , 0x0 , 0x8c, 0x1 , 
+	0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x66, 0x1 , 0x0 , 
+	0x0 , 0x8d, 0x1 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x67, 0x1 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0x6b, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 
+	0x0 , 0x0 , 0x0 , 0x8e, 0x1 , 0x0 , 0x0 , 0x47, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x8f, 0x1 , 0x0 , 0x0 , 0xbc, 0x0 , 0x0 , 
+	0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x90, 0x1 , 0x0 , 0x0 , 
+	0x8f, 0x1 , 0x0 , 0x0 , 0x8e, 0x1 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xbc, 
+	0x0 , 0x0 , 0x0 , 0x90, 0x1 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x44, 0x1 , 
+	0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x45, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x92, 0x1 , 0x0 , 0x0 , 0xdf, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x93, 0x1 , 0x0 , 0x0 , 0xe0, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x94, 0x1 , 
+	0x0 , 0x0 , 0x38, 0x1 , 0x0 , 0x0 , 0xc7, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 
+	0x0 , 0x95, 0x1 , 0x0 , 0x0 , 0x93, 0x1 , 0x0 , 0x0 , 0x94, 0x1 , 0x0 , 0x0 , 
+	0xc5, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x96, 0x1 , 0x0 , 0x0 , 0x92, 
+	0x1 , 0x0 , 0x0 , 0x95, 0x1 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x91, 0x1 , 
+	0x0 , 0x0 , 0x96, 0x1 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x97, 0x1 , 0x0 , 
+	0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x98, 0x1 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0x98, 0x1 , 0x0 , 0x0 , 0xf6, 0x0 , 0x4 , 0x0 , 0x9c, 
+	0x1 , 0x0 , 0x0 , 0x9b, 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 
+	0x2 , 0x0 , 0x99, 0x1 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x99, 0x1 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x9d, 0x1 , 0x0 , 0x0 , 
+	0x97, 0x1 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x9e, 
+	0x1 , 0x0 , 0x0 , 0x9d, 0x1 , 0x0 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 
+	0x4 , 0x0 , 0x9e, 0x1 , 0x0 , 0x0 , 0x9a, 0x1 , 0x0 , 0x0 , 0x9c, 0x1 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x9a, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0xa , 0x0 , 0x0 , 0x0 , 0x9f, 0x1 , 0x0 , 0x0 , 0x3c, 0x1 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xa0, 0x1 , 0x0 , 0x0 , 0x97, 0x1 , 
+	0x0 , 0x0 , 0xc2, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xa1, 0x1 , 0x0 , 
+	0x0 , 0x9f, 0x1 , 0x0 , 0x0 , 0xa0, 0x1 , 0x0 , 0x0 , 0xc7, 0x0 , 0x5 , 0x0 , 
+	0xa , 0x0 , 0x0 , 0x0 , 0xa2, 0x1 , 0x0 , 0x0 , 0xa1, 0x1 , 0x0 , 0x0 , 0x6c, 
+	0x0 , 0x0 , 0x0 , 0xab, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xa3, 0x1 , 
+	0x0 , 0x0 , 0xa2, 0x1 , 0x0 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0x45, 0x11, 0x4 , 
+	0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0xa4, 0x1 , 0x0 , 0x0 , 0xa3, 0x1 , 0x0 , 0x0 , 
+	0x51, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xa5, 0x1 , 0x0 , 0x0 , 0xa4, 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0xa6, 0x1 , 0x0 , 0x0 , 0xa4, 0x1 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 
+	0x0 , 0x50, 0x0 , 0x5 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0xa7, 0x1 , 0x0 , 0x0 , 
+	0xa5, 0x1 , 0x0 , 0x0 , 0xa6, 0x1 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x23, 
+	0x0 , 0x0 , 0x0 , 0xa8, 0x1 , 0x0 , 0x0 , 0xa7, 0x1 , 0x0 , 0x0 , 0x39, 0x0 , 
+	0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xa9, 0x1 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 
+	0x0 , 0xa8, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 
+	0xaa, 0x1 , 0x0 , 0x0 , 0xc9, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0xa , 
+	0x0 , 0x0 , 0x0 , 0xab, 0x1 , 0x0 , 0x0 , 0xaa, 0x1 , 0x0 , 0x0 , 0xa9, 0x1 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xc9, 0x0 , 0x0 , 0x0 , 0xab, 0x1 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xac, 0x1 , 0x0 , 0x0 , 
+	0x91, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xad, 
+	0x1 , 0x0 , 0x0 , 0x97, 0x1 , 0x0 , 0x0 , 0xc2, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0xae, 0x1 , 0x0 , 0x0 , 0xac, 0x1 , 0x0 , 0x0 , 0xad, 0x1 , 0x0 , 
+	0x0 , 0xc7, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xaf, 0x1 , 0x0 , 0x0 , 
+	0xae, 0x1 , 0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0xab, 0x0 , 0x5 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0xb0, 0x1 , 0x0 , 0x0 , 0xaf, 0x1 , 0x0 , 0x0 , 0x5f, 0x0 , 
+	0x0 , 0x0 , 0x45, 0x11, 0x4 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0xb1, 0x1 , 0x0 , 
+	0x0 , 0xb0, 0x1 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 
+	0xb2, 0x1 , 0x0 , 0x0 , 0xb1, 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x51, 
+	0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xb3, 0x1 , 0x0 , 0x0 , 0xb1, 0x1 , 
+	0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x5 , 0x0 , 0xe , 0x0 , 0x0 , 
+	0x0 , 0xb4, 0x1 , 0x0 , 0x0 , 0xb2, 0x1 , 0x0 , 0x0 , 0xb3, 0x1 , 0x0 , 0x0 , 
+	0x7c, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0xb5, 0x1 , 0x0 , 0x0 , 0xb4, 
+	0x1 , 0x0 , 0x0 , 0x39, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xb6, 0x1 , 
+	0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0xb5, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xb7, 0x1 , 0x0 , 0x0 , 0xca, 0x0 , 0x0 , 0x0 , 
+	0x80, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xb8, 0x1 , 0x0 , 0x0 , 0xb7, 
+	0x1 , 0x0 , 0x0 , 0xb6, 0x1 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xca, 0x0 , 
+	0x0 , 0x0 , 0xb8, 0x1 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x9b, 0x1 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x9b, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0xa , 0x0 , 0x0 , 0x0 , 0xb9, 0x1 , 0x0 , 0x0 , 0x97, 0x1 , 0x0 , 0x0 , 0x80, 
+	0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xba, 0x1 , 0x0 , 0x0 , 0xb9, 0x1 , 
+	0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x97, 0x1 , 0x0 , 
+	0x0 , 0xba, 0x1 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x98, 0x1 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0x9c, 0x1 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x44, 
+	0x1 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x44, 0x1 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0xbb, 0x1 , 0x0 , 0x0 , 0x21, 0x1 , 0x0 , 
+	0x0 , 0x39, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xbc, 0x1 , 0x0 , 0x0 , 
+	0x22, 0x0 , 0x0 , 0x0 , 0xbb, 0x1 , 0x0 , 0x0 , 0xc7, 0x0 , 0x5 , 0x0 , 0xa , 
+	0x0 , 0x0 , 0x0 , 0xbd, 0x1 , 0x0 , 0x0 , 0xbc, 0x1 , 0x0 , 0x0 , 0x6c, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xbe, 0x1 , 0x0 , 
+	0x0 , 0xbb, 0x0 , 0x0 , 0x0 , 0xc6, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 
+	0xbf, 0x1 , 0x0 , 0x0 , 0xbe, 0x1 , 0x0 , 0x0 , 0xbd, 0x1 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0xbb, 0x0 , 0x0 , 0x0 , 0xbf, 0x1 , 0x0 , 0x0 , 0xf9, 0x0 , 
+	0x2 , 0x0 , 0xcf, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xcf, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xc0, 0x1 , 0x0 , 0x0 , 
+	0xcb, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xc1, 
+	0x1 , 0x0 , 0x0 , 0xc0, 0x1 , 0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x3 , 0x0 , 0xcb, 0x0 , 0x0 , 0x0 , 0xc1, 0x1 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 
+	0x0 , 0xcc, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xd0, 0x0 , 0x0 , 0x0 , 
+	0xa8, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xc2, 0x1 , 0x0 , 0x0 , 0x6 , 
+	0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0xc4, 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0xc2, 0x1 , 0x0 , 0x0 , 0xc3, 0x1 , 0x0 , 
+	0x0 , 0xc4, 0x1 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xc3, 0x1 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xc5, 0x1 , 0x0 , 0x0 , 0xb7, 
+	0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xc6, 0x1 , 
+	0x0 , 0x0 , 0xc5, 0x1 , 0x0 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 
+	0x0 , 0xc4, 0x1 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xc4, 0x1 , 0x0 , 0x0 , 
+	0xf5, 0x0 , 0x7 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xc7, 0x1 , 0x0 , 0x0 , 0xc2, 
+	0x1 , 0x0 , 0x0 , 0xd0, 0x0 , 0x0 , 0x0 , 0xc6, 0x1 , 0x0 , 0x0 , 0xc3, 0x1 , 
+	0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0xc9, 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0xc7, 0x1 , 0x0 , 0x0 , 0xc8, 0x1 , 0x0 , 0x0 , 
+	0xc9, 0x1 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xc8, 0x1 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xca, 0x1 , 0x0 , 0x0 , 0xa2, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0xcb, 0x1 , 0x0 , 
+	0x0 , 0xbb, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 
+	0xcc, 0x1 , 0x0 , 0x0 , 0xc9, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 
+	0x0 , 0x0 , 0x0 , 0xcd, 0x1 , 0x0 , 0x0 , 0xca, 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 
+	0x7 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0xce, 0x1 , 0x0 , 0x0 , 0xcb, 0x1 , 0x0 , 
+	0x0 , 0xcc, 0x1 , 0x0 , 0x0 , 0xcd, 0x1 , 0x0 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 
+	0x41, 0x0 , 0x6 , 0x0 , 0xc3, 0x0 , 0x0 , 0x0 , 0xcf, 0x1 , 0x0 , 0x0 , 0x15, 
+	0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0xca, 0x1 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x3 , 0x0 , 0xcf, 0x1 , 0x0 , 0x0 , 0xce, 0x1 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 
+	0x0 , 0xc9, 0x1 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xc9, 0x1 , 0x0 , 0x0 , 
+	0xfd, 0x0 , 0x1 , 0x0 , 0x38, 0x0 , 0x1 , 0x0 , 
+};
+const unsigned char TextScanShader [] = {
+	0x3 , 0x2 , 0x23, 0x7 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xd7, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x2 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0xb , 0x0 , 0x6 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x47, 0x4c, 0x53, 
+	0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0xe , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0xf , 
+	0x0 , 0x6 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 
+	0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x3f, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x6 , 
+	0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x3 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0xc2, 0x1 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x3a, 0x0 , 
+	0x0 , 0x0 , 0x6d, 0x61, 0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 
+	0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 
+	0x72, 0x73, 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x62, 0x79, 0x74, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x0 , 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 
+	0x0 , 0x74, 0x69, 0x6c, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x0 , 0x0 , 0x0 , 
+	0x6 , 0x0 , 0x7 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x73, 
+	0x74, 0x61, 0x72, 0x74, 0x73, 0x49, 0x6e, 0x51, 0x75, 0x6f, 0x74, 0x65, 0x0 , 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 
+	0x0 , 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x43, 0x61, 0x70, 0x61, 0x63, 0x69, 
+	0x74, 0x79, 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x62, 0x61, 0x73, 0x65, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x64, 0x65, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x65, 0x72, 0x0 , 0x0 , 0x0 , 
+	0x6 , 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x71, 
+	0x75, 0x6f, 0x74, 0x65, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 
+	0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x6e, 0x65, 0x77, 0x6c, 0x69, 0x6e, 0x65, 
+	0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x70, 0x61, 0x72, 0x61, 
+	0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0xd , 
+	0x0 , 0x0 , 0x0 , 0x74, 0x69, 0x6c, 0x65, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x74, 0x69, 0x6c, 0x65, 0x41, 0x72, 0x72, 0x61, 0x79, 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x5 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x72, 0x65, 0x73, 0x75, 0x6c, 
+	0x74, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x11, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x43, 
+	0x6f, 0x75, 0x6e, 0x74, 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x65, 0x6e, 0x64, 0x73, 0x49, 0x6e, 0x51, 0x75, 0x6f, 
+	0x74, 0x65, 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x73, 0x75, 
+	0x6d, 0x6d, 0x61, 0x72, 0x69, 0x65, 0x73, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 
+	0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x43, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x0 , 
+	0x5 , 0x0 , 0x3 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x61, 0x0 , 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x3 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x62, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x3 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 0x61, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x3 , 
+	0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x62, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 
+	0x20, 0x0 , 0x0 , 0x0 , 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x73, 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x4 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 0x3f, 0x0 , 0x0 , 0x0 , 0x67, 0x6c, 0x5f, 
+	0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 
+	0x6f, 0x6e, 0x49, 0x44, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 0x44, 
+	0x0 , 0x0 , 0x0 , 0x74, 0x69, 0x6c, 0x65, 0x73, 0x50, 0x65, 0x72, 0x54, 0x68, 
+	0x72, 0x65, 0x61, 0x64, 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x4c, 0x0 , 0x0 , 
+	0x0 , 0x66, 0x69, 0x72, 0x73, 0x74, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 
+	0x53, 0x0 , 0x0 , 0x0 , 0x6c, 0x61, 0x73, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x4 , 0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0x76, 0x61, 0x6c, 0x75, 0x65, 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x3 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0x69, 0x0 , 0x0 , 
+	0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x76, 0x0 , 0x0 , 0x0 , 0x73, 0x74, 0x72, 0x69, 
+	0x64, 0x65, 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x7e, 0x0 , 0x0 , 0x0 , 0x6c, 
+	0x65, 0x66, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x92, 0x0 , 
+	0x0 , 0x0 , 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 
+	0x0 , 0x9b, 0x0 , 0x0 , 0x0 , 0x73, 0x74, 0x61, 0x74, 0x65, 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x4 , 0x0 , 0xa1, 0x0 , 0x0 , 0x0 , 0x73, 0x6c, 0x6f, 0x74, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x3 , 0x0 , 0xaa, 0x0 , 0x0 , 0x0 , 0x69, 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0xb4, 0x0 , 0x0 , 0x0 , 0x74, 0x69, 0x6c, 
+	0x65, 0x0 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x48, 
+	0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 
+	0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 0x0 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 
+	0x48, 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x23, 
+	0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 
+	0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 
+	0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 
+	0x23, 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x8 , 
+	0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x1c, 0x0 , 
+	0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 
+	0x8 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0xc , 
+	0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 
+	0x5 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 
+	0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x22, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 
+	0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 
+	0x3 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 
+	0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x47, 0x0 , 0x4 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x3 , 
+	0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x3f, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 
+	0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x15, 
+	0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0xa , 0x0 , 0x8 , 
+	0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 
+	0x9 , 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x3b, 
+	0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 
+	0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x3 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 
+	0xb , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0xc , 
+	0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0xe , 0x0 , 0x0 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x1e, 
+	0x0 , 0x4 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 
+	0x10, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 
+	0x4 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 
+	0x0 , 0x1c, 0x0 , 0x4 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x17, 0x0 , 
+	0x0 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x5 , 
+	0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 
+	0x15, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x7 , 
+	0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x21, 0x0 , 
+	0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x20, 0x0 , 0x4 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 0x2 , 0x0 , 0x28, 0x0 , 0x0 , 
+	0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x13, 0x0 , 0x2 , 0x0 , 0x3b, 0x0 , 0x0 , 0x0 , 0x21, 
+	0x0 , 0x3 , 0x0 , 0x3c, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 
+	0x4 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x3f, 0x0 , 0x0 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x46, 0x0 , 
+	0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x49, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 
+	0x2c, 0x0 , 0x6 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x5b, 0x0 , 0x0 , 0x0 , 0x26, 
+	0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 
+	0x4 , 0x0 , 0x6a, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 
+	0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x73, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x15, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x74, 
+	0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x8 , 0x1 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0x20, 0x0 , 0x4 , 0x0 , 0xb5, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0xb , 
+	0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xce, 0x0 , 
+	0x0 , 0x0 , 0xff, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0xd4, 0x0 , 0x0 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x5 , 0x0 , 
+	0x15, 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x19, 
+	0x0 , 0x0 , 0x0 , 0x37, 0x0 , 0x3 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 
+	0x0 , 0x0 , 0x37, 0x0 , 0x3 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x1e, 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 
+	0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 
+	0x1a, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x1b, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 
+	0x0 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 
+	0xab, 0x0 , 0x5 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x25, 
+	0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x15, 0x0 , 
+	0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x4f, 0x0 , 0x7 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 
+	0x29, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x1f, 0x0 , 
+	0x0 , 0x0 , 0x4f, 0x0 , 0x7 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 0x0 , 
+	0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x5 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x2d, 
+	0x0 , 0x0 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0xa9, 0x0 , 
+	0x6 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0x2d, 0x0 , 0x0 , 
+	0x0 , 0x2a, 0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0x20, 0x0 , 0x0 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x24, 
+	0x0 , 0x0 , 0x0 , 0x30, 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x31, 0x0 , 0x0 , 
+	0x0 , 0x30, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 
+	0x32, 0x0 , 0x0 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0x32, 0x0 , 
+	0x0 , 0x0 , 0xc6, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x34, 0x0 , 0x0 , 
+	0x0 , 0x31, 0x0 , 0x0 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x15, 0x0 , 0x0 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 0x4f, 
+	0x0 , 0x7 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x35, 0x0 , 
+	0x0 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 
+	0x20, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x38, 
+	0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 
+	0x5 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0x34, 0x0 , 0x0 , 
+	0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0xfe, 0x0 , 0x2 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 
+	0x38, 0x0 , 0x1 , 0x0 , 0x36, 0x0 , 0x5 , 0x0 , 0x3b, 0x0 , 0x0 , 0x0 , 0x3a, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x3c, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 
+	0x2 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x24, 0x0 , 0x0 , 
+	0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x24, 0x0 , 0x0 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 
+	0x0 , 0x4 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x53, 0x0 , 0x0 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 
+	0x5a, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x24, 
+	0x0 , 0x0 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x4 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x76, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x7e, 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x92, 
+	0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x24, 0x0 , 
+	0x0 , 0x0 , 0x9b, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 
+	0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0xa1, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x4 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x0 , 0x0 , 0x7 , 
+	0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0xb5, 0x0 , 0x0 , 0x0 , 0xb4, 0x0 , 
+	0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x42, 0x0 , 0x0 , 
+	0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x3f, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x43, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0x43, 0x0 , 
+	0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x46, 0x0 , 0x0 , 0x0 , 0x45, 0x0 , 0x0 , 
+	0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x45, 0x0 , 0x0 , 0x0 , 0x80, 
+	0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x0 , 0x0 , 0x49, 0x0 , 0x0 , 0x0 , 
+	0x86, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 0x4a, 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x44, 0x0 , 
+	0x0 , 0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x4d, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0x84, 
+	0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0x4d, 0x0 , 
+	0x0 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x46, 0x0 , 0x0 , 
+	0x0 , 0x50, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0x50, 
+	0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x7 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x52, 0x0 , 
+	0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x4f, 0x0 , 0x0 , 
+	0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 
+	0x52, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x54, 
+	0x0 , 0x0 , 0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x56, 0x0 , 0x0 , 0x0 , 0x54, 0x0 , 0x0 , 0x0 , 
+	0x55, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x46, 0x0 , 0x0 , 0x0 , 0x57, 
+	0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0x57, 0x0 , 0x0 , 
+	0x0 , 0xc , 0x0 , 0x7 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x59, 0x0 , 0x0 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x56, 0x0 , 0x0 , 0x0 , 0x58, 
+	0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 0x59, 0x0 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0x5b, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 
+	0x4c, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0x5d, 
+	0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 
+	0x2 , 0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 0xf6, 0x0 , 0x4 , 0x0 , 0x62, 0x0 , 0x0 , 
+	0x0 , 0x61, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 
+	0x5f, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0x5c, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x64, 0x0 , 0x0 , 
+	0x0 , 0x53, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 
+	0x65, 0x0 , 0x0 , 0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0x64, 0x0 , 0x0 , 0x0 , 0xfa, 
+	0x0 , 0x4 , 0x0 , 0x65, 0x0 , 0x0 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0x62, 0x0 , 
+	0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x66, 0x0 , 0x0 , 0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 0x5c, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x68, 0x0 , 
+	0x0 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x6a, 0x0 , 0x0 , 
+	0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 
+	0x68, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x6b, 
+	0x0 , 0x0 , 0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0x4f, 0x0 , 0x8 , 0x0 , 0x15, 0x0 , 
+	0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0x6b, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0x39, 0x0 , 0x6 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x6d, 0x0 , 0x0 , 0x0 , 0x18, 
+	0x0 , 0x0 , 0x0 , 0x66, 0x0 , 0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x3 , 0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0x6d, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 
+	0x0 , 0x61, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x61, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x6e, 0x0 , 0x0 , 0x0 , 0x5c, 
+	0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x6f, 0x0 , 
+	0x0 , 0x0 , 0x6e, 0x0 , 0x0 , 0x0 , 0x49, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 
+	0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 0x6f, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 
+	0x5e, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x62, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x70, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x71, 0x0 , 0x0 , 
+	0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x73, 0x0 , 0x0 , 0x0 , 
+	0x72, 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x70, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0x72, 0x0 , 0x0 , 0x0 , 0x71, 0x0 , 0x0 , 0x0 , 0xe0, 0x0 , 
+	0x4 , 0x0 , 0x74, 0x0 , 0x0 , 0x0 , 0x74, 0x0 , 0x0 , 0x0 , 0x75, 0x0 , 0x0 , 
+	0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x76, 0x0 , 0x0 , 0x0 , 0x49, 0x0 , 0x0 , 0x0 , 
+	0xf9, 0x0 , 0x2 , 0x0 , 0x77, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x77, 
+	0x0 , 0x0 , 0x0 , 0xf6, 0x0 , 0x4 , 0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 0x7a, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x78, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x78, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x0 , 0x0 , 0x76, 0x0 , 0x0 , 0x0 , 0xb0, 
+	0x0 , 0x5 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x7d, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x7d, 0x0 , 0x0 , 
+	0x0 , 0x79, 0x0 , 0x0 , 0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0x79, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x7e, 0x0 , 0x0 , 0x0 , 0x5b, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x7f, 0x0 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x80, 0x0 , 0x0 , 0x0 , 0x76, 0x0 , 0x0 , 0x0 , 0xae, 0x0 , 0x5 , 0x0 , 
+	0x28, 0x0 , 0x0 , 0x0 , 0x81, 0x0 , 0x0 , 0x0 , 0x7f, 0x0 , 0x0 , 0x0 , 0x80, 
+	0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x83, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x81, 0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x0 , 
+	0x0 , 0x83, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x82, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x85, 0x0 , 
+	0x0 , 0x0 , 0x76, 0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x86, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x0 , 0x0 , 0x85, 0x0 , 0x0 , 0x0 , 
+	0x41, 0x0 , 0x5 , 0x0 , 0x73, 0x0 , 0x0 , 0x0 , 0x87, 0x0 , 0x0 , 0x0 , 0x14, 
+	0x0 , 0x0 , 0x0 , 0x86, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x15, 0x0 , 
+	0x0 , 0x0 , 0x88, 0x0 , 0x0 , 0x0 , 0x87, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 
+	0x0 , 0x7e, 0x0 , 0x0 , 0x0 , 0x88, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 
+	0x83, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x83, 0x0 , 0x0 , 0x0 , 0xe0, 
+	0x0 , 0x4 , 0x0 , 0x74, 0x0 , 0x0 , 0x0 , 0x74, 0x0 , 0x0 , 0x0 , 0x75, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x89, 0x0 , 0x0 , 
+	0x0 , 0x7e, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 
+	0x8a, 0x0 , 0x0 , 0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0x39, 0x0 , 0x6 , 0x0 , 0x15, 
+	0x0 , 0x0 , 0x0 , 0x8b, 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x89, 0x0 , 
+	0x0 , 0x0 , 0x8a, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x5a, 0x0 , 0x0 , 
+	0x0 , 0x8b, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x8c, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x15, 
+	0x0 , 0x0 , 0x0 , 0x8d, 0x0 , 0x0 , 0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 
+	0x5 , 0x0 , 0x73, 0x0 , 0x0 , 0x0 , 0x8e, 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 0x0 , 
+	0x0 , 0x8c, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x8e, 0x0 , 0x0 , 0x0 , 
+	0x8d, 0x0 , 0x0 , 0x0 , 0xe0, 0x0 , 0x4 , 0x0 , 0x74, 0x0 , 0x0 , 0x0 , 0x74, 
+	0x0 , 0x0 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x7a, 0x0 , 
+	0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x7a, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x90, 0x0 , 0x0 , 0x0 , 0x76, 0x0 , 0x0 , 0x0 , 
+	0x84, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x91, 0x0 , 0x0 , 0x0 , 0x90, 
+	0x0 , 0x0 , 0x0 , 0x74, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x76, 0x0 , 
+	0x0 , 0x0 , 0x91, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x77, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0x92, 0x0 , 0x0 , 0x0 , 0x5b, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x93, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0xac, 0x0 , 
+	0x5 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x94, 0x0 , 0x0 , 0x0 , 0x93, 0x0 , 0x0 , 
+	0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x96, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x94, 0x0 , 0x0 , 0x0 , 0x95, 
+	0x0 , 0x0 , 0x0 , 0x96, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x95, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x97, 0x0 , 0x0 , 
+	0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x98, 0x0 , 0x0 , 0x0 , 0x97, 0x0 , 0x0 , 0x0 , 0x49, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x5 , 0x0 , 0x73, 0x0 , 0x0 , 0x0 , 0x99, 0x0 , 0x0 , 0x0 , 0x14, 0x0 , 
+	0x0 , 0x0 , 0x98, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x15, 0x0 , 0x0 , 
+	0x0 , 0x9a, 0x0 , 0x0 , 0x0 , 0x99, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0x92, 0x0 , 0x0 , 0x0 , 0x9a, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x96, 
+	0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x96, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 
+	0x5 , 0x0 , 0x46, 0x0 , 0x0 , 0x0 , 0x9c, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 
+	0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x9d, 0x0 , 0x0 , 0x0 , 0x9c, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x24, 
+	0x0 , 0x0 , 0x0 , 0x9e, 0x0 , 0x0 , 0x0 , 0x92, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x9f, 0x0 , 0x0 , 
+	0x0 , 0x9e, 0x0 , 0x0 , 0x0 , 0xc6, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0xa0, 0x0 , 0x0 , 0x0 , 0x9d, 0x0 , 0x0 , 0x0 , 0x9f, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0x9b, 0x0 , 0x0 , 0x0 , 0xa0, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 
+	0x5 , 0x0 , 0x46, 0x0 , 0x0 , 0x0 , 0xa2, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 
+	0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0xa3, 0x0 , 0x0 , 0x0 , 0xa2, 0x0 , 0x0 , 0x0 , 0xab, 0x0 , 0x5 , 0x0 , 0x28, 
+	0x0 , 0x0 , 0x0 , 0xa4, 0x0 , 0x0 , 0x0 , 0xa3, 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 
+	0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0xa5, 0x0 , 0x0 , 
+	0x0 , 0x92, 0x0 , 0x0 , 0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0xa6, 0x0 , 0x0 , 0x0 , 0xa5, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x5 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0xa7, 0x0 , 0x0 , 0x0 , 0x92, 0x0 , 
+	0x0 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0xa8, 0x0 , 0x0 , 0x0 , 0xa7, 0x0 , 0x0 , 0x0 , 0xa9, 0x0 , 0x6 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0xa9, 0x0 , 0x0 , 0x0 , 0xa4, 0x0 , 0x0 , 0x0 , 0xa6, 
+	0x0 , 0x0 , 0x0 , 0xa8, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xa1, 0x0 , 
+	0x0 , 0x0 , 0xa9, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0xab, 0x0 , 0x0 , 0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0xaa, 0x0 , 0x0 , 0x0 , 0xab, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xac, 
+	0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xac, 0x0 , 0x0 , 0x0 , 0xf6, 0x0 , 
+	0x4 , 0x0 , 0xb0, 0x0 , 0x0 , 0x0 , 0xaf, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xad, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0xad, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xb1, 
+	0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0xb2, 0x0 , 0x0 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 
+	0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0xb3, 0x0 , 0x0 , 0x0 , 0xb1, 0x0 , 0x0 , 0x0 , 
+	0xb2, 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0xb3, 0x0 , 0x0 , 0x0 , 0xae, 
+	0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xae, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xb6, 0x0 , 0x0 , 
+	0x0 , 0xaa, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x6a, 0x0 , 0x0 , 0x0 , 
+	0xb7, 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0xb6, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0xb8, 0x0 , 
+	0x0 , 0x0 , 0xb7, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xb4, 0x0 , 0x0 , 
+	0x0 , 0xb8, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0xb9, 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0xba, 0x0 , 0x0 , 0x0 , 0x9b, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xbb, 0x0 , 0x0 , 0x0 , 0xa1, 0x0 , 0x0 , 
+	0x0 , 0x50, 0x0 , 0x7 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0xbc, 0x0 , 0x0 , 0x0 , 
+	0xba, 0x0 , 0x0 , 0x0 , 0xbb, 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x26, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x6a, 0x0 , 0x0 , 0x0 , 0xbd, 0x0 , 
+	0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0xb9, 0x0 , 0x0 , 
+	0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xbd, 0x0 , 0x0 , 0x0 , 0xbc, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xbe, 0x0 , 0x0 , 0x0 , 0x9b, 
+	0x0 , 0x0 , 0x0 , 0xab, 0x0 , 0x5 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0xbf, 0x0 , 
+	0x0 , 0x0 , 0xbe, 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 
+	0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0xc0, 0x0 , 0x0 , 0x0 , 0xb4, 0x0 , 0x0 , 0x0 , 
+	0x8f, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xc1, 
+	0x0 , 0x0 , 0x0 , 0xc0, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x24, 0x0 , 
+	0x0 , 0x0 , 0xc2, 0x0 , 0x0 , 0x0 , 0xb4, 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xc3, 0x0 , 0x0 , 0x0 , 
+	0xc2, 0x0 , 0x0 , 0x0 , 0xa9, 0x0 , 0x6 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xc4, 
+	0x0 , 0x0 , 0x0 , 0xbf, 0x0 , 0x0 , 0x0 , 0xc1, 0x0 , 0x0 , 0x0 , 0xc3, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xc5, 0x0 , 0x0 , 
+	0x0 , 0xa1, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0xc6, 0x0 , 0x0 , 0x0 , 0xc5, 0x0 , 0x0 , 0x0 , 0xc4, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0xa1, 0x0 , 0x0 , 0x0 , 0xc6, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 
+	0x5 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0xc7, 0x0 , 0x0 , 0x0 , 0xb4, 0x0 , 0x0 , 
+	0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0xc8, 0x0 , 0x0 , 0x0 , 0xc7, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0xc9, 0x0 , 0x0 , 0x0 , 0x9b, 0x0 , 0x0 , 0x0 , 0xc6, 0x0 , 
+	0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xca, 0x0 , 0x0 , 0x0 , 0xc9, 0x0 , 0x0 , 
+	0x0 , 0xc8, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x9b, 0x0 , 0x0 , 0x0 , 
+	0xca, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xaf, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0xaf, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0xcb, 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xcc, 0x0 , 0x0 , 0x0 , 0xcb, 0x0 , 0x0 , 0x0 , 
+	0x49, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xaa, 0x0 , 0x0 , 0x0 , 0xcc, 
+	0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xac, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 
+	0x2 , 0x0 , 0xb0, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0xcd, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0xaa, 0x0 , 0x5 , 0x0 , 
+	0x28, 0x0 , 0x0 , 0x0 , 0xcf, 0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 0x0 , 0x0 , 0xce, 
+	0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0xd1, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0xcf, 0x0 , 0x0 , 0x0 , 0xd0, 0x0 , 0x0 , 
+	0x0 , 0xd1, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xd0, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0xd2, 0x0 , 0x0 , 0x0 , 0xa1, 
+	0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0xd4, 0x0 , 0x0 , 0x0 , 0xd3, 0x0 , 
+	0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 
+	0x0 , 0xd3, 0x0 , 0x0 , 0x0 , 0xd2, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0xd5, 0x0 , 0x0 , 0x0 , 0x9b, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x5 , 0x0 , 0xd4, 0x0 , 0x0 , 0x0 , 0xd6, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 
+	0x0 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0xd6, 0x0 , 0x0 , 
+	0x0 , 0xd5, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0xd1, 0x0 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0xd1, 0x0 , 0x0 , 0x0 , 0xfd, 0x0 , 0x1 , 0x0 , 0x38, 
+	0x0 , 0x1 , 0x0 , 
+};
+const unsigned char CsrCompactShader [] = {
+	0x3 , 0x2 , 0x23, 0x7 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xa6, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x2 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x11, 0x0 , 0x2 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x2 , 
+	0x0 , 0x47, 0x11, 0x0 , 0x0 , 0xa , 0x0 , 0x7 , 0x0 , 0x53, 0x50, 0x56, 0x5f, 
+	0x4b, 0x48, 0x52, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 
+	0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x7 , 0x0 , 0x53, 0x50, 
+	0x56, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 
+	0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x6 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 
+	0x34, 0x35, 0x30, 0x0 , 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x8 , 0x0 , 0x80, 0x0 , 
+	0x0 , 0x0 , 0x53, 0x50, 0x56, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 0x73, 0x68, 0x61, 
+	0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 
+	0xe , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0xf , 
+	0x0 , 0x8 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 
+	0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 0x0 , 
+	0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x6 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 
+	0x11, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x3 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xc2, 0x1 , 
+	0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 0x5f, 0x41, 0x4d, 0x44, 0x5f, 
+	0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 0x5f, 0x41, 0x52, 
+	0x42, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x62, 0x61, 0x6c, 0x6c, 
+	0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x7 , 0x0 , 0x47, 0x4c, 0x5f, 
+	0x41, 0x52, 0x42, 0x5f, 0x67, 0x70, 0x75, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 
+	0x72, 0x5f, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x1e, 
+	0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x6 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x77, 0x72, 0x69, 0x74, 0x65, 0x45, 0x6e, 
+	0x74, 0x72, 0x69, 0x65, 0x73, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 
+	0xb , 0x0 , 0x0 , 0x0 , 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 
+	0x73, 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x72, 0x6f, 0x77, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 
+	0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x0 , 0x6 , 
+	0x0 , 0x6 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x72, 0x6f, 
+	0x77, 0x50, 0x69, 0x74, 0x63, 0x68, 0x0 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 
+	0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x74, 0x68, 0x72, 0x65, 
+	0x73, 0x68, 0x6f, 0x6c, 0x64, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x8 , 
+	0x0 , 0x0 , 0x0 , 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x74, 
+	0x72, 0x69, 0x78, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 
+	0xf , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x74, 0x72, 0x69, 
+	0x78, 0x41, 0x72, 0x72, 0x61, 0x79, 0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 0x13, 0x0 , 
+	0x0 , 0x0 , 0x72, 0x6f, 0x77, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x44, 0x61, 
+	0x74, 0x61, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x72, 0x6f, 0x77, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 
+	0x41, 0x72, 0x72, 0x61, 0x79, 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x17, 0x0 , 
+	0x0 , 0x0 , 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x44, 0x61, 0x74, 0x61, 0x0 , 
+	0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x41, 0x72, 0x72, 0x61, 0x79, 0x0 , 0x5 , 
+	0x0 , 0x5 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x76, 0x61, 0x6c, 0x75, 0x65, 0x44, 
+	0x61, 0x74, 0x61, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x1b, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x76, 0x61, 0x6c, 0x75, 0x65, 0x41, 0x72, 0x72, 
+	0x61, 0x79, 0x0 , 0x0 , 0x5 , 0x0 , 0x3 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x72, 
+	0x6f, 0x77, 0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x67, 0x6c, 
+	0x5f, 0x57, 0x6f, 0x72, 0x6b, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x49, 0x44, 0x0 , 
+	0x0 , 0x5 , 0x0 , 0x7 , 0x0 , 0x2a, 0x0 , 0x0 , 0x0 , 0x67, 0x6c, 0x5f, 0x4e, 
+	0x75, 0x6d, 0x57, 0x6f, 0x72, 0x6b, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x72, 0x6f, 
+	0x77, 0x53, 0x74, 0x61, 0x72, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 
+	0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x73, 0x6c, 0x6f, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x4 , 0x0 , 0x45, 0x0 , 0x0 , 0x0 , 0x66, 0x69, 0x72, 0x73, 0x74, 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0x63, 0x6f, 
+	0x6c, 0x75, 0x6d, 0x6e, 0x0 , 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 0x51, 0x0 , 0x0 , 
+	0x0 , 0x67, 0x6c, 0x5f, 0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 
+	0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 
+	0x0 , 0x6 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x74, 0x68, 0x69, 0x73, 0x4c, 0x61, 
+	0x6e, 0x65, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 
+	0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0x6c, 0x61, 0x6e, 0x65, 0x41, 0x63, 0x74, 0x69, 
+	0x76, 0x65, 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x6d, 
+	0x61, 0x73, 0x6b, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x7d, 0x0 , 
+	0x0 , 0x0 , 0x65, 0x6e, 0x74, 0x72, 0x79, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 
+	0x0 , 0x89, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 0x73, 0x6b, 0x50, 0x61, 0x72, 0x74, 
+	0x73, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0xb , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 
+	0x23, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0xb , 
+	0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 
+	0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 
+	0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 
+	0xb , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0xe , 
+	0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 
+	0x5 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 
+	0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x22, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0xd , 0x0 , 
+	0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 
+	0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x48, 0x0 , 0x5 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x13, 0x0 , 
+	0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 0x0 , 
+	0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 
+	0x11, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x48, 
+	0x0 , 0x5 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x17, 0x0 , 0x0 , 
+	0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 
+	0x22, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x16, 
+	0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 
+	0x5 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 
+	0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x22, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x1a, 0x0 , 
+	0x0 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 
+	0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 
+	0x47, 0x0 , 0x4 , 0x0 , 0x2a, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x18, 
+	0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 
+	0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x14, 
+	0x0 , 0x2 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 0x3 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x31, 0x0 , 0x3 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x4 , 0x0 , 0x9 , 
+	0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 
+	0x3 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x6 , 
+	0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 
+	0x9 , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0xc , 
+	0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x4 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 
+	0x0 , 0x1d, 0x0 , 0x3 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 
+	0x1e, 0x0 , 0x3 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x20, 
+	0x0 , 0x4 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 
+	0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x3 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 
+	0x9 , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x12, 
+	0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x14, 0x0 , 0x0 , 
+	0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x1e, 
+	0x0 , 0x3 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 
+	0x4 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 
+	0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x19, 
+	0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x3 , 0x0 , 0x1b, 0x0 , 
+	0x0 , 0x0 , 0xe , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x1c, 0x0 , 0x0 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x1c, 0x0 , 0x0 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 
+	0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 
+	0x0 , 0x0 , 0x13, 0x0 , 0x2 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x21, 0x0 , 0x3 , 
+	0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 
+	0x23, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x17, 
+	0x0 , 0x4 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 
+	0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 
+	0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 
+	0x24, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x28, 
+	0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x4 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 
+	0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 
+	0x9 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x43, 0x0 , 
+	0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 
+	0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 
+	0x20, 0x0 , 0x4 , 0x0 , 0x56, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0xa , 
+	0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x57, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x59, 0x0 , 0x0 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 
+	0x64, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x20, 
+	0x0 , 0x4 , 0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 
+	0x0 , 0x0 , 0x15, 0x0 , 0x4 , 0x0 , 0x6d, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x6e, 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x6d, 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0x71, 
+	0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x17, 0x0 , 
+	0x4 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x8a, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x75, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x98, 
+	0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x5 , 0x0 , 0x1f, 0x0 , 
+	0x0 , 0x0 , 0x1e, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x23, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 
+	0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x0 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 
+	0x45, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x23, 
+	0x0 , 0x0 , 0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x4 , 0x0 , 0x56, 0x0 , 0x0 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x59, 0x0 , 0x0 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x6e, 0x0 , 0x0 , 0x0 , 0x6c, 
+	0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x23, 0x0 , 
+	0x0 , 0x0 , 0x7d, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 
+	0x0 , 0x8a, 0x0 , 0x0 , 0x0 , 0x89, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x41, 0x0 , 0x5 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x24, 
+	0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 
+	0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 
+	0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 0x0 , 0x0 , 
+	0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x2c, 
+	0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0x9 , 0x0 , 
+	0x0 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 0x0 , 
+	0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 
+	0x24, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x9 , 
+	0x0 , 0x0 , 0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 
+	0x5 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x30, 0x0 , 0x0 , 0x0 , 0x2d, 0x0 , 0x0 , 
+	0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 
+	0x30, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x31, 
+	0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x33, 0x0 , 
+	0x0 , 0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x34, 0x0 , 0x0 , 0x0 , 
+	0x32, 0x0 , 0x0 , 0x0 , 0xae, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x35, 
+	0x0 , 0x0 , 0x0 , 0x31, 0x0 , 0x0 , 0x0 , 0x34, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 
+	0x3 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 
+	0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0xfd, 0x0 , 0x1 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 
+	0x0 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 
+	0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 
+	0x19, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x3b, 
+	0x0 , 0x0 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0x9 , 0x0 , 
+	0x0 , 0x0 , 0x3c, 0x0 , 0x0 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x0 , 
+	0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0x3c, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0xf7, 
+	0x0 , 0x3 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 
+	0x4 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x3f, 0x0 , 0x0 , 0x0 , 0x40, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x3f, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x9 , 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x6 , 0x0 , 0x43, 0x0 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 
+	0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0xf9, 
+	0x0 , 0x2 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x40, 0x0 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x45, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x0 , 
+	0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x46, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0x46, 0x0 , 0x0 , 0x0 , 0xf6, 0x0 , 0x4 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0x49, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x47, 0x0 , 
+	0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 0x45, 0x0 , 0x0 , 0x0 , 
+	0x41, 0x0 , 0x5 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 0x8 , 
+	0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 
+	0x0 , 0x0 , 0x4d, 0x0 , 0x0 , 0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 
+	0x4d, 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x48, 
+	0x0 , 0x0 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x48, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x0 , 
+	0x0 , 0x45, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 
+	0x52, 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 0x52, 0x0 , 
+	0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x54, 0x0 , 0x0 , 
+	0x0 , 0x50, 0x0 , 0x0 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0x4f, 0x0 , 0x0 , 0x0 , 0x54, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x55, 
+	0x0 , 0x0 , 0x0 , 0x57, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x58, 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 
+	0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 
+	0x33, 0x0 , 0x0 , 0x0 , 0x5b, 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x15, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x5c, 0x0 , 
+	0x0 , 0x0 , 0x5b, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0x5c, 0x0 , 0x0 , 0x0 , 
+	0xf7, 0x0 , 0x3 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 
+	0x0 , 0x4 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 0x5f, 0x0 , 
+	0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0x38, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x61, 0x0 , 0x0 , 0x0 , 0x4f, 
+	0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x62, 0x0 , 
+	0x0 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0x61, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 
+	0x0 , 0x64, 0x0 , 0x0 , 0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 
+	0x3 , 0x0 , 0x0 , 0x0 , 0x62, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 
+	0x0 , 0x0 , 0x0 , 0x65, 0x0 , 0x0 , 0x0 , 0x63, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x3 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x65, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x66, 0x0 , 0x0 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 
+	0xc , 0x0 , 0x6 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x66, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 
+	0x5 , 0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0x68, 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 
+	0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 
+	0x6a, 0x0 , 0x0 , 0x0 , 0x68, 0x0 , 0x0 , 0x0 , 0xba, 0x0 , 0x5 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0x67, 0x0 , 0x0 , 0x0 , 0x6a, 0x0 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0x6b, 0x0 , 0x0 , 
+	0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x5f, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0x5f, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x6f, 
+	0x0 , 0x0 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0x45, 0x11, 0x4 , 0x0 , 0x71, 0x0 , 
+	0x0 , 0x0 , 0x70, 0x0 , 0x0 , 0x0 , 0x6f, 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 
+	0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x72, 0x0 , 0x0 , 0x0 , 0x70, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x51, 0x0 , 0x5 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x73, 
+	0x0 , 0x0 , 0x0 , 0x70, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 
+	0x5 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x74, 0x0 , 0x0 , 0x0 , 0x72, 0x0 , 0x0 , 
+	0x0 , 0x73, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x6d, 0x0 , 0x0 , 0x0 , 
+	0x76, 0x0 , 0x0 , 0x0 , 0x74, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x6c, 
+	0x0 , 0x0 , 0x0 , 0x76, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x78, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x6 , 0x0 , 0x0 , 
+	0x0 , 0x77, 0x0 , 0x0 , 0x0 , 0x78, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 
+	0x77, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x79, 
+	0x0 , 0x0 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x78, 0x0 , 
+	0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x78, 0x0 , 0x0 , 0x0 , 0xf5, 0x0 , 0x7 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x7a, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 
+	0x5f, 0x0 , 0x0 , 0x0 , 0x79, 0x0 , 0x0 , 0x0 , 0x77, 0x0 , 0x0 , 0x0 , 0xf7, 
+	0x0 , 0x3 , 0x0 , 0x7c, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 
+	0x4 , 0x0 , 0x7a, 0x0 , 0x0 , 0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x9 , 0x0 , 0x0 , 0x0 , 0x7e, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x6d, 0x0 , 0x0 , 0x0 , 0x7f, 0x0 , 0x0 , 0x0 , 0x6c, 0x0 , 
+	0x0 , 0x0 , 0xc , 0x0 , 0x6 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x81, 0x0 , 0x0 , 
+	0x0 , 0x80, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x7f, 0x0 , 0x0 , 0x0 , 
+	0x80, 0x0 , 0x5 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x0 , 0x0 , 0x7e, 
+	0x0 , 0x0 , 0x0 , 0x81, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x7d, 0x0 , 
+	0x0 , 0x0 , 0x82, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 
+	0x0 , 0x83, 0x0 , 0x0 , 0x0 , 0x7d, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x9 , 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x0 , 0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0x41, 
+	0x0 , 0x6 , 0x0 , 0x43, 0x0 , 0x0 , 0x0 , 0x85, 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 
+	0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x83, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 
+	0x0 , 0x85, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x9 , 0x0 , 0x0 , 0x0 , 0x86, 0x0 , 0x0 , 0x0 , 0x7d, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x87, 0x0 , 0x0 , 0x0 , 0x55, 0x0 , 
+	0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x64, 0x0 , 0x0 , 0x0 , 0x88, 0x0 , 0x0 , 
+	0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x86, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x88, 0x0 , 0x0 , 0x0 , 0x87, 0x0 , 0x0 , 0x0 , 0xf9, 
+	0x0 , 0x2 , 0x0 , 0x7c, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x7c, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x6d, 0x0 , 0x0 , 0x0 , 0x8b, 0x0 , 0x0 , 
+	0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 
+	0x8c, 0x0 , 0x0 , 0x0 , 0x8b, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x89, 
+	0x0 , 0x0 , 0x0 , 0x8c, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x23, 0x0 , 
+	0x0 , 0x0 , 0x8d, 0x0 , 0x0 , 0x0 , 0x89, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x8e, 0x0 , 0x0 , 0x0 , 
+	0x8d, 0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x8f, 
+	0x0 , 0x0 , 0x0 , 0x8e, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x23, 0x0 , 
+	0x0 , 0x0 , 0x90, 0x0 , 0x0 , 0x0 , 0x89, 0x0 , 0x0 , 0x0 , 0x15, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x91, 0x0 , 0x0 , 0x0 , 
+	0x90, 0x0 , 0x0 , 0x0 , 0xcd, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x92, 
+	0x0 , 0x0 , 0x0 , 0x91, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x2 , 0x0 , 
+	0x0 , 0x0 , 0x93, 0x0 , 0x0 , 0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 0x92, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x94, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x0 , 0x0 , 0x7c, 0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x95, 
+	0x0 , 0x0 , 0x0 , 0x93, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x9 , 0x0 , 
+	0x0 , 0x0 , 0x96, 0x0 , 0x0 , 0x0 , 0x94, 0x0 , 0x0 , 0x0 , 0x95, 0x0 , 0x0 , 
+	0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x3d, 0x0 , 0x0 , 0x0 , 0x96, 0x0 , 0x0 , 0x0 , 
+	0xf9, 0x0 , 0x2 , 0x0 , 0x49, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x49, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x97, 0x0 , 
+	0x0 , 0x0 , 0x45, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x9 , 0x0 , 0x0 , 
+	0x0 , 0x99, 0x0 , 0x0 , 0x0 , 0x97, 0x0 , 0x0 , 0x0 , 0x98, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x45, 0x0 , 0x0 , 0x0 , 0x99, 0x0 , 0x0 , 0x0 , 0xf9, 
+	0x0 , 0x2 , 0x0 , 0x46, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x4a, 0x0 , 
+	0x0 , 0x0 , 0xa8, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x9a, 0x0 , 0x0 , 
+	0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x9c, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x9a, 0x0 , 0x0 , 0x0 , 0x9b, 
+	0x0 , 0x0 , 0x0 , 0x9c, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x9b, 0x0 , 
+	0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x9d, 0x0 , 0x0 , 
+	0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x9 , 0x0 , 0x0 , 0x0 , 0x9e, 0x0 , 0x0 , 0x0 , 0x9d, 0x0 , 0x0 , 0x0 , 0xaa, 
+	0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x9f, 0x0 , 0x0 , 0x0 , 0x9e, 0x0 , 
+	0x0 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x9c, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x9c, 0x0 , 0x0 , 0x0 , 0xf5, 0x0 , 0x7 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0xa0, 0x0 , 0x0 , 0x0 , 0x9a, 0x0 , 0x0 , 0x0 , 0x4a, 
+	0x0 , 0x0 , 0x0 , 0x9f, 0x0 , 0x0 , 0x0 , 0x9b, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 
+	0x3 , 0x0 , 0xa2, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 
+	0x0 , 0xa0, 0x0 , 0x0 , 0x0 , 0xa1, 0x0 , 0x0 , 0x0 , 0xa2, 0x0 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0xa1, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x9 , 
+	0x0 , 0x0 , 0x0 , 0xa3, 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0xa4, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x0 , 
+	0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x43, 0x0 , 0x0 , 0x0 , 0xa5, 0x0 , 0x0 , 0x0 , 
+	0x11, 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0xa3, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0xa5, 0x0 , 0x0 , 0x0 , 0xa4, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 
+	0x2 , 0x0 , 0xa2, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0xa2, 0x0 , 0x0 , 
+	0x0 , 0xfd, 0x0 , 0x1 , 0x0 , 0x38, 0x0 , 0x1 , 0x0 , 
+};
+const unsigned char CsrScanShader [] = {
+	0x3 , 0x2 , 0x23, 0x7 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x94, 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x2 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0xb , 0x0 , 0x6 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x47, 0x4c, 0x53, 
+	0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30, 0x0 , 0x0 , 0x0 , 0x0 , 
+	0xe , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0xf , 
+	0x0 , 0x6 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x6d, 0x61, 
+	0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x6 , 
+	0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 
+	0x1 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x3 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0xc2, 0x1 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x12, 0x0 , 
+	0x0 , 0x0 , 0x6d, 0x61, 0x69, 0x6e, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 
+	0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x50, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 
+	0x72, 0x73, 0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x72, 0x6f, 0x77, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x6 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 
+	0x0 , 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x0 , 
+	0x6 , 0x0 , 0x6 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x72, 
+	0x6f, 0x77, 0x50, 0x69, 0x74, 0x63, 0x68, 0x0 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 
+	0x6 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x74, 0x68, 0x72, 
+	0x65, 0x73, 0x68, 0x6f, 0x6c, 0x64, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x5 , 0x0 , 
+	0x6 , 0x0 , 0x0 , 0x0 , 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 
+	0x73, 0x0 , 0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x72, 0x6f, 
+	0x77, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x44, 0x61, 0x74, 0x61, 0x0 , 0x0 , 
+	0x0 , 0x6 , 0x0 , 0x7 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x72, 0x6f, 0x77, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x41, 0x72, 0x72, 0x61, 
+	0x79, 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x73, 0x75, 
+	0x6d, 0x73, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x16, 0x0 , 0x0 , 
+	0x0 , 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x0 , 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 
+	0x18, 0x0 , 0x0 , 0x0 , 0x67, 0x6c, 0x5f, 0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x49, 
+	0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x5 , 0x0 , 0x6 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x72, 0x6f, 0x77, 
+	0x73, 0x50, 0x65, 0x72, 0x54, 0x68, 0x72, 0x65, 0x61, 0x64, 0x0 , 0x0 , 0x0 , 
+	0x5 , 0x0 , 0x4 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x66, 0x69, 0x72, 0x73, 0x74, 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x6c, 0x61, 
+	0x73, 0x74, 0x0 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x35, 0x0 , 0x0 , 
+	0x0 , 0x76, 0x61, 0x6c, 0x75, 0x65, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x3 , 0x0 , 
+	0x37, 0x0 , 0x0 , 0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x50, 
+	0x0 , 0x0 , 0x0 , 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x0 , 0x0 , 0x5 , 0x0 , 
+	0x4 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0x6c, 0x65, 0x66, 0x74, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x6f, 0x66, 0x66, 0x73, 
+	0x65, 0x74, 0x0 , 0x0 , 0x5 , 0x0 , 0x3 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x69, 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x7f, 0x0 , 0x0 , 0x0 , 0x63, 0x6f, 
+	0x75, 0x6e, 0x74, 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x48, 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x23, 
+	0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 
+	0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 
+	0x0 , 0x48, 0x0 , 0x5 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 
+	0x23, 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0x8 , 
+	0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0xb , 0x0 , 
+	0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x5 , 
+	0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x3 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0x3 , 
+	0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 0xa , 0x0 , 0x0 , 
+	0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x4 , 0x0 , 
+	0x18, 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x15, 
+	0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 
+	0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x3 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x15, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x20, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x16, 0x0 , 
+	0x3 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x6 , 
+	0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x9 , 
+	0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 
+	0x4 , 0x0 , 0x9 , 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 0x0 , 
+	0x0 , 0x1d, 0x0 , 0x3 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x1e, 0x0 , 0x3 , 0x0 , 0xc , 0x0 , 0x0 , 0x0 , 0xb , 0x0 , 0x0 , 0x0 , 0x20, 
+	0x0 , 0x4 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 
+	0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0xd , 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 
+	0xe , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x1c, 0x0 , 0x4 , 0x0 , 0x10, 
+	0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 
+	0x4 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x11, 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0x13, 0x0 , 0x2 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x21, 
+	0x0 , 0x3 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 
+	0x4 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x17, 0x0 , 0x4 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x3 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x1a, 0x0 , 0x0 , 0x0 , 0x1 , 
+	0x0 , 0x0 , 0x0 , 0x19, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x1a, 0x0 , 
+	0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 
+	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x20, 0x0 , 0x4 , 0x0 , 0x1d, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x9 , 0x0 , 
+	0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x14, 
+	0x0 , 0x2 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 0x0 , 0x44, 0x0 , 
+	0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x4 , 
+	0x0 , 0x4d, 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x2b, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x2 , 
+	0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x4f, 0x0 , 
+	0x0 , 0x0 , 0x8 , 0x1 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 0x2 , 0x0 , 0x0 , 
+	0x0 , 0x69, 0x0 , 0x0 , 0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x4 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0x8c, 0x0 , 0x0 , 0x0 , 0xff, 0x0 , 0x0 , 0x0 , 0x36, 
+	0x0 , 0x5 , 0x0 , 0x13, 0x0 , 0x0 , 0x0 , 0x12, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x14, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x15, 0x0 , 0x0 , 
+	0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 
+	0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x1f, 
+	0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x17, 0x0 , 
+	0x0 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 
+	0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 
+	0x3b, 0x0 , 0x4 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x7 , 
+	0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x37, 0x0 , 
+	0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x17, 0x0 , 0x0 , 
+	0x0 , 0x50, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 
+	0x17, 0x0 , 0x0 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 
+	0x0 , 0x4 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 
+	0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 0x75, 0x0 , 0x0 , 
+	0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x4 , 0x0 , 0x17, 0x0 , 0x0 , 0x0 , 
+	0x7f, 0x0 , 0x0 , 0x0 , 0x7 , 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x1d, 
+	0x0 , 0x0 , 0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0x18, 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x1e, 0x0 , 0x0 , 
+	0x0 , 0x1c, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 
+	0x1e, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x21, 0x0 , 0x0 , 0x0 , 0x20, 
+	0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x22, 0x0 , 0x0 , 0x0 , 0x20, 0x0 , 0x0 , 
+	0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 
+	0x22, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x5 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x23, 0x0 , 0x0 , 0x0 , 0x24, 0x0 , 
+	0x0 , 0x0 , 0x86, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 
+	0x0 , 0x25, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0x1f, 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x28, 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x1f, 0x0 , 0x0 , 
+	0x0 , 0x84, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x2a, 0x0 , 0x0 , 0x0 , 
+	0x28, 0x0 , 0x0 , 0x0 , 0x29, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x21, 
+	0x0 , 0x0 , 0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 0x0 , 
+	0x0 , 0x2b, 0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x7 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x2d, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x2a, 
+	0x0 , 0x0 , 0x0 , 0x2c, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x27, 0x0 , 
+	0x0 , 0x0 , 0x2d, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x2f, 0x0 , 0x0 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0x30, 0x0 , 0x0 , 0x0 , 0x1f, 0x0 , 0x0 , 0x0 , 0x80, 
+	0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x31, 0x0 , 0x0 , 0x0 , 0x2f, 0x0 , 
+	0x0 , 0x0 , 0x30, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x21, 0x0 , 0x0 , 
+	0x0 , 0x32, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0x32, 
+	0x0 , 0x0 , 0x0 , 0xc , 0x0 , 0x7 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x34, 0x0 , 
+	0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x26, 0x0 , 0x0 , 0x0 , 0x31, 0x0 , 0x0 , 
+	0x0 , 0x33, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 
+	0x34, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x36, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x38, 0x0 , 
+	0x0 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x37, 0x0 , 0x0 , 
+	0x0 , 0x38, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0xf6, 0x0 , 0x4 , 0x0 , 0x3d, 
+	0x0 , 0x0 , 0x0 , 0x3c, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 
+	0x2 , 0x0 , 0x3a, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x3a, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 
+	0x37, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x3f, 
+	0x0 , 0x0 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 0x41, 0x0 , 
+	0x0 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x0 , 0x0 , 0x3f, 0x0 , 0x0 , 
+	0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x40, 0x0 , 0x0 , 0x0 , 0x3b, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x3b, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 0x37, 0x0 , 
+	0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0x43, 0x0 , 0x0 , 
+	0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x42, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x45, 0x0 , 0x0 , 0x0 , 0x43, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x46, 0x0 , 
+	0x0 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0x46, 0x0 , 0x0 , 0x0 , 0x45, 0x0 , 0x0 , 0x0 , 
+	0x3e, 0x0 , 0x3 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x47, 0x0 , 0x0 , 0x0 , 0xf9, 
+	0x0 , 0x2 , 0x0 , 0x3c, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x3c, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x0 , 
+	0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x49, 0x0 , 0x0 , 0x0 , 0x48, 0x0 , 0x0 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0x37, 0x0 , 0x0 , 0x0 , 0x49, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 
+	0x2 , 0x0 , 0x39, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x3d, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x4a, 0x0 , 0x0 , 0x0 , 
+	0x16, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x4b, 
+	0x0 , 0x0 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x4d, 0x0 , 
+	0x0 , 0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x4a, 0x0 , 0x0 , 
+	0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x4c, 0x0 , 0x0 , 0x0 , 0x4b, 0x0 , 0x0 , 0x0 , 
+	0xe0, 0x0 , 0x4 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x4f, 
+	0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x50, 0x0 , 0x0 , 0x0 , 0x24, 0x0 , 
+	0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 
+	0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0xf6, 0x0 , 0x4 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 
+	0x54, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x52, 
+	0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x52, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x56, 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x0 , 
+	0x0 , 0xb0, 0x0 , 0x5 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x57, 0x0 , 0x0 , 0x0 , 
+	0x56, 0x0 , 0x0 , 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x57, 
+	0x0 , 0x0 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 
+	0x2 , 0x0 , 0x53, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x58, 0x0 , 0x0 , 
+	0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x59, 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x0 , 0x0 , 0xae, 0x0 , 
+	0x5 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x5b, 0x0 , 0x0 , 0x0 , 0x59, 0x0 , 0x0 , 
+	0x0 , 0x5a, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x5b, 0x0 , 0x0 , 0x0 , 0x5c, 
+	0x0 , 0x0 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x5c, 0x0 , 
+	0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x5e, 0x0 , 0x0 , 
+	0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x5f, 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x5 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0x5e, 0x0 , 0x0 , 0x0 , 0x5f, 0x0 , 
+	0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x4d, 0x0 , 0x0 , 0x0 , 0x61, 0x0 , 0x0 , 
+	0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x60, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0x62, 0x0 , 0x0 , 0x0 , 0x61, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0x62, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 
+	0x2 , 0x0 , 0x5d, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x5d, 0x0 , 0x0 , 
+	0x0 , 0xe0, 0x0 , 0x4 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 
+	0x4f, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x63, 
+	0x0 , 0x0 , 0x0 , 0x58, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0x64, 0x0 , 0x0 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x65, 0x0 , 0x0 , 0x0 , 0x64, 0x0 , 0x0 , 0x0 , 
+	0x63, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x65, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x66, 0x0 , 
+	0x0 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x67, 0x0 , 0x0 , 0x0 , 0x35, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 
+	0x4d, 0x0 , 0x0 , 0x0 , 0x68, 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 0x66, 
+	0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x68, 0x0 , 0x0 , 0x0 , 0x67, 0x0 , 
+	0x0 , 0x0 , 0xe0, 0x0 , 0x4 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x4e, 0x0 , 0x0 , 
+	0x0 , 0x4f, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x54, 0x0 , 0x0 , 0x0 , 
+	0xf8, 0x0 , 0x2 , 0x0 , 0x54, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x6a, 0x0 , 0x0 , 0x0 , 0x50, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 
+	0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x6b, 0x0 , 0x0 , 0x0 , 0x6a, 0x0 , 0x0 , 
+	0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x50, 0x0 , 0x0 , 0x0 , 
+	0x6b, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x51, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0x55, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x6c, 0x0 , 
+	0x0 , 0x0 , 0x36, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x6d, 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 0x0 , 0x0 , 0xac, 0x0 , 0x5 , 0x0 , 
+	0x41, 0x0 , 0x0 , 0x0 , 0x6e, 0x0 , 0x0 , 0x0 , 0x6d, 0x0 , 0x0 , 0x0 , 0x36, 
+	0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 0x70, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x6e, 0x0 , 0x0 , 0x0 , 0x6f, 0x0 , 0x0 , 
+	0x0 , 0x70, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x6f, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x71, 0x0 , 0x0 , 0x0 , 0x16, 
+	0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x72, 0x0 , 
+	0x0 , 0x0 , 0x71, 0x0 , 0x0 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 
+	0x0 , 0x4d, 0x0 , 0x0 , 0x0 , 0x73, 0x0 , 0x0 , 0x0 , 0xf , 0x0 , 0x0 , 0x0 , 
+	0x72, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x74, 
+	0x0 , 0x0 , 0x0 , 0x73, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x6c, 0x0 , 
+	0x0 , 0x0 , 0x74, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x70, 0x0 , 0x0 , 
+	0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x70, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 
+	0x4 , 0x0 , 0x0 , 0x0 , 0x76, 0x0 , 0x0 , 0x0 , 0x27, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x76, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 
+	0x2 , 0x0 , 0x77, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x77, 0x0 , 0x0 , 
+	0x0 , 0xf6, 0x0 , 0x4 , 0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 0x7a, 0x0 , 0x0 , 0x0 , 
+	0x0 , 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x78, 0x0 , 0x0 , 0x0 , 0xf8, 
+	0x0 , 0x2 , 0x0 , 0x78, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 
+	0x0 , 0x0 , 0x7c, 0x0 , 0x0 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 
+	0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x7d, 0x0 , 0x0 , 0x0 , 0x2e, 0x0 , 0x0 , 0x0 , 
+	0xb0, 0x0 , 0x5 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x7e, 0x0 , 0x0 , 0x0 , 0x7c, 
+	0x0 , 0x0 , 0x0 , 0x7d, 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x7e, 0x0 , 
+	0x0 , 0x0 , 0x79, 0x0 , 0x0 , 0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 
+	0x0 , 0x79, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 
+	0x80, 0x0 , 0x0 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x44, 
+	0x0 , 0x0 , 0x0 , 0x81, 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 
+	0x0 , 0x0 , 0x80, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 
+	0x0 , 0x82, 0x0 , 0x0 , 0x0 , 0x81, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 
+	0x7f, 0x0 , 0x0 , 0x0 , 0x82, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 
+	0x0 , 0x0 , 0x0 , 0x83, 0x0 , 0x0 , 0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 
+	0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x44, 0x0 , 0x0 , 0x0 , 0x85, 0x0 , 0x0 , 0x0 , 
+	0xa , 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 0x83, 0x0 , 0x0 , 0x0 , 0x3e, 
+	0x0 , 0x3 , 0x0 , 0x85, 0x0 , 0x0 , 0x0 , 0x84, 0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 
+	0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x86, 0x0 , 0x0 , 0x0 , 0x7f, 0x0 , 0x0 , 
+	0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x87, 0x0 , 0x0 , 0x0 , 
+	0x6c, 0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x88, 
+	0x0 , 0x0 , 0x0 , 0x87, 0x0 , 0x0 , 0x0 , 0x86, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 
+	0x3 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x88, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 
+	0x0 , 0x7a, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x7a, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x89, 0x0 , 0x0 , 0x0 , 0x75, 
+	0x0 , 0x0 , 0x0 , 0x80, 0x0 , 0x5 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x8a, 0x0 , 
+	0x0 , 0x0 , 0x89, 0x0 , 0x0 , 0x0 , 0x24, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 
+	0x0 , 0x75, 0x0 , 0x0 , 0x0 , 0x8a, 0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 
+	0x77, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 0x2 , 0x0 , 0x7b, 0x0 , 0x0 , 0x0 , 0x3d, 
+	0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x8b, 0x0 , 0x0 , 0x0 , 0x16, 0x0 , 
+	0x0 , 0x0 , 0xaa, 0x0 , 0x5 , 0x0 , 0x41, 0x0 , 0x0 , 0x0 , 0x8d, 0x0 , 0x0 , 
+	0x0 , 0x8b, 0x0 , 0x0 , 0x0 , 0x8c, 0x0 , 0x0 , 0x0 , 0xf7, 0x0 , 0x3 , 0x0 , 
+	0x8f, 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0xfa, 0x0 , 0x4 , 0x0 , 0x8d, 
+	0x0 , 0x0 , 0x0 , 0x8e, 0x0 , 0x0 , 0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 
+	0x2 , 0x0 , 0x8e, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x5 , 0x0 , 0x21, 0x0 , 0x0 , 
+	0x0 , 0x90, 0x0 , 0x0 , 0x0 , 0x6 , 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 
+	0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x91, 0x0 , 0x0 , 0x0 , 0x90, 
+	0x0 , 0x0 , 0x0 , 0x3d, 0x0 , 0x4 , 0x0 , 0x4 , 0x0 , 0x0 , 0x0 , 0x92, 0x0 , 
+	0x0 , 0x0 , 0x6c, 0x0 , 0x0 , 0x0 , 0x41, 0x0 , 0x6 , 0x0 , 0x44, 0x0 , 0x0 , 
+	0x0 , 0x93, 0x0 , 0x0 , 0x0 , 0xa , 0x0 , 0x0 , 0x0 , 0x1b, 0x0 , 0x0 , 0x0 , 
+	0x91, 0x0 , 0x0 , 0x0 , 0x3e, 0x0 , 0x3 , 0x0 , 0x93, 0x0 , 0x0 , 0x0 , 0x92, 
+	0x0 , 0x0 , 0x0 , 0xf9, 0x0 , 0x2 , 0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 0xf8, 0x0 , 
+	0x2 , 0x0 , 0x8f, 0x0 , 0x0 , 0x0 , 0xfd, 0x0 , 0x1 , 0x0 , 0x38, 0x0 , 0x1 , 
+	0x0 , 
+};
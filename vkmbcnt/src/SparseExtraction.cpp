@@ -0,0 +1,239 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "SparseExtraction.h"
+
+#include "Trace.h"
+
+#include "Shaders.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#ifdef max
+#undef max
+#endif
+
+#ifdef min
+#undef min
+#endif
+
+namespace AMD
+{
+namespace
+{
+const uint32_t TileWidths[TileShapeCount] = { 8, 16, 64 };
+}   // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+SparseExtractor::SparseExtractor(std::shared_ptr<VulkanContext> context)
+    : context_(context)
+    , submitter_(*context, "SparseExtraction")
+{
+    device_ = context_->GetDevice();
+
+    // The set layouts are identical, so sets work with every pipeline
+    for (int i = 0; i < TileShapeCount; ++i)
+    {
+        VkSpecializationMapEntry mapEntry = {};
+        mapEntry.constantID = 0;
+        mapEntry.size = sizeof(uint32_t);
+
+        VkSpecializationInfo specializationInfo = {};
+        specializationInfo.mapEntryCount = 1;
+        specializationInfo.pMapEntries = &mapEntry;
+        specializationInfo.dataSize = sizeof(uint32_t);
+        specializationInfo.pData = &TileWidths[i];
+
+        pipelines_[i] = CreateComputePipeline(device_, context_->GetPipelineCache(),
+            Extract2DShader, sizeof(Extract2DShader), 3,
+            sizeof(ExtractionParameters), 0, &specializationInfo);
+    }
+
+    buffers_[2] = CreateBuffer(device_, context_->GetCapabilities().memoryTypes,
+        sizeof(uint32_t),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+SparseExtractor::~SparseExtractor()
+{
+    if (descriptorPool_)
+    {
+        vkDestroyDescriptorPool(device_, descriptorPool_, nullptr);
+    }
+
+    for (const auto& buffer : buffers_)
+    {
+        if (buffer.buffer)
+        {
+            DestroyBuffer(device_, buffer);
+        }
+    }
+
+    for (const auto& pipeline : pipelines_)
+    {
+        DestroyComputePipeline(device_, pipeline);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t SparseExtractor::Extract(const float* image, const std::size_t rowPitch,
+    const uint32_t x, const uint32_t y, const uint32_t width,
+    const uint32_t height, const float threshold, const TileShape shape,
+    PixelRecord* output, const std::size_t outputCapacity)
+{
+    AMD_TRACE_SCOPE("SparseExtract");
+
+    assert(x + width <= rowPitch);
+    assert(x + width <= 65536 && y + height <= 65536);
+
+    if (width == 0 || height == 0)
+    {
+        return 0;
+    }
+
+    // Only the rows of the region are uploaded, the last one only up to
+    // the end of the region
+    const std::size_t imageSize = (height - 1) * rowPitch + x + width;
+    const std::size_t capacity = std::min<std::size_t>(outputCapacity,
+        static_cast<std::size_t> (width) * height);
+
+    ReserveBuffers(imageSize, std::max<std::size_t>(capacity, 1));
+
+    {
+        AMD_TRACE_SCOPE("Upload");
+
+        void* mapping = MapBuffer(device_, buffers_[0]);
+        std::memcpy(mapping, image + y * rowPitch, imageSize * sizeof(float));
+        UnmapBuffer(device_, buffers_[0]);
+    }
+
+    ExtractionParameters parameters;
+    parameters.regionOrigin[0] = x;
+    parameters.regionOrigin[1] = 0;
+    parameters.regionSize[0] = width;
+    parameters.regionSize[1] = height;
+    parameters.rowPitch = static_cast<uint32_t> (rowPitch);
+    parameters.threshold = threshold;
+    parameters.outputCapacity = static_cast<uint32_t> (capacity);
+
+    const VkCommandBuffer commandBuffer = submitter_.Begin();
+
+    Record(commandBuffer, buffers_, descriptorSet_, parameters, shape);
+    submitter_.SubmitAndWait();
+
+    std::size_t result = 0;
+
+    {
+        AMD_TRACE_SCOPE("Readback");
+
+        result = *static_cast<const uint32_t*> (MapBuffer(device_, buffers_[2]));
+        vkUnmapMemory(device_, buffers_[2].memory);
+
+        std::memcpy(output, MapBuffer(device_, buffers_[1]),
+            std::min(result, capacity) * sizeof(PixelRecord));
+        vkUnmapMemory(device_, buffers_[1].memory);
+    }
+
+    // The upload started at row y
+    if (y > 0)
+    {
+        for (std::size_t i = 0; i < std::min(result, capacity); ++i)
+        {
+            output[i].y = static_cast<uint16_t> (output[i].y + y);
+        }
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SparseExtractor::Record(VkCommandBuffer commandBuffer, const Buffer* buffers,
+    VkDescriptorSet descriptorSet, const ExtractionParameters& parameters,
+    const TileShape shape)
+{
+    // The counter may still be in use by a previous extraction recorded
+    // into the same command buffer
+    VkMemoryBarrier memoryBarrier = {};
+    memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    memoryBarrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    memoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+        1, &memoryBarrier, 0, nullptr, 0, nullptr);
+
+    vkCmdFillBuffer(commandBuffer, buffers[2].buffer, 0, sizeof(uint32_t), 0);
+
+    memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    memoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+        1, &memoryBarrier, 0, nullptr, 0, nullptr);
+
+    const ComputePipeline& pipeline = pipelines_[static_cast<int> (shape)];
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+        pipeline.pipeline);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+        pipeline.pipelineLayout, 0, 1, &descriptorSet, 0, nullptr);
+    vkCmdPushConstants(commandBuffer, pipeline.pipelineLayout,
+        VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(parameters), &parameters);
+
+    // One tile per work group
+    const uint32_t tileWidth = TileWidths[static_cast<int> (shape)];
+    const uint32_t tileHeight = 64 / tileWidth;
+    const uint32_t tilesPerRow = (parameters.regionSize[0] + tileWidth - 1) / tileWidth;
+    const uint32_t tileRows = (parameters.regionSize[1] + tileHeight - 1) / tileHeight;
+
+    DispatchFlat(commandBuffer, tilesPerRow * tileRows);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SparseExtractor::ReserveBuffers(const std::size_t imageSize,
+    const std::size_t recordCount)
+{
+    const auto& memoryTypes = context_->GetCapabilities().memoryTypes;
+    bool recreated = false;
+
+    recreated |= ReserveBuffer(device_, memoryTypes, imageSize * sizeof(float),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, &buffers_[0]);
+    recreated |= ReserveBuffer(device_, memoryTypes, recordCount * sizeof(PixelRecord),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, &buffers_[1]);
+
+    if (!recreated)
+    {
+        return;
+    }
+
+    // The set points at the old buffers
+    if (descriptorPool_)
+    {
+        vkDestroyDescriptorPool(device_, descriptorPool_, nullptr);
+    }
+
+    descriptorSet_ = CreateStorageBufferDescriptorSet(device_,
+        GetDescriptorSetLayout(), buffers_, 3, &descriptorPool_);
+}
+}   // namespace AMD
@@ -0,0 +1,131 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef AMD_VULKAN_SAMPLE_SPARSE_EXTRACTION_H_
+#define AMD_VULKAN_SAMPLE_SPARSE_EXTRACTION_H_
+
+#include "VulkanContext.h"
+#include "VulkanUtility.h"
+
+#include <cstddef>
+#include <memory>
+
+namespace AMD
+{
+///////////////////////////////////////////////////////////////////////////////
+// Pixels one wave of extract2d.comp covers
+enum class TileShape
+{
+    Tile8x8,
+    Tile16x4,
+
+    // 64 pixels of one row, which is what the flat kernels do
+    Row64
+};
+
+const int TileShapeCount = 3;
+
+///////////////////////////////////////////////////////////////////////////////
+// A pixel SparseExtractor kept
+struct PixelRecord
+{
+    uint16_t x;
+    uint16_t y;
+    float value;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Push constants of extract2d.comp. Coordinates are in pixels, rowPitch
+// in elements
+struct ExtractionParameters
+{
+    uint32_t regionOrigin[2];
+    uint32_t regionSize[2];
+    uint32_t rowPitch = 0;
+    float threshold = 0;
+    uint32_t outputCapacity = 0xFFFFFFFFu;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Turns a float image into a list of the pixels above a threshold, for
+// instance the valid pixels of a depth image or the set pixels of a mask.
+//
+// The image is a row-major buffer with a row pitch, optionally restricted
+// to a rectangular region. Every wave of extract2d.comp takes one tile
+// (TileShape), tests its pixels and compacts the survivors with
+// ballot/mbcnt into PixelRecords. Like the other out of place kernels,
+// waves are written in the order they finish. Coordinates are stored in
+// 16 bits, so images can be at most 65536 pixels wide and high.
+class SparseExtractor
+{
+public:
+    SparseExtractor(const SparseExtractor&) = delete;
+    SparseExtractor& operator= (const SparseExtractor&) = delete;
+
+    explicit SparseExtractor(std::shared_ptr<VulkanContext> context = VulkanContext::Get());
+    ~SparseExtractor();
+
+    // Extracts the pixels of the region (x, y, width, height) of image,
+    // whose rows are rowPitch floats apart. Coordinates in the records are
+    // relative to the image. output has room for outputCapacity records.
+    // Returns the number of pixels above threshold, which may be larger
+    // than outputCapacity, in which case only outputCapacity were written
+    std::size_t Extract(const float* image, const std::size_t rowPitch,
+        const uint32_t x, const uint32_t y, const uint32_t width,
+        const uint32_t height, const float threshold, const TileShape shape,
+        PixelRecord* output, const std::size_t outputCapacity);
+
+    // Records clearing the counter and one extraction into commandBuffer,
+    // which must be recording. buffers are the image, the records and the
+    // counter (one uint32_t, needs TRANSFER_DST usage), descriptorSet was
+    // created for them against GetDescriptorSetLayout ()
+    void Record(VkCommandBuffer commandBuffer, const Buffer* buffers,
+        VkDescriptorSet descriptorSet, const ExtractionParameters& parameters,
+        const TileShape shape);
+
+    VkDescriptorSetLayout GetDescriptorSetLayout() const
+    {
+        return pipelines_[0].descriptorSetLayout;
+    }
+
+private:
+    void ReserveBuffers(const std::size_t imageSize, const std::size_t recordCount);
+
+    std::shared_ptr<VulkanContext> context_;
+    VkDevice device_ = VK_NULL_HANDLE;
+
+    // Indexed by TileShape
+    ComputePipeline pipelines_[TileShapeCount];
+
+    // Image, records, counter
+    Buffer buffers_[3];
+
+    // Recreated along with the buffers
+    VkDescriptorPool descriptorPool_ = VK_NULL_HANDLE;
+    VkDescriptorSet descriptorSet_ = VK_NULL_HANDLE;
+
+    CommandSubmitter submitter_;
+};
+}   // namespace AMD
+
+#endif
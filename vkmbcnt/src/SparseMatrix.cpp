@@ -0,0 +1,361 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "SparseMatrix.h"
+
+#include "Trace.h"
+
+#include "Shaders.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#ifdef max
+#undef max
+#endif
+
+#ifdef min
+#undef min
+#endif
+
+namespace AMD
+{
+namespace
+{
+// Largest matrix chunk uploaded at once, also bounded by
+// maxStorageBufferRange
+const std::size_t MaxChunkSize = 256 * 1024 * 1024;
+
+///////////////////////////////////////////////////////////////////////////////
+void Dispatch(VkCommandBuffer commandBuffer, const ComputePipeline& pipeline,
+    VkDescriptorSet descriptorSet, const CsrParameters& parameters,
+    const uint32_t groupCount)
+{
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+        pipeline.pipeline);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+        pipeline.pipelineLayout, 0, 1, &descriptorSet, 0, nullptr);
+    vkCmdPushConstants(commandBuffer, pipeline.pipelineLayout,
+        VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(parameters), &parameters);
+
+    DispatchFlat(commandBuffer, groupCount);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ComputeBarrier(VkCommandBuffer commandBuffer)
+{
+    VkMemoryBarrier memoryBarrier = {};
+    memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    memoryBarrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    memoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+        1, &memoryBarrier, 0, nullptr, 0, nullptr);
+}
+}   // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+CsrConverter::CsrConverter(std::shared_ptr<VulkanContext> context)
+    : context_(context)
+    , submitter_(*context, "CsrConversion")
+{
+    device_ = context_->GetDevice();
+
+    // The set layouts are identical, so sets work with every pipeline
+    for (int i = 0; i < 2; ++i)
+    {
+        const VkBool32 writeEntries = (i == 1) ? VK_TRUE : VK_FALSE;
+
+        VkSpecializationMapEntry mapEntry = {};
+        mapEntry.constantID = 0;
+        mapEntry.size = sizeof(VkBool32);
+
+        VkSpecializationInfo specializationInfo = {};
+        specializationInfo.mapEntryCount = 1;
+        specializationInfo.pMapEntries = &mapEntry;
+        specializationInfo.dataSize = sizeof(VkBool32);
+        specializationInfo.pData = &writeEntries;
+
+        compactPipelines_[i] = CreateComputePipeline(device_,
+            context_->GetPipelineCache(),
+            CsrCompactShader, sizeof(CsrCompactShader), 4,
+            sizeof(CsrParameters), 0, &specializationInfo);
+    }
+
+    scanPipeline_ = CreateComputePipeline(device_, context_->GetPipelineCache(),
+        CsrScanShader, sizeof(CsrScanShader), 4, sizeof(CsrParameters));
+
+    // Only limited by the size of the matrix chunks
+    SetChunkRows(SIZE_MAX);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+CsrConverter::~CsrConverter()
+{
+    if (descriptorPool_)
+    {
+        vkDestroyDescriptorPool(device_, descriptorPool_, nullptr);
+    }
+
+    for (const auto& buffer : buffers_)
+    {
+        if (buffer.buffer)
+        {
+            DestroyBuffer(device_, buffer);
+        }
+    }
+
+    for (const auto& pipeline : compactPipelines_)
+    {
+        DestroyComputePipeline(device_, pipeline);
+    }
+
+    DestroyComputePipeline(device_, scanPipeline_);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t CsrConverter::Convert(const float* matrix, const std::size_t rowCount,
+    const std::size_t columnCount, const std::size_t rowPitch,
+    const float threshold, CsrMatrix* output)
+{
+    AMD_TRACE_SCOPE("DenseToCsr");
+
+    assert(columnCount <= rowPitch);
+
+    output->columnCount = static_cast<uint32_t> (columnCount);
+    output->rowOffsets.assign(rowCount + 1, 0);
+    output->columns.clear();
+    output->values.clear();
+
+    // Whole rows per chunk, at least one
+    const std::size_t maxChunkSize = std::min<std::size_t>(MaxChunkSize,
+        context_->GetCapabilities().properties.limits.maxStorageBufferRange);
+    const std::size_t rowsPerChunk = std::max<std::size_t>(1, std::min(chunkRows_,
+        maxChunkSize / (std::max<std::size_t>(rowPitch, 1) * sizeof(float))));
+
+    assert(columnCount * sizeof(float) <= maxChunkSize);
+
+    std::size_t total = 0;
+
+    for (std::size_t firstRow = 0; firstRow < rowCount; firstRow += rowsPerChunk)
+    {
+        const std::size_t chunkRows = std::min(rowsPerChunk, rowCount - firstRow);
+
+        // The last row only up to its last column
+        const std::size_t matrixSize = (chunkRows - 1) * rowPitch + columnCount;
+
+        // The element buffers grow once the count is known
+        ReserveBuffers(matrixSize, chunkRows, 1);
+
+        {
+            AMD_TRACE_SCOPE("Upload");
+
+            void* mapping = MapBuffer(device_, buffers_[0]);
+            std::memcpy(mapping, matrix + firstRow * rowPitch, matrixSize * sizeof(float));
+            UnmapBuffer(device_, buffers_[0]);
+        }
+
+        CsrParameters parameters;
+        parameters.rowCount = static_cast<uint32_t> (chunkRows);
+        parameters.columnCount = static_cast<uint32_t> (columnCount);
+        parameters.rowPitch = static_cast<uint32_t> (rowPitch);
+        parameters.threshold = threshold;
+
+        const VkCommandBuffer commandBuffer = submitter_.Begin();
+
+        RecordCount(commandBuffer, descriptorSet_, parameters);
+        submitter_.SubmitAndWait();
+
+        std::size_t chunkTotal = 0;
+
+        {
+            AMD_TRACE_SCOPE("ReadOffsets");
+
+            const uint32_t* rowOffsets = static_cast<const uint32_t*> (
+                MapBuffer(device_, buffers_[1]));
+
+            for (std::size_t row = 0; row < chunkRows; ++row)
+            {
+                output->rowOffsets[firstRow + row] =
+                    static_cast<uint32_t> (total + rowOffsets[row]);
+            }
+
+            chunkTotal = rowOffsets[chunkRows];
+            UnmapBuffer(device_, buffers_[1]);
+        }
+
+        assert(total + chunkTotal <= 0xFFFFFFFFu);
+
+        if (chunkTotal == 0)
+        {
+            continue;
+        }
+
+        // Keeps the matrix and the offsets, they are large enough already
+        ReserveBuffers(matrixSize, chunkRows, chunkTotal);
+
+        const VkCommandBuffer fillCommandBuffer = submitter_.Begin();
+
+        RecordFill(fillCommandBuffer, descriptorSet_, parameters);
+        submitter_.SubmitAndWait();
+
+        {
+            AMD_TRACE_SCOPE("Readback");
+
+            output->columns.resize(total + chunkTotal);
+            output->values.resize(total + chunkTotal);
+
+            std::memcpy(output->columns.data() + total,
+                MapBuffer(device_, buffers_[2]), chunkTotal * sizeof(uint32_t));
+            UnmapBuffer(device_, buffers_[2]);
+
+            std::memcpy(output->values.data() + total,
+                MapBuffer(device_, buffers_[3]), chunkTotal * sizeof(float));
+            UnmapBuffer(device_, buffers_[3]);
+        }
+
+        total += chunkTotal;
+    }
+
+    output->rowOffsets[rowCount] = static_cast<uint32_t> (total);
+
+    return total;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void CsrConverter::RecordCount(VkCommandBuffer commandBuffer,
+    VkDescriptorSet descriptorSet, const CsrParameters& parameters)
+{
+    // The row offsets may still be in use by a previous conversion recorded
+    // into the same command buffer
+    ComputeBarrier(commandBuffer);
+
+    Dispatch(commandBuffer, compactPipelines_[0], descriptorSet, parameters,
+        parameters.rowCount);
+    ComputeBarrier(commandBuffer);
+
+    Dispatch(commandBuffer, scanPipeline_, descriptorSet, parameters, 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void CsrConverter::RecordFill(VkCommandBuffer commandBuffer,
+    VkDescriptorSet descriptorSet, const CsrParameters& parameters)
+{
+    ComputeBarrier(commandBuffer);
+
+    Dispatch(commandBuffer, compactPipelines_[1], descriptorSet, parameters,
+        parameters.rowCount);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void CsrConverter::SetChunkRows(const std::size_t chunkRows)
+{
+    chunkRows_ = std::max<std::size_t>(chunkRows, 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void CsrConverter::ReserveBuffers(const std::size_t matrixSize,
+    const std::size_t rowCount, const std::size_t elementCount)
+{
+    const auto& memoryTypes = context_->GetCapabilities().memoryTypes;
+    bool recreated = false;
+
+    recreated |= ReserveBuffer(device_, memoryTypes,
+        std::max<std::size_t>(matrixSize, 1) * sizeof(float),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, &buffers_[0],
+        MemoryLocation::HostVisible);
+    recreated |= ReserveBuffer(device_, memoryTypes, (rowCount + 1) * sizeof(uint32_t),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, &buffers_[1],
+        MemoryLocation::HostCached);
+    recreated |= ReserveBuffer(device_, memoryTypes, elementCount * sizeof(uint32_t),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, &buffers_[2],
+        MemoryLocation::HostCached);
+    recreated |= ReserveBuffer(device_, memoryTypes, elementCount * sizeof(float),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, &buffers_[3],
+        MemoryLocation::HostCached);
+
+    if (!recreated)
+    {
+        return;
+    }
+
+    // The set points at the old buffers
+    if (descriptorPool_)
+    {
+        vkDestroyDescriptorPool(device_, descriptorPool_, nullptr);
+    }
+
+    descriptorSet_ = CreateStorageBufferDescriptorSet(device_,
+        GetDescriptorSetLayout(), buffers_, 4, &descriptorPool_);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void DenseToCsr(const float* matrix, const std::size_t rowCount,
+    const std::size_t columnCount, const std::size_t rowPitch,
+    const float threshold, CsrMatrix* output)
+{
+    AMD_TRACE_SCOPE("HostDenseToCsr");
+
+    output->columnCount = static_cast<uint32_t> (columnCount);
+    output->rowOffsets.resize(rowCount + 1);
+    output->columns.clear();
+    output->values.clear();
+
+    for (std::size_t row = 0; row < rowCount; ++row)
+    {
+        output->rowOffsets[row] = static_cast<uint32_t> (output->columns.size());
+
+        const float* rowData = matrix + row * rowPitch;
+
+        for (std::size_t column = 0; column < columnCount; ++column)
+        {
+            if (std::abs(rowData[column]) > threshold)
+            {
+                output->columns.push_back(static_cast<uint32_t> (column));
+                output->values.push_back(rowData[column]);
+            }
+        }
+    }
+
+    output->rowOffsets[rowCount] = static_cast<uint32_t> (output->columns.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void CsrToDense(const CsrMatrix& input, float* matrix, const std::size_t rowPitch)
+{
+    const uint32_t rowCount = input.GetRowCount();
+
+    for (uint32_t row = 0; row < rowCount; ++row)
+    {
+        float* rowData = matrix + row * rowPitch;
+        std::fill(rowData, rowData + input.columnCount, 0.0f);
+
+        for (uint32_t i = input.rowOffsets[row]; i < input.rowOffsets[row + 1]; ++i)
+        {
+            rowData[input.columns[i]] = input.values[i];
+        }
+    }
+}
+}   // namespace AMD
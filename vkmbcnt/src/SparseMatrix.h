@@ -0,0 +1,156 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef AMD_VULKAN_SAMPLE_SPARSE_MATRIX_H_
+#define AMD_VULKAN_SAMPLE_SPARSE_MATRIX_H_
+
+#include "VulkanContext.h"
+#include "VulkanUtility.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace AMD
+{
+///////////////////////////////////////////////////////////////////////////////
+// Matrix in compressed sparse row form: row r holds the elements
+// [rowOffsets [r] .. rowOffsets [r + 1]), each a column and a value. The
+// columns of a row are sorted
+struct CsrMatrix
+{
+    uint32_t columnCount = 0;
+    std::vector<uint32_t> rowOffsets;
+    std::vector<uint32_t> columns;
+    std::vector<float> values;
+
+    uint32_t GetRowCount() const
+    {
+        return rowOffsets.empty() ? 0
+            : static_cast<uint32_t> (rowOffsets.size() - 1);
+    }
+
+    std::size_t GetElementCount() const
+    {
+        return columns.size();
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Push constants of csr-compact.comp and csr-scan.comp
+struct CsrParameters
+{
+    uint32_t rowCount = 0;
+    uint32_t columnCount = 0;
+
+    // In elements
+    uint32_t rowPitch = 0;
+
+    // Elements whose magnitude is greater than this are kept, 0 keeps all
+    // non-zero ones
+    float threshold = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Converts a row-major float matrix into a CsrMatrix, dropping the elements
+// whose magnitude is at most a threshold, for instance to sparsify pruned
+// weights or similarity matrices.
+//
+// Every row is compacted by one wave of csr-compact.comp, which walks it in
+// order, so the columns of a row come out sorted. The count pass stores the
+// number of kept elements per row, csr-scan.comp turns them into row
+// offsets on the device, and the fill pass writes columns and values. The
+// host reads the total in between to size the output. Large matrices are
+// processed in chunks of whole rows.
+class CsrConverter
+{
+public:
+    CsrConverter(const CsrConverter&) = delete;
+    CsrConverter& operator= (const CsrConverter&) = delete;
+
+    explicit CsrConverter(std::shared_ptr<VulkanContext> context = VulkanContext::Get());
+    ~CsrConverter();
+
+    // Converts the rowCount x columnCount matrix whose rows are rowPitch
+    // floats apart into output. Returns the number of elements kept
+    std::size_t Convert(const float* matrix, const std::size_t rowCount,
+        const std::size_t columnCount, const std::size_t rowPitch,
+        const float threshold, CsrMatrix* output);
+
+    // Record the passes into commandBuffer, which must be recording.
+    // descriptorSet was created against GetDescriptorSetLayout () for the
+    // matrix, the row offsets (rowCount + 1 uint32_t), the columns and the
+    // values. RecordCount fills in the row offsets, including the total at
+    // the end, RecordFill then needs room for that many columns and values
+    void RecordCount(VkCommandBuffer commandBuffer, VkDescriptorSet descriptorSet,
+        const CsrParameters& parameters);
+    void RecordFill(VkCommandBuffer commandBuffer, VkDescriptorSet descriptorSet,
+        const CsrParameters& parameters);
+
+    VkDescriptorSetLayout GetDescriptorSetLayout() const
+    {
+        return compactPipelines_[0].descriptorSetLayout;
+    }
+
+    std::size_t GetChunkRows() const
+    {
+        return chunkRows_;
+    }
+
+    // Upper limit for the rows per chunk, mostly to test the chunk
+    // boundaries. The matrix buffer also has to fit the device's limits
+    void SetChunkRows(const std::size_t chunkRows);
+
+private:
+    void ReserveBuffers(const std::size_t matrixSize, const std::size_t rowCount,
+        const std::size_t elementCount);
+
+    std::shared_ptr<VulkanContext> context_;
+    VkDevice device_ = VK_NULL_HANDLE;
+
+    // Count and fill pass
+    ComputePipeline compactPipelines_[2];
+    ComputePipeline scanPipeline_;
+
+    std::size_t chunkRows_ = 0;
+
+    // Matrix, row offsets, columns, values
+    Buffer buffers_[4];
+
+    // Recreated along with the buffers
+    VkDescriptorPool descriptorPool_ = VK_NULL_HANDLE;
+    VkDescriptorSet descriptorSet_ = VK_NULL_HANDLE;
+
+    CommandSubmitter submitter_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Host versions, to compare against and to check round trips. DenseToCsr
+// filters every row in a loop, CsrToDense writes every element of matrix,
+// zero where the CSR has none
+void DenseToCsr(const float* matrix, const std::size_t rowCount,
+    const std::size_t columnCount, const std::size_t rowPitch,
+    const float threshold, CsrMatrix* output);
+void CsrToDense(const CsrMatrix& input, float* matrix, const std::size_t rowPitch);
+}   // namespace AMD
+
+#endif
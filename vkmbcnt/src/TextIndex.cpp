@@ -0,0 +1,399 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "TextIndex.h"
+
+#include "BallotBitmap.h"
+#include "Trace.h"
+
+#include "Shaders.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#ifdef max
+#undef max
+#endif
+
+#ifdef min
+#undef min
+#endif
+
+namespace AMD
+{
+namespace
+{
+// Must match the push constants of text-classify.comp and text-scan.comp
+struct TextKernelParameters
+{
+    uint32_t byteCount;
+    uint32_t tileCount;
+    uint32_t startsInQuote;
+    uint32_t outputCapacity;
+    uint32_t baseOffset[2];
+    uint32_t delimiter;
+    uint32_t quote;
+    uint32_t newline;
+};
+
+// Every byte may be structural, so the offsets of a chunk can take up to
+// 8 times its size
+const std::size_t DefaultChunkSize = 32 * 1024 * 1024;
+const std::size_t MaxOffsetSize = sizeof(uint64_t);
+
+///////////////////////////////////////////////////////////////////////////////
+void Dispatch(VkCommandBuffer commandBuffer, const ComputePipeline& pipeline,
+    VkDescriptorSet descriptorSet, const TextKernelParameters& parameters,
+    const uint32_t groupCount)
+{
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+        pipeline.pipeline);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+        pipeline.pipelineLayout, 0, 1, &descriptorSet, 0, nullptr);
+    vkCmdPushConstants(commandBuffer, pipeline.pipelineLayout,
+        VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(parameters), &parameters);
+
+    DispatchFlat(commandBuffer, groupCount);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ComputeBarrier(VkCommandBuffer commandBuffer)
+{
+    VkMemoryBarrier memoryBarrier = {};
+    memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    memoryBarrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    memoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+        1, &memoryBarrier, 0, nullptr, 0, nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Bit i of the result is the XOR of bits 0 .. i of mask
+uint64_t PrefixXor(uint64_t mask)
+{
+    mask ^= mask << 1;
+    mask ^= mask << 2;
+    mask ^= mask << 4;
+    mask ^= mask << 8;
+    mask ^= mask << 16;
+    mask ^= mask << 32;
+
+    return mask;
+}
+}   // namespace
+
+const std::size_t StructuralIndexer::TileSize;
+
+///////////////////////////////////////////////////////////////////////////////
+StructuralIndexer::StructuralIndexer(std::shared_ptr<VulkanContext> context)
+    : context_(context)
+    , submitter_(*context, "StructuralIndex")
+{
+    device_ = context_->GetDevice();
+
+    // writeOffsets, wideOffsets
+    const VkBool32 specializations[3][2] =
+    {
+        { VK_FALSE, VK_FALSE },
+        { VK_TRUE, VK_FALSE },
+        { VK_TRUE, VK_TRUE }
+    };
+
+    // The set layouts are identical, so sets work with every pipeline
+    for (int i = 0; i < 3; ++i)
+    {
+        VkSpecializationMapEntry mapEntries[2] = {};
+        mapEntries[0].constantID = 0;
+        mapEntries[0].size = sizeof(VkBool32);
+        mapEntries[1].constantID = 1;
+        mapEntries[1].offset = sizeof(VkBool32);
+        mapEntries[1].size = sizeof(VkBool32);
+
+        VkSpecializationInfo specializationInfo = {};
+        specializationInfo.mapEntryCount = 2;
+        specializationInfo.pMapEntries = mapEntries;
+        specializationInfo.dataSize = sizeof(specializations[i]);
+        specializationInfo.pData = specializations[i];
+
+        classifyPipelines_[i] = CreateComputePipeline(device_,
+            context_->GetPipelineCache(),
+            TextClassifyShader, sizeof(TextClassifyShader), 4,
+            sizeof(TextKernelParameters), 0, &specializationInfo);
+    }
+
+    scanPipeline_ = CreateComputePipeline(device_, context_->GetPipelineCache(),
+        TextScanShader, sizeof(TextScanShader), 4,
+        sizeof(TextKernelParameters));
+
+    SetChunkSize(DefaultChunkSize);
+
+    buffers_[3] = CreateBuffer(device_, context_->GetCapabilities().memoryTypes,
+        2 * sizeof(uint32_t), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+        MemoryLocation::HostCached);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StructuralIndexer::~StructuralIndexer()
+{
+    if (descriptorPool_)
+    {
+        vkDestroyDescriptorPool(device_, descriptorPool_, nullptr);
+    }
+
+    for (const auto& buffer : buffers_)
+    {
+        if (buffer.buffer)
+        {
+            DestroyBuffer(device_, buffer);
+        }
+    }
+
+    for (const auto& pipeline : classifyPipelines_)
+    {
+        DestroyComputePipeline(device_, pipeline);
+    }
+
+    DestroyComputePipeline(device_, scanPipeline_);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t StructuralIndexer::Index(const char* text, const std::size_t size,
+    const TextDialect& dialect, uint64_t* offsets,
+    const std::size_t outputCapacity)
+{
+    return IndexChunks(text, size, dialect, OffsetWidth::Bits64, offsets,
+        outputCapacity);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t StructuralIndexer::Index(const char* text, const std::size_t size,
+    const TextDialect& dialect, uint32_t* offsets,
+    const std::size_t outputCapacity)
+{
+    assert(static_cast<uint64_t> (size) <= 0xFFFFFFFFu);
+
+    return IndexChunks(text, size, dialect, OffsetWidth::Bits32, offsets,
+        outputCapacity);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t StructuralIndexer::IndexChunks(const char* text,
+    const std::size_t size, const TextDialect& dialect,
+    const OffsetWidth width, void* offsets, const std::size_t outputCapacity)
+{
+    AMD_TRACE_SCOPE("StructuralIndex");
+
+    const std::size_t offsetSize = (width == OffsetWidth::Bits64)
+        ? sizeof(uint64_t) : sizeof(uint32_t);
+
+    std::size_t total = 0;
+    std::size_t written = 0;
+    bool inQuote = false;
+
+    // The chunks only share the quote state, which comes back with the
+    // result of the previous one
+    for (std::size_t chunkStart = 0; chunkStart < size; chunkStart += chunkSize_)
+    {
+        const std::size_t byteCount = std::min(chunkSize_, size - chunkStart);
+
+        // A chunk can't have more structural characters than bytes
+        const std::size_t capacity = std::min(outputCapacity - written, byteCount);
+
+        ReserveBuffers(byteCount, std::max<std::size_t>(capacity, 1) * offsetSize);
+
+        {
+            AMD_TRACE_SCOPE("Upload");
+
+            void* mapping = MapBuffer(device_, buffers_[0]);
+            std::memcpy(mapping, text + chunkStart, byteCount);
+            UnmapBuffer(device_, buffers_[0]);
+        }
+
+        TextIndexParameters parameters;
+        parameters.byteCount = static_cast<uint32_t> (byteCount);
+        parameters.baseOffset = chunkStart;
+        parameters.startsInQuote = inQuote;
+        parameters.outputCapacity = static_cast<uint32_t> (capacity);
+        parameters.dialect = dialect;
+        parameters.width = width;
+
+        const VkCommandBuffer commandBuffer = submitter_.Begin();
+
+        Record(commandBuffer, descriptorSet_, parameters);
+        submitter_.SubmitAndWait();
+
+        {
+            AMD_TRACE_SCOPE("Readback");
+
+            uint32_t result[2];
+            std::memcpy(result, MapBuffer(device_, buffers_[3]), sizeof(result));
+            vkUnmapMemory(device_, buffers_[3].memory);
+
+            const std::size_t count = std::min<std::size_t>(result[0], capacity);
+            std::memcpy(static_cast<char*> (offsets) + written * offsetSize,
+                MapBuffer(device_, buffers_[2]), count * offsetSize);
+            vkUnmapMemory(device_, buffers_[2].memory);
+
+            written += count;
+            total += result[0];
+            inQuote = (result[1] != 0);
+        }
+    }
+
+    return total;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void StructuralIndexer::Record(VkCommandBuffer commandBuffer,
+    VkDescriptorSet descriptorSet, const TextIndexParameters& parameters)
+{
+    TextKernelParameters kernelParameters;
+    kernelParameters.byteCount = parameters.byteCount;
+    kernelParameters.tileCount = static_cast<uint32_t> (
+        (static_cast<uint64_t> (parameters.byteCount) + TileSize - 1) / TileSize);
+    kernelParameters.startsInQuote = parameters.startsInQuote ? 1 : 0;
+    kernelParameters.outputCapacity = parameters.outputCapacity;
+    kernelParameters.baseOffset[0] = static_cast<uint32_t> (parameters.baseOffset);
+    kernelParameters.baseOffset[1] = static_cast<uint32_t> (parameters.baseOffset >> 32);
+    kernelParameters.delimiter = static_cast<unsigned char> (parameters.dialect.delimiter);
+    kernelParameters.quote = static_cast<unsigned char> (parameters.dialect.quote);
+    kernelParameters.newline = static_cast<unsigned char> (parameters.dialect.newline);
+
+    // The tile state may still be in use by a previous pass recorded into
+    // the same command buffer
+    ComputeBarrier(commandBuffer);
+
+    Dispatch(commandBuffer, classifyPipelines_[0], descriptorSet,
+        kernelParameters, kernelParameters.tileCount);
+    ComputeBarrier(commandBuffer);
+
+    Dispatch(commandBuffer, scanPipeline_, descriptorSet, kernelParameters, 1);
+    ComputeBarrier(commandBuffer);
+
+    const int indexPipeline = (parameters.width == OffsetWidth::Bits64) ? 2 : 1;
+    Dispatch(commandBuffer, classifyPipelines_[indexPipeline], descriptorSet,
+        kernelParameters, kernelParameters.tileCount);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t StructuralIndexer::GetTileStateSize(const std::size_t byteCount)
+{
+    const std::size_t tileCount = std::max<std::size_t>(
+        (byteCount + TileSize - 1) / TileSize, 1);
+
+    return tileCount * 4 * sizeof(uint32_t);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void StructuralIndexer::SetChunkSize(const std::size_t chunkSize)
+{
+    const std::size_t maxRange =
+        context_->GetCapabilities().properties.limits.maxStorageBufferRange;
+
+    chunkSize_ = std::min(chunkSize, maxRange / MaxOffsetSize);
+    chunkSize_ = std::max(chunkSize_ / TileSize * TileSize, TileSize);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void StructuralIndexer::ReserveBuffers(const std::size_t byteCount,
+    const std::size_t offsetSize)
+{
+    const auto& memoryTypes = context_->GetCapabilities().memoryTypes;
+    bool recreated = false;
+
+    // The kernel reads whole words
+    recreated |= ReserveBuffer(device_, memoryTypes, (byteCount + 3) & ~std::size_t(3),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, &buffers_[0],
+        MemoryLocation::HostVisible);
+    recreated |= ReserveBuffer(device_, memoryTypes, GetTileStateSize(byteCount),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, &buffers_[1],
+        MemoryLocation::DeviceLocal);
+    recreated |= ReserveBuffer(device_, memoryTypes, offsetSize,
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, &buffers_[2],
+        MemoryLocation::HostCached);
+
+    if (!recreated)
+    {
+        return;
+    }
+
+    // The set points at the old buffers
+    if (descriptorPool_)
+    {
+        vkDestroyDescriptorPool(device_, descriptorPool_, nullptr);
+    }
+
+    descriptorSet_ = CreateStorageBufferDescriptorSet(device_,
+        GetDescriptorSetLayout(), buffers_, 4, &descriptorPool_);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t IndexTextOnHost(const char* text, const std::size_t size,
+    const TextDialect& dialect, uint64_t* offsets,
+    const std::size_t outputCapacity)
+{
+    AMD_TRACE_SCOPE("HostStructuralIndex");
+
+    std::size_t total = 0;
+
+    // All ones while inside quotes
+    uint64_t carry = 0;
+
+    for (std::size_t blockStart = 0; blockStart < size; blockStart += 64)
+    {
+        const std::size_t blockSize = std::min<std::size_t>(64, size - blockStart);
+        const char* block = text + blockStart;
+
+        uint64_t quoteMask = 0;
+        uint64_t otherMask = 0;
+
+        for (std::size_t i = 0; i < blockSize; ++i)
+        {
+            const char c = block[i];
+            quoteMask |= static_cast<uint64_t> (c == dialect.quote) << i;
+            otherMask |= static_cast<uint64_t> (
+                c == dialect.delimiter || c == dialect.newline) << i;
+        }
+
+        const uint64_t inside = PrefixXor(quoteMask) ^ carry;
+        uint64_t structural = quoteMask | (otherMask & ~inside);
+
+        // Replicate the top bit
+        carry = static_cast<uint64_t> (0) - (inside >> 63);
+
+        while (structural)
+        {
+            if (total < outputCapacity)
+            {
+                offsets[total] = blockStart + FindLowestBit64(structural);
+            }
+
+            ++total;
+            structural &= structural - 1;
+        }
+    }
+
+    return total;
+}
+}   // namespace AMD
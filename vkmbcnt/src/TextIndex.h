@@ -0,0 +1,170 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef AMD_VULKAN_SAMPLE_TEXT_INDEX_H_
+#define AMD_VULKAN_SAMPLE_TEXT_INDEX_H_
+
+#include "VulkanContext.h"
+#include "VulkanUtility.h"
+
+#include <cstddef>
+#include <memory>
+
+namespace AMD
+{
+///////////////////////////////////////////////////////////////////////////////
+// Characters which give delimited text its structure
+struct TextDialect
+{
+    char delimiter = ',';
+    char quote = '"';
+    char newline = '\n';
+};
+
+///////////////////////////////////////////////////////////////////////////////
+enum class OffsetWidth
+{
+    Bits32,
+    Bits64
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct TextIndexParameters
+{
+    // At most 4 GiB
+    uint32_t byteCount = 0;
+
+    // Added to every position, for text which is part of a larger file
+    uint64_t baseOffset = 0;
+
+    // Whether the first byte is inside a quoted field
+    bool startsInQuote = false;
+
+    // Positions past this are counted but not written
+    uint32_t outputCapacity = 0xFFFFFFFFu;
+
+    TextDialect dialect;
+    OffsetWidth width = OffsetWidth::Bits64;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Finds the structural characters of CSV-like text: every quote, plus every
+// delimiter and newline outside of quoted fields. A doubled quote inside a
+// field ("") just closes and reopens it, so it needs no special handling.
+// The result is the sorted list of their byte positions, which is what a
+// parser needs to split records and fields without looking at every byte
+// again.
+//
+// Three passes run per chunk of text: text-classify.comp counts the
+// structural characters of every TileSize bytes for both possible quote
+// states at the start of the tile, text-scan.comp resolves the actual
+// state and output offset of every tile, and text-classify.comp runs again
+// to write the positions. The quote state within a tile comes from a prefix
+// XOR over the ballot of quote parities, so no byte is looked at serially.
+// Unlike most kernels here the output is in order, so a truncated result
+// is still a valid prefix of the full one.
+class StructuralIndexer
+{
+public:
+    StructuralIndexer(const StructuralIndexer&) = delete;
+    StructuralIndexer& operator= (const StructuralIndexer&) = delete;
+
+    explicit StructuralIndexer(std::shared_ptr<VulkanContext> context = VulkanContext::Get());
+    ~StructuralIndexer();
+
+    // Writes the positions of the structural characters of text to
+    // offsets, which has room for outputCapacity of them. Returns how many
+    // there are, which may be more than outputCapacity, in which case only
+    // the first outputCapacity were written. The text is processed in
+    // chunks of GetChunkSize () bytes, so it can be larger than any buffer
+    std::size_t Index(const char* text, const std::size_t size,
+        const TextDialect& dialect, uint64_t* offsets,
+        const std::size_t outputCapacity);
+
+    // Same with 32-bit positions, for text smaller than 4 GiB
+    std::size_t Index(const char* text, const std::size_t size,
+        const TextDialect& dialect, uint32_t* offsets,
+        const std::size_t outputCapacity);
+
+    // Records one indexing pass into commandBuffer, which must be
+    // recording. descriptorSet was created against GetDescriptorSetLayout ()
+    // for the text (padded to whole uint32_t), the tile state
+    // (GetTileStateSize bytes), the offsets and a result of two uint32_t:
+    // the number of structural characters and whether the text ends inside
+    // quotes. Nothing needs clearing in between passes
+    void Record(VkCommandBuffer commandBuffer, VkDescriptorSet descriptorSet,
+        const TextIndexParameters& parameters);
+
+    VkDescriptorSetLayout GetDescriptorSetLayout() const
+    {
+        return classifyPipelines_[0].descriptorSetLayout;
+    }
+
+    static std::size_t GetTileStateSize(const std::size_t byteCount);
+
+    std::size_t GetChunkSize() const
+    {
+        return chunkSize_;
+    }
+
+    // Mostly to test the chunk boundaries. Rounded down to whole tiles and
+    // limited by the largest buffer the device can bind
+    void SetChunkSize(const std::size_t chunkSize);
+
+    // Bytes one work group of text-classify.comp covers
+    static const std::size_t TileSize = 4096;
+
+private:
+    std::size_t IndexChunks(const char* text, const std::size_t size,
+        const TextDialect& dialect, const OffsetWidth width, void* offsets,
+        const std::size_t outputCapacity);
+    void ReserveBuffers(const std::size_t byteCount, const std::size_t offsetSize);
+
+    std::shared_ptr<VulkanContext> context_;
+    VkDevice device_ = VK_NULL_HANDLE;
+
+    // Count pass, then the index pass with 32 and 64-bit offsets
+    ComputePipeline classifyPipelines_[3];
+    ComputePipeline scanPipeline_;
+
+    std::size_t chunkSize_ = 0;
+
+    // Text, tile state, offsets, result
+    Buffer buffers_[4];
+
+    // Recreated along with the buffers
+    VkDescriptorPool descriptorPool_ = VK_NULL_HANDLE;
+    VkDescriptorSet descriptorSet_ = VK_NULL_HANDLE;
+
+    CommandSubmitter submitter_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// CPU version of StructuralIndexer::Index for comparison: builds 64-bit
+// masks of the quotes and the other structural characters per block of 64
+// bytes and resolves the quote state with the same prefix XOR
+std::size_t IndexTextOnHost(const char* text, const std::size_t size,
+    const TextDialect& dialect, uint64_t* offsets,
+    const std::size_t outputCapacity);
+}   // namespace AMD
+
+#endif
@@ -0,0 +1,215 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "ThreadPool.h"
+
+namespace AMD
+{
+///////////////////////////////////////////////////////////////////////////////
+ThreadPool::ThreadPool(int threadCount)
+    : remainingTasks_(0)
+{
+    if (threadCount <= 0)
+    {
+        threadCount = static_cast<int> (std::thread::hardware_concurrency());
+    }
+
+    if (threadCount <= 0)
+    {
+        threadCount = 1;
+    }
+
+    for (int i = 0; i < threadCount; ++i)
+    {
+        queues_.emplace_back(new TaskQueue);
+    }
+
+    // Thread 0 is whoever calls ParallelFor
+    for (int i = 1; i < threadCount; ++i)
+    {
+        workers_.emplace_back(&ThreadPool::WorkerMain, this, i);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shutdown_ = true;
+    }
+
+    wakeCondition_.notify_all();
+
+    for (auto& worker : workers_)
+    {
+        worker.join();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ThreadPool::ParallelFor(const int taskCount,
+    const std::function<void(int task, int thread)>& body)
+{
+    if (taskCount <= 0)
+    {
+        return;
+    }
+
+    const int threadCount = GetThreadCount();
+
+    if (threadCount == 1 || taskCount == 1)
+    {
+        for (int i = 0; i < taskCount; ++i)
+        {
+            body(i, 0);
+        }
+
+        return;
+    }
+
+    // Thread i gets tasks [i * taskCount / threadCount, (i + 1) * ...)
+    for (int i = 0; i < threadCount; ++i)
+    {
+        const int first = static_cast<int> (static_cast<long long> (i) * taskCount / threadCount);
+        const int last = static_cast<int> (static_cast<long long> (i + 1) * taskCount / threadCount);
+
+        std::lock_guard<std::mutex> lock(queues_[i]->mutex);
+        for (int task = first; task < last; ++task)
+        {
+            queues_[i]->tasks.push_back(task);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        body_ = &body;
+        remainingTasks_ = taskCount;
+        busyWorkers_ = static_cast<int> (workers_.size());
+        ++generation_;
+    }
+
+    wakeCondition_.notify_all();
+
+    RunTasks(0);
+
+    // All tasks are done once remainingTasks_ hits 0, but the workers may
+    // still be looking at body_, so wait until they are back to sleep
+    std::unique_lock<std::mutex> lock(mutex_);
+    doneCondition_.wait(lock, [this]() { return busyWorkers_ == 0; });
+    body_ = nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ThreadPool::WorkerMain(const int thread)
+{
+    unsigned int seenGeneration = 0;
+
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wakeCondition_.wait(lock, [&]() {
+                return shutdown_ || generation_ != seenGeneration;
+            });
+
+            if (shutdown_)
+            {
+                return;
+            }
+
+            seenGeneration = generation_;
+        }
+
+        RunTasks(thread);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --busyWorkers_;
+        }
+
+        doneCondition_.notify_one();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ThreadPool::RunTasks(const int thread)
+{
+    int task = 0;
+
+    while (remainingTasks_.load() > 0)
+    {
+        if (PopTask(thread, &task) || StealTask(thread, &task))
+        {
+            (*body_)(task, thread);
+            --remainingTasks_;
+        }
+        else
+        {
+            // Everything is queued up front, so once all queues are empty
+            // the remaining tasks are running on other threads
+            break;
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool ThreadPool::PopTask(const int thread, int* task)
+{
+    auto& queue = *queues_[thread];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+
+    if (queue.tasks.empty())
+    {
+        return false;
+    }
+
+    *task = queue.tasks.front();
+    queue.tasks.pop_front();
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool ThreadPool::StealTask(const int thread, int* task)
+{
+    const int threadCount = GetThreadCount();
+
+    // Start with the neighbour so thieves spread out over the victims
+    for (int i = 1; i < threadCount; ++i)
+    {
+        auto& queue = *queues_[(thread + i) % threadCount];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+
+        if (!queue.tasks.empty())
+        {
+            // Steal from the back, the owner works from the front
+            *task = queue.tasks.back();
+            queue.tasks.pop_back();
+
+            return true;
+        }
+    }
+
+    return false;
+}
+}   // namespace AMD
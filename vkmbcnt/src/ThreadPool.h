@@ -0,0 +1,94 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef AMD_VULKAN_SAMPLE_THREAD_POOL_H_
+#define AMD_VULKAN_SAMPLE_THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace AMD
+{
+///////////////////////////////////////////////////////////////////////////////
+// Fork/join pool with one task queue per thread. ParallelFor hands every
+// thread a contiguous range of tasks up front, so repeated calls with the
+// same task count usually map a given task to the same thread, which may
+// still have its data in cache. Threads which run out of work steal from
+// the back of the other queues, so a task can end up on any thread. The
+// threads aren't pinned and stealing ignores NUMA nodes, so there is no
+// guarantee a task runs on the node which holds its data.
+class ThreadPool
+{
+public:
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator= (const ThreadPool&) = delete;
+
+    // threadCount includes the calling thread. 0 uses one thread per
+    // hardware thread
+    explicit ThreadPool(int threadCount = 0);
+    ~ThreadPool();
+
+    int GetThreadCount() const
+    {
+        return static_cast<int> (queues_.size());
+    }
+
+    // Calls body (task, thread) for every task in [0, taskCount) and returns
+    // once all of them have finished. thread is in [0, GetThreadCount ()),
+    // 0 being the calling thread
+    void ParallelFor(const int taskCount,
+        const std::function<void(int task, int thread)>& body);
+
+private:
+    struct TaskQueue
+    {
+        std::mutex mutex;
+        std::deque<int> tasks;
+    };
+
+    void WorkerMain(const int thread);
+    void RunTasks(const int thread);
+    bool PopTask(const int thread, int* task);
+    bool StealTask(const int thread, int* task);
+
+    std::vector<std::unique_ptr<TaskQueue>> queues_;
+    std::vector<std::thread> workers_;
+
+    std::mutex mutex_;
+    std::condition_variable wakeCondition_;
+    std::condition_variable doneCondition_;
+
+    const std::function<void(int, int)>* body_ = nullptr;
+    std::atomic<int> remainingTasks_;
+    int busyWorkers_ = 0;
+    unsigned int generation_ = 0;
+    bool shutdown_ = false;
+};
+}   // namespace AMD
+
+#endif
@@ -0,0 +1,309 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "TopK.h"
+
+#include "Trace.h"
+
+#include "Shaders.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#ifdef max
+#undef max
+#endif
+
+#ifdef min
+#undef min
+#endif
+
+namespace AMD
+{
+namespace
+{
+// Must match the push constants of topk-histogram.comp. The uvec2 members
+// are 8 byte aligned
+struct HistogramParameters
+{
+    uint32_t elementCount;
+    uint32_t padding;
+    uint32_t prefix[2];
+    uint32_t prefixMask[2];
+    uint32_t shift;
+};
+
+// Must match the push constants of topk-select.comp
+struct SelectParameters
+{
+    uint32_t elementCount;
+    uint32_t padding;
+    uint32_t threshold[2];
+};
+
+const int BinCount = 256;
+
+// Elements per work group of topk-histogram.comp
+const uint32_t HistogramTileSize = 1024;
+
+///////////////////////////////////////////////////////////////////////////////
+// Splits a 64-bit key into the (high, low) uvec2 the shaders use
+void SplitKey(const uint64_t key, uint32_t* parts)
+{
+    parts[0] = static_cast<uint32_t> (key >> 32);
+    parts[1] = static_cast<uint32_t> (key);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void RecordFill(VkCommandBuffer commandBuffer, const Buffer& buffer)
+{
+    vkCmdFillBuffer(commandBuffer, buffer.buffer, 0, VK_WHOLE_SIZE, 0);
+
+    VkMemoryBarrier memoryBarrier = {};
+    memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    memoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+        1, &memoryBarrier, 0, nullptr, 0, nullptr);
+}
+}   // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+TopKSelector::TopKSelector(std::shared_ptr<VulkanContext> context)
+    : context_(context)
+    , submitter_(*context, "TopK")
+{
+    device_ = context_->GetDevice();
+
+    histogramPipeline_ = CreateComputePipeline(device_, context_->GetPipelineCache(),
+        TopKHistogramShader, sizeof(TopKHistogramShader), 2,
+        sizeof(HistogramParameters));
+    selectPipeline_ = CreateComputePipeline(device_, context_->GetPipelineCache(),
+        TopKSelectShader, sizeof(TopKSelectShader), 4,
+        sizeof(SelectParameters));
+
+    const auto& memoryTypes = context_->GetCapabilities().memoryTypes;
+    histogramBuffer_ = CreateBuffer(device_, memoryTypes, BinCount * sizeof(uint32_t),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    counterBuffer_ = CreateBuffer(device_, memoryTypes, sizeof(uint32_t),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TopKSelector::~TopKSelector()
+{
+    if (histogramDescriptorPool_)
+    {
+        vkDestroyDescriptorPool(device_, histogramDescriptorPool_, nullptr);
+        vkDestroyDescriptorPool(device_, selectDescriptorPool_, nullptr);
+    }
+
+    for (const auto buffer : { &inputBuffer_, &histogramBuffer_, &valueBuffer_,
+        &counterBuffer_, &indexBuffer_ })
+    {
+        if (buffer->buffer)
+        {
+            DestroyBuffer(device_, *buffer);
+        }
+    }
+
+    DestroyComputePipeline(device_, selectPipeline_);
+    DestroyComputePipeline(device_, histogramPipeline_);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t TopKSelector::Select(const float* input, const std::size_t elementCount,
+    std::size_t k, float* values, uint32_t* indices)
+{
+    AMD_TRACE_SCOPE("TopK");
+
+    // The index is part of the 64-bit key
+    assert(elementCount <= 0xFFFFFFFFu);
+
+    k = std::min(k, elementCount);
+    lastPassCount_ = 0;
+
+    if (k == 0)
+    {
+        return 0;
+    }
+
+    ReserveBuffers(elementCount, k);
+
+    {
+        AMD_TRACE_SCOPE("Upload");
+
+        void* mapping = MapBuffer(device_, inputBuffer_);
+        std::memcpy(mapping, input, elementCount * sizeof(float));
+        UnmapBuffer(device_, inputBuffer_);
+    }
+
+    // Everything >= threshold is selected. 0 keeps all elements
+    uint64_t threshold = 0;
+
+    if (k < elementCount)
+    {
+        uint64_t prefix = 0, prefixMask = 0;
+        std::size_t remaining = k;
+
+        for (int shift = 56; shift >= 0; shift -= 8)
+        {
+            AMD_TRACE_SCOPE("HistogramPass");
+            ++lastPassCount_;
+
+            HistogramParameters parameters = {};
+            parameters.elementCount = static_cast<uint32_t> (elementCount);
+            SplitKey(prefix, parameters.prefix);
+            SplitKey(prefixMask, parameters.prefixMask);
+            parameters.shift = static_cast<uint32_t> (shift);
+
+            const VkCommandBuffer commandBuffer = submitter_.Begin();
+            RecordFill(commandBuffer, histogramBuffer_);
+            vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+                histogramPipeline_.pipeline);
+            vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+                histogramPipeline_.pipelineLayout, 0, 1, &histogramDescriptorSet_,
+                0, nullptr);
+            vkCmdPushConstants(commandBuffer, histogramPipeline_.pipelineLayout,
+                VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(parameters), &parameters);
+            DispatchFlat(commandBuffer, static_cast<uint32_t> (
+                (elementCount + HistogramTileSize - 1) / HistogramTileSize));
+            submitter_.SubmitAndWait();
+
+            uint32_t bins[BinCount];
+            std::memcpy(bins, MapBuffer(device_, histogramBuffer_), sizeof(bins));
+            vkUnmapMemory(device_, histogramBuffer_.memory);
+
+            // Walk down from the largest digit until the bucket holding the
+            // remaining-th largest key
+            std::size_t above = 0;
+            int digit = BinCount - 1;
+            for (; digit > 0; --digit)
+            {
+                if (above + bins[digit] >= remaining)
+                {
+                    break;
+                }
+
+                above += bins[digit];
+            }
+
+            prefix |= static_cast<uint64_t> (digit) << shift;
+            prefixMask |= static_cast<uint64_t> (0xFF) << shift;
+
+            // If the whole bucket is needed, so is everything >= its
+            // smallest possible key. Keys are unique, so this is always the
+            // case after the last digit
+            if (above + bins[digit] == remaining)
+            {
+                break;
+            }
+
+            remaining -= above;
+        }
+
+        threshold = prefix;
+    }
+
+    std::size_t result = 0;
+
+    {
+        AMD_TRACE_SCOPE("SelectPass");
+
+        SelectParameters parameters = {};
+        parameters.elementCount = static_cast<uint32_t> (elementCount);
+        SplitKey(threshold, parameters.threshold);
+
+        const VkCommandBuffer commandBuffer = submitter_.Begin();
+        RecordFill(commandBuffer, counterBuffer_);
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+            selectPipeline_.pipeline);
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+            selectPipeline_.pipelineLayout, 0, 1, &selectDescriptorSet_,
+            0, nullptr);
+        vkCmdPushConstants(commandBuffer, selectPipeline_.pipelineLayout,
+            VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(parameters), &parameters);
+
+        // One wave per work group
+        DispatchFlat(commandBuffer, static_cast<uint32_t> ((elementCount + 63) / 64));
+        submitter_.SubmitAndWait();
+    }
+
+    {
+        AMD_TRACE_SCOPE("Readback");
+
+        result = *static_cast<const uint32_t*> (MapBuffer(device_, counterBuffer_));
+        vkUnmapMemory(device_, counterBuffer_.memory);
+        assert(result == k);
+
+        std::memcpy(values, MapBuffer(device_, valueBuffer_), result * sizeof(float));
+        vkUnmapMemory(device_, valueBuffer_.memory);
+
+        if (indices)
+        {
+            std::memcpy(indices, MapBuffer(device_, indexBuffer_), result * sizeof(uint32_t));
+            vkUnmapMemory(device_, indexBuffer_.memory);
+        }
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TopKSelector::ReserveBuffers(const std::size_t elementCount, const std::size_t k)
+{
+    const auto& memoryTypes = context_->GetCapabilities().memoryTypes;
+    bool recreated = false;
+
+    recreated |= ReserveBuffer(device_, memoryTypes, elementCount * sizeof(float),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, &inputBuffer_);
+    recreated |= ReserveBuffer(device_, memoryTypes, k * sizeof(float),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, &valueBuffer_);
+    recreated |= ReserveBuffer(device_, memoryTypes, k * sizeof(uint32_t),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, &indexBuffer_);
+
+    if (!recreated)
+    {
+        return;
+    }
+
+    // The sets point at the old buffers
+    if (histogramDescriptorPool_)
+    {
+        vkDestroyDescriptorPool(device_, histogramDescriptorPool_, nullptr);
+        vkDestroyDescriptorPool(device_, selectDescriptorPool_, nullptr);
+    }
+
+    const Buffer histogramBuffers[] = { inputBuffer_, histogramBuffer_ };
+    histogramDescriptorSet_ = CreateStorageBufferDescriptorSet(device_,
+        histogramPipeline_.descriptorSetLayout, histogramBuffers, 2,
+        &histogramDescriptorPool_);
+
+    const Buffer selectBuffers[] = { inputBuffer_, valueBuffer_, counterBuffer_, indexBuffer_ };
+    selectDescriptorSet_ = CreateStorageBufferDescriptorSet(device_,
+        selectPipeline_.descriptorSetLayout, selectBuffers, 4,
+        &selectDescriptorPool_);
+}
+}   // namespace AMD
@@ -0,0 +1,99 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef AMD_VULKAN_SAMPLE_TOP_K_H_
+#define AMD_VULKAN_SAMPLE_TOP_K_H_
+
+#include "VulkanContext.h"
+#include "VulkanUtility.h"
+
+#include <cstddef>
+#include <memory>
+
+namespace AMD
+{
+///////////////////////////////////////////////////////////////////////////////
+// Selects the K largest values on the GPU without sorting.
+//
+// Every element gets a unique 64-bit key: the float mapped to an unsigned
+// integer with the same order, followed by the inverted index so equal
+// values prefer the lower index. A radix select then finds the K-th
+// largest key one 8-bit digit at a time: each pass builds a histogram of
+// the next digit over the elements matching the digits chosen so far
+// (topk-histogram.comp), and the host picks the bucket which contains the
+// K-th key. Once all elements of the chosen bucket are needed the threshold
+// is known, which for distinct values usually happens within the 4 digits
+// of the float. Ties take up to 4 more passes over the index digits.
+// Finally topk-select.comp compacts every element whose key is at least
+// the threshold with ballot/mbcnt, which are exactly K.
+class TopKSelector
+{
+public:
+    TopKSelector(const TopKSelector&) = delete;
+    TopKSelector& operator= (const TopKSelector&) = delete;
+
+    explicit TopKSelector(std::shared_ptr<VulkanContext> context = VulkanContext::Get());
+    ~TopKSelector();
+
+    // Writes the min (k, elementCount) largest values of input to values,
+    // and their indices to indices unless it is null. Among equal values
+    // the lower indices win. The output is not sorted. Returns the number
+    // of values written. -0 counts as smaller than +0, NaNs with the sign
+    // bit clear as larger than +inf
+    std::size_t Select(const float* input, const std::size_t elementCount,
+        std::size_t k, float* values, uint32_t* indices);
+
+    // Histogram passes of the last Select
+    int GetLastPassCount() const
+    {
+        return lastPassCount_;
+    }
+
+private:
+    void ReserveBuffers(const std::size_t elementCount, const std::size_t k);
+
+    std::shared_ptr<VulkanContext> context_;
+    VkDevice device_ = VK_NULL_HANDLE;
+
+    ComputePipeline histogramPipeline_;
+    ComputePipeline selectPipeline_;
+
+    Buffer inputBuffer_;
+    Buffer histogramBuffer_;
+    Buffer valueBuffer_;
+    Buffer counterBuffer_;
+    Buffer indexBuffer_;
+
+    // Recreated along with the buffers
+    VkDescriptorPool histogramDescriptorPool_ = VK_NULL_HANDLE;
+    VkDescriptorSet histogramDescriptorSet_ = VK_NULL_HANDLE;
+    VkDescriptorPool selectDescriptorPool_ = VK_NULL_HANDLE;
+    VkDescriptorSet selectDescriptorSet_ = VK_NULL_HANDLE;
+
+    CommandSubmitter submitter_;
+
+    int lastPassCount_ = 0;
+};
+}   // namespace AMD
+
+#endif
@@ -0,0 +1,197 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Trace.h"
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <stdio.h>
+
+namespace AMD
+{
+namespace Trace
+{
+bool enabled = false;
+
+namespace
+{
+// Process id and thread id used for the GPU track in the trace
+const int ProcessId = 1;
+const int GpuThreadId = 0;
+
+struct Event
+{
+    const char* name;
+    char phase;
+    int threadId;
+    double timestamp;
+    double duration;
+    std::uint64_t value;
+};
+
+struct TraceState
+{
+    std::string outputFilename;
+    std::chrono::high_resolution_clock::time_point start;
+
+    std::mutex mutex;
+    std::vector<Event> events;
+
+    // CPU threads are numbered in order of their first event, starting at 1,
+    // so they show up in a stable order below the GPU track
+    std::map<std::thread::id, int> threadIds;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+TraceState& GetState()
+{
+    static TraceState state;
+    return state;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int GetCurrentThreadId(TraceState& state)
+{
+    const auto id = std::this_thread::get_id();
+    auto it = state.threadIds.find(id);
+
+    if (it == state.threadIds.end())
+    {
+        const int threadId = static_cast<int> (state.threadIds.size()) + 1;
+        state.threadIds[id] = threadId;
+        return threadId;
+    }
+
+    return it->second;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AddEvent(const char* name, const char phase, const bool onGpu,
+    const double timestamp, const double duration, const std::uint64_t value)
+{
+    auto& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    Event event;
+    event.name = name;
+    event.phase = phase;
+    event.threadId = onGpu ? GpuThreadId : GetCurrentThreadId(state);
+    event.timestamp = timestamp;
+    event.duration = duration;
+    event.value = value;
+
+    state.events.push_back(event);
+}
+}   // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+void Enable(const char* outputFilename)
+{
+    auto& state = GetState();
+
+    state.outputFilename = outputFilename;
+    state.start = std::chrono::high_resolution_clock::now();
+    state.events.reserve(1024);
+
+    enabled = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+double Now()
+{
+    const auto elapsed = std::chrono::high_resolution_clock::now() - GetState().start;
+    return std::chrono::duration<double, std::micro>(elapsed).count();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AddCpuSpan(const char* name, const double start, const double duration)
+{
+    AddEvent(name, 'X', false, start, duration, 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AddGpuSpan(const char* name, const double start, const double duration)
+{
+    AddEvent(name, 'X', true, start, duration, 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AddCounter(const char* name, const double timestamp, const std::uint64_t value)
+{
+    AddEvent(name, 'C', false, timestamp, 0, value);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Flush()
+{
+    if (!enabled)
+    {
+        return;
+    }
+
+    auto& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    auto handle = fopen(state.outputFilename.c_str(), "w");
+
+    if (!handle)
+    {
+        std::cerr << "Could not open trace file '" << state.outputFilename
+            << "'" << std::endl;
+        return;
+    }
+
+    fprintf(handle, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    fprintf(handle, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,"
+        "\"args\":{\"name\":\"GPU\"}}", ProcessId, GpuThreadId);
+
+    for (const auto& event : state.events)
+    {
+        if (event.phase == 'C')
+        {
+            fprintf(handle, ",\n{\"name\":\"%s\",\"ph\":\"C\",\"pid\":%d,\"tid\":%d,"
+                "\"ts\":%.3f,\"args\":{\"value\":%llu}}",
+                event.name, ProcessId, event.threadId, event.timestamp,
+                static_cast<unsigned long long> (event.value));
+        }
+        else
+        {
+            fprintf(handle, ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":%d,"
+                "\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                event.name, event.threadId == GpuThreadId ? "gpu" : "cpu",
+                ProcessId, event.threadId, event.timestamp, event.duration);
+        }
+    }
+
+    fprintf(handle, "\n]}\n");
+    fclose(handle);
+
+    state.events.clear();
+}
+}   // namespace Trace
+}   // namespace AMD
@@ -0,0 +1,109 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef AMD_VULKAN_SAMPLE_TRACE_H_
+#define AMD_VULKAN_SAMPLE_TRACE_H_
+
+#include <cstdint>
+
+namespace AMD
+{
+///////////////////////////////////////////////////////////////////////////////
+// Minimal tracer which records CPU spans, GPU spans and counters and writes
+// them out in the Chrome trace event format (load the file in
+// chrome://tracing or ui.perfetto.dev).
+//
+// Tracing is off by default. While it is off, a TraceScope only tests a
+// single global flag. Define AMD_DISABLE_TRACING to compile all
+// AMD_TRACE_SCOPE markers out entirely.
+namespace Trace
+{
+extern bool enabled;
+
+inline bool IsEnabled()
+{
+    return enabled;
+}
+
+// Start recording. The events are written to outputFilename by Flush ().
+void Enable(const char* outputFilename);
+
+// Microseconds since tracing was enabled, on the CPU timeline.
+double Now();
+
+// name must point to a string which outlives the tracer, in practice a
+// string literal.
+void AddCpuSpan(const char* name, const double start, const double duration);
+
+// GPU spans are placed on their own track. start and duration are given in
+// microseconds on the CPU timeline, see GpuTimer::AddSpan () for how GPU
+// timestamps are mapped onto it.
+void AddGpuSpan(const char* name, const double start, const double duration);
+
+void AddCounter(const char* name, const double timestamp, const std::uint64_t value);
+
+// Writes all recorded events to the output file. Does nothing if tracing
+// is disabled.
+void Flush();
+}   // namespace Trace
+
+///////////////////////////////////////////////////////////////////////////////
+class TraceScope
+{
+public:
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator= (const TraceScope&) = delete;
+
+    explicit TraceScope(const char* name)
+    {
+        if (Trace::IsEnabled())
+        {
+            name_ = name;
+            start_ = Trace::Now();
+        }
+    }
+
+    ~TraceScope()
+    {
+        if (name_)
+        {
+            Trace::AddCpuSpan(name_, start_, Trace::Now() - start_);
+        }
+    }
+
+private:
+    const char* name_ = nullptr;
+    double start_ = 0;
+};
+}   // namespace AMD
+
+#define AMD_TRACE_CONCAT_IMPL(a, b) a##b
+#define AMD_TRACE_CONCAT(a, b) AMD_TRACE_CONCAT_IMPL(a, b)
+
+#ifdef AMD_DISABLE_TRACING
+#define AMD_TRACE_SCOPE(name)
+#else
+#define AMD_TRACE_SCOPE(name) \
+    ::AMD::TraceScope AMD_TRACE_CONCAT(traceScope, __LINE__) (name)
+#endif
+
+#endif
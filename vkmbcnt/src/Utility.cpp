@@ -32,6 +32,11 @@ std::vector<std::uint8_t> ReadFile(const char* filename)
 
     auto handle = fopen(filename, "rb");
 
+    if (!handle)
+    {
+        return result;
+    }
+
     for (;;)
     {
         const auto bytesRead = fread(buffer, 1, sizeof(buffer), handle);
@@ -48,3 +53,19 @@ std::vector<std::uint8_t> ReadFile(const char* filename)
 
     return result;
 }
+
+///////////////////////////////////////////////////////////////////////////////
+bool WriteFile(const char* filename, const void* data, const std::size_t size)
+{
+    auto handle = fopen(filename, "wb");
+
+    if (!handle)
+    {
+        return false;
+    }
+
+    const auto bytesWritten = fwrite(data, 1, size, handle);
+    fclose(handle);
+
+    return bytesWritten == size;
+}
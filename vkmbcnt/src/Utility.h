@@ -25,6 +25,7 @@
 
 #include <vector>
 #include <cstdint>
+#include <cstddef>
 
 ///////////////////////////////////////////////////////////////////////////////
 template <typename T>
@@ -33,6 +34,8 @@ T RoundToNextMultiple(const T a, const T multiple)
     return ((a + multiple - 1) / multiple) * multiple;
 }
 
+// Returns an empty vector if the file can't be opened
 std::vector<std::uint8_t> ReadFile(const char* filename);
+bool WriteFile(const char* filename, const void* data, const std::size_t size);
 
 #endif
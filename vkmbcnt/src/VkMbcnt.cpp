@@ -0,0 +1,745 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "VkMbcnt.h"
+
+#include "GpuCompaction.h"
+#include "VulkanContext.h"
+#include "VulkanUtility.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#ifdef max
+#undef max
+#endif
+
+#ifdef min
+#undef min
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Jobs are recycled, so the command buffer, fence, counter and descriptor
+// set are created once and reused by millions of calls
+struct VkmbcntJob_T
+{
+    VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+    VkFence fence = VK_NULL_HANDLE;
+    VkDescriptorPool descriptorPool = VK_NULL_HANDLE;
+    VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+
+    // Receives the survivor count. Also bound as the output if there is none
+    AMD::Buffer counter;
+
+    // Caller memory imported for this job only: input, output
+    AMD::Buffer imports[2];
+
+    // Used instead of imports [i] if the caller memory can't be imported.
+    // Kept for later jobs, they only ever grow
+    AMD::Buffer staging[2];
+
+    // Where the survivors go once the job has finished, if they were
+    // written to staging [1]
+    float* output = nullptr;
+    std::size_t outputCapacity = 0;
+
+    bool pending = false;
+    std::size_t survivorCount = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct VkmbcntHostMemory_T
+{
+    AMD::Buffer buffer;
+
+    // The imported range, for vkmbcntCompactHost to find
+    const char* pointer = nullptr;
+    std::size_t size = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct VkmbcntContext_T
+{
+    std::shared_ptr<AMD::VulkanContext> context;
+    std::unique_ptr<AMD::GpuCompactor> compactor;
+    VkDevice device = VK_NULL_HANDLE;
+    std::size_t maxElementCount = 0;
+
+    // Guards the command pool, recording and the job lists
+    std::mutex mutex;
+    VkCommandPool commandPool = VK_NULL_HANDLE;
+    std::vector<std::unique_ptr<VkmbcntJob_T>> jobs;
+    std::vector<VkmbcntJob_T*> freeJobs;
+
+    // Host memory imported with vkmbcntImportHostMemory and not released
+    // yet. Guarded by mutex as well
+    std::vector<VkmbcntHostMemory_T*> hostMemory;
+};
+
+namespace AMD
+{
+namespace
+{
+///////////////////////////////////////////////////////////////////////////////
+// Must be called with the context locked
+VkmbcntJob_T* AcquireJob(VkmbcntContext_T* context)
+{
+    VkDevice device = context->device;
+
+    if (!context->freeJobs.empty())
+    {
+        VkmbcntJob_T* job = context->freeJobs.back();
+        context->freeJobs.pop_back();
+
+        vkResetFences(device, 1, &job->fence);
+        return job;
+    }
+
+    std::unique_ptr<VkmbcntJob_T> job(new VkmbcntJob_T);
+
+    VkCommandBufferAllocateInfo commandBufferAllocateInfo = {};
+    commandBufferAllocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    commandBufferAllocateInfo.commandBufferCount = 1;
+    commandBufferAllocateInfo.commandPool = context->commandPool;
+    commandBufferAllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+
+    vkAllocateCommandBuffers(device, &commandBufferAllocateInfo, &job->commandBuffer);
+
+    VkFenceCreateInfo fenceCreateInfo = {};
+    fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+    vkCreateFence(device, &fenceCreateInfo, nullptr, &job->fence);
+
+    job->counter = CreateBuffer(device, context->context->GetCapabilities().memoryTypes,
+        sizeof(uint32_t), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+        MemoryLocation::HostCached);
+
+    // Every call points the set at its own buffers, start with something
+    // valid
+    const Buffer initialBuffers[] = { job->counter, job->counter, job->counter };
+    job->descriptorSet = CreateStorageBufferDescriptorSet(device,
+        context->compactor->GetDescriptorSetLayout(), initialBuffers, 3,
+        &job->descriptorPool);
+
+    context->jobs.push_back(std::move(job));
+    return context->jobs.back().get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void DestroyImports(VkDevice device, VkmbcntJob_T* job)
+{
+    for (auto& buffer : job->imports)
+    {
+        if (buffer.buffer)
+        {
+            DestroyBuffer(device, buffer);
+            buffer = Buffer();
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Returns the staging buffer, grown to at least size bytes, with its size
+// set to exactly size so it can be bound as is
+Buffer GetStagingBuffer(VkmbcntContext_T* context, VkmbcntJob_T* job,
+    const int index, const VkDeviceSize size)
+{
+    Buffer& staging = job->staging[index];
+
+    if (staging.size < size)
+    {
+        if (staging.buffer)
+        {
+            DestroyBuffer(context->device, staging);
+        }
+
+        // Input is written by the host once, output read back, so only the
+        // latter benefits from cached memory
+        staging = CreateBuffer(context->device,
+            context->context->GetCapabilities().memoryTypes, size,
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+            (index == 0) ? MemoryLocation::HostVisible : MemoryLocation::HostCached);
+    }
+
+    Buffer result = staging;
+    result.size = size;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Must be called with the context locked. buffers are input, output and
+// counter, as for GpuCompactor::Record, and are bound at offsets
+VkmbcntResult Submit(VkmbcntContext_T* context, VkmbcntJob_T* job,
+    const Buffer* buffers, const VkDeviceSize* offsets,
+    const std::size_t elementCount, const std::size_t outputCapacity,
+    const float threshold)
+{
+    // The job isn't in use, so its set can be updated
+    VkDescriptorBufferInfo bufferInfos[3];
+    VkWriteDescriptorSet writeDescriptorSets[3];
+
+    for (int i = 0; i < 3; ++i)
+    {
+        bufferInfos[i].buffer = buffers[i].buffer;
+        bufferInfos[i].offset = offsets[i];
+        bufferInfos[i].range = buffers[i].size;
+
+        writeDescriptorSets[i] = {};
+        writeDescriptorSets[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writeDescriptorSets[i].dstSet = job->descriptorSet;
+        writeDescriptorSets[i].descriptorCount = 1;
+        writeDescriptorSets[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        writeDescriptorSets[i].dstBinding = i;
+        writeDescriptorSets[i].pBufferInfo = &bufferInfos[i];
+    }
+
+    vkUpdateDescriptorSets(context->device, 3, writeDescriptorSets, 0, nullptr);
+
+    VkCommandBufferBeginInfo commandBufferBeginInfo = {};
+    commandBufferBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkBeginCommandBuffer(job->commandBuffer, &commandBufferBeginInfo);
+
+    CompactionParameters parameters;
+    parameters.elementCount = static_cast<uint32_t> (elementCount);
+    parameters.threshold = threshold;
+    parameters.outputCapacity = static_cast<uint32_t> (outputCapacity);
+
+    context->compactor->Record(job->commandBuffer, buffers, job->descriptorSet,
+        parameters);
+
+    // Covers the counter as well as host memory written by the kernel
+    VkMemoryBarrier memoryBarrier = {};
+    memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    memoryBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    memoryBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    vkCmdPipelineBarrier(job->commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_PIPELINE_STAGE_HOST_BIT, 0,
+        1, &memoryBarrier, 0, nullptr, 0, nullptr);
+
+    vkEndCommandBuffer(job->commandBuffer);
+
+    VkSubmitInfo submitInfo = {};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &job->commandBuffer;
+
+    if (context->context->Submit(submitInfo, job->fence) != VK_SUCCESS)
+    {
+        return VKMBCNT_ERROR_DEVICE_LOST;
+    }
+
+    job->pending = true;
+    return VKMBCNT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// The job's fence must be signaled
+void FinishJob(VkmbcntContext_T* context, VkmbcntJob_T* job)
+{
+    VkDevice device = context->device;
+
+    job->survivorCount = *static_cast<const uint32_t*> (MapBuffer(device, job->counter));
+    vkUnmapMemory(device, job->counter.memory);
+
+    if (job->output)
+    {
+        const std::size_t written = std::min(job->survivorCount, job->outputCapacity);
+
+        std::memcpy(job->output, MapBuffer(device, job->staging[1]),
+            written * sizeof(float));
+        vkUnmapMemory(device, job->staging[1].memory);
+    }
+
+    DestroyImports(device, job);
+
+    job->output = nullptr;
+    job->pending = false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Must be called with the context locked. Returns the buffer of the host
+// memory imported with vkmbcntImportHostMemory which contains the size bytes
+// at pointer, and their offset in it, or an empty Buffer. The offset has
+// to meet minStorageBufferOffsetAlignment, or the range has to be imported
+// again
+Buffer FindHostMemory(const VkmbcntContext_T* context, const void* pointer,
+    const std::size_t size, VkDeviceSize* offset)
+{
+    const char* begin = static_cast<const char*> (pointer);
+    const VkDeviceSize offsetAlignment = context->context->GetCapabilities()
+        .properties.limits.minStorageBufferOffsetAlignment;
+
+    for (const auto memory : context->hostMemory)
+    {
+        if (begin >= memory->pointer && begin + size <= memory->pointer + memory->size
+            && (begin - memory->pointer) % offsetAlignment == 0)
+        {
+            *offset = begin - memory->pointer;
+            return memory->buffer;
+        }
+    }
+
+    return Buffer();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// The kernel reads input while other waves write output, so the two must
+// not share any memory
+bool Overlaps(const void* first, const std::size_t firstSize,
+    const void* second, const std::size_t secondSize)
+{
+    const char* a = static_cast<const char*> (first);
+    const char* b = static_cast<const char*> (second);
+
+    return a < b + secondSize && b < a + firstSize;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool IsValidRange(const VkmbcntContext_T* context, const std::size_t elementCount,
+    const std::size_t outputCapacity, const bool hasOutput, VkmbcntJob* job)
+{
+    return context && job && elementCount <= context->maxElementCount
+        && (hasOutput || outputCapacity == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// An empty input doesn't need the GPU, the job is finished right away
+VkmbcntResult CompleteEmptyJob(VkmbcntContext_T* context, VkmbcntJob* job)
+{
+    std::lock_guard<std::mutex> lock(context->mutex);
+
+    VkmbcntJob_T* result = AcquireJob(context);
+    result->survivorCount = 0;
+
+    *job = result;
+    return VKMBCNT_SUCCESS;
+}
+}   // namespace
+}   // namespace AMD
+
+///////////////////////////////////////////////////////////////////////////////
+uint32_t vkmbcntGetApiVersion(void)
+{
+    return VKMBCNT_API_VERSION;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+VkmbcntResult vkmbcntCreateContext(const VkmbcntContextCreateInfo* createInfo,
+    VkmbcntContext* context)
+{
+    if (!context)
+    {
+        return VKMBCNT_ERROR_INVALID_ARGUMENT;
+    }
+
+    try
+    {
+        AMD::VulkanContext::Options options;
+
+        if (createInfo)
+        {
+            options.headless = createInfo->headless != 0;
+
+            if (createInfo->pipelineCacheFilename)
+            {
+                options.pipelineCacheFilename = createInfo->pipelineCacheFilename;
+            }
+        }
+
+        std::unique_ptr<VkmbcntContext_T> result(new VkmbcntContext_T);
+        result->context = std::make_shared<AMD::VulkanContext>(options);
+
+        if (!result->context->IsValid())
+        {
+            return VKMBCNT_ERROR_UNSUPPORTED;
+        }
+
+        result->device = result->context->GetDevice();
+        result->compactor.reset(new AMD::GpuCompactor(result->context));
+        result->maxElementCount = result->context->GetCapabilities()
+            .properties.limits.maxStorageBufferRange / sizeof(float);
+
+        VkCommandPoolCreateInfo commandPoolCreateInfo = {};
+        commandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        commandPoolCreateInfo.queueFamilyIndex = result->context->GetQueueFamilyIndex();
+        commandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+
+        vkCreateCommandPool(result->device, &commandPoolCreateInfo, nullptr,
+            &result->commandPool);
+
+        *context = result.release();
+        return VKMBCNT_SUCCESS;
+    }
+    catch (const std::bad_alloc&)
+    {
+        return VKMBCNT_ERROR_OUT_OF_MEMORY;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void vkmbcntDestroyContext(VkmbcntContext context)
+{
+    if (!context)
+    {
+        return;
+    }
+
+    VkDevice device = context->device;
+    vkDeviceWaitIdle(device);
+
+    for (const auto& job : context->jobs)
+    {
+        AMD::DestroyImports(device, job.get());
+
+        for (const auto& buffer : job->staging)
+        {
+            if (buffer.buffer)
+            {
+                AMD::DestroyBuffer(device, buffer);
+            }
+        }
+
+        AMD::DestroyBuffer(device, job->counter);
+        vkDestroyDescriptorPool(device, job->descriptorPool, nullptr);
+        vkDestroyFence(device, job->fence, nullptr);
+    }
+
+    // Frees the command buffers of all jobs
+    vkDestroyCommandPool(device, context->commandPool, nullptr);
+
+    context->compactor.reset();
+    delete context;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void vkmbcntGetDeviceInfo(VkmbcntContext context, VkmbcntDeviceInfo* info)
+{
+    if (!context || !info)
+    {
+        return;
+    }
+
+    info->instance = context->context->GetInstance();
+    info->physicalDevice = context->context->GetPhysicalDevice();
+    info->device = context->device;
+    info->queueFamilyIndex = static_cast<uint32_t> (context->context->GetQueueFamilyIndex());
+    info->hostImportAlignment = context->context->GetCapabilities().minImportedHostPointerAlignment;
+    info->maxElementCount = context->maxElementCount;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+VkmbcntResult vkmbcntImportHostMemory(VkmbcntContext context, void* pointer,
+    size_t size, VkmbcntHostMemory* memory)
+{
+    if (!context || !pointer || size == 0 || !memory)
+    {
+        return VKMBCNT_ERROR_INVALID_ARGUMENT;
+    }
+
+    const AMD::Buffer buffer = AMD::ImportHostBuffer(*context->context, pointer, size,
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT
+        | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    if (!buffer.buffer)
+    {
+        return VKMBCNT_ERROR_UNSUPPORTED;
+    }
+
+    try
+    {
+        std::unique_ptr<VkmbcntHostMemory_T> result(new VkmbcntHostMemory_T);
+        result->buffer = buffer;
+        result->pointer = static_cast<const char*> (pointer);
+        result->size = size;
+
+        std::lock_guard<std::mutex> lock(context->mutex);
+        context->hostMemory.push_back(result.get());
+
+        *memory = result.release();
+        return VKMBCNT_SUCCESS;
+    }
+    catch (const std::bad_alloc&)
+    {
+        AMD::DestroyBuffer(context->device, buffer);
+        return VKMBCNT_ERROR_OUT_OF_MEMORY;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+VkBuffer vkmbcntGetHostMemoryBuffer(VkmbcntHostMemory memory)
+{
+    return memory ? memory->buffer.buffer : VK_NULL_HANDLE;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void vkmbcntReleaseHostMemory(VkmbcntContext context, VkmbcntHostMemory memory)
+{
+    if (!context || !memory)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(context->mutex);
+
+        auto& hostMemory = context->hostMemory;
+        hostMemory.erase(std::remove(hostMemory.begin(), hostMemory.end(), memory),
+            hostMemory.end());
+    }
+
+    AMD::DestroyBuffer(context->device, memory->buffer);
+    delete memory;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+VkmbcntResult vkmbcntCompactBuffers(VkmbcntContext context, VkBuffer input,
+    VkBuffer output, size_t elementCount, size_t outputCapacity,
+    float threshold, VkmbcntJob* job)
+{
+    // The ranges of one buffer aren't known here, so the buffers must
+    // differ
+    if (!AMD::IsValidRange(context, elementCount, outputCapacity,
+        output != VK_NULL_HANDLE, job) || (elementCount > 0 && !input)
+        || (outputCapacity > 0 && input == output))
+    {
+        return VKMBCNT_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (elementCount == 0)
+    {
+        return AMD::CompleteEmptyJob(context, job);
+    }
+
+    // There can't be more survivors than elements, and the binding must
+    // stay below maxStorageBufferRange
+    outputCapacity = std::min(outputCapacity, elementCount);
+
+    try
+    {
+        std::lock_guard<std::mutex> lock(context->mutex);
+
+        VkmbcntJob_T* result = AMD::AcquireJob(context);
+
+        AMD::Buffer buffers[3];
+        buffers[0].buffer = input;
+        buffers[0].size = elementCount * sizeof(float);
+        buffers[2] = result->counter;
+
+        if (outputCapacity > 0)
+        {
+            buffers[1].buffer = output;
+            buffers[1].size = outputCapacity * sizeof(float);
+        }
+        else
+        {
+            buffers[1] = result->counter;
+        }
+
+        const VkDeviceSize offsets[3] = {};
+        const VkmbcntResult status = AMD::Submit(context, result, buffers,
+            offsets, elementCount, outputCapacity, threshold);
+
+        if (status != VKMBCNT_SUCCESS)
+        {
+            context->freeJobs.push_back(result);
+            return status;
+        }
+
+        *job = result;
+        return VKMBCNT_SUCCESS;
+    }
+    catch (const std::bad_alloc&)
+    {
+        return VKMBCNT_ERROR_OUT_OF_MEMORY;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+VkmbcntResult vkmbcntCompactHost(VkmbcntContext context, const float* input,
+    size_t elementCount, float* output, size_t outputCapacity,
+    float threshold, VkmbcntJob* job)
+{
+    if (!AMD::IsValidRange(context, elementCount, outputCapacity,
+        output != nullptr, job) || (elementCount > 0 && !input))
+    {
+        return VKMBCNT_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (elementCount == 0)
+    {
+        return AMD::CompleteEmptyJob(context, job);
+    }
+
+    outputCapacity = std::min(outputCapacity, elementCount);
+
+    if (AMD::Overlaps(input, elementCount * sizeof(float),
+        output, outputCapacity * sizeof(float)))
+    {
+        return VKMBCNT_ERROR_INVALID_ARGUMENT;
+    }
+
+    try
+    {
+        std::lock_guard<std::mutex> lock(context->mutex);
+
+        VkmbcntJob_T* result = AMD::AcquireJob(context);
+        VkDevice device = context->device;
+
+        AMD::Buffer buffers[3];
+        VkDeviceSize offsets[3] = {};
+        buffers[2] = result->counter;
+
+        // Memory imported with vkmbcntImportHostMemory is used as is.
+        // Anything else is imported for this job only, which pins and maps
+        // its pages again on every call
+        const VkDeviceSize inputSize = elementCount * sizeof(float);
+        buffers[0] = AMD::FindHostMemory(context, input, inputSize, &offsets[0]);
+
+        if (!buffers[0].buffer)
+        {
+            // The kernel only reads the input, importing it writable is fine
+            result->imports[0] = AMD::ImportHostBuffer(*context->context,
+                const_cast<float*> (input), inputSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+            buffers[0] = result->imports[0];
+        }
+
+        if (buffers[0].buffer)
+        {
+            buffers[0].size = inputSize;
+        }
+        else
+        {
+            buffers[0] = AMD::GetStagingBuffer(context, result, 0, inputSize);
+
+            std::memcpy(AMD::MapBuffer(device, buffers[0]), input, inputSize);
+            AMD::UnmapBuffer(device, buffers[0]);
+        }
+
+        if (outputCapacity > 0)
+        {
+            const VkDeviceSize outputSize = outputCapacity * sizeof(float);
+            buffers[1] = AMD::FindHostMemory(context, output, outputSize, &offsets[1]);
+
+            if (!buffers[1].buffer)
+            {
+                result->imports[1] = AMD::ImportHostBuffer(*context->context,
+                    output, outputSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+                buffers[1] = result->imports[1];
+            }
+
+            if (buffers[1].buffer)
+            {
+                buffers[1].size = outputSize;
+            }
+            else
+            {
+                buffers[1] = AMD::GetStagingBuffer(context, result, 1, outputSize);
+                result->output = output;
+                result->outputCapacity = outputCapacity;
+            }
+        }
+        else
+        {
+            buffers[1] = result->counter;
+        }
+
+        const VkmbcntResult status = AMD::Submit(context, result, buffers,
+            offsets, elementCount, outputCapacity, threshold);
+
+        if (status != VKMBCNT_SUCCESS)
+        {
+            AMD::DestroyImports(device, result);
+            result->output = nullptr;
+            context->freeJobs.push_back(result);
+            return status;
+        }
+
+        *job = result;
+        return VKMBCNT_SUCCESS;
+    }
+    catch (const std::bad_alloc&)
+    {
+        return VKMBCNT_ERROR_OUT_OF_MEMORY;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+VkmbcntResult vkmbcntWaitJob(VkmbcntContext context, VkmbcntJob job,
+    uint64_t timeout, size_t* survivorCount)
+{
+    if (!context || !job)
+    {
+        return VKMBCNT_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (job->pending)
+    {
+        const VkResult result = vkWaitForFences(context->device, 1, &job->fence,
+            VK_TRUE, timeout);
+
+        if (result == VK_TIMEOUT)
+        {
+            return VKMBCNT_NOT_READY;
+        }
+        else if (result != VK_SUCCESS)
+        {
+            return VKMBCNT_ERROR_DEVICE_LOST;
+        }
+
+        AMD::FinishJob(context, job);
+    }
+
+    if (survivorCount)
+    {
+        *survivorCount = job->survivorCount;
+    }
+
+    return VKMBCNT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void vkmbcntDestroyJob(VkmbcntContext context, VkmbcntJob job)
+{
+    if (!context || !job)
+    {
+        return;
+    }
+
+    if (job->pending)
+    {
+        // The caller's memory may be gone once we return, don't copy into it
+        job->output = nullptr;
+
+        vkWaitForFences(context->device, 1, &job->fence, VK_TRUE, UINT64_MAX);
+        AMD::FinishJob(context, job);
+    }
+
+    std::lock_guard<std::mutex> lock(context->mutex);
+    context->freeJobs.push_back(job);
+}
@@ -0,0 +1,176 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef AMD_VULKAN_SAMPLE_VKMBCNT_H_
+#define AMD_VULKAN_SAMPLE_VKMBCNT_H_
+
+// C interface of the compaction library (VkMBCNTLib). A context owns a
+// Vulkan instance, device and the compiled kernels, so long-running
+// processes create one and keep it for all their calls.
+//
+// Compaction keeps every element greater than a threshold, like
+// AMD::GpuCompactor. Calls are asynchronous: they record and submit the
+// work and return a job, which is waited on with vkmbcntWaitJob. All
+// functions taking a context are thread safe.
+
+#include <vulkan/vulkan.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(VKMBCNT_STATIC)
+#define VKMBCNT_API
+#elif defined(_WIN32)
+#ifdef VKMBCNT_EXPORTS
+#define VKMBCNT_API __declspec(dllexport)
+#else
+#define VKMBCNT_API __declspec(dllimport)
+#endif
+#else
+#define VKMBCNT_API __attribute__ ((visibility ("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Changes whenever a function or structure changes incompatibly
+#define VKMBCNT_API_VERSION 1
+
+typedef struct VkmbcntContext_T* VkmbcntContext;
+typedef struct VkmbcntJob_T* VkmbcntJob;
+typedef struct VkmbcntHostMemory_T* VkmbcntHostMemory;
+
+typedef enum VkmbcntResult
+{
+    VKMBCNT_SUCCESS = 0,
+
+    // The job hasn't finished within the timeout
+    VKMBCNT_NOT_READY = 1,
+
+    VKMBCNT_ERROR_INVALID_ARGUMENT = -1,
+
+    // No usable device, or the device lacks an extension the call needs
+    VKMBCNT_ERROR_UNSUPPORTED = -2,
+
+    VKMBCNT_ERROR_OUT_OF_MEMORY = -3,
+    VKMBCNT_ERROR_DEVICE_LOST = -4
+} VkmbcntResult;
+
+typedef struct VkmbcntContextCreateInfo
+{
+    // Non-zero skips validation layers and debug callbacks in debug builds
+    uint32_t headless;
+
+    // If not null, compiled pipelines are loaded from and saved to this file
+    const char* pipelineCacheFilename;
+} VkmbcntContextCreateInfo;
+
+typedef struct VkmbcntDeviceInfo
+{
+    // Buffers passed to vkmbcntCompactBuffers must be created on device
+    VkInstance instance;
+    VkPhysicalDevice physicalDevice;
+    VkDevice device;
+    uint32_t queueFamilyIndex;
+
+    // Host memory can be used without copies if this is non-zero (the
+    // device supports VK_EXT_external_memory_host). Pointers don't have to
+    // be aligned to it, the surrounding pages are imported
+    VkDeviceSize hostImportAlignment;
+
+    // Upper bound for elementCount
+    size_t maxElementCount;
+} VkmbcntDeviceInfo;
+
+// Returns VKMBCNT_API_VERSION of the library
+VKMBCNT_API uint32_t vkmbcntGetApiVersion(void);
+
+// createInfo may be null for the defaults
+VKMBCNT_API VkmbcntResult vkmbcntCreateContext(
+    const VkmbcntContextCreateInfo* createInfo, VkmbcntContext* context);
+
+// All jobs must have been destroyed and all host memory released
+VKMBCNT_API void vkmbcntDestroyContext(VkmbcntContext context);
+
+VKMBCNT_API void vkmbcntGetDeviceInfo(VkmbcntContext context,
+    VkmbcntDeviceInfo* info);
+
+// Imports size bytes at pointer once, for callers which reuse the same host
+// memory for many calls. The buffer can be passed to vkmbcntCompactBuffers
+// and covers exactly the given range. vkmbcntCompactHost uses it as well
+// for input and output within the range, at offsets which are a multiple
+// of minStorageBufferOffsetAlignment (the start of the range always works),
+// instead of importing them again on every call. The memory must stay
+// allocated until it is released. Fails with VKMBCNT_ERROR_UNSUPPORTED if
+// the device can't import it into coherent memory
+VKMBCNT_API VkmbcntResult vkmbcntImportHostMemory(VkmbcntContext context,
+    void* pointer, size_t size, VkmbcntHostMemory* memory);
+
+VKMBCNT_API VkBuffer vkmbcntGetHostMemoryBuffer(VkmbcntHostMemory memory);
+
+// No job using the memory may be pending
+VKMBCNT_API void vkmbcntReleaseHostMemory(VkmbcntContext context,
+    VkmbcntHostMemory memory);
+
+// Compacts elementCount floats from input into output, which has room for
+// outputCapacity floats. Both are caller buffers on the context's device
+// with STORAGE_BUFFER usage, used in place. output may be VK_NULL_HANDLE
+// if outputCapacity is 0, which only counts. input and output must be
+// different buffers, VKMBCNT_ERROR_INVALID_ARGUMENT otherwise. The buffers
+// must not be touched until the job has finished
+VKMBCNT_API VkmbcntResult vkmbcntCompactBuffers(VkmbcntContext context,
+    VkBuffer input, VkBuffer output, size_t elementCount,
+    size_t outputCapacity, float threshold, VkmbcntJob* job);
+
+// Same for host memory. If the device can import host memory, the kernel
+// reads input and writes output directly, without copies. Memory which is
+// not in a range imported with vkmbcntImportHostMemory is imported for
+// this call only, so callers reusing their memory should import it once.
+// Otherwise the data goes through staging buffers owned by the job, and
+// output is written when the job is waited on. input and the first
+// outputCapacity floats of output must not overlap,
+// VKMBCNT_ERROR_INVALID_ARGUMENT otherwise. The memory must stay valid and
+// must not be touched until the job has finished
+VKMBCNT_API VkmbcntResult vkmbcntCompactHost(VkmbcntContext context,
+    const float* input, size_t elementCount, float* output,
+    size_t outputCapacity, float threshold, VkmbcntJob* job);
+
+// Waits up to timeout nanoseconds for the job. Returns VKMBCNT_NOT_READY
+// if it is still running; 0 only polls. Once finished, survivorCount (may
+// be null) receives the total number of survivors: if that is more than
+// outputCapacity, only outputCapacity of them were written, and calling
+// again with the returned count as capacity is guaranteed to fit. A job
+// may only be waited on by one thread at a time
+VKMBCNT_API VkmbcntResult vkmbcntWaitJob(VkmbcntContext context,
+    VkmbcntJob job, uint64_t timeout, size_t* survivorCount);
+
+// Waits for the job if it is still running and recycles it. Staged output
+// of unfinished jobs is dropped
+VKMBCNT_API void vkmbcntDestroyJob(VkmbcntContext context, VkmbcntJob job);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
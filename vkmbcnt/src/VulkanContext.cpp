@@ -0,0 +1,831 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "VulkanContext.h"
+
+#include <iostream>
+#include <string.h>
+
+#include "Trace.h"
+#include "Utility.h"
+
+#include <cassert>
+
+#pragma warning( disable : 4100 ) // disable unreferenced formal parameter warnings
+
+namespace AMD
+{
+///////////////////////////////////////////////////////////////////////////////
+ImportTable::ImportTable(VkInstance instance, VkDevice device,
+    const std::vector<const char*>& enabledDeviceExtensions)
+{
+    auto isEnabled = [&](const char* name) {
+        for (const auto extension : enabledDeviceExtensions)
+        {
+            if (strcmp(extension, name) == 0)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    };
+
+#define GET_INSTANCE_ENTRYPOINT(i, w) w = reinterpret_cast<PFN_##w>(vkGetInstanceProcAddr(i, #w))
+#define GET_DEVICE_ENTRYPOINT(i, w) w = reinterpret_cast<PFN_##w>(vkGetDeviceProcAddr(i, #w))
+
+#ifdef _DEBUG
+    GET_INSTANCE_ENTRYPOINT(instance, vkCreateDebugReportCallbackEXT);
+    GET_INSTANCE_ENTRYPOINT(instance, vkDebugReportMessageEXT);
+    GET_INSTANCE_ENTRYPOINT(instance, vkDestroyDebugReportCallbackEXT);
+#endif
+
+    // Entry points of extensions which aren't enabled stay null
+    if (isEnabled("VK_KHR_push_descriptor"))
+    {
+        GET_DEVICE_ENTRYPOINT(device, vkCmdPushDescriptorSetKHR);
+    }
+
+    if (isEnabled("VK_KHR_descriptor_update_template"))
+    {
+        GET_DEVICE_ENTRYPOINT(device, vkCreateDescriptorUpdateTemplateKHR);
+        GET_DEVICE_ENTRYPOINT(device, vkDestroyDescriptorUpdateTemplateKHR);
+        GET_DEVICE_ENTRYPOINT(device, vkUpdateDescriptorSetWithTemplateKHR);
+    }
+
+    if (isEnabled("VK_EXT_external_memory_host"))
+    {
+        GET_DEVICE_ENTRYPOINT(device, vkGetMemoryHostPointerPropertiesEXT);
+    }
+
+#undef GET_INSTANCE_ENTRYPOINT
+#undef GET_DEVICE_ENTRYPOINT
+}
+
+namespace
+{
+///////////////////////////////////////////////////////////////////////////////
+VKAPI_ATTR VkBool32 VKAPI_CALL DebugReportCallback(
+    VkDebugReportFlagsEXT       /*flags*/,
+    VkDebugReportObjectTypeEXT  /*objectType*/,
+    uint64_t                    /*object*/,
+    size_t                      /*location*/,
+    int32_t                     /*messageCode*/,
+    const char*                 /*pLayerPrefix*/,
+    const char*                 pMessage,
+    void*                       /*pUserData*/)
+{
+#ifdef _WIN32
+    OutputDebugStringA(pMessage);
+    OutputDebugStringA("\n");
+#else
+    printf("%s\n", pMessage);
+#endif
+    return VK_FALSE;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<VkExtensionProperties> GetDeviceExtensions(VkPhysicalDevice device)
+{
+    uint32_t extensionCount = 0;
+
+    vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount,
+        nullptr);
+
+    std::vector<VkExtensionProperties> deviceExtensions{ extensionCount };
+
+    vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount,
+        deviceExtensions.data());
+
+    return deviceExtensions;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// There are only a few dozen extensions, a linear scan is cheaper than
+// building a set just to look up a handful of names
+bool HasExtension(const std::vector<VkExtensionProperties>& extensions,
+    const char* name)
+{
+    for (const auto& e : extensions)
+    {
+        if (strcmp(e.extensionName, name) == 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<const char*> GetDebugInstanceLayerNames()
+{
+    uint32_t layerCount = 0;
+
+    vkEnumerateInstanceLayerProperties(&layerCount,
+        nullptr);
+
+    std::vector<VkLayerProperties> instanceLayers{ layerCount };
+
+    vkEnumerateInstanceLayerProperties(&layerCount,
+        instanceLayers.data());
+
+    std::vector<const char*> result;
+    for (const auto& p : instanceLayers)
+    {
+        if (strcmp(p.layerName, "VK_LAYER_LUNARG_standard_validation") == 0)
+        {
+            result.push_back("VK_LAYER_LUNARG_standard_validation");
+        }
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<const char*> GetDebugInstanceExtensionNames()
+{
+    uint32_t extensionCount = 0;
+
+    vkEnumerateInstanceExtensionProperties(nullptr, &extensionCount,
+        nullptr);
+
+    std::vector<VkExtensionProperties> instanceExtensions{ extensionCount };
+
+    vkEnumerateInstanceExtensionProperties(nullptr, &extensionCount,
+        instanceExtensions.data());
+
+    std::vector<const char*> result;
+    for (const auto& e : instanceExtensions)
+    {
+        if (strcmp(e.extensionName, "VK_EXT_debug_report") == 0)
+        {
+            result.push_back("VK_EXT_debug_report");
+        }
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<const char*> GetDebugDeviceLayerNames(VkPhysicalDevice device)
+{
+    uint32_t layerCount = 0;
+    vkEnumerateDeviceLayerProperties(device, &layerCount, nullptr);
+
+    std::vector<VkLayerProperties> deviceLayers{ layerCount };
+    vkEnumerateDeviceLayerProperties(device, &layerCount, deviceLayers.data());
+
+    std::vector<const char*> result;
+    for (const auto& p : deviceLayers)
+    {
+        if (strcmp(p.layerName, "VK_LAYER_LUNARG_standard_validation") == 0)
+        {
+            result.push_back("VK_LAYER_LUNARG_standard_validation");
+        }
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FindPhysicalDeviceWithComputeQueue(const std::vector<VkPhysicalDevice>& physicalDevices,
+    VkPhysicalDevice* outputDevice, int* outputComputeQueueIndex)
+{
+    for (auto physicalDevice : physicalDevices)
+    {
+        uint32_t queueFamilyPropertyCount = 0;
+
+        vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice,
+            &queueFamilyPropertyCount, nullptr);
+
+        std::vector<VkQueueFamilyProperties> queueFamilyProperties{ queueFamilyPropertyCount };
+        vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice,
+            &queueFamilyPropertyCount, queueFamilyProperties.data());
+
+        int i = 0;
+        for (const auto& queueFamilyProperty : queueFamilyProperties)
+        {
+            if (queueFamilyProperty.queueFlags & VK_QUEUE_COMPUTE_BIT
+                || queueFamilyProperty.queueFlags & VK_QUEUE_GRAPHICS_BIT)
+            {
+                if (outputDevice)
+                {
+                    *outputDevice = physicalDevice;
+                }
+
+                if (outputComputeQueueIndex)
+                {
+                    *outputComputeQueueIndex = i;
+                }
+
+                return;
+            }
+
+            ++i;
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+VkInstance CreateInstance(const bool headless, bool* hasProperties2,
+    bool* hasExternalMemoryCapabilities)
+{
+    VkInstanceCreateInfo instanceCreateInfo = {};
+    instanceCreateInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+
+    std::vector<const char*> instanceExtensions;
+
+    if (headless)
+    {
+        // Enumerating the extensions is another pass of the loader over all
+        // drivers and layers. Ask for both optional ones instead and only
+        // drop them if instance creation fails below
+        *hasProperties2 = true;
+        *hasExternalMemoryCapabilities = true;
+    }
+    else
+    {
+        uint32_t extensionCount = 0;
+        vkEnumerateInstanceExtensionProperties(nullptr, &extensionCount, nullptr);
+
+        std::vector<VkExtensionProperties> supportedExtensions{ extensionCount };
+        vkEnumerateInstanceExtensionProperties(nullptr, &extensionCount,
+            supportedExtensions.data());
+
+        *hasProperties2 = HasExtension(supportedExtensions,
+            "VK_KHR_get_physical_device_properties2");
+        *hasExternalMemoryCapabilities = *hasProperties2 && HasExtension(
+            supportedExtensions, "VK_KHR_external_memory_capabilities");
+    }
+
+    // VK_KHR_push_descriptor depends on this one
+    if (*hasProperties2)
+    {
+        instanceExtensions.push_back("VK_KHR_get_physical_device_properties2");
+    }
+
+    // Needed for importing host memory, see VK_EXT_external_memory_host
+    if (*hasExternalMemoryCapabilities)
+    {
+        instanceExtensions.push_back("VK_KHR_external_memory_capabilities");
+    }
+
+#ifdef _DEBUG
+    if (!headless)
+    {
+        auto debugInstanceExtensionNames = GetDebugInstanceExtensionNames();
+        instanceExtensions.insert(instanceExtensions.end(),
+            debugInstanceExtensionNames.begin(), debugInstanceExtensionNames.end());
+    }
+#endif
+
+    instanceCreateInfo.ppEnabledExtensionNames = instanceExtensions.data();
+    instanceCreateInfo.enabledExtensionCount = static_cast<uint32_t> (instanceExtensions.size());
+
+    std::vector<const char*> instanceLayers;
+
+#ifdef _DEBUG
+    if (!headless)
+    {
+        auto debugInstanceLayerNames = GetDebugInstanceLayerNames();
+        instanceLayers.insert(instanceLayers.end(),
+            debugInstanceLayerNames.begin(), debugInstanceLayerNames.end());
+    }
+#endif
+
+    instanceCreateInfo.ppEnabledLayerNames = instanceLayers.data();
+    instanceCreateInfo.enabledLayerCount = static_cast<uint32_t> (instanceLayers.size());
+
+    VkApplicationInfo applicationInfo = {};
+    applicationInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    applicationInfo.apiVersion = VK_API_VERSION_1_0;
+    applicationInfo.applicationVersion = VK_MAKE_VERSION(1, 0, 0);
+    applicationInfo.engineVersion = VK_MAKE_VERSION(1, 0, 0);
+    applicationInfo.pApplicationName = "AMD Vulkan Compute Sample application";
+    applicationInfo.pEngineName = "AMD Vulkan Compute Sample Engine";
+
+    instanceCreateInfo.pApplicationInfo = &applicationInfo;
+
+    VkInstance instance = nullptr;
+
+    if (vkCreateInstance(&instanceCreateInfo, nullptr, &instance)
+        == VK_ERROR_EXTENSION_NOT_PRESENT && headless)
+    {
+        *hasProperties2 = false;
+        *hasExternalMemoryCapabilities = false;
+
+        instanceCreateInfo.enabledExtensionCount = 0;
+        vkCreateInstance(&instanceCreateInfo, nullptr, &instance);
+    }
+
+    return instance;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+VkDevice CreateDevice(VkPhysicalDevice physicalDevice, const int queueFamilyIndex,
+    const std::vector<VkExtensionProperties>& supportedExtensions,
+    const bool hasProperties2, const bool hasExternalMemoryCapabilities,
+    const bool headless, std::vector<const char*>* enabledExtensions)
+{
+    VkDeviceQueueCreateInfo deviceQueueCreateInfo = {};
+    deviceQueueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    deviceQueueCreateInfo.queueCount = 1;
+    deviceQueueCreateInfo.queueFamilyIndex = queueFamilyIndex;
+
+    static const float queuePriorities[] = { 1.0f };
+    deviceQueueCreateInfo.pQueuePriorities = queuePriorities;
+
+    VkDeviceCreateInfo deviceCreateInfo = {};
+    deviceCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    deviceCreateInfo.queueCreateInfoCount = 1;
+    deviceCreateInfo.pQueueCreateInfos = &deviceQueueCreateInfo;
+
+    VkPhysicalDeviceFeatures enabledFeatures = {};
+    enabledFeatures.shaderInt64 = true;
+
+    // Pipeline statistics are only needed for tracing, so we don't ask for
+    // them otherwise
+    if (Trace::IsEnabled())
+    {
+        VkPhysicalDeviceFeatures supportedFeatures = {};
+        vkGetPhysicalDeviceFeatures(physicalDevice, &supportedFeatures);
+
+        enabledFeatures.pipelineStatisticsQuery = supportedFeatures.pipelineStatisticsQuery;
+    }
+
+    deviceCreateInfo.pEnabledFeatures = &enabledFeatures;
+
+    std::vector<const char*> deviceLayers;
+
+#ifdef _DEBUG
+    if (!headless)
+    {
+        auto debugDeviceLayerNames = GetDebugDeviceLayerNames(physicalDevice);
+        deviceLayers.insert(deviceLayers.end(),
+            debugDeviceLayerNames.begin(), debugDeviceLayerNames.end());
+    }
+#endif
+
+    deviceCreateInfo.ppEnabledLayerNames = deviceLayers.data();
+    deviceCreateInfo.enabledLayerCount = static_cast<uint32_t> (deviceLayers.size());
+
+    // The kernels use both the AMD and the cross-vendor ballot instructions
+    std::vector<const char*> deviceExtensions;
+    deviceExtensions.push_back("VK_AMD_shader_ballot");
+
+    if (HasExtension(supportedExtensions, "VK_EXT_shader_subgroup_ballot"))
+    {
+        deviceExtensions.push_back("VK_EXT_shader_subgroup_ballot");
+    }
+
+    // Optional, they make binding cheaper (see Compactor)
+    if (hasProperties2 && HasExtension(supportedExtensions, "VK_KHR_push_descriptor"))
+    {
+        deviceExtensions.push_back("VK_KHR_push_descriptor");
+    }
+
+    if (HasExtension(supportedExtensions, "VK_KHR_descriptor_update_template"))
+    {
+        deviceExtensions.push_back("VK_KHR_descriptor_update_template");
+    }
+
+    // Optional, lets the GPU read and write caller memory directly (see
+    // ImportHostBuffer)
+    if (hasExternalMemoryCapabilities
+        && HasExtension(supportedExtensions, "VK_KHR_external_memory")
+        && HasExtension(supportedExtensions, "VK_EXT_external_memory_host"))
+    {
+        deviceExtensions.push_back("VK_KHR_external_memory");
+        deviceExtensions.push_back("VK_EXT_external_memory_host");
+    }
+
+    *enabledExtensions = deviceExtensions;
+
+    deviceCreateInfo.ppEnabledExtensionNames = deviceExtensions.data();
+    deviceCreateInfo.enabledExtensionCount = static_cast<uint32_t> (deviceExtensions.size());
+
+    VkDevice device = VK_NULL_HANDLE;
+    if (vkCreateDevice(physicalDevice, &deviceCreateInfo, nullptr, &device) != VK_SUCCESS)
+    {
+        return VK_NULL_HANDLE;
+    }
+
+    return device;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Reads the pipeline cache blob written by a previous run, if any
+VkPipelineCache CreatePipelineCache(VkDevice device, const std::string& filename)
+{
+    std::vector<std::uint8_t> initialData;
+
+    if (!filename.empty())
+    {
+        initialData = ReadFile(filename.c_str());
+    }
+
+    VkPipelineCacheCreateInfo pipelineCacheCreateInfo = {};
+    pipelineCacheCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    pipelineCacheCreateInfo.initialDataSize = initialData.size();
+    pipelineCacheCreateInfo.pInitialData = initialData.empty() ? nullptr : initialData.data();
+
+    VkPipelineCache pipelineCache = VK_NULL_HANDLE;
+
+    // The driver rejects blobs from a different device or driver version.
+    // In that case we just start with an empty cache
+    if (vkCreatePipelineCache(device, &pipelineCacheCreateInfo, nullptr,
+        &pipelineCache) != VK_SUCCESS && !initialData.empty())
+    {
+        pipelineCacheCreateInfo.initialDataSize = 0;
+        pipelineCacheCreateInfo.pInitialData = nullptr;
+
+        vkCreatePipelineCache(device, &pipelineCacheCreateInfo, nullptr,
+            &pipelineCache);
+    }
+
+    return pipelineCache;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SavePipelineCache(VkDevice device, VkPipelineCache pipelineCache,
+    const std::string& filename)
+{
+    size_t size = 0;
+    vkGetPipelineCacheData(device, pipelineCache, &size, nullptr);
+
+    std::vector<std::uint8_t> data(size);
+    vkGetPipelineCacheData(device, pipelineCache, &size, data.data());
+
+    WriteFile(filename.c_str(), data.data(), size);
+}
+
+#ifdef _DEBUG
+///////////////////////////////////////////////////////////////////////////////
+VkDebugReportCallbackEXT SetupDebugCallback(VkInstance instance, const ImportTable* importTable)
+{
+    if (importTable->vkCreateDebugReportCallbackEXT)
+    {
+        VkDebugReportCallbackCreateInfoEXT callbackCreateInfo = {};
+        callbackCreateInfo.sType = VK_STRUCTURE_TYPE_DEBUG_REPORT_CREATE_INFO_EXT;
+        callbackCreateInfo.flags =
+            VK_DEBUG_REPORT_ERROR_BIT_EXT |
+            VK_DEBUG_REPORT_WARNING_BIT_EXT |
+            VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT;
+        callbackCreateInfo.pfnCallback = &DebugReportCallback;
+
+        VkDebugReportCallbackEXT callback;
+        importTable->vkCreateDebugReportCallbackEXT(instance, &callbackCreateInfo, nullptr, &callback);
+        return callback;
+    }
+    else
+    {
+        return VK_NULL_HANDLE;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void CleanupDebugCallback(VkInstance instance, VkDebugReportCallbackEXT callback,
+    const ImportTable* importTable)
+{
+    if (importTable->vkDestroyDebugReportCallbackEXT)
+    {
+        importTable->vkDestroyDebugReportCallbackEXT(instance, callback, nullptr);
+    }
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+struct SharedContext
+{
+    std::mutex mutex;
+    VulkanContext::Options options;
+    std::shared_ptr<VulkanContext> context;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Returns the subgroup size of the device and stores its supported subgroup
+// operations. Both are 0 unless the instance and the device support
+// Vulkan 1.1
+uint32_t GetSubgroupProperties(VkInstance instance, VkPhysicalDevice physicalDevice,
+    uint32_t* supportedOperations)
+{
+    *supportedOperations = 0;
+
+#ifdef VK_VERSION_1_1
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+
+    // We create a 1.0 instance, so the 1.1 entry point is only available
+    // if the loader exports it; query it instead of linking against it
+    auto getPhysicalDeviceProperties2 = reinterpret_cast<PFN_vkGetPhysicalDeviceProperties2>(
+        vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceProperties2"));
+
+    if (getPhysicalDeviceProperties2 && properties.apiVersion >= VK_API_VERSION_1_1)
+    {
+        VkPhysicalDeviceSubgroupProperties subgroupProperties = {};
+        subgroupProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES;
+
+        VkPhysicalDeviceProperties2 properties2 = {};
+        properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+        properties2.pNext = &subgroupProperties;
+
+        getPhysicalDeviceProperties2(physicalDevice, &properties2);
+
+        *supportedOperations = subgroupProperties.supportedOperations;
+        return subgroupProperties.subgroupSize;
+    }
+#else
+    (void) instance;
+    (void) physicalDevice;
+#endif
+
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+SharedContext& GetSharedContext()
+{
+    static SharedContext sharedContext;
+    return sharedContext;
+}
+}   // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<MemoryTypeInfo> EnumerateHeaps(VkPhysicalDevice device)
+{
+    VkPhysicalDeviceMemoryProperties memoryProperties = {};
+    vkGetPhysicalDeviceMemoryProperties(device, &memoryProperties);
+
+    std::vector<MemoryTypeInfo::Heap> heaps;
+
+    for (uint32_t i = 0; i < memoryProperties.memoryHeapCount; ++i)
+    {
+        MemoryTypeInfo::Heap info;
+        info.size = memoryProperties.memoryHeaps[i].size;
+        info.deviceLocal = (memoryProperties.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0;
+
+        heaps.push_back(info);
+    }
+
+    std::vector<MemoryTypeInfo> result;
+
+    for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; ++i)
+    {
+        MemoryTypeInfo typeInfo;
+
+        typeInfo.deviceLocal = (memoryProperties.memoryTypes[i].propertyFlags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT) != 0;
+        typeInfo.hostVisible = (memoryProperties.memoryTypes[i].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0;
+        typeInfo.hostCoherent = (memoryProperties.memoryTypes[i].propertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
+        typeInfo.hostCached = (memoryProperties.memoryTypes[i].propertyFlags & VK_MEMORY_PROPERTY_HOST_CACHED_BIT) != 0;
+        typeInfo.lazilyAllocated = (memoryProperties.memoryTypes[i].propertyFlags & VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT) != 0;
+
+        typeInfo.heap = heaps[memoryProperties.memoryTypes[i].heapIndex];
+
+        typeInfo.index = static_cast<int> (i);
+
+        result.push_back(typeInfo);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+VulkanContext::VulkanContext(const Options& options)
+    : pipelineCacheFilename_(options.pipelineCacheFilename)
+{
+    {
+        AMD_TRACE_SCOPE("CreateInstance");
+        instance_ = CreateInstance(options.headless, &hasProperties2_,
+            &hasExternalMemoryCapabilities_);
+    }
+
+    // Failures leave the context invalid (see IsValid): Get () exits,
+    // library users get an error back
+    if (!instance_)
+    {
+        std::cerr << "Could not create a Vulkan instance" << std::endl;
+        return;
+    }
+
+    AMD_TRACE_SCOPE("CreateDevice");
+
+    uint32_t physicalDeviceCount = 0;
+    vkEnumeratePhysicalDevices(instance_, &physicalDeviceCount, nullptr);
+
+    std::vector<VkPhysicalDevice> devices{ physicalDeviceCount };
+    vkEnumeratePhysicalDevices(instance_, &physicalDeviceCount,
+        devices.data());
+
+    FindPhysicalDeviceWithComputeQueue(devices, &physicalDevice_, &queueFamilyIndex_);
+
+    if (!physicalDevice_)
+    {
+        std::cerr << "No device with a compute queue" << std::endl;
+        return;
+    }
+
+    // Check if the device supports the SPIR-V extensions
+    deviceExtensions_ = GetDeviceExtensions(physicalDevice_);
+
+    if (!HasExtension(deviceExtensions_, "VK_AMD_shader_ballot"))
+    {
+        std::cerr << "AMD_shader_ballot is not supported" << std::endl;
+        return;
+    }
+
+    // Every kernel and BallotBitmap assume 64 lanes per wave, the ballot
+    // masks are 64 bits wide. Vulkan 1.0 devices can't tell, they are
+    // taken to be GCN, which always runs 64 lanes
+    uint32_t subgroupOperations = 0;
+    const uint32_t subgroupSize = GetSubgroupProperties(instance_,
+        physicalDevice_, &subgroupOperations);
+
+    if (subgroupSize != 0 && subgroupSize != 64)
+    {
+        std::cerr << "The device runs " << subgroupSize << " lanes per subgroup, "
+            "the kernels need 64" << std::endl;
+        return;
+    }
+
+    device_ = CreateDevice(physicalDevice_, queueFamilyIndex_,
+        deviceExtensions_, hasProperties2_, hasExternalMemoryCapabilities_,
+        options.headless, &enabledDeviceExtensions_);
+
+    if (!device_)
+    {
+        std::cerr << "Could not create a Vulkan device" << std::endl;
+        return;
+    }
+
+    vkGetDeviceQueue(device_, queueFamilyIndex_, 0, &queue_);
+    assert(queue_);
+
+    importTable_.reset(new ImportTable{ instance_, device_, enabledDeviceExtensions_ });
+
+#ifdef _DEBUG
+    if (!options.headless)
+    {
+        debugCallback_ = SetupDebugCallback(instance_, importTable_.get());
+    }
+#endif
+
+    pipelineCache_ = CreatePipelineCache(device_, pipelineCacheFilename_);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+VulkanContext::~VulkanContext()
+{
+    if (device_)
+    {
+        if (!pipelineCacheFilename_.empty())
+        {
+            SavePipelineCache(device_, pipelineCache_, pipelineCacheFilename_);
+        }
+
+        vkDestroyPipelineCache(device_, pipelineCache_, nullptr);
+
+#ifdef _DEBUG
+        if (debugCallback_)
+        {
+            CleanupDebugCallback(instance_, debugCallback_, importTable_.get());
+        }
+#endif
+
+        vkDestroyDevice(device_, nullptr);
+    }
+
+    vkDestroyInstance(instance_, nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::shared_ptr<VulkanContext> VulkanContext::Get()
+{
+    auto& shared = GetSharedContext();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+
+    if (!shared.context)
+    {
+        shared.context = std::make_shared<VulkanContext>(shared.options);
+
+        if (!shared.context->IsValid())
+        {
+            exit(1);
+        }
+    }
+
+    return shared.context;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void VulkanContext::Initialize(const Options& options)
+{
+    auto& shared = GetSharedContext();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+
+    shared.options = options;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void VulkanContext::Shutdown()
+{
+    auto& shared = GetSharedContext();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+
+    shared.context.reset();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool VulkanContext::HasDeviceExtension(const char* name) const
+{
+    return HasExtension(deviceExtensions_, name);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool VulkanContext::IsDeviceExtensionEnabled(const char* name) const
+{
+    for (const auto extension : enabledDeviceExtensions_)
+    {
+        if (strcmp(extension, name) == 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const DeviceCapabilities& VulkanContext::GetCapabilities() const
+{
+    std::call_once(capabilitiesProbed_, [this]() {
+        AMD_TRACE_SCOPE("ProbeCapabilities");
+
+        vkGetPhysicalDeviceProperties(physicalDevice_, &capabilities_.properties);
+        vkGetPhysicalDeviceFeatures(physicalDevice_, &capabilities_.features);
+
+        uint32_t queueFamilyPropertyCount = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice_,
+            &queueFamilyPropertyCount, nullptr);
+
+        std::vector<VkQueueFamilyProperties> queueFamilyProperties{ queueFamilyPropertyCount };
+        vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice_,
+            &queueFamilyPropertyCount, queueFamilyProperties.data());
+
+        capabilities_.timestampValidBits =
+            queueFamilyProperties[queueFamilyIndex_].timestampValidBits;
+
+        capabilities_.subgroupSize = GetSubgroupProperties(instance_,
+            physicalDevice_, &capabilities_.subgroupSupportedOperations);
+
+        if (IsDeviceExtensionEnabled("VK_EXT_external_memory_host"))
+        {
+            auto getPhysicalDeviceProperties2KHR = reinterpret_cast<PFN_vkGetPhysicalDeviceProperties2KHR>(
+                vkGetInstanceProcAddr(instance_, "vkGetPhysicalDeviceProperties2KHR"));
+
+            VkPhysicalDeviceExternalMemoryHostPropertiesEXT externalMemoryHostProperties = {};
+            externalMemoryHostProperties.sType =
+                VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT;
+
+            VkPhysicalDeviceProperties2KHR properties2 = {};
+            properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2_KHR;
+            properties2.pNext = &externalMemoryHostProperties;
+
+            getPhysicalDeviceProperties2KHR(physicalDevice_, &properties2);
+
+            capabilities_.minImportedHostPointerAlignment =
+                externalMemoryHostProperties.minImportedHostPointerAlignment;
+        }
+
+        capabilities_.memoryTypes = EnumerateHeaps(physicalDevice_);
+    });
+
+    return capabilities_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+VkResult VulkanContext::Submit(const VkSubmitInfo& submitInfo, VkFence fence)
+{
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    return vkQueueSubmit(queue_, 1, &submitInfo, fence);
+}
+}   // namespace AMD
@@ -0,0 +1,227 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef AMD_VULKAN_CONTEXT_H_
+#define AMD_VULKAN_CONTEXT_H_
+
+#ifdef _WIN32
+#define VK_USE_PLATFORM_WIN32_KHR
+#endif
+
+#include <vulkan/vulkan.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace AMD
+{
+///////////////////////////////////////////////////////////////////////////////
+struct MemoryTypeInfo
+{
+    bool deviceLocal = false;
+    bool hostVisible = false;
+    bool hostCoherent = false;
+    bool hostCached = false;
+    bool lazilyAllocated = false;
+
+    struct Heap
+    {
+        uint64_t size = 0;
+        bool deviceLocal = false;
+    };
+
+    Heap heap;
+    int index;
+};
+
+std::vector<MemoryTypeInfo> EnumerateHeaps(VkPhysicalDevice device);
+
+///////////////////////////////////////////////////////////////////////////////
+// Everything we need to know about the device which isn't required to create
+// it. This is probed on first use and then cached for the lifetime of the
+// context.
+struct DeviceCapabilities
+{
+    VkPhysicalDeviceProperties properties;
+    VkPhysicalDeviceFeatures features;
+
+    // Only valid if both the instance and the device support Vulkan 1.1,
+    // otherwise subgroupSize is 0
+    uint32_t subgroupSize = 0;
+    uint32_t subgroupSupportedOperations = 0;
+
+    // Of the queue family we're using. 0 means no timestamp support
+    uint32_t timestampValidBits = 0;
+
+    // Host pointers and sizes passed to VK_EXT_external_memory_host must be
+    // multiples of this. 0 if the extension isn't enabled
+    VkDeviceSize minImportedHostPointerAlignment = 0;
+
+    std::vector<MemoryTypeInfo> memoryTypes;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Entry points which are not exported by the loader and have to be queried
+struct ImportTable
+{
+    ImportTable() = default;
+    ImportTable(VkInstance instance, VkDevice device,
+        const std::vector<const char*>& enabledDeviceExtensions);
+
+#ifdef _DEBUG
+    PFN_vkCreateDebugReportCallbackEXT vkCreateDebugReportCallbackEXT = nullptr;
+    PFN_vkDebugReportMessageEXT vkDebugReportMessageEXT = nullptr;
+    PFN_vkDestroyDebugReportCallbackEXT vkDestroyDebugReportCallbackEXT = nullptr;
+#endif
+
+    // VK_KHR_push_descriptor
+    PFN_vkCmdPushDescriptorSetKHR vkCmdPushDescriptorSetKHR = nullptr;
+
+    // VK_KHR_descriptor_update_template
+    PFN_vkCreateDescriptorUpdateTemplateKHR vkCreateDescriptorUpdateTemplateKHR = nullptr;
+    PFN_vkDestroyDescriptorUpdateTemplateKHR vkDestroyDescriptorUpdateTemplateKHR = nullptr;
+    PFN_vkUpdateDescriptorSetWithTemplateKHR vkUpdateDescriptorSetWithTemplateKHR = nullptr;
+
+    // VK_EXT_external_memory_host
+    PFN_vkGetMemoryHostPointerPropertiesEXT vkGetMemoryHostPointerPropertiesEXT = nullptr;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Owns the instance, device and queue. A context can be shared by any number
+// of compute objects; the process-wide one is created on the first call to
+// VulkanContext::Get ().
+class VulkanContext
+{
+public:
+    struct Options
+    {
+        // Skips everything not strictly needed to run compute work: no
+        // layer enumeration, no validation and no debug callback, even in
+        // debug builds
+        bool headless = false;
+
+        // If set, the pipeline cache is loaded from this file when the
+        // context is created and written back when it is destroyed, so
+        // later runs skip shader compilation in the driver
+        std::string pipelineCacheFilename;
+    };
+
+    VulkanContext(const VulkanContext&) = delete;
+    VulkanContext& operator= (const VulkanContext&) = delete;
+
+    explicit VulkanContext(const Options& options);
+    ~VulkanContext();
+
+    // False if no device could be created, for instance because it lacks
+    // VK_AMD_shader_ballot. Nothing else may be called then
+    bool IsValid() const
+    {
+        return device_ != VK_NULL_HANDLE;
+    }
+
+    // Returns the process-wide context, creating it on first use with the
+    // options passed to Initialize (), or the defaults. Exits if the
+    // context isn't valid
+    static std::shared_ptr<VulkanContext> Get();
+
+    // Sets the options for the process-wide context. Has no effect once the
+    // context has been created
+    static void Initialize(const Options& options);
+
+    // Drops the process-wide reference. The context is destroyed once the
+    // last object using it goes away
+    static void Shutdown();
+
+    VkInstance GetInstance() const
+    {
+        return instance_;
+    }
+
+    VkPhysicalDevice GetPhysicalDevice() const
+    {
+        return physicalDevice_;
+    }
+
+    VkDevice GetDevice() const
+    {
+        return device_;
+    }
+
+    VkQueue GetQueue() const
+    {
+        return queue_;
+    }
+
+    int GetQueueFamilyIndex() const
+    {
+        return queueFamilyIndex_;
+    }
+
+    VkPipelineCache GetPipelineCache() const
+    {
+        return pipelineCache_;
+    }
+
+    const ImportTable& GetImportTable() const
+    {
+        return *importTable_;
+    }
+
+    // Whether the device supports the extension
+    bool HasDeviceExtension(const char* name) const;
+
+    // Whether the extension was enabled when creating the device
+    bool IsDeviceExtensionEnabled(const char* name) const;
+
+    const DeviceCapabilities& GetCapabilities() const;
+
+    // The queue is shared by everyone using this context, so submissions
+    // have to go through here
+    VkResult Submit(const VkSubmitInfo& submitInfo, VkFence fence);
+
+private:
+    VkInstance instance_ = VK_NULL_HANDLE;
+    VkPhysicalDevice physicalDevice_ = VK_NULL_HANDLE;
+    VkDevice device_ = VK_NULL_HANDLE;
+    VkQueue queue_ = VK_NULL_HANDLE;
+    int queueFamilyIndex_ = -1;
+
+    VkPipelineCache pipelineCache_ = VK_NULL_HANDLE;
+    std::string pipelineCacheFilename_;
+
+    std::unique_ptr<ImportTable> importTable_;
+    std::vector<VkExtensionProperties> deviceExtensions_;
+    std::vector<const char*> enabledDeviceExtensions_;
+    bool hasProperties2_ = false;
+    bool hasExternalMemoryCapabilities_ = false;
+
+    mutable std::once_flag capabilitiesProbed_;
+    mutable DeviceCapabilities capabilities_;
+
+    std::mutex queueMutex_;
+
+    VkDebugReportCallbackEXT debugCallback_ = VK_NULL_HANDLE;
+};
+}   // namespace AMD
+
+#endif
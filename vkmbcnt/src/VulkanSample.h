@@ -23,11 +23,10 @@
 #ifndef AMD_VULKAN_SAMPLE_H_
 #define AMD_VULKAN_SAMPLE_H_
 
-#ifdef _WIN32
-#define VK_USE_PLATFORM_WIN32_KHR
-#endif
+#include "VulkanContext.h"
+#include "VulkanUtility.h"
+#include "BallotBitmap.h"
 
-#include <vulkan/vulkan.h>
 #include <memory>
 
 namespace AMD
@@ -39,29 +38,40 @@ public:
     VulkanComputeSample(const VulkanComputeSample&) = delete;
     VulkanComputeSample& operator= (const VulkanComputeSample&) = delete;
 
+    // Uses the process-wide context
     VulkanComputeSample();
+    explicit VulkanComputeSample(std::shared_ptr<VulkanContext> context);
     virtual ~VulkanComputeSample();
 
     void Run();
-    struct ImportTable;
+
+    // Evaluates the same predicate as Run () on elementCount elements, but
+    // only reads back the ballot mask of every wave
+    BallotBitmap ComputeBitmap(const float* input, const size_t elementCount);
 
 protected:
-    VkInstance instance_ = VK_NULL_HANDLE;
+    std::shared_ptr<VulkanContext> context_;
+
+    // Cached from the context
     VkDevice device_ = VK_NULL_HANDLE;
     VkPhysicalDevice physicalDevice_ = VK_NULL_HANDLE;
     VkQueue queue_ = VK_NULL_HANDLE;
 
-    std::unique_ptr<ImportTable> importTable_;
-
     int queueFamilyIndex_ = -1;
 
 private:
+    // Submits commandBuffer_ and waits for it to finish. Returns the time
+    // of the submission on the trace timeline
+    double SubmitAndWait();
+
     VkCommandPool commandPool_;
     VkCommandBuffer commandBuffer_;
+    VkFence fence_;
 
-#ifdef _DEBUG
-    VkDebugReportCallbackEXT debugCallback_;
-#endif
+    GpuTimer timer_;
+
+    // Only created when tracing is enabled
+    VkQueryPool statisticsQueryPool_ = VK_NULL_HANDLE;
 };
 }   // namespace AMD
 
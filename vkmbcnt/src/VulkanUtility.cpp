@@ -0,0 +1,676 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "VulkanUtility.h"
+
+#include "Trace.h"
+#include "Utility.h"
+
+#include <algorithm>
+#include <cassert>
+
+#ifdef max
+#undef max
+#endif
+
+#ifdef min
+#undef min
+#endif
+
+namespace AMD
+{
+namespace
+{
+///////////////////////////////////////////////////////////////////////////////
+bool Matches(const MemoryTypeInfo& memoryInfo, const MemoryLocation location)
+{
+    switch (location)
+    {
+    case MemoryLocation::DeviceLocal:
+        return memoryInfo.deviceLocal;
+    case MemoryLocation::HostCached:
+        return memoryInfo.hostVisible && memoryInfo.hostCached;
+    default:
+        return memoryInfo.hostVisible;
+    }
+}
+}   // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+const MemoryTypeInfo* FindMemoryType(const std::vector<MemoryTypeInfo>& memoryInfos,
+    const uint32_t memoryTypeBits, const MemoryLocation location)
+{
+    const MemoryLocation fallbacks[] = { location, MemoryLocation::HostVisible };
+
+    for (const auto fallback : fallbacks)
+    {
+        for (const auto& memoryInfo : memoryInfos)
+        {
+            if ((memoryTypeBits & (1u << memoryInfo.index)) && Matches(memoryInfo, fallback))
+            {
+                return &memoryInfo;
+            }
+        }
+    }
+
+    for (const auto& memoryInfo : memoryInfos)
+    {
+        if (memoryTypeBits & (1u << memoryInfo.index))
+        {
+            return &memoryInfo;
+        }
+    }
+
+    return nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+VkDeviceMemory AllocateMemory(const std::vector<MemoryTypeInfo>& memoryInfos,
+    VkDevice device, const VkDeviceSize size, bool* isHostCoherent)
+{
+    // We take the first HOST_VISIBLE memory
+    for (auto& memoryInfo : memoryInfos)
+    {
+        if (memoryInfo.hostVisible)
+        {
+            VkMemoryAllocateInfo memoryAllocateInfo = {};
+            memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+            memoryAllocateInfo.memoryTypeIndex = memoryInfo.index;
+            memoryAllocateInfo.allocationSize = size;
+
+            VkDeviceMemory deviceMemory;
+            vkAllocateMemory(device, &memoryAllocateInfo, nullptr,
+                &deviceMemory);
+
+            if (isHostCoherent)
+            {
+                *isHostCoherent = memoryInfo.hostCoherent;
+            }
+
+            return deviceMemory;
+        }
+    }
+
+    return VK_NULL_HANDLE;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+VkShaderModule LoadShader(VkDevice device, const void* shaderContents,
+    const size_t size)
+{
+    VkShaderModuleCreateInfo shaderModuleCreateInfo = {};
+    shaderModuleCreateInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+
+    shaderModuleCreateInfo.pCode = static_cast<const uint32_t*> (shaderContents);
+    shaderModuleCreateInfo.codeSize = size;
+
+    VkShaderModule result;
+    vkCreateShaderModule(device, &shaderModuleCreateInfo, nullptr, &result);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ComputePipeline CreateComputePipeline(VkDevice device,
+    VkPipelineCache pipelineCache, const void* shaderContents,
+    const size_t shaderSize, const int storageBufferCount,
+    const uint32_t pushConstantSize,
+    const VkDescriptorSetLayoutCreateFlags descriptorSetLayoutFlags,
+    const VkSpecializationInfo* specializationInfo)
+{
+    ComputePipeline result;
+
+    result.shaderModule = LoadShader(device, shaderContents, shaderSize);
+
+    std::vector<VkDescriptorSetLayoutBinding> descriptorSetLayoutBindings(storageBufferCount);
+    for (int i = 0; i < storageBufferCount; ++i)
+    {
+        descriptorSetLayoutBindings[i] = {};
+        descriptorSetLayoutBindings[i].binding = i;
+        descriptorSetLayoutBindings[i].descriptorCount = 1;
+        descriptorSetLayoutBindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        descriptorSetLayoutBindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    }
+
+    VkDescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo = {};
+    descriptorSetLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    descriptorSetLayoutCreateInfo.flags = descriptorSetLayoutFlags;
+    descriptorSetLayoutCreateInfo.bindingCount = static_cast<uint32_t> (storageBufferCount);
+    descriptorSetLayoutCreateInfo.pBindings = descriptorSetLayoutBindings.data();
+
+    vkCreateDescriptorSetLayout(device, &descriptorSetLayoutCreateInfo,
+        nullptr, &result.descriptorSetLayout);
+
+    VkPushConstantRange pushConstantRange = {};
+    pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    pushConstantRange.offset = 0;
+    pushConstantRange.size = pushConstantSize;
+
+    VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo = {};
+    pipelineLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutCreateInfo.pSetLayouts = &result.descriptorSetLayout;
+    pipelineLayoutCreateInfo.setLayoutCount = 1;
+
+    if (pushConstantSize > 0)
+    {
+        pipelineLayoutCreateInfo.pPushConstantRanges = &pushConstantRange;
+        pipelineLayoutCreateInfo.pushConstantRangeCount = 1;
+    }
+
+    vkCreatePipelineLayout(device, &pipelineLayoutCreateInfo,
+        nullptr, &result.pipelineLayout);
+
+    VkComputePipelineCreateInfo computePipelineCreateInfo = {};
+    computePipelineCreateInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+
+    computePipelineCreateInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    computePipelineCreateInfo.stage.pName = "main";
+    computePipelineCreateInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    computePipelineCreateInfo.stage.module = result.shaderModule;
+    computePipelineCreateInfo.stage.pSpecializationInfo = specializationInfo;
+    computePipelineCreateInfo.layout = result.pipelineLayout;
+
+    vkCreateComputePipelines(device, pipelineCache, 1, &computePipelineCreateInfo,
+        nullptr, &result.pipeline);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void DestroyComputePipeline(VkDevice device, const ComputePipeline& pipeline)
+{
+    vkDestroyPipeline(device, pipeline.pipeline, nullptr);
+    vkDestroyPipelineLayout(device, pipeline.pipelineLayout, nullptr);
+    vkDestroyDescriptorSetLayout(device, pipeline.descriptorSetLayout, nullptr);
+    vkDestroyShaderModule(device, pipeline.shaderModule, nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Buffer CreateBuffer(VkDevice device, const std::vector<MemoryTypeInfo>& memoryInfos,
+    const VkDeviceSize size, const VkBufferUsageFlags usage,
+    const MemoryLocation location)
+{
+    Buffer result;
+    result.size = size;
+
+    VkBufferCreateInfo bufferCreateInfo = {};
+    bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferCreateInfo.usage = usage;
+    bufferCreateInfo.size = size;
+
+    vkCreateBuffer(device, &bufferCreateInfo, nullptr, &result.buffer);
+
+    VkMemoryRequirements bufferRequirements;
+    vkGetBufferMemoryRequirements(device, result.buffer, &bufferRequirements);
+
+    const MemoryTypeInfo* memoryInfo = FindMemoryType(memoryInfos,
+        bufferRequirements.memoryTypeBits, location);
+    assert(memoryInfo);
+
+    VkMemoryAllocateInfo memoryAllocateInfo = {};
+    memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    memoryAllocateInfo.memoryTypeIndex = memoryInfo->index;
+    memoryAllocateInfo.allocationSize = bufferRequirements.size;
+
+    vkAllocateMemory(device, &memoryAllocateInfo, nullptr, &result.memory);
+    assert(result.memory);
+
+    result.hostVisible = memoryInfo->hostVisible;
+    result.hostCoherent = memoryInfo->hostCoherent;
+
+    vkBindBufferMemory(device, result.buffer, result.memory, 0);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void DestroyBuffer(VkDevice device, const Buffer& buffer)
+{
+    vkDestroyBuffer(device, buffer.buffer, nullptr);
+    vkFreeMemory(device, buffer.memory, nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool ReserveBuffer(VkDevice device, const std::vector<MemoryTypeInfo>& memoryInfos,
+    const VkDeviceSize size, const VkBufferUsageFlags usage, Buffer* buffer,
+    const MemoryLocation location)
+{
+    if (buffer->size >= size)
+    {
+        return false;
+    }
+
+    if (buffer->buffer)
+    {
+        DestroyBuffer(device, *buffer);
+    }
+
+    *buffer = CreateBuffer(device, memoryInfos, size, usage, location);
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Buffer ImportHostBuffer(VulkanContext& context, void* pointer,
+    const VkDeviceSize size, const VkBufferUsageFlags usage)
+{
+    const VkDeviceSize importAlignment =
+        context.GetCapabilities().minImportedHostPointerAlignment;
+    const auto& importTable = context.GetImportTable();
+
+    if (importAlignment == 0 || !importTable.vkGetMemoryHostPointerPropertiesEXT
+        || !pointer || size == 0)
+    {
+        return Buffer();
+    }
+
+    VkDevice device = context.GetDevice();
+
+    const uintptr_t address = reinterpret_cast<uintptr_t> (pointer);
+    const uintptr_t importBegin = address - address % importAlignment;
+    const uintptr_t importEnd = static_cast<uintptr_t> (
+        RoundToNextMultiple(address + size, importAlignment));
+    void* importPointer = reinterpret_cast<void*> (importBegin);
+
+    VkMemoryHostPointerPropertiesEXT hostPointerProperties = {};
+    hostPointerProperties.sType = VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT;
+
+    if (importTable.vkGetMemoryHostPointerPropertiesEXT(device,
+        VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT, importPointer,
+        &hostPointerProperties) != VK_SUCCESS)
+    {
+        return Buffer();
+    }
+
+    VkExternalMemoryBufferCreateInfoKHR externalMemoryBufferCreateInfo = {};
+    externalMemoryBufferCreateInfo.sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO_KHR;
+    externalMemoryBufferCreateInfo.handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT;
+
+    VkBufferCreateInfo bufferCreateInfo = {};
+    bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferCreateInfo.pNext = &externalMemoryBufferCreateInfo;
+    bufferCreateInfo.usage = usage;
+    bufferCreateInfo.size = size;
+
+    Buffer result;
+    result.size = size;
+
+    if (vkCreateBuffer(device, &bufferCreateInfo, nullptr, &result.buffer) != VK_SUCCESS)
+    {
+        return Buffer();
+    }
+
+    VkMemoryRequirements bufferRequirements;
+    vkGetBufferMemoryRequirements(device, result.buffer, &bufferRequirements);
+
+    // The host reads and writes through pointer, never through a mapping,
+    // so non-coherent memory could neither be flushed nor invalidated
+    const auto& memoryTypes = context.GetCapabilities().memoryTypes;
+    uint32_t coherentTypeBits = 0;
+
+    for (const auto& memoryType : memoryTypes)
+    {
+        if (memoryType.hostCoherent)
+        {
+            coherentTypeBits |= 1u << memoryType.index;
+        }
+    }
+
+    const VkDeviceSize bindOffset = address - importBegin;
+    const uint32_t memoryTypeBits = bufferRequirements.memoryTypeBits
+        & hostPointerProperties.memoryTypeBits & coherentTypeBits;
+    const MemoryTypeInfo* memoryInfo = memoryTypeBits ? FindMemoryType(
+        memoryTypes, memoryTypeBits, MemoryLocation::HostCached) : nullptr;
+
+    if (!memoryInfo || bindOffset % bufferRequirements.alignment != 0)
+    {
+        vkDestroyBuffer(device, result.buffer, nullptr);
+        return Buffer();
+    }
+
+    VkImportMemoryHostPointerInfoEXT importMemoryHostPointerInfo = {};
+    importMemoryHostPointerInfo.sType = VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT;
+    importMemoryHostPointerInfo.handleType = VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT;
+    importMemoryHostPointerInfo.pHostPointer = importPointer;
+
+    VkMemoryAllocateInfo memoryAllocateInfo = {};
+    memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    memoryAllocateInfo.pNext = &importMemoryHostPointerInfo;
+    memoryAllocateInfo.memoryTypeIndex = memoryInfo->index;
+    memoryAllocateInfo.allocationSize = importEnd - importBegin;
+
+    if (vkAllocateMemory(device, &memoryAllocateInfo, nullptr,
+        &result.memory) != VK_SUCCESS)
+    {
+        vkDestroyBuffer(device, result.buffer, nullptr);
+        return Buffer();
+    }
+
+    vkBindBufferMemory(device, result.buffer, result.memory, bindOffset);
+
+    result.hostVisible = false;
+    result.hostCoherent = true;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void* MapBuffer(VkDevice device, const Buffer& buffer)
+{
+    void* mapping = nullptr;
+    vkMapMemory(device, buffer.memory, 0, VK_WHOLE_SIZE, 0, &mapping);
+
+    if (! buffer.hostCoherent)
+    {
+        VkMappedMemoryRange memoryRange = {};
+        memoryRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        memoryRange.memory = buffer.memory;
+        memoryRange.offset = 0;
+        memoryRange.size = VK_WHOLE_SIZE;
+
+        vkInvalidateMappedMemoryRanges(device, 1, &memoryRange);
+    }
+
+    return mapping;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void* MapBufferRange(VkDevice device, const Buffer& buffer,
+    const VkDeviceSize offset, const VkDeviceSize size,
+    const VkDeviceSize nonCoherentAtomSize)
+{
+    const VkDeviceSize atomSize = std::max<VkDeviceSize>(nonCoherentAtomSize, 1);
+    const VkDeviceSize mapOffset = offset - offset % atomSize;
+    VkDeviceSize mapSize = RoundToNextMultiple(offset + size, atomSize) - mapOffset;
+
+    // Rounding up may go past the buffer, the rest of the allocation is
+    // only known to the driver
+    if (mapOffset + mapSize > buffer.size)
+    {
+        mapSize = VK_WHOLE_SIZE;
+    }
+
+    void* mapping = nullptr;
+    vkMapMemory(device, buffer.memory, mapOffset, mapSize, 0, &mapping);
+
+    if (! buffer.hostCoherent)
+    {
+        VkMappedMemoryRange memoryRange = {};
+        memoryRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        memoryRange.memory = buffer.memory;
+        memoryRange.offset = mapOffset;
+        memoryRange.size = mapSize;
+
+        vkInvalidateMappedMemoryRanges(device, 1, &memoryRange);
+    }
+
+    return static_cast<char*> (mapping) + (offset - mapOffset);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void UnmapBuffer(VkDevice device, const Buffer& buffer)
+{
+    if (! buffer.hostCoherent)
+    {
+        VkMappedMemoryRange memoryRange = {};
+        memoryRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        memoryRange.memory = buffer.memory;
+        memoryRange.offset = 0;
+        memoryRange.size = VK_WHOLE_SIZE;
+
+        vkFlushMappedMemoryRanges(device, 1, &memoryRange);
+    }
+
+    vkUnmapMemory(device, buffer.memory);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void DispatchFlat(VkCommandBuffer commandBuffer, const uint32_t groupCount)
+{
+    const uint32_t MaxGroupCount = 65535;
+
+    const uint32_t groupCountX = std::max(1u, std::min(groupCount, MaxGroupCount));
+    const uint32_t groupCountY = std::max(1u, (groupCount + groupCountX - 1) / groupCountX);
+
+    vkCmdDispatch(commandBuffer, groupCountX, groupCountY, 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+GpuTimer::GpuTimer(VulkanContext& context)
+    : device_(context.GetDevice())
+{
+    const auto& capabilities = context.GetCapabilities();
+
+    if (!Trace::IsEnabled() || capabilities.timestampValidBits == 0)
+    {
+        return;
+    }
+
+    VkQueryPoolCreateInfo queryPoolCreateInfo = {};
+    queryPoolCreateInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    queryPoolCreateInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    queryPoolCreateInfo.queryCount = 2;
+
+    vkCreateQueryPool(device_, &queryPoolCreateInfo, nullptr, &queryPool_);
+
+    timestampPeriod_ = capabilities.properties.limits.timestampPeriod;
+    timestampMask_ = capabilities.timestampValidBits >= 64
+        ? ~0ull : (1ull << capabilities.timestampValidBits) - 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+GpuTimer::~GpuTimer()
+{
+    if (queryPool_)
+    {
+        vkDestroyQueryPool(device_, queryPool_, nullptr);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void GpuTimer::Begin(VkCommandBuffer commandBuffer)
+{
+    if (queryPool_)
+    {
+        vkCmdResetQueryPool(commandBuffer, queryPool_, 0, 2);
+        vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+            queryPool_, 0);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void GpuTimer::End(VkCommandBuffer commandBuffer)
+{
+    if (queryPool_)
+    {
+        vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+            queryPool_, 1);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void GpuTimer::AddSpan(const char* name, const double submitTime)
+{
+    if (!queryPool_)
+    {
+        return;
+    }
+
+    uint64_t timestamps[2] = {};
+    vkGetQueryPoolResults(device_, queryPool_, 0, 2,
+        sizeof(timestamps), timestamps, sizeof(uint64_t),
+        VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+
+    // The bits above timestampValidBits are undefined, and the counter may
+    // wrap around between the two timestamps
+    const uint64_t ticks = ((timestamps[1] & timestampMask_)
+        - (timestamps[0] & timestampMask_)) & timestampMask_;
+
+    // timestampPeriod is in nanoseconds per tick. There is no common clock
+    // between host and device, so the span is anchored at the time of the
+    // submission; its duration is exact, its start is a lower bound
+    Trace::AddGpuSpan(name, submitTime,
+        static_cast<double> (ticks) * timestampPeriod_ / 1000.0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+CommandSubmitter::CommandSubmitter(VulkanContext& context, const char* name)
+    : context_(context)
+    , device_(context.GetDevice())
+    , name_(name)
+    , timer_(context)
+{
+    VkCommandPoolCreateInfo commandPoolCreateInfo = {};
+    commandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    commandPoolCreateInfo.queueFamilyIndex = context_.GetQueueFamilyIndex();
+    commandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+
+    vkCreateCommandPool(device_, &commandPoolCreateInfo, nullptr,
+        &commandPool_);
+
+    VkCommandBufferAllocateInfo commandBufferAllocateInfo = {};
+    commandBufferAllocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    commandBufferAllocateInfo.commandBufferCount = 1;
+    commandBufferAllocateInfo.commandPool = commandPool_;
+    commandBufferAllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+
+    vkAllocateCommandBuffers(device_, &commandBufferAllocateInfo,
+        &commandBuffer_);
+
+    VkFenceCreateInfo fenceCreateInfo = {};
+    fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+    vkCreateFence(device_, &fenceCreateInfo, nullptr, &fence_);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+CommandSubmitter::~CommandSubmitter()
+{
+    vkDestroyFence(device_, fence_, nullptr);
+    vkDestroyCommandPool(device_, commandPool_, nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+VkCommandBuffer CommandSubmitter::Begin()
+{
+    VkCommandBufferBeginInfo commandBufferBeginInfo = {};
+    commandBufferBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkBeginCommandBuffer(commandBuffer_, &commandBufferBeginInfo);
+
+    timer_.Begin(commandBuffer_);
+
+    return commandBuffer_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void CommandSubmitter::SubmitAndWait()
+{
+    timer_.End(commandBuffer_);
+
+    VkMemoryBarrier memoryBarrier = {};
+    memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    memoryBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    memoryBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    vkCmdPipelineBarrier(commandBuffer_, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_PIPELINE_STAGE_HOST_BIT, 0,
+        1, &memoryBarrier, 0, nullptr, 0, nullptr);
+    vkEndCommandBuffer(commandBuffer_);
+
+    double submitTime = 0;
+
+    {
+        AMD_TRACE_SCOPE("Submit");
+
+        VkSubmitInfo submitInfo = {};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &commandBuffer_;
+
+        if (Trace::IsEnabled())
+        {
+            submitTime = Trace::Now();
+        }
+
+        context_.Submit(submitInfo, fence_);
+    }
+
+    {
+        AMD_TRACE_SCOPE("Wait");
+        vkWaitForFences(device_, 1, &fence_, VK_TRUE, UINT64_MAX);
+        vkResetFences(device_, 1, &fence_);
+    }
+
+    timer_.AddSpan(name_, submitTime);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+VkDescriptorSet CreateStorageBufferDescriptorSet(VkDevice device,
+    VkDescriptorSetLayout layout, const Buffer* buffers,
+    const int storageBufferCount, VkDescriptorPool* outputPool)
+{
+    VkDescriptorPoolSize descriptorPoolSize = {};
+    descriptorPoolSize.descriptorCount = static_cast<uint32_t> (storageBufferCount);
+    descriptorPoolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+
+    VkDescriptorPoolCreateInfo descriptorPoolCreateInfo = {};
+    descriptorPoolCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    descriptorPoolCreateInfo.maxSets = 1;
+    descriptorPoolCreateInfo.poolSizeCount = 1;
+    descriptorPoolCreateInfo.pPoolSizes = &descriptorPoolSize;
+
+    vkCreateDescriptorPool(device, &descriptorPoolCreateInfo,
+        nullptr, outputPool);
+
+    VkDescriptorSetAllocateInfo descriptorSetAllocateInfo = {};
+    descriptorSetAllocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    descriptorSetAllocateInfo.pSetLayouts = &layout;
+    descriptorSetAllocateInfo.descriptorSetCount = 1;
+    descriptorSetAllocateInfo.descriptorPool = *outputPool;
+
+    VkDescriptorSet descriptorSet;
+    vkAllocateDescriptorSets(device, &descriptorSetAllocateInfo, &descriptorSet);
+
+    std::vector<VkDescriptorBufferInfo> descriptorBufferInfos(storageBufferCount);
+    std::vector<VkWriteDescriptorSet> writeDescriptorSets(storageBufferCount);
+
+    for (int i = 0; i < storageBufferCount; ++i)
+    {
+        descriptorBufferInfos[i].buffer = buffers[i].buffer;
+        descriptorBufferInfos[i].offset = 0;
+        descriptorBufferInfos[i].range = buffers[i].size;
+
+        writeDescriptorSets[i] = {};
+        writeDescriptorSets[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writeDescriptorSets[i].dstSet = descriptorSet;
+        writeDescriptorSets[i].descriptorCount = 1;
+        writeDescriptorSets[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        writeDescriptorSets[i].dstBinding = i;
+        writeDescriptorSets[i].pBufferInfo = &descriptorBufferInfos[i];
+    }
+
+    vkUpdateDescriptorSets(device, static_cast<uint32_t> (storageBufferCount),
+        writeDescriptorSets.data(), 0, nullptr);
+
+    return descriptorSet;
+}
+}   // namespace AMD
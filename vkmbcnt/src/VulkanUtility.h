@@ -0,0 +1,219 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef AMD_VULKAN_SAMPLE_VULKAN_UTILITY_H_
+#define AMD_VULKAN_SAMPLE_VULKAN_UTILITY_H_
+
+#include "VulkanContext.h"
+
+#include <vector>
+
+namespace AMD
+{
+///////////////////////////////////////////////////////////////////////////////
+// Allocates from the first HOST_VISIBLE memory type
+VkDeviceMemory AllocateMemory(const std::vector<MemoryTypeInfo>& memoryInfos,
+    VkDevice device, const VkDeviceSize size, bool* isHostCoherent = nullptr);
+
+VkShaderModule LoadShader(VkDevice device, const void* shaderContents,
+    const size_t size);
+
+///////////////////////////////////////////////////////////////////////////////
+// A compute pipeline whose only set contains storage buffers at bindings
+// 0 .. storageBufferCount-1, plus an optional push constant block.
+// descriptorSetLayoutFlags is passed on to the set layout, for instance to
+// use push descriptors. specializationInfo may be null
+struct ComputePipeline
+{
+    VkShaderModule shaderModule = VK_NULL_HANDLE;
+    VkDescriptorSetLayout descriptorSetLayout = VK_NULL_HANDLE;
+    VkPipelineLayout pipelineLayout = VK_NULL_HANDLE;
+    VkPipeline pipeline = VK_NULL_HANDLE;
+};
+
+ComputePipeline CreateComputePipeline(VkDevice device,
+    VkPipelineCache pipelineCache, const void* shaderContents,
+    const size_t shaderSize, const int storageBufferCount,
+    const uint32_t pushConstantSize = 0,
+    const VkDescriptorSetLayoutCreateFlags descriptorSetLayoutFlags = 0,
+    const VkSpecializationInfo* specializationInfo = nullptr);
+void DestroyComputePipeline(VkDevice device, const ComputePipeline& pipeline);
+
+///////////////////////////////////////////////////////////////////////////////
+// Which memory type CreateBuffer allocates from
+enum class MemoryLocation
+{
+    // The first HOST_VISIBLE type, like AllocateMemory. On discrete GPUs
+    // this is often device memory behind the BAR, which the host can only
+    // read uncached
+    HostVisible,
+
+    // The first DEVICE_LOCAL type. May not be mappable, so the host has to
+    // go through a staging buffer
+    DeviceLocal,
+
+    // The first HOST_VISIBLE and HOST_CACHED type, for reading back. Falls
+    // back to HostVisible
+    HostCached
+};
+
+// First type allowed by memoryTypeBits which matches location. If there is
+// none, the first allowed HOST_VISIBLE one, and finally any allowed type.
+// Returns null if memoryTypeBits allows none of memoryInfos
+const MemoryTypeInfo* FindMemoryType(const std::vector<MemoryTypeInfo>& memoryInfos,
+    const uint32_t memoryTypeBits, const MemoryLocation location);
+
+///////////////////////////////////////////////////////////////////////////////
+// A buffer with its own allocation
+struct Buffer
+{
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkDeviceSize size = 0;
+    bool hostVisible = false;
+    bool hostCoherent = false;
+};
+
+Buffer CreateBuffer(VkDevice device, const std::vector<MemoryTypeInfo>& memoryInfos,
+    const VkDeviceSize size, const VkBufferUsageFlags usage,
+    const MemoryLocation location = MemoryLocation::HostVisible);
+void DestroyBuffer(VkDevice device, const Buffer& buffer);
+
+// Recreates buffer if it is smaller than size, dropping its contents.
+// Returns true if it was recreated, so descriptors pointing at it have to
+// be written again
+bool ReserveBuffer(VkDevice device, const std::vector<MemoryTypeInfo>& memoryInfos,
+    const VkDeviceSize size, const VkBufferUsageFlags usage, Buffer* buffer,
+    const MemoryLocation location = MemoryLocation::HostVisible);
+
+// Wraps size bytes of host memory at pointer into a buffer without copying
+// them, using VK_EXT_external_memory_host. The whole pages around the range
+// are imported and the buffer is bound at pointer, so pointer only has to
+// meet the buffer's own alignment (usually 4 or 16 bytes). Only coherent
+// memory types are used, as the host accesses the memory through pointer.
+// The memory must stay allocated until the buffer is destroyed. Returns an
+// empty Buffer if the extension isn't enabled or the range can't be
+// imported into a coherent type
+Buffer ImportHostBuffer(VulkanContext& context, void* pointer,
+    const VkDeviceSize size, const VkBufferUsageFlags usage);
+
+// Maps the whole buffer. Invalidates it first if it isn't coherent, so
+// writes from the device are visible
+void* MapBuffer(VkDevice device, const Buffer& buffer);
+
+// Maps and invalidates only the size bytes at offset, widened to whole
+// nonCoherentAtomSize blocks as Vulkan requires. Returns a pointer to
+// offset. Unmap with vkUnmapMemory
+void* MapBufferRange(VkDevice device, const Buffer& buffer,
+    const VkDeviceSize offset, const VkDeviceSize size,
+    const VkDeviceSize nonCoherentAtomSize);
+
+// Unmaps the buffer. Flushes it first if it isn't coherent, so writes from
+// the host are visible to the device
+void UnmapBuffer(VkDevice device, const Buffer& buffer);
+
+///////////////////////////////////////////////////////////////////////////////
+// Dispatches groupCount work groups, spread over y once there are more than
+// the 65535 every implementation supports in x. Shaders get the flat group
+// index as gl_WorkGroupID.y * gl_NumWorkGroups.x + gl_WorkGroupID.x and
+// have to skip the groups past the end
+void DispatchFlat(VkCommandBuffer commandBuffer, const uint32_t groupCount);
+
+///////////////////////////////////////////////////////////////////////////////
+// Two timestamp queries around the commands of one submission, which end up
+// as a span on the GPU track of the trace. Does nothing unless tracing is
+// enabled and the queue family supports timestamps
+class GpuTimer
+{
+public:
+    explicit GpuTimer(VulkanContext& context);
+    ~GpuTimer();
+
+    GpuTimer(const GpuTimer&) = delete;
+    GpuTimer& operator= (const GpuTimer&) = delete;
+
+    // Resets the queries and writes the first timestamp
+    void Begin(VkCommandBuffer commandBuffer);
+
+    // Writes the second timestamp once all previous commands are done
+    void End(VkCommandBuffer commandBuffer);
+
+    // Call once the submission has completed. name must outlive the tracer,
+    // submitTime is the time of the submission on the trace timeline
+    void AddSpan(const char* name, const double submitTime);
+
+private:
+    VkDevice device_ = VK_NULL_HANDLE;
+    VkQueryPool queryPool_ = VK_NULL_HANDLE;
+    float timestampPeriod_ = 0;
+
+    // Only the low timestampValidBits bits of a timestamp are meaningful
+    uint64_t timestampMask_ = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// One command buffer with its own pool and a fence, for classes which
+// record some work, submit it to the context's queue and wait for it.
+// Every submission shows up as a span called name in the trace
+class CommandSubmitter
+{
+public:
+    CommandSubmitter(VulkanContext& context, const char* name);
+    ~CommandSubmitter();
+
+    CommandSubmitter(const CommandSubmitter&) = delete;
+    CommandSubmitter& operator= (const CommandSubmitter&) = delete;
+
+    // Begins recording a one time submit, the previous one must be finished
+    VkCommandBuffer Begin();
+
+    VkCommandBuffer GetCommandBuffer() const
+    {
+        return commandBuffer_;
+    }
+
+    // Makes shader writes visible to the host, ends the command buffer,
+    // submits it and waits until it has executed
+    void SubmitAndWait();
+
+private:
+    VulkanContext& context_;
+    VkDevice device_ = VK_NULL_HANDLE;
+    const char* name_ = nullptr;
+
+    VkCommandPool commandPool_ = VK_NULL_HANDLE;
+    VkCommandBuffer commandBuffer_ = VK_NULL_HANDLE;
+    VkFence fence_ = VK_NULL_HANDLE;
+
+    GpuTimer timer_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Creates a pool for a single set of storageBufferCount storage buffers,
+// allocates the set from it and points binding i at buffers [i]
+VkDescriptorSet CreateStorageBufferDescriptorSet(VkDevice device,
+    VkDescriptorSetLayout layout, const Buffer* buffers,
+    const int storageBufferCount, VkDescriptorPool* outputPool);
+}   // namespace AMD
+
+#endif
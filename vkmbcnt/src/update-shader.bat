@@ -1,4 +1,46 @@
 del cs.spv
+del bitmap.spv
+del compact.spv
+del inplace.spv
+del formats.spv
+del topk-histogram.spv
+del topk-select.spv
+del bfs-expand.spv
+del bfs-advance.spv
+del cull.spv
+del extract2d.spv
+del text-classify.spv
+del text-scan.spv
+del csr-compact.spv
+del csr-scan.spv
 glslangValidator.exe cs.comp -V -o cs.spv
+glslangValidator.exe bitmap.comp -V -o bitmap.spv
+glslangValidator.exe compact.comp -V -o compact.spv
+glslangValidator.exe inplace.comp -V -o inplace.spv
+glslangValidator.exe formats.comp -V -o formats.spv
+glslangValidator.exe topk-histogram.comp -V -o topk-histogram.spv
+glslangValidator.exe topk-select.comp -V -o topk-select.spv
+glslangValidator.exe bfs-expand.comp -V -o bfs-expand.spv
+glslangValidator.exe bfs-advance.comp -V -o bfs-advance.spv
+glslangValidator.exe cull.comp -V -o cull.spv
+glslangValidator.exe extract2d.comp -V -o extract2d.spv
+glslangValidator.exe text-classify.comp -V -o text-classify.spv
+glslangValidator.exe text-scan.comp -V -o text-scan.spv
+glslangValidator.exe csr-compact.comp -V -o csr-compact.spv
+glslangValidator.exe csr-scan.comp -V -o csr-scan.spv
 del Shaders.h
 ..\tools\binaryToHeader.py cs.spv BasicComputeShader > Shaders.h
+..\tools\binaryToHeader.py bitmap.spv BallotBitmapShader >> Shaders.h
+..\tools\binaryToHeader.py compact.spv CompactShader >> Shaders.h
+..\tools\binaryToHeader.py inplace.spv InPlaceCompactShader >> Shaders.h
+..\tools\binaryToHeader.py formats.spv PackedCompactShader >> Shaders.h
+..\tools\binaryToHeader.py topk-histogram.spv TopKHistogramShader >> Shaders.h
+..\tools\binaryToHeader.py topk-select.spv TopKSelectShader >> Shaders.h
+..\tools\binaryToHeader.py bfs-expand.spv BfsExpandShader >> Shaders.h
+..\tools\binaryToHeader.py bfs-advance.spv BfsAdvanceShader >> Shaders.h
+..\tools\binaryToHeader.py cull.spv CullShader >> Shaders.h
+..\tools\binaryToHeader.py extract2d.spv Extract2DShader >> Shaders.h
+..\tools\binaryToHeader.py text-classify.spv TextClassifyShader >> Shaders.h
+..\tools\binaryToHeader.py text-scan.spv TextScanShader >> Shaders.h
+..\tools\binaryToHeader.py csr-compact.spv CsrCompactShader >> Shaders.h
+..\tools\binaryToHeader.py csr-scan.spv CsrScanShader >> Shaders.h